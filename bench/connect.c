@@ -0,0 +1,134 @@
+// Time the construction of a hypercube whose connector declares a
+// configurable number of parallel edges per dimension, and report the
+// average time per edge spent in cru_connect alone and in the build
+// as a whole. Usage:
+//
+//   bench_connect [dimension [fan-out [lanes [trials]]]]
+//
+// The defaults are 16, 8, 0 (one lane per core), and 5. The best of
+// all trials is reported for each. With more than one lane, the time
+// in cru_connect is the sum over all workers.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <cru.h>
+
+#define DEFAULT_DIMENSION 16
+#define DEFAULT_FAN_OUT 8
+#define DEFAULT_LANES 0
+#define DEFAULT_TRIALS 5
+
+// nanoseconds per second
+#define BILLION 1000000000
+
+// the number of dimensions of the hypercube being built
+static uintptr_t dimension = DEFAULT_DIMENSION;
+
+// the number of edges declared along each dimensional axis
+static uintptr_t fan_out = DEFAULT_FAN_OUT;
+
+// total nanoseconds spent by all workers in calls to cru_connect
+static uintptr_t connecting = 0;
+
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare fan_out outgoing edges from the given vertex along
+	  // each dimensional axis, labeled consecutively from zero, and
+	  // add the time taken to the total.
+{
+  struct timespec start, finish;
+  uintptr_t axis, copy;
+
+  clock_gettime (CLOCK_MONOTONIC, &start);
+  for (axis = 0; axis < dimension; axis++)
+	 for (copy = 0; copy < fan_out; copy++)
+		cru_connect ((cru_edge) (axis * fan_out + copy), (cru_vertex) (given_vertex ^ (((uintptr_t) 1) << axis)), err);
+  clock_gettime (CLOCK_MONOTONIC, &finish);
+  __atomic_fetch_add (&connecting, (uintptr_t) ((finish.tv_sec - start.tv_sec) * BILLION + (finish.tv_nsec - start.tv_nsec)), __ATOMIC_RELAXED);
+}
+
+
+
+
+
+
+double
+elapsed (lanes, err)
+	  unsigned lanes;
+	  int *err;
+
+	  // Return the number of seconds taken to build and free one
+	  // hypercube, and leave the part of it spent connecting in
+	  // connecting.
+{
+  struct timespec start, finish;
+  cru_graph g;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule};
+
+  connecting = 0;
+  clock_gettime (CLOCK_MONOTONIC, &start);
+  g = cru_built (&b, 0, UNKILLABLE, lanes, err);
+  clock_gettime (CLOCK_MONOTONIC, &finish);
+  cru_free_now (g, lanes, err);
+  return ((double) (finish.tv_sec - start.tv_sec)) + ((double) (finish.tv_nsec - start.tv_nsec)) / (double) BILLION;
+}
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  unsigned lanes, trials;
+  double best, t, c;
+  uintptr_t edges;
+  int err;
+
+  err = 0;
+  lanes = DEFAULT_LANES;
+  trials = DEFAULT_TRIALS;
+  if (argc > 1)
+	 dimension = strtoull (argv[1], NULL, 0);
+  if (argc > 2)
+	 fan_out = strtoull (argv[2], NULL, 0);
+  if (argc > 3)
+	 lanes = (unsigned) strtoul (argv[3], NULL, 0);
+  if (argc > 4)
+	 trials = (unsigned) strtoul (argv[4], NULL, 0);
+  if ((! dimension) ? 1 : (dimension > 24) ? 1 : (! fan_out) ? 1 : ! trials)
+	 {
+		fprintf (stderr, "usage: %s [dimension (1-24) [fan-out [lanes [trials]]]]\n", argv[0]);
+		exit (EXIT_FAILURE);
+	 }
+  edges = (((uintptr_t) 1) << dimension) * dimension * fan_out;
+  for (best = c = -1.0; trials--;)
+	 if ((t = elapsed (lanes, &err)), err)
+		break;
+	 else
+		{
+		  best = (((best < 0.0) ? 1 : (t < best)) ? t : best);
+		  c = (((c < 0.0) ? 1 : ((double) connecting < c)) ? (double) connecting : c);
+		}
+  if (err)
+	 printf ("%s failed\n%s\n", argv[0], cru_strerror (err));
+  else
+	 printf ("%lu edges in %.3f s, %.1f ns per edge overall, %.1f ns per edge in cru_connect\n",
+				edges, best, best * (double) BILLION / (double) edges, c / (double) edges);
+  exit (err ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -0,0 +1,121 @@
+// Time the construction of a circulant graph in which every vertex has
+// the same large number of outgoing edges all with the same label, so
+// that deduplicating the edges of each vertex by their termini
+// dominates the build time. Usage:
+//
+//   bench_dedup [vertices [degree [lanes [trials]]]]
+//
+// The defaults are 2048, 1000, 0 (one lane per core), and 3. The best
+// of all trials is reported.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <cru.h>
+
+#define DEFAULT_VERTICES 2048
+#define DEFAULT_DEGREE 1000
+#define DEFAULT_LANES 0
+#define DEFAULT_TRIALS 3
+
+// nanoseconds per second
+#define BILLION 1000000000.0
+
+// the label on every edge
+#define TAU 0
+
+// the number of vertices in the graph
+static uintptr_t vertices = DEFAULT_VERTICES;
+
+// the number of outgoing edges from each vertex
+static uintptr_t degree = DEFAULT_DEGREE;
+
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare an outgoing edge labeled TAU from the given vertex to
+	  // each of the next degree vertices modulo the number of
+	  // vertices.
+{
+  uintptr_t offset;
+
+  for (offset = 1; offset <= degree; offset++)
+	 cru_connect ((cru_edge) TAU, (cru_vertex) ((given_vertex + offset) % vertices), err);
+}
+
+
+
+
+
+
+double
+elapsed (lanes, err)
+	  unsigned lanes;
+	  int *err;
+
+	  // Return the number of seconds taken to build one graph.
+{
+  struct timespec start, finish;
+  cru_graph g;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule};
+
+  clock_gettime (CLOCK_MONOTONIC, &start);
+  g = cru_built (&b, 0, UNKILLABLE, lanes, err);
+  clock_gettime (CLOCK_MONOTONIC, &finish);
+  cru_free_now (g, lanes, err);
+  return ((double) (finish.tv_sec - start.tv_sec)) + ((double) (finish.tv_nsec - start.tv_nsec)) / BILLION;
+}
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  unsigned lanes, trials;
+  double best, t;
+  uintptr_t edges;
+  int err;
+
+  err = 0;
+  lanes = DEFAULT_LANES;
+  trials = DEFAULT_TRIALS;
+  if (argc > 1)
+	 vertices = strtoull (argv[1], NULL, 0);
+  if (argc > 2)
+	 degree = strtoull (argv[2], NULL, 0);
+  if (argc > 3)
+	 lanes = (unsigned) strtoul (argv[3], NULL, 0);
+  if (argc > 4)
+	 trials = (unsigned) strtoul (argv[4], NULL, 0);
+  if ((! vertices) ? 1 : (! degree) ? 1 : (degree >= vertices) ? 1 : ! trials)
+	 {
+		fprintf (stderr, "usage: %s [vertices [degree (less than vertices) [lanes [trials]]]]\n", argv[0]);
+		exit (EXIT_FAILURE);
+	 }
+  edges = vertices * degree;
+  for (best = -1.0; trials--;)
+	 if ((t = elapsed (lanes, &err)), err)
+		break;
+	 else
+		best = (((best < 0.0) ? 1 : (t < best)) ? t : best);
+  if (err)
+	 printf ("%s failed\n%s\n", argv[0], cru_strerror (err));
+  else
+	 printf ("%lu edges in %.3f s, %.1f ns per edge\n", edges, best, best * BILLION / (double) edges);
+  exit (err ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -2,6 +2,7 @@
 #ifndef CRU_H
 #define CRU_H 1
 
+#include <stddef.h>
 #include <stdint.h>
 #include "error_codes.h"
 #include "function_types.h"
@@ -23,6 +24,11 @@
 // passed to cru_fabricated requests a shallow copy of a graph
 #define COPYING_FABRICATOR ((cru_fabricator) NULL)
 
+// valid values for the format field of a cru_exporter
+#define DOT_FORMAT ((int) 0)
+#define GRAPHML_FORMAT ((int) 1)
+#define CSV_FORMAT ((int) 2)
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -38,6 +44,10 @@ cru_new_kill_switch (int *err);
 extern cru_graph
 cru_built (cru_builder b, cru_vertex v, cru_kill_switch k, unsigned lanes, int *err);
 
+// return the graph specified by the builder with a base vertex whose outgoing edges are given
+extern cru_graph
+cru_built_from (cru_builder b, cru_vertex v, const cru_edge *labels, const cru_vertex *termini, size_t n, cru_kill_switch k, unsigned lanes, int *err);
+
 // form a product of two graphs
 extern cru_graph
 cru_crossed (cru_graph g, cru_graph h, cru_crosser c, cru_kill_switch k, unsigned lanes, int *err);
@@ -56,6 +66,10 @@ cru_kill (cru_kill_switch k, int *err);
 extern void
 cru_connect (cru_edge label, cru_vertex terminus, int *err);
 
+// called by a connector function in a builder, assert n connections from its argument to the termini
+extern void
+cru_connect_many (const cru_edge *labels, const cru_vertex *termini, size_t n, int *err);
+
 // called by an expander function in an stretcher, put a new vertex in series with two new edges
 extern void
 cru_stretch (cru_edge label_in, cru_vertex new_vertex, cru_edge label_out, int *err);
@@ -160,6 +174,28 @@ cru_postponed (cru_graph g, cru_postponer p, cru_kill_switch k, unsigned lanes,
 extern cru_graph
 cru_composed (cru_graph g, cru_composer c, cru_kill_switch k, unsigned lanes, int *err);
 
+// consume and return a graph like g with its nodes and edges repacked into contiguous storage
+extern cru_graph
+cru_frozen (cru_graph g, int *err);
+
+// --------------- persistence -----------------------------------------------------------------------------
+
+// write a graph to a file descriptor and return the number of bytes written
+extern uintptr_t
+cru_saved (cru_graph g, int fd, cru_codec_pair c, unsigned lanes, int *err);
+
+// read a graph previously written by cru_saved from a file descriptor
+extern cru_graph
+cru_loaded (int fd, cru_sig s, cru_codec_pair c, unsigned lanes, int *err);
+
+// concurrently build a graph from an edge list read from a file descriptor starting at the base v
+extern cru_graph
+cru_imported (int fd, cru_importer i, cru_vertex v, unsigned lanes, int *err);
+
+// concurrently write a graph to a file descriptor as text and return the number of bytes written
+extern uintptr_t
+cru_exported (cru_graph g, int fd, cru_exporter x, unsigned lanes, int *err);
+
 // --------------- reclamation -----------------------------------------------------------------------------
 
 // free a partition
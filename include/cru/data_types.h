@@ -64,6 +64,14 @@ typedef struct cru_destructor_pair_s
   cru_destructor e_free;                     // used to reclaim edge labels
 } *cru_destructor_pair;
 
+// a specification to tell cru how to write vertices or edge labels to a file and read them back
+
+typedef struct cru_codec_s
+{
+  cru_encoder encoder;                       // writes the bytes representing an item into a buffer and returns how many
+  cru_decoder decoder;                       // creates an item from the bytes written by the encoder
+} *cru_codec;
+
 // a specification for computing something about a set of vertices or edges in a graph
 
 typedef struct cru_fold_s
@@ -85,6 +93,25 @@ typedef struct cru_zone_s
   int backwards;                             // non-zero directs the walk toward incident edges instead of outgoing edges
 } *cru_zone;
 
+// the accumulated time in nanoseconds spent by idle workers in each waiting state
+
+typedef struct cru_idling_s
+{
+  uintptr_t spinning;                        // busy waiting with processor pause instructions
+  uintptr_t yielding;                        // yielding the processor to other threads
+  uintptr_t parked;                          // blocked until signaled by another worker or timed out
+} *cru_idling;
+
+// a specification of how workers wait for unvisited prerequisites during an ordered traversal
+
+typedef struct cru_idler_s
+{
+  unsigned spins;                            // number of busy waiting rounds before yielding, or a default if zero
+  unsigned yields;                           // number of yielding rounds before parking, or a default if zero
+  unsigned park_limit;                       // maximum microseconds parked per round, or a default if zero
+  cru_idling idled;                          // if non-null, the time spent in each state is added to it
+} *cru_idler;
+
 // --------------- derived structures ----------------------------------------------------------------------
 
 // a pair of orders for the vertices and the edges in a graph
@@ -95,6 +122,14 @@ typedef struct cru_order_pair_s
   struct cru_order_s e_order;                // for sorting edges and detecting edge label collisions
 } *cru_order_pair;
 
+// a pair of codecs for the vertices and the edges in a graph
+
+typedef struct cru_codec_pair_s
+{
+  struct cru_codec_s v_codec;                // for saving and loading vertices
+  struct cru_codec_s e_codec;                // for saving and loading edge labels
+} *cru_codec_pair;
+
 // a specification for operating on a vertex and allowed to depend on its adjacent edges
 
 typedef struct cru_prop_s
@@ -119,6 +154,7 @@ typedef struct cru_plan_s
   int local_first;                           // non-zero constrains the traversal to visit nodes in top down order
   int remote_first;                          // non-zero constrains the traversal to visit nodes in bottom up order
   struct cru_zone_s zone;
+  struct cru_idler_s idler;                  // how workers wait for prerequisites if either order is constrained
 } *cru_plan;
 
 // guard conditions on outgoing edges from the initial and intermediate vertex in an edge composition operation
@@ -152,6 +188,7 @@ typedef struct cru_sig_s
   uintptr_t vertex_limit;                    // kill a build or expansion if the number of vertices exceeds this number
   struct cru_order_pair_s orders;            // for organizing efficient temporary storage during graph traversal
   struct cru_destructor_pair_s destructors;  // for unmaking the graph
+  int arena;                                 // non-zero to allocate nodes and edges in bulk when building the graph
 } *cru_sig;
 
 // --------------- top level structures for building -------------------------------------------------------
@@ -164,6 +201,13 @@ typedef struct cru_builder_s
   cru_connector connector;                   // calls cru_connect unconditionally for every outgoing edge from a given vertex
   cru_subconnector subconnector;             // calls cru_connect for each of a subset of edges determined by an incident edge
   struct cru_sig_s bu_sig;                   // summary of graph vertex and edge properties
+  cru_partitioner partitioner;               // optionally assigns vertices to workers by their hashes
+  cru_discoverer discoverer;                 // optionally called on each vertex as soon as it's added to the graph
+  cru_upred stopper;                         // optionally stops the build when true of a vertex added to the graph
+  uintptr_t depth_limit;                     // if non-zero, the maximum distance of any vertex from the initial vertex
+  int partial;                               // non-zero to return a partial graph rather than an error at the vertex limit or when killed
+  cru_uop priority;                          // optionally ranks vertices so that each worker builds lower values first
+  cru_uop canonical;                         // optionally maps each vertex to a representative of its symmetry class
 } *cru_builder;
 
 // a specification for combining two graphs into their product
@@ -184,6 +228,16 @@ typedef struct cru_fabricator_s
   struct cru_sig_s fa_sig;                   // describes the fabricated graph
 } *cru_fabricator;
 
+// a specification for building a graph from an edge list in a file
+
+typedef struct cru_importer_s
+{
+  int binary;                                // non-zero if the edges are 64 bit words rather than lines of text
+  int labeled;                               // non-zero if each edge has a label following its terminus
+  uintptr_t *strays;                         // if non-NULL, unreachable vertices are dropped and their number stored here
+  struct cru_order_pair_s im_orders;         // optionally for hashing and comparing the vertices and edge labels
+} *cru_importer;
+
 // --------------- top level structures for analysis -------------------------------------------------------
 
 // a specification for computing something about a graph
@@ -203,6 +257,15 @@ typedef struct cru_inducer_s
   struct cru_fold_s in_fold;                 // encapsulates the work to be done at each vertex
 } *cru_inducer;
 
+// a specification for writing a graph to a file in a format readable by other tools
+
+typedef struct cru_exporter_s
+{
+  int format;                                // one of DOT_FORMAT, GRAPHML_FORMAT, or CSV_FORMAT
+  cru_encoder v_format;                      // writes the text representing a vertex into a buffer and returns its length
+  cru_encoder e_format;                      // the same for an edge label
+} *cru_exporter;
+
 // --------------- top level structures for classification -------------------------------------------------
 
 // a specification for defining equivalence classes over a graph's vertices
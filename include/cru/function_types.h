@@ -1,6 +1,7 @@
 #ifndef CRU_FUNCTION_TYPES_H
 #define CRU_FUNCTION_TYPES_H 1
 
+#include <stddef.h>
 #include <stdint.h>
 
 // This file defines prototypes for user-defined callback functions
@@ -24,6 +25,10 @@ typedef void (*cru_destructor)(void *, int *);
 typedef void (*cru_connector)(void *, int *);
 typedef void (*cru_subconnector)(int, void *, void *, int *);
 typedef int (*cru_pruner)(int, void *, int *);
+typedef unsigned (*cru_partitioner)(uintptr_t, unsigned, int *);
+typedef void (*cru_discoverer)(void *, int *);
+typedef size_t (*cru_encoder)(void *, void *, size_t, int *);
+typedef void *(*cru_decoder)(const void *, size_t, int *);
 
 // --------------- nullary through quarternary operators ---------------------------------------------------
 
@@ -37,10 +42,11 @@ typedef void *(*cru_bop)(void *, void *, int *);
 typedef void *(*cru_top)(void *, void *, void *, int *);
 typedef void *(*cru_qop)(void *, void *, void *, void *, int *);
 
-// --------------- binary through quarternary predicates ---------------------------------------------------
+// --------------- unary through quarternary predicates ----------------------------------------------------
 
 // Predicates return zero for false and any non-zero value for true.
 
+typedef int (*cru_upred)(void *, int *);
 typedef int (*cru_bpred)(void *, void *, int *);
 typedef int (*cru_tpred)(void *, void *, void *, int *);
 typedef int (*cru_qpred)(void *, void *, void *, void *, int *);
@@ -0,0 +1,430 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include "arena.h"
+#include "errs.h"
+#include "getset.h"
+#include "wrap.h"
+
+// the number of bytes in each slab including the header, kept small
+// enough for the heap tracker in memory testing builds
+#ifdef WRAP
+#define SLAB_SIZE (size_t) 0x400
+#else
+#define SLAB_SIZE (size_t) 0x40000
+#endif
+
+// the number of bytes in each slab available for allocation
+#define SLAB_ROOM (SLAB_SIZE - sizeof (struct slab_s))
+
+// reclaim a slab, whose size isn't implied by its type
+#ifdef WRAP
+#define FREE_SLAB(s) _cru_free_wrapper (__LINE__, __FILE__, SLAB_SIZE, s)
+#else
+#define FREE_SLAB(s) free (s)
+#endif
+
+// round up a requested size to keep pointers aligned
+#define ALIGNED(n) (((n) + sizeof (void *) - 1) & ~(sizeof (void *) - 1))
+
+// pseudo-random heap priority of a slab in the registry
+#define PRIORITY(s) (((uintptr_t) (s) * (uintptr_t) 0x9e3779b97f4a7c15) >> 0x10)
+
+// root of a treap of all slabs in use by any graph or worker, ordered by address
+static slab registry = NULL;
+
+// the number of registered slabs, which is also read without locking
+static uintptr_t registered = 0;
+
+// for exclusive access to the registry
+static pthread_rwlock_t arena_lock;
+
+
+
+
+// --------------- initialization and teardown -------------------------------------------------------------
+
+
+
+
+int
+_cru_open_arena (err)
+	  int *err;
+
+	  // Initialize pthread resources.
+{
+  return ! (pthread_rwlock_init (&arena_lock, NULL) ? IER(560) : 0);
+}
+
+
+
+
+
+
+void
+_cru_close_arena (void)
+
+	  // Do this when the process exits. Slabs belonging to graphs the
+	  // application never freed are its own responsibility.
+{
+  registry = NULL;
+  registered = 0;
+  if (pthread_rwlock_destroy (&arena_lock))
+	 _cru_globally_throw (THE_IER(561));
+}
+
+
+
+
+
+// --------------- registry --------------------------------------------------------------------------------
+
+
+
+
+
+static void
+rotated (t)
+	  slab *t;
+
+	  // Rotate the higher priority child of a subtree into its root.
+{
+  slab c;
+
+  if ((c = (*t)->lesser) ? ((*t)->greater ? (PRIORITY(c) >= PRIORITY((*t)->greater)) : 1) : 0)
+	 {
+		(*t)->lesser = c->greater;
+		c->greater = *t;
+	 }
+  else if ((c = (*t)->greater))
+	 {
+		(*t)->greater = c->lesser;
+		c->lesser = *t;
+	 }
+  else
+	 return;
+  *t = c;
+}
+
+
+
+
+
+
+
+static void
+inserted (t, s)
+	  slab *t;
+	  slab s;
+
+	  // Insert a slab into a subtree of the registry, assuming the
+	  // caller holds the lock.
+{
+  slab *c;
+
+  if (! *t)
+	 {
+		s->lesser = s->greater = NULL;
+		*t = s;
+		return;
+	 }
+  inserted (c = (((uintptr_t) s < (uintptr_t) *t) ? &((*t)->lesser) : &((*t)->greater)), s);
+  if (PRIORITY(*c) > PRIORITY(*t))
+	 rotated (t);
+}
+
+
+
+
+
+
+
+static int
+deleted (t, s)
+	  slab *t;
+	  slab s;
+
+	  // Delete a slab from the registry by rotating it down until it's
+	  // a leaf and return non-zero if it was found, assuming the caller
+	  // holds the lock.
+{
+  while (*t ? (*t != s) : 0)
+	 t = (((uintptr_t) s < (uintptr_t) *t) ? &((*t)->lesser) : &((*t)->greater));
+  if (! *t)
+	 return 0;
+  while (s->lesser ? 1 : ! ! (s->greater))
+	 {
+		rotated (t);
+		t = ((*t)->lesser == s) ? &((*t)->lesser) : &((*t)->greater);
+	 }
+  *t = NULL;
+  return 1;
+}
+
+
+
+
+
+
+
+int
+_cru_slabbed (p, err)
+	  void *p;
+	  int *err;
+
+	  // Return non-zero if an address is within a registered slab. The
+	  // registry is consulted only if any slabs exist and the calling
+	  // thread isn't known to be freeing a graph that owns none, so
+	  // there is no locking when arenas aren't in use by the graph at
+	  // hand.
+{
+  slab s, c;
+
+  if ((! p) ? 1 : _cru_get_heaped () ? 1 : ! __atomic_load_n (&registered, __ATOMIC_RELAXED))
+	 return 0;
+  if (pthread_rwlock_rdlock (&arena_lock) ? IER(562) : 0)
+	 return 1;
+  for (c = NULL, s = registry; s;)
+	 if ((uintptr_t) s <= (uintptr_t) p)
+		s = (c = s)->greater;
+	 else
+		s = s->lesser;
+  if (pthread_rwlock_unlock (&arena_lock))
+	 IER(563);
+  return (c ? ((uintptr_t) p < (uintptr_t) c + SLAB_SIZE) : 0);
+}
+
+
+
+
+
+// --------------- memory management -----------------------------------------------------------------------
+
+
+
+
+static slab
+new_slab (err)
+	  int *err;
+
+	  // Allocate and register an empty slab. If the heap is exhausted,
+	  // return NULL and leave it to the caller to raise an error.
+{
+  slab t;
+
+  if (*err ? 1 : ! (t = (slab) _cru_malloc (SLAB_SIZE)))
+	 return NULL;
+  if (pthread_rwlock_wrlock (&arena_lock) ? IER(564) : 0)
+	 goto a;
+  memset (t, 0, sizeof (*t));
+  inserted (&registry, t);
+  __atomic_store_n (&registered, registered + 1, __ATOMIC_RELAXED);
+  if (pthread_rwlock_unlock (&arena_lock) ? IER(565) : 1)
+	 return t;
+ a: FREE_SLAB(t);
+  return NULL;
+}
+
+
+
+
+
+
+
+void *
+_cru_carved (s, n, err)
+	  slab *s;
+	  size_t n;
+	  int *err;
+
+	  // Allocate n bytes from the first slab in a list, or from a new
+	  // slab pushed onto the list if there isn't room in the first
+	  // one. If the heap is exhausted, return NULL and leave it to the
+	  // caller to raise an error, as with _cru_malloc.
+{
+  slab t;
+  void *p;
+
+  if ((! s) ? IER(566) : (n = ALIGNED(n)) > SLAB_ROOM ? IER(567) : *s ? ((*s)->used + n <= SLAB_ROOM) : 0)
+	 goto a;
+  if (! (t = new_slab (err)))
+	 return NULL;
+  t->next_slab = *s;
+  *s = t;
+ a: if (*err)
+	 return NULL;
+  p = (void *) ((char *) (*s + 1) + (*s)->used);
+  (*s)->used += n;
+  return p;
+}
+
+
+
+
+
+
+
+void *
+_cru_carved_run (s, n, c, err)
+	  slab *s;
+	  size_t n;
+	  uintptr_t *c;
+	  int *err;
+
+	  // Allocate a contiguous run of up to *c objects of n bytes each
+	  // from the first slab in a list, or from a new slab pushed onto
+	  // the list if not even one of them fits, and set *c to the
+	  // number allocated. If the heap is exhausted, return NULL and
+	  // leave it to the caller to raise an error.
+{
+  uintptr_t k;
+  slab t;
+  void *p;
+
+  if (*err ? 1 : (! s) ? IER(568) : (! c) ? IER(569) : (! *c) ? IER(570) : (n = ALIGNED(n)) ? (n > SLAB_ROOM) ? IER(571) : 0 : IER(572))
+	 return NULL;
+  if (*s ? ((*s)->used + n <= SLAB_ROOM) : 0)
+	 goto a;
+  if (! (t = new_slab (err)))
+	 return NULL;
+  t->next_slab = *s;
+  *s = t;
+ a: if ((k = (uintptr_t) ((SLAB_ROOM - (*s)->used) / n)) < *c)
+	 *c = k;
+  p = (void *) ((char *) (*s + 1) + (*s)->used);
+  (*s)->used += *c * n;
+  return p;
+}
+
+
+
+
+
+
+
+slab
+_cru_slabs_for (c, n, err)
+	  uintptr_t c;
+	  size_t n;
+	  int *err;
+
+	  // Allocate a list of slabs with room for c objects of n bytes
+	  // each, or free them and return NULL if there isn't enough
+	  // memory for all of them.
+{
+  slab s, t;
+  uintptr_t k;            // number of objects per slab
+
+  if (((n = ALIGNED(n)) ? (n > SLAB_ROOM) : 1) ? IER(573) : 0)
+	 return NULL;
+  k = (uintptr_t) (SLAB_ROOM / n);
+  for (s = NULL, c = (c + k - 1) / k; c--; s = t)
+	 if ((t = new_slab (err)) ? 0 : RAISE(ENOMEM))
+		goto a;
+	 else
+		t->next_slab = s;
+  return s;
+ a: _cru_free_slabs (s, err);
+  return NULL;
+}
+
+
+
+
+
+
+
+void *
+_cru_taken (s, n, err)
+	  slab *s;
+	  size_t n;
+	  int *err;
+
+	  // Allocate n bytes from a list of slabs made by _cru_slabs_for,
+	  // advancing to the next one in the list when the current one is
+	  // full. The cursor s initially points to the first slab.
+{
+  void *p;
+
+  n = ALIGNED(n);
+  while (*s ? ((*s)->used + n > SLAB_ROOM) : 0)
+	 *s = (*s)->next_slab;
+  if (*s ? 0 : IER(574))
+	 return NULL;
+  p = (void *) ((char *) (*s + 1) + (*s)->used);
+  (*s)->used += n;
+  return p;
+}
+
+
+
+
+
+
+
+void
+_cru_free_slabs (s, err)
+	  slab s;
+	  int *err;
+
+	  // Unregister and free a list of slabs.
+{
+  slab t;
+
+  if ((! s) ? 1 : pthread_rwlock_wrlock (&arena_lock) ? IER(575) : 0)
+	 goto a;
+  for (t = s; t; t = t->next_slab)
+	 if (deleted (&registry, t) ? 1 : ! IER(576))
+		__atomic_store_n (&registered, registered - 1, __ATOMIC_RELAXED);
+  if (pthread_rwlock_unlock (&arena_lock))
+	 IER(577);
+ a: while ((t = s))
+	 {
+		s = s->next_slab;
+		FREE_SLAB(t);
+	 }
+}
+
+
+
+
+
+// --------------- editing ---------------------------------------------------------------------------------
+
+
+
+
+
+slab
+_cru_cat_slabs (s, t)
+	  slab s;
+	  slab t;
+
+	  // Destructively concatenate two lists of slabs.
+{
+  slab u;
+
+  if (! s)
+	 return t;
+  for (u = s; u->next_slab; u = u->next_slab);
+  u->next_slab = t;
+  return s;
+}
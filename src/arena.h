@@ -0,0 +1,98 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CRU_ARENA_H
+#define CRU_ARENA_H 1
+
+// When a graph is built with the arena field set in its sig, each
+// worker allocates the nodes and edges it creates consecutively from
+// slabs of its own, which are handed over to the graph when the build
+// is finished. Nodes and edges in slabs are never freed individually
+// but only when all of the graph's slabs are released together. Every
+// slab is registered globally in a search tree threaded through the
+// slab headers so that the functions freeing nodes and edges can tell
+// whether they came from the heap. Workers on a graph owning no slabs
+// set a thread specific flag to skip the search and its lock.
+
+#include "ptr.h"
+
+// default argument to _cru_slab_node_of and _cru_slab_edge
+#define NO_SLABS NULL
+
+// free a node or edge unless it's in a slab
+#define RELEASE(p) (_cru_slabbed (p, err) ? (void) 0 : (void) _cru_free (p))
+
+struct slab_s
+{
+  slab next_slab;                // another slab owned by the same worker or graph
+  slab lesser;                   // a registered slab at a lower address
+  slab greater;                  // a registered slab at a higher address
+  uintptr_t used;                // number of bytes allocated from this slab past the header
+};
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// --------------- initialization and teardown -------------------------------------------------------------
+
+// initialize pthread resources
+extern int
+_cru_open_arena (int *err);
+
+// release pthread resources and the slab registry
+extern void
+_cru_close_arena (void);
+
+// --------------- memory management -----------------------------------------------------------------------
+
+// allocate n bytes from the first of a list of slabs, pushing a new one if necessary
+extern void *
+_cru_carved (slab *s, size_t n, int *err);
+
+// allocate a contiguous run of up to *c objects of n bytes each from the first of a list of slabs
+extern void *
+_cru_carved_run (slab *s, size_t n, uintptr_t *c, int *err);
+
+// allocate a list of slabs with room for c objects of n bytes each
+extern slab
+_cru_slabs_for (uintptr_t c, size_t n, int *err);
+
+// allocate n bytes from a list of slabs made by _cru_slabs_for, advancing the cursor s as they fill up
+extern void *
+_cru_taken (slab *s, size_t n, int *err);
+
+// return non-zero if p points into a registered slab
+extern int
+_cru_slabbed (void *p, int *err);
+
+// free and unregister a list of slabs and everything in them
+extern void
+_cru_free_slabs (slab s, int *err);
+
+// --------------- editing ---------------------------------------------------------------------------------
+
+// destructively concatenate two lists of slabs
+extern slab
+_cru_cat_slabs (slab s, slab t);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -38,7 +38,7 @@ _cru_push_bucket (bucket, b, d, err)
 {
   brigade n;
 
-  if ((! b) ? IER(557) : (n = (brigade) _cru_malloc (sizeof (*n))) ? 0 : RAISE(ENOMEM))
+  if ((! b) ? IER(578) : (n = (brigade) _cru_malloc (sizeof (*n))) ? 0 : RAISE(ENOMEM))
 	 {
 		_cru_free_edges_and_labels (d, bucket, err);
 		return;
@@ -66,7 +66,7 @@ _cru_popped_bucket (b, err)
 {
   brigade t;
 
-  if ((! b) ? IER(558) : ! *b)
+  if ((! b) ? IER(579) : ! *b)
 	 return NULL;
   t = *b;
   *b = (*b)->other_buckets;
@@ -89,12 +89,12 @@ deleted_bucket (target, b, err)
 {
   brigade *e;
 
-  if ((! b) ? IER(559) : 0)
+  if ((! b) ? IER(580) : 0)
 	 return NULL;
   for (e = b; *e; e = &((*e)->other_buckets))
 	 if (*e == target)
 		return _cru_popped_bucket (e, err);
-  IER(560);
+  IER(581);
   return NULL;
 }
 
@@ -119,12 +119,12 @@ _cru_minimum_bucket (t, b, err)
   edge_list e;
   int ux, ut;
 
-  if ((! t) ? IER(561) : (! b) ? IER(562) : (! *b) ? IER(563) : 0)
+  if ((! t) ? IER(582) : (! b) ? IER(583) : (! *b) ? IER(584) : 0)
 	 return NULL;
   m = NULL;
   for (c = *b; *err ? NULL : c; c = c->other_buckets)
-	 if ((e = c->bucket) ? 1 : ! IER(564))
-		if (e->remote.node ? 1 : ! IER(565))
+	 if ((e = c->bucket) ? 1 : ! IER(585))
+		if (e->remote.node ? 1 : ! IER(586))
 		  if (m ? PASSED(t, e->label, e->remote.node->vertex, m->bucket->label, m->bucket->remote.node->vertex) : 1)
 			 m = c;
   return (*err ? NULL : deleted_bucket (m, b, err));
@@ -175,18 +175,18 @@ _cru_bucketed (e, by_class, err)
   node_list n, o;
 
   t = NULL;
-  if (e ? 0 : IER(566))
+  if (e ? 0 : IER(587))
 	 return NULL;
   o = NULL;
   for (f = &t; *e;)
 	 {
-		if (((o = (by_class ? CLASS_OF((*e)->remote.node) : (*e)->remote.node))) ? 0 : IER(567))
+		if (((o = (by_class ? CLASS_OF((*e)->remote.node) : (*e)->remote.node))) ? 0 : IER(588))
 		  break;
 		if (! *f)
 		  _cru_push_bucket (NULL, f, NO_LABEL_DESTRUCTOR, err);
 		if (! *f)
 		  break;
-		if ((*f)->bucket ? ((n = (*f)->bucket->remote.node) ? (by_class ? (CLASS_OF(n) != o) : (n != o)) : IER(568)) : 0)
+		if ((*f)->bucket ? ((n = (*f)->bucket->remote.node) ? (by_class ? (CLASS_OF(n) != o) : (n != o)) : IER(589)) : 0)
 		  {
 			 f = &((*f)->other_buckets);
 			 continue;
@@ -224,13 +224,13 @@ _cru_bundled (r, e, err)
   int ux, ut;
 
   t = NULL;
-  if ((! e) ? IER(569) : ! *e)
+  if ((! e) ? IER(590) : ! *e)
 	 return NULL;
   if (! r)
 	 for (; *err ? NULL : *e; t->bucket = _cru_popped_edge (e, err))
 		{
 		  _cru_push_bucket (EMPTY_BUCKET, &t, NO_LABEL_DESTRUCTOR, err);
-		  if (*err ? 1 : t ? 0 : IER(570))
+		  if (*err ? 1 : t ? 0 : IER(591))
 			 break;
 		}
   else
@@ -238,7 +238,7 @@ _cru_bundled (r, e, err)
 		{
 		  if (! *f)
 			 _cru_push_bucket (EMPTY_BUCKET, f, NO_LABEL_DESTRUCTOR, err);
-		  if (*err ? 1 : *f ? 0 : IER(571))
+		  if (*err ? 1 : *f ? 0 : IER(592))
 			 break;
 		  if ((*f)->bucket ? PASSED(r, (*f)->bucket->label, (*e)->label) : 1)
 			 {
@@ -369,8 +369,8 @@ _cru_reduced_brigade (m, v, t, by_class, d, err)
   r.e_free = (m ? m->r_free : NULL);
   for (result = NULL; (o = t); _cru_free (o))
 	 {
-		if (t->bucket ? 1 : ! IER(572))
-		  if ((n = (by_class ? CLASS_OF(t->bucket->remote.node) : t->bucket->remote.node)) ? 1 : ! IER(573))
+		if (t->bucket ? 1 : ! IER(593))
+		  if ((n = (by_class ? CLASS_OF(t->bucket->remote.node) : t->bucket->remote.node)) ? 1 : ! IER(594))
 			 {
 				l = _cru_configurably_reduced_edges (m, v, t->bucket, by_class, WITHOUT_LOCKS, err);
 				_cru_push_edge (_cru_edge (&r, l, NO_VERTEX, n, NO_NEXT_EDGE, err), &result, err);
@@ -17,8 +17,10 @@
 */
 
 #include <stdlib.h>
+#include "arena.h"
 #include "brig.h"
 #include "build.h"
+#include "count.h"
 #include "edges.h"
 #include "errs.h"
 #include "getset.h"
@@ -35,48 +37,83 @@
 #include "table.h"
 #include "wrap.h"
 
+// the context of a thread that isn't a worker
+#define NO_CONTEXT NULL
+
 // first parameter to a subconnector function
 #define INITIAL 1
 #define NOT_INITIAL 0
 
 #define UNEQUAL(a,b) ((a == b) ? 0 : FAILED(s->orders.v_order.equal, a, b))
 
+// non-zero if the vertex in packet p is at the depth limit of builder b and gets no outgoing edges
+#define AT_LIMIT(b,p) ((b)->depth_limit ? ((p)->depth >= (b)->depth_limit) : 0)
+
+// the packet recording the base node of a graph built from given edges is neither initial nor carried
+#define BASE(p) ((p)->initial ? 0 : ! ((p)->carrier))
+
+
+
+
+
+
+
+static void *
+canonical (v, c, z, err)
+	  void *v;
+	  cru_uop c;
+	  cru_destructor_pair z;
+	  int *err;
+
+	  // Return the canonical representative of a vertex v given by
+	  // the function c if it's defined, and otherwise v. If they
+	  // differ, v is consumed.
+{
+  void *u, *ua;
+  int ux;
+
+  if ((! c) ? 1 : *err)
+	 return v;
+  if ((u = APPLIED(c, v)) == v)
+	 return v;
+  if (z->v_free ? v : NULL)
+	 APPLY(z->v_free, v);
+  return u;
+}
+
+
+
 
 
 
 
 
 static edge_list
-unique (e, s, err)
+unique (e, c, s, err)
 	  edge_list e;
+	  cru_uop c;              // optional canonicalizing function for remote vertices
 	  cru_sig s;
 	  int *err;
 
-	  // Deduplicate edges by label and remote vertex. Time is
-	  // quadratic in the cardinality of the largest edge label
-	  // equivalence class, making it possibly a bottleneck if
-	  // connectors create large numbers of identically labeled
-	  // outgoing edges between the same vertices.
+	  // Deduplicate edges by label and remote vertex after replacing
+	  // each remote vertex with its canonical representative if
+	  // there's a canonicalizing function. Edges are first bucketed
+	  // by label, and then the remote vertices in each bucket are
+	  // binned by their hashes so that time is linear in the number
+	  // of edges when Judy arrays are available, even if connectors
+	  // create large numbers of identically labeled outgoing edges.
 {
   brigade b, t;           // each bucket has only one edge label but multiple remote vertices
-  edge_list *l;           // all edges in a bucket
-  edge_list p;            // next edge in a bucket
   edge_list r;            // cumulative unique edges
-  int ux, ut;
 
-  if (s ? 0 : IER(574))
+  if (s ? 0 : IER(595))
 	 return NULL;
+  for (r = (c ? e : NULL); r; r = r->next_edge)
+	 r->remote.vertex = canonical (r->remote.vertex, c, &(s->destructors), err);
   t = _cru_rallied (s->orders.e_order.hash, s->orders.e_order.equal, &e, err);
   _cru_free_edges_and_termini (&(s->destructors), e, err);
   for (r = NULL; (b = _cru_popped_bucket (&t, err)); _cru_free_brigade (b, err))
-	 for (l = &(b->bucket); (p = (*l ? _cru_popped_edge (l, err) : NULL));)
-		{
-		  for (e = b->bucket; e ? UNEQUAL(p->remote.vertex, e->remote.vertex) : 0; e = e->next_edge);
-		  if (e ? 1 : *err)
-			 _cru_free_edges_and_termini (&(s->destructors), p, err);
-		  else
-			 _cru_push_edge (p, &r, err);
-		}
+	 r = _cru_cat_edges (_cru_distinct_termini (s->orders.v_order.hash, s->orders.v_order.equal, &(s->destructors), b->bucket, err), r);
   return r;
 }
 
@@ -91,11 +128,12 @@ unique (e, s, err)
 
 
 void
-_cru_reach_extant_node (i, c, b, d, err)
+_cru_reach_extant_node (i, c, b, d, stopped, err)
 	  packet_list *i;
 	  packet_list c;       // colliding packet
 	  cru_builder b;
 	  packet_pod d;
+	  int stopped;         // non-zero if the job has been stopped and no more edges are to be created
 	  int *err;
 
 	  // Discard a packet i whose payload vertex matches one already in
@@ -104,7 +142,8 @@ _cru_reach_extant_node (i, c, b, d, err)
 	  // functions and the label on the edge leading to the vertex
 	  // hasn't been seen already, then call the subconnector function
 	  // and percolate messages to other workers through any new edges
-	  // it creates.
+	  // it creates. The base node of a graph built from given edges
+	  // keeps only those edges.
 {
   int ux;
   void *l;
@@ -113,28 +152,28 @@ _cru_reach_extant_node (i, c, b, d, err)
   edge_list *new_edges_out;
   edge_list extant_edges_out;
 
-  if ((! i) ? IER(575) : (! *i) ? IER(576) : (! ((*i)->carrier)) ? IER(577) : c ? 0 : IER(578))
+  if ((! i) ? IER(596) : (! *i) ? IER(597) : (! ((*i)->carrier)) ? IER(598) : c ? 0 : IER(599))
 	 goto a;
-  if ((! b) ? IER(579) : (new_edges_out = _cru_get_edges ()) ? (! ! (*new_edges_out = NULL)) : IER(580))
+  if ((! b) ? IER(600) : (new_edges_out = _cru_get_edges ()) ? (! ! (*new_edges_out = NULL)) : IER(601))
 	 goto b;
   if (b->bu_sig.destructors.v_free ? (*i)->payload : NULL)           // get rid of the extra copy of the vertex
 	 APPLY(b->bu_sig.destructors.v_free, (*i)->payload);
   (*i)->payload = NULL;
-  if (((n = c->receiver)) ? 0 : IER(581))
+  if (((n = c->receiver)) ? 0 : IER(602))
 	 goto b;
-  if (b->connector ? (b->subconnector ? IER(582) : 1) : 0)
+  if (b->connector ? (b->subconnector ? IER(603) : 1) : 0)
 	 goto b;
-  if (b->subconnector ? (b->bu_sig.orders.e_order.hash ? 0 : IER(583)) : IER(584))
+  if (b->subconnector ? (b->bu_sig.orders.e_order.hash ? 0 : IER(604)) : IER(605))
 	 goto b;
   h = (b->bu_sig.orders.e_order.hash) (l = (*i)->carrier->label);
-  if ((*i)->initial ? IER(585) : _cru_already_recorded (h, b->bu_sig.orders.e_order.equal, l, c->seen_carriers, err))
+  if ((*i)->initial ? IER(606) : AT_LIMIT(b, c) ? 1 : BASE(c) ? 1 : stopped ? 1 : _cru_already_recorded (h, b->bu_sig.orders.e_order.equal, l, c->seen_carriers, err))
 	 goto b;
   _cru_record_edge (h, b->bu_sig.orders.e_order.equal, l, &(c->seen_carriers), err);
   APPLY(b->subconnector, NOT_INITIAL, l, c->receiver->vertex);                                  // make new edges
   extant_edges_out = c->receiver->edges_out;
-  c->receiver->edges_out = unique (*new_edges_out, &(b->bu_sig), err);
+  c->receiver->edges_out = unique (*new_edges_out, b->canonical, &(b->bu_sig), err);
   *new_edges_out = NULL;
-  _cru_scatter_out_or_consume (c->receiver, b->bu_sig.orders.v_order.hash, &(b->bu_sig.destructors), d, err);
+  _cru_scatter_out_or_consume (c->receiver, b->bu_sig.orders.v_order.hash, &(b->bu_sig.destructors), d, c->depth + 1, err);
   c->receiver->edges_out = _cru_cat_edges (c->receiver->edges_out, extant_edges_out);
  b: (*i)->carrier->remote.node = c->receiver;
  a: _cru_nack (_cru_popped_packet (i, err), err);
@@ -153,17 +192,21 @@ _cru_reach_extant_node (i, c, b, d, err)
 
 
 packet_list
-_cru_reached_new_node (i, b, q, d, err)
+_cru_reached_new_node (i, b, q, d, s, stopped, err)
 	  packet_list *i;
 	  cru_builder b;
 	  node_queue *q;       // the output queue where all newly created nodes are stored
 	  packet_pod d;
+	  slab *s;             // storage for the new node in arena mode, otherwise NULL
+	  int stopped;         // non-zero if the job has been stopped and no more edges are to be created
 	  int *err;
 
 	  // Create a new node for the graph, store it in the receiver
 	  // field of the top packet, connect the sender node in the packet
 	  // to the new node if applicable, send adjacent vertices to other
-	  // workers in other packets, and pop the packet.
+	  // workers in other packets, and pop the packet. A node at the
+	  // depth limit or created after the job is stopped is left with
+	  // no outgoing edges so that it can be spread later.
 {
 #define NO_INCIDENT_EDGE_LABEL NULL
 
@@ -172,19 +215,21 @@ _cru_reached_new_node (i, b, q, d, err)
   void *l;                // incident edge label
   int ux;
 
-  if ((! i) ? IER(586) : (! *i) ? IER(587) : (! b) ? IER(588) : 0)
+  if ((! i) ? IER(607) : (! *i) ? IER(608) : (! b) ? IER(609) : 0)
 	 goto a;
-  if (((! (b->connector)) == ! (b->subconnector)) ? IER(589) : 0)
+  if (((! (b->connector)) == ! (b->subconnector)) ? IER(610) : 0)
 	 goto a;
-  if (b->subconnector ? (b->bu_sig.orders.e_order.hash ? 0 : IER(590)) : 0)
+  if (b->subconnector ? (b->bu_sig.orders.e_order.hash ? 0 : IER(611)) : 0)
 	 goto a;
-  if ((new_edges_out = _cru_get_edges ()) ? (! ! (*new_edges_out = NULL)) : IER(591))
+  if ((new_edges_out = _cru_get_edges ()) ? (! ! (*new_edges_out = NULL)) : IER(612))
 	 goto a;
+  if (stopped ? 1 : AT_LIMIT(b, *i))
+	 goto b;
   if (b->connector)
 	 APPLY(b->connector, (*i)->payload);
   else if ((*i)->initial)
 	 APPLY(b->subconnector, INITIAL, NO_INCIDENT_EDGE_LABEL, (*i)->payload);
-  else if ((*i)->carrier ? 0 : IER(592))
+  else if ((*i)->carrier ? 0 : IER(613))
 	 goto a;
   else
 	 {
@@ -192,7 +237,7 @@ _cru_reached_new_node (i, b, q, d, err)
 		_cru_record_edge ((b->bu_sig.orders.e_order.hash) (l), b->bu_sig.orders.e_order.equal, l, &((*i)->seen_carriers), err);
 		APPLY(b->subconnector, NOT_INITIAL, l, (*i)->payload);
 	 }
-  n = _cru_node_of (&(b->bu_sig.destructors), (*i)->payload, NO_EDGES_IN, *new_edges_out, err);
+ b: n = _cru_slab_node_of (s, &(b->bu_sig.destructors), (*i)->payload, NO_EDGES_IN, *new_edges_out, err);
   *new_edges_out = NULL;
   if (! _cru_enqueued_node (n, q, err))
 	 {
@@ -201,8 +246,8 @@ _cru_reached_new_node (i, b, q, d, err)
 	 }
   if ((*i)->carrier)
 	 (*i)->carrier->remote.node = n;
-  n->edges_out = unique (n->edges_out, &(b->bu_sig), err);
-  _cru_scatter_out_or_consume ((*i)->receiver = n, b->bu_sig.orders.v_order.hash, &(b->bu_sig.destructors), d, err);
+  n->edges_out = unique (n->edges_out, b->canonical, &(b->bu_sig), err);
+  _cru_scatter_out_or_consume ((*i)->receiver = n, b->bu_sig.orders.v_order.hash, &(b->bu_sig.destructors), d, (*i)->depth + 1, err);
   return _cru_popped_packet (i, err);
  a: _cru_nack (_cru_popped_packet (i, err), err);
   return NULL;
@@ -216,6 +261,145 @@ _cru_reached_new_node (i, b, q, d, err)
 
 
 
+packet_list
+_cru_prioritized (source, d, b, err)
+	  port source;
+	  packet_pod d;
+	  cru_builder b;
+	  int *err;
+
+	  // Acquire more packets for a worker as _cru_exchanged does
+	  // unless the builder has a priority function. In that case rank
+	  // the packets in the worker's priority inbox and return only the
+	  // one whose vertex has the least priority value. New packets are
+	  // taken without waiting while any remain in the inbox, so each
+	  // worker always builds the most promising vertex it knows of.
+{
+  packet_list p, t;
+  void *ua;
+  int ux;
+
+  if ((! source) ? IER(614) : (! b) ? IER(615) : ! (b->priority))
+	 return _cru_exchanged (source, d, err);
+  p = (source->ranked ? _cru_polled (source, d, err) : _cru_exchanged (source, d, err));
+  while (p)
+	 {
+		t = _cru_popped_packet (&p, err);
+		t->priority = (uintptr_t) APPLIED(b->priority, t->payload);
+		_cru_rank_packet (t, &(source->ranked), err);
+	 }
+  return _cru_best_packet (&(source->ranked), err);
+}
+
+
+
+
+
+
+
+void
+_cru_truncate (i, b, err)
+	  packet_list *i;
+	  cru_builder b;
+	  int *err;
+
+	  // Discard a packet i whose payload vertex would exceed the
+	  // vertex limit in a partial build, and mark its carrier for
+	  // removal by clearing the node it reaches. The payload is the
+	  // carrier's copy of the vertex, so it's freed only once.
+{
+  int ux;
+
+  if ((! i) ? IER(616) : (! *i) ? IER(617) : (! b) ? IER(618) : (*i)->carrier ? 0 : IER(619))
+	 goto a;
+  if (b->bu_sig.destructors.v_free ? (*i)->payload : NULL)
+	 APPLY(b->bu_sig.destructors.v_free, (*i)->payload);
+  (*i)->payload = NULL;
+  (*i)->carrier->remote.node = NULL;
+ a: _cru_nack (_cru_popped_packet (i, err), err);
+}
+
+
+
+
+
+
+
+void
+_cru_prune_truncations (n, e_free, c, err)
+	  node_list n;
+	  cru_destructor e_free;
+	  census c;
+	  int *err;
+
+	  // Remove the outgoing edges marked by _cru_truncate from a list
+	  // of nodes after a partial build has finished, and deduct them
+	  // from the census c if it's not NULL. Every other edge reaches
+	  // a node by then.
+{
+  edge_list *e;
+  uintptr_t pruned;
+
+  for (; *err ? NULL : n; n = n->next_node)
+	 {
+		for (pruned = 0, e = &(n->edges_out); *e;)
+		  if ((*e)->remote.node)
+			 e = &((*e)->next_edge);
+		  else if (++pruned)
+			 _cru_free_edges_and_labels (e_free, _cru_popped_edge (e, err), err);
+		if ((! c) ? 1 : ! pruned)
+		  continue;
+		c->edges -= pruned;
+		c->termini += ! (n->edges_out);
+	 }
+}
+
+
+
+
+
+
+
+int
+_cru_discovered (b, n, x, k, err)
+	  cru_builder b;
+	  node_list n;         // a node just created by the calling worker
+	  context *x;          // the calling worker's context
+	  int *k;              // the killed field of the router
+	  int *err;
+
+	  // Pass the vertex of a newly created node to the discoverer and
+	  // the stopper in a builder if they're defined, and kill the job
+	  // if the stopper returns non-zero. Clear the context while they
+	  // run so that they can't call cru_connect. Return non-zero if
+	  // the job is killed.
+{
+  int ux, ut, stop;
+  int ignored;
+  context c;
+
+  if ((! b) ? IER(620) : (! n) ? 1 : b->discoverer ? 0 : ! (b->stopper))
+	 return 0;
+  c = (x ? *x : IDLE);
+  if (x)
+	 *x = IDLE;
+  APPLY(b->discoverer, n->vertex);
+  stop = (b->stopper ? PASSED(b->stopper, n->vertex) : 0);
+  if (x)
+	 *x = c;
+  if (stop)
+	 _cru_kill (k, &ignored);
+  return stop;
+}
+
+
+
+
+
+
+
+
+
 void *
 _cru_building_task (source, err)
 	  port source;
@@ -224,14 +408,13 @@ _cru_building_task (source, err)
 	  // Receive packets carrying graph vertices from other workers,
 	  // check for their presence in the graph, create adjacent
 	  // vertices to those not previously present, and send the created
-	  // adjacent vertices to other workers.
+	  // adjacent vertices to other workers. A base node owned by this
+	  // worker is recorded before any packets are received.
 {
   packet_table collisions;    // previous incoming packets
   edge_list new_edges_out;    // thread specific storage location for created edges
-  packet_list incoming;
+  packet_list incoming, p;
   int ux, ut, unequal;
-  uintptr_t limit;            // maximum number of vertices allowed to be created by this worker
-  uintptr_t count;            // number of vertices created by this worker
   unsigned sample;
   packet_list *c;
   cru_builder b;
@@ -239,40 +422,51 @@ _cru_building_task (source, err)
   packet_pod d;
   node_list n;
   int killed;                 // non-zero when the job is killed
+  int stopped;                // non-zero when a partial job is killed without an error
   context x;
   cru_sig s;
   router r;
 
   q = NULL;
   d = NULL;
-  count = 0;
   sample = 0;
   killed = 0;
   x = BUILDING;
   collisions = NULL;
   new_edges_out = NULL;
-  if ((! source) ? IER(593) : (source->gruntled != PORT_MAGIC) ? IER(594) : 0)
+  if ((! source) ? IER(621) : (source->gruntled != PORT_MAGIC) ? IER(622) : 0)
 	 return NULL;
-  if ((!(r = source->local)) ? IER(595) : (r->valid != ROUTER_MAGIC) ? IER(596) : 0)
+  if ((!(r = source->local)) ? IER(623) : (r->valid != ROUTER_MAGIC) ? IER(624) : 0)
 	 return NULL;
   b = &(r->builder);
-  if ((!(d = source->peers)) ? IER(597) : (r->tag != BUI) ? IER(598) : ! (s = &(b->bu_sig)))
+  if ((!(d = source->peers)) ? IER(625) : (r->tag != BUI) ? IER(626) : ! (s = &(b->bu_sig)))
 	 goto a;
-  if ((s->orders.v_order.equal) ? 0 : IER(599))
+  if ((s->orders.v_order.equal) ? 0 : IER(627))
 	 goto a;
   if (_cru_set_destructors (&(b->bu_sig.destructors), err))
 	 goto a;
   if (_cru_set_context (&x, err) ? 1 : _cru_set_storage (r->ro_store, err) ? 1 : _cru_set_edges (&new_edges_out, err))
 	 goto a;
-  if (_cru_set_kill_switch (&(r->killed), err))
+  if (_cru_set_kill_switch (&(r->killed), err) ? 1 : _cru_set_slabs (s->arena ? &(source->slabs) : NO_SLABS, err))
 	 goto a;
-  limit = b->bu_sig.vertex_limit / r->lanes;
-  limit = (limit ? limit : b->bu_sig.vertex_limit ? 1 : 0);
-  for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
+  if (source->extant ? (c = _cru_collision (source->extant->hash_value, &collisions, err)) : NULL)
+	 {
+		_cru_push_packet (source->extant, c, err);
+		source->extant = NULL;
+	 }
+  for (incoming = NULL; incoming ? incoming : (incoming = _cru_prioritized (source, d, b, err));)
 	 {
 		KILL_SITE(1);
 		killed = (killed ? 1 : KILLED);
-		if (*err ? 1 : killed ? 1 : ! (c = _cru_collision (incoming->hash_value, &collisions, err)))
+		stopped = (killed ? STOPPED(r) : 0);
+		if (*err ? 0 : killed ? 0 : HELD(incoming, r))
+		  {
+			 _cru_push_packet (_cru_popped_packet (&incoming, err), &(source->frontier), err);
+			 continue;
+		  }
+		if (*err ? 1 : killed ? (! stopped) : 0)
+		  goto b;
+		if (! (c = _cru_collision (incoming->hash_value, &collisions, err)))
 		  goto b;
 		if (*c)
 		  while (*err ? 0 : (unequal = UNEQUAL(incoming->payload, (*c)->payload)) ? (*c)->next_packet : NULL)
@@ -280,9 +474,15 @@ _cru_building_task (source, err)
 		if (*err)
 		  goto b;
 		if (*c ? (! unequal) : 0)
-		  _cru_reach_extant_node (&incoming, *c, b, d, err);
-		else if (limit ? (count++ < limit) : 1)
-		  _cru_push_packet (_cru_reached_new_node (&incoming, b, &q, d, err), *c ? &((*c)->next_packet) : c, err);
+		  _cru_reach_extant_node (&incoming, *c, b, d, stopped, err);
+		else if (BUDGETED(s->vertex_limit, r))
+		  {
+			 _cru_push_packet (p = _cru_reached_new_node (&incoming, b, &q, d, s->arena ? &(source->slabs) : NO_SLABS, stopped, err), *c ? &((*c)->next_packet) : c, err);
+			 if (p)
+				_cru_discovered (b, p->receiver, &x, &(r->killed), err);
+		  }
+		else if (b->partial)
+		  _cru_truncate (&incoming, b, err);
 		else
 		  RAISE(CRU_INTOVF);
 		continue;
@@ -296,6 +496,8 @@ _cru_building_task (source, err)
   if ((! q) ? 0 : *err ? 0 : ! (b->connector))
 	 for (n = q->front; n; n = n->next_node)
 		n->edges_out = _cru_deduplicated_edges (n->edges_out, &(b->bu_sig.orders.e_order), b->bu_sig.destructors.e_free, err);
+  if (! *err)
+	 _cru_tally (&(source->tally), q ? q->front : NULL);
   if (! *err)
 	 return q;
  a: _cru_free_node_queue (q, &(s->destructors), err);
@@ -325,14 +527,63 @@ _cru_built (v, k, r, err)
 
   g = NULL;
   _cru_disable_killing (k, err);
-  if ((! r) ? IER(600) : (r->valid != ROUTER_MAGIC) ? IER(601) : (! (r->ro_sig.orders.v_order.hash)) ? IER(602) : 0)
+  if ((! r) ? IER(628) : (r->valid != ROUTER_MAGIC) ? IER(629) : (! (r->ro_sig.orders.v_order.hash)) ? IER(630) : 0)
 	 goto a;
+  v = canonical (v, r->builder.canonical, &(r->ro_sig.destructors), err);
+  if (*err)
+	 goto b;
   if (! _cru_graph_launched (k, v, (r->ro_sig.orders.v_order.hash) (v), r, &g, err))
 	 if (v ? r->ro_sig.destructors.v_free : NULL)
 		APPLY(r->ro_sig.destructors.v_free, v);
   if (*err)
 	 _cru_free_now (g, err);
   return (*err ? NULL : g);
+ b: if (v ? r->ro_sig.destructors.v_free : NULL)
+	 APPLY(r->ro_sig.destructors.v_free, v);
+ a: _cru_free_router (r, err);
+  return NULL;
+}
+
+
+
+
+
+
+
+
+cru_graph
+_cru_built_from (v, labels, termini, n, k, r, err)
+	  void *v;
+	  void *const *labels;
+	  void *const *termini;
+	  size_t n;
+	  cru_kill_switch k;
+	  router r;
+	  int *err;
+
+	  // Concurrently build the graph of all nodes reachable from any
+	  // of n termini through edges with the given labels from the
+	  // base vertex v, and consume the base vertex, the labels, the
+	  // termini, and the router.
+{
+  cru_graph g;
+  node_list b;
+
+  g = NULL;
+  _cru_disable_killing (k, err);
+  if ((! r) ? IER(631) : (r->valid != ROUTER_MAGIC) ? IER(632) : (! (r->ro_sig.orders.v_order.hash)) ? IER(633) : 0)
+	 goto a;
+  v = canonical (v, r->builder.canonical, &(r->ro_sig.destructors), err);
+  if (! (b = _cru_node_of (&(r->ro_sig.destructors), v, NO_EDGES_IN, _cru_slab_edges (NO_SLABS, &(r->ro_sig.destructors), labels, termini, n, NULL, err), err)))
+	 goto a;
+  b->edges_out = unique (b->edges_out, r->builder.canonical, &(r->ro_sig), err);
+  if (*err ? 0 : _cru_discovered (&(r->builder), b, NO_CONTEXT, &(r->killed), err))
+	 RAISE(CRU_INTKIL);
+  r->created = 1;                     // the base vertex counts against the vertex limit
+  _cru_graph_seeded (k, b, r, &g, err);
+  if (*err)
+	 _cru_free_now (g, err);
+  return (*err ? NULL : g);
  a: _cru_free_router (r, err);
   return NULL;
 }
@@ -22,6 +22,13 @@
 // functions used for building a graph
 
 #include "ptr.h"
+#include "getset.h"
+
+// non-zero if a packet p has to wait for a later level of a depth limited build by router r
+#define HELD(p,r) ((r)->builder.depth_limit ? ((p)->depth > (r)->level) : 0)
+
+// parameter to _cru_prune_truncations when the census isn't known
+#define NO_CENSUS NULL
 
 #ifdef __cplusplus
 extern "C"
@@ -30,11 +37,27 @@ extern "C"
 
 // create a new edge to an existng node in a graph
 extern void
-_cru_reach_extant_node (packet_list *i, packet_list c, cru_builder b, packet_pod d, int *err);
+_cru_reach_extant_node (packet_list *i, packet_list c, cru_builder b, packet_pod d, int stopped, int *err);
 
 // create and enqueue a new node for the graph
 extern packet_list
-_cru_reached_new_node (packet_list *i, cru_builder b, node_queue *q, packet_pod d, int *err);
+_cru_reached_new_node (packet_list *i, cru_builder b, node_queue *q, packet_pod d, slab *s, int stopped, int *err);
+
+// acquire more packets for a worker, returning only the highest ranked one if the builder has a priority function
+extern packet_list
+_cru_prioritized (port source, packet_pod d, cru_builder b, int *err);
+
+// discard a packet whose vertex would exceed the vertex limit of a partial build
+extern void
+_cru_truncate (packet_list *i, cru_builder b, int *err);
+
+// remove edges to vertices discarded from a partial build and update the census if any
+extern void
+_cru_prune_truncations (node_list n, cru_destructor e_free, census c, int *err);
+
+// report a newly created node to the builder's discoverer and stopper, killing the job if it's stopped
+extern int
+_cru_discovered (cru_builder b, node_list n, context *x, int *k, int *err);
 
 // build a graph co-operatively with other workers
 extern void *
@@ -44,6 +67,10 @@ _cru_building_task (port source, int *err);
 extern cru_graph
 _cru_built (void *v, cru_kill_switch k, router r, int *err);
 
+// concurrently build the graph of all nodes reachable from n termini of edges from the base vertex v
+extern cru_graph
+_cru_built_from (void *v, void *const *labels, void *const *termini, size_t n, cru_kill_switch k, router r, int *err);
+
 #ifdef __cplusplus
 }
 #endif
@@ -62,7 +62,7 @@ map_size (p, err)
   vertex_map v;
   size_t result;
 
-  if ((! p) ? IER(603) : ((result = p * sizeof (v)) < p) ? IER(604) : (result < sizeof (v)) ? IER(605) : 0)
+  if ((! p) ? IER(634) : ((result = p * sizeof (v)) < p) ? IER(635) : (result < sizeof (v)) ? IER(636) : 0)
 	 return 0;
   return result;
 }
@@ -84,13 +84,13 @@ _cru_partition (p, err)
   size_t m;
   cru_partition h;
 
-  if ((m = map_size (p, err)) ? *err : IER(606))
+  if ((m = map_size (p, err)) ? *err : IER(637))
 	 return NULL;
   if ((h = (cru_partition) _cru_malloc (sizeof (*h))) ? 0 : RAISE(ENOMEM))
 	 return NULL;
   memset (h, 0, sizeof (*h));
   h->plurality = p;
-  if (pthread_rwlock_init (&(h->loch), NULL) ? IER(607) : 0)
+  if (pthread_rwlock_init (&(h->loch), NULL) ? IER(638) : 0)
 	 goto a;
   if ((h->maps = (vertex_map *) _cru_malloc (m)) ? 0 : RAISE(ENOMEM))
 	 goto a;
@@ -120,11 +120,11 @@ class_freeing_slacker (h)
   unsigned p;
   int err;
 
-  if ((err = (h ? 0 : THE_IER(608))))
+  if ((err = (h ? 0 : THE_IER(639))))
 	 goto a;
-  if ((err = ((h->parted == PARTITION_MAGIC) ? 0 : THE_IER(609))))
+  if ((err = ((h->parted == PARTITION_MAGIC) ? 0 : THE_IER(640))))
 	 goto a;
-  if ((err = (h->maps ? (h->plurality ? 0 : THE_IER(610)) : THE_IER(611))))
+  if ((err = (h->maps ? (h->plurality ? 0 : THE_IER(641)) : THE_IER(642))))
 	 goto a;
   for (p = h->plurality; p--;)
 	 _cru_free_vertex_map (h->maps[p], &err);
@@ -134,7 +134,7 @@ class_freeing_slacker (h)
   free (h->maps);
 #endif
   if (pthread_rwlock_destroy (&(h->loch)))
-	 err = THE_IER(612);
+	 err = THE_IER(643);
   h->parted = MUGGLE(1);
   _cru_free (h);
  a: _cru_globally_throw (err);
@@ -182,7 +182,7 @@ _cru_free_class (h, err)
 
 	  // Free a class.
 {
-  if ((! h) ? 1 : (h->classed != CLASS_MAGIC) ? IER(613) : 0)
+  if ((! h) ? 1 : (h->classed != CLASS_MAGIC) ? IER(644) : 0)
 	 return;
   if ((h->references)--)
 	 return;
@@ -205,7 +205,7 @@ copied_class (h, err)
 
 	  // Return a shared copy of a class.
 {
-  if ((! h) ? 1 : (h->classed != CLASS_MAGIC) ? IER(614) : 0)
+  if ((! h) ? 1 : (h->classed != CLASS_MAGIC) ? IER(645) : 0)
 	 return NULL;
   if (++(h->references))
 	 return h;
@@ -238,7 +238,7 @@ classifying_task (source, err)
 	  // the hash of its property.
 {
 #define UNEQUAL(a,b) \
-(*err ? 0 : (! b) ? (! IER(615)) : (a->vertex_property == b->vertex_property) ? 0 : \
+(*err ? 0 : (! b) ? (! IER(646)) : (a->vertex_property == b->vertex_property) ? 0 : \
 FAILED(r->merger.me_classifier.cl_order.equal, a->vertex_property, b->vertex_property))
 
   packet_table collisions;    // previous incoming packets
@@ -259,19 +259,19 @@ FAILED(r->merger.me_classifier.cl_order.equal, a->vertex_property, b->vertex_pro
   sample = 0;
   seen = NULL;
   collisions = NULL;
-  if ((! source) ? IER(616) : (source->gruntled != PORT_MAGIC) ? IER(617) : 0)
+  if ((! source) ? IER(647) : (source->gruntled != PORT_MAGIC) ? IER(648) : 0)
 	 goto a;
-  if ((!(r = source->local)) ? IER(618) : (r->valid != ROUTER_MAGIC) ? IER(619) : (killed = 0))
+  if ((!(r = source->local)) ? IER(649) : (r->valid != ROUTER_MAGIC) ? IER(650) : (killed = 0))
 	 goto a;
-  if ((! (d = source->peers)) ? IER(620) : (r->tag != CLU) ? IER(621) : 0)
+  if ((! (d = source->peers)) ? IER(651) : (r->tag != CLU) ? IER(652) : 0)
 	 goto b;
-  if ((! (r->partition)) ? IER(622) : (! (r->partition->maps)) ? IER(623) : 0)
+  if ((! (r->partition)) ? IER(653) : (! (r->partition->maps)) ? IER(654) : 0)
 	 goto b;
   m = &(r->partition->maps[source->own_index]);
-  if (r->merger.me_classifier.cl_order.equal ? 0 : IER(624))
+  if (r->merger.me_classifier.cl_order.equal ? 0 : IER(655))
 	 goto b;
   h = r->merger.me_classifier.cl_order.hash;
-  if (h ? 0 : r->ro_sig.destructors.v_free ? IER(625) : ! (h = (cru_hash) _cru_scalar_hash))
+  if (h ? 0 : r->ro_sig.destructors.v_free ? IER(656) : ! (h = (cru_hash) _cru_scalar_hash))
 	 goto b;
   _cru_set_storage (r->ro_store, err);
   _cru_set_kill_switch (&(r->killed), err);
@@ -279,7 +279,7 @@ FAILED(r->merger.me_classifier.cl_order.equal, a->vertex_property, b->vertex_pro
 	 {
 		KILL_SITE(2);
 		killed = (killed ? 1 : KILLED);
-		if (*err ? 1 : killed ? 1 : ((n = incoming->receiver)) ? _cru_member (n, seen) : IER(626))
+		if (*err ? 1 : killed ? 1 : ((n = incoming->receiver)) ? _cru_member (n, seen) : IER(657))
 		  goto c;
 		if (! (c = _cru_collision (incoming->hash_value, &collisions, err)))
 		  goto c;
@@ -293,7 +293,7 @@ FAILED(r->merger.me_classifier.cl_order.equal, a->vertex_property, b->vertex_pro
 		p = (*c ? &((*c)->next_packet) : c);
 		*p = _cru_popped_packet (&incoming, err);
 		continue;
-	 d: if ((*c)->receiver ? 1 : ! IER(627))
+	 d: if ((*c)->receiver ? 1 : ! IER(658))
 		  _cru_associate (m, n->vertex, copied_class (_cru_image (*m, (*c)->receiver->vertex, err), err), err);
 	 c: _cru_nack (_cru_popped_packet (&incoming, err), err);
  	 }
@@ -327,9 +327,9 @@ _cru_partition_of (g, k, r, err)
 
   result = NULL;
   _cru_disable_killing (k, err);
-  if ((! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(628) : (! g) ? IER(629) : (! (b = g->base_node)) ? IER(630) : 0)
+  if ((! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(659) : (! g) ? IER(660) : (! (b = g->base_node)) ? IER(661) : 0)
 	 goto a;
-  if ((r->tag != CLU) ? IER(631) : 0)
+  if ((r->tag != CLU) ? IER(662) : 0)
 	 goto a;
   h = r->merger.me_classifier.cl_order.hash;
   if (h ? 0 : r->ro_sig.destructors.v_free ? RAISE(CRU_UNDHSH) : ! (h = (cru_hash) _cru_scalar_hash))
@@ -340,7 +340,7 @@ _cru_partition_of (g, k, r, err)
 		goto a;
 	 }
   if (_cru_status_launched (k, b, h (b->vertex_property), _cru_reset (r, (task) classifying_task, err), err))
-	 if ((result = r->partition) ? 1 : ! IER(632))
+	 if ((result = r->partition) ? 1 : ! IER(663))
 		goto b;
   cru_free_partition (r->partition, (*err == CRU_INTKIL) ? LATER : NOW, err);
  b: _cru_unset_properties (g, r, err);
@@ -377,7 +377,7 @@ cru_class_size (c, err)
   CONTROL_ENTRY;
   if (c ? ((c->classed == CLASS_MAGIC) ? 0 : RAISE(CRU_BADCLS)) : RAISE(CRU_NULCLS))
 	 return 0;
-  return ((((s = c->references + 1) ? 0 : IER(633)) ? (c->classed = MUGGLE(4)) : 0) ? 0 : s);
+  return ((((s = c->references + 1) ? 0 : IER(664)) ? (c->classed = MUGGLE(4)) : 0) ? 0 : s);
 }
 
 
@@ -421,7 +421,7 @@ cru_free_partition (p, now, err)
   free (p->maps);
 #endif
  a: if (pthread_rwlock_destroy (&(p->loch)))
-	 IER(634);
+	 IER(665);
   p->parted = MUGGLE(5);
   _cru_free (p);
 }
@@ -453,11 +453,11 @@ cru_class_of (p, x, err)
 		break;
   if (i ? 0 : (*err == ENOMEM) ? 1 : RAISE(CRU_PARVNF))
 	 return NULL;
-  if ((pthread_rwlock_rdlock (&(p->loch)) ? IER(635) : 0) ? (p->parted = MUGGLE(6)) : 0)
+  if ((pthread_rwlock_rdlock (&(p->loch)) ? IER(666) : 0) ? (p->parted = MUGGLE(6)) : 0)
 	 return NULL;
   while (i->superclass)
 	 i = i->superclass;
-  if ((pthread_rwlock_unlock (&(p->loch)) ? IER(636) : 0) ? (p->parted = MUGGLE(7)) : 0)
+  if ((pthread_rwlock_unlock (&(p->loch)) ? IER(667) : 0) ? (p->parted = MUGGLE(7)) : 0)
 	 return NULL;
   return i;
 }
@@ -490,7 +490,7 @@ cru_united (p, x, y, err)
 	 return 0;
   if ((p->parted == PARTITION_MAGIC) ? 0 : RAISE(CRU_BADPRT))
 	 return 0;
-  if ((pthread_rwlock_wrlock (&(p->loch)) ? IER(637) : 0) ? (p->parted = MUGGLE(8)) : 0)
+  if ((pthread_rwlock_wrlock (&(p->loch)) ? IER(668) : 0) ? (p->parted = MUGGLE(8)) : 0)
 	 return 0;
   dblx = 0;
   for (xs = 0; ((x->classed != CLASS_MAGIC) ? ((dblx = CRU_BADCLS)) : 0) ? NULL : x->superclass; x = x->superclass)
@@ -512,7 +512,7 @@ cru_united (p, x, y, err)
 		y->superclass = x;
 	 }
  a: RAISE(dblx);
-  if ((pthread_rwlock_unlock (&(p->loch)) ? IER(638) : 0) ? (p->parted = MUGGLE(9)) : 0)
+  if ((pthread_rwlock_unlock (&(p->loch)) ? IER(669) : 0) ? (p->parted = MUGGLE(9)) : 0)
 	 return 0;
   return ! dblx;
 }
@@ -56,7 +56,7 @@ guard_it (n, c, visited, err)
   void *a;
   int ux;
 
-  if (*err ? 1 : (! n) ? IER(639) : (! c) ? IER(640) : ! _cru_set_membership (n, visited, err))
+  if (*err ? 1 : (! n) ? IER(670) : (! c) ? IER(671) : ! _cru_set_membership (n, visited, err))
 	 return;
   if ((g = (mapex_pair) _cru_malloc (sizeof (*g))) ? 0 : RAISE(ENOMEM))
 	 return;
@@ -94,7 +94,7 @@ free_props (n, c, visited, err)
   mapex_pair g;
   int ux;
 
-  if ((! c) ? IER(641) : (! visited) ? IER(642) : (! n) ? IER(643) : ! _cru_member (n, *visited))
+  if ((! c) ? IER(672) : (! visited) ? IER(673) : (! n) ? IER(674) : ! _cru_member (n, *visited))
 	 return;
   if (! (g = n->props))
 	 return;
@@ -140,11 +140,11 @@ guarding_task (source, err)
   sample = 0;
   seen = NULL;
   memset (&buffer, 0, sizeof (buffer));
-  if ((! source) ? IER(644) : (source->gruntled != PORT_MAGIC) ? IER(645) : 0)
+  if ((! source) ? IER(675) : (source->gruntled != PORT_MAGIC) ? IER(676) : 0)
 	 return NULL;
-  if ((! (r = source->local)) ? IER(646) : (r->valid != ROUTER_MAGIC) ? IER(647) : 0)
+  if ((! (r = source->local)) ? IER(677) : (r->valid != ROUTER_MAGIC) ? IER(678) : 0)
 	 return NULL;
-  if ((! (d = source->peers)) ? IER(648) : (r->tag != COM) ? IER(649) : 0)
+  if ((! (d = source->peers)) ? IER(679) : (r->tag != COM) ? IER(680) : 0)
 	 return _cru_abort_status (source, d, err);
   _cru_set_storage (r->ro_store, err);
   _cru_set_kill_switch (&(r->killed), err);
@@ -152,7 +152,7 @@ guarding_task (source, err)
 	 {
 		KILL_SITE(3);
 		killed = (killed ? 1 : KILLED);
-		if ((n = (node_list) incoming->payload) ? RECORDED(n) : IER(650))
+		if ((n = (node_list) incoming->payload) ? RECORDED(n) : IER(681))
 		  goto a;
 		if (*err ? 0 : killed ? 0 : _cru_scattered (n->edges_out, d, err))
 		  goto b;
@@ -214,9 +214,9 @@ compose (l, n, c, g, f, b, z, err)
   edge_list e;
   mapex_pair r;
 
-  if ((! n) ? IER(651) : (! c) ? IER(652) : ! g)
+  if ((! n) ? IER(682) : (! c) ? IER(683) : ! g)
 	 return;
-  if ((! (c->labeler.qpred)) ? IER(653) : (! (c->labeler.qop)) ? IER(654) : 0)
+  if ((! (c->labeler.qpred)) ? IER(684) : (! (c->labeler.qop)) ? IER(685) : 0)
 	 return;
   for (e = n->edges_out; *err ? NULL : e; e = e->next_edge)
 	 if ((m = e->remote.node) ? (r = m->props) : NULL)
@@ -254,11 +254,11 @@ composing_task (s, err)
 
   sample = 0;
   killed = 0;
-  if ((! s) ? IER(655) : (s->gruntled != PORT_MAGIC) ? IER(656) : ! _cru_pingback (s, err))
+  if ((! s) ? IER(686) : (s->gruntled != PORT_MAGIC) ? IER(687) : ! _cru_pingback (s, err))
 	 return NULL;
-  if ((! (r = s->local)) ? IER(657) : (r->valid != ROUTER_MAGIC) ? IER(658) : (! (r->ports)) ? IER(659) : 0)
+  if ((! (r = s->local)) ? IER(688) : (r->valid != ROUTER_MAGIC) ? IER(689) : (! (r->ports)) ? IER(690) : 0)
 	 return NULL;
-  if ((r->tag != COM) ? IER(660) : (! (r->lanes)) ? IER(661) : (s->own_index >= r->lanes) ? IER(662) : 0)
+  if ((r->tag != COM) ? IER(691) : (! (r->lanes)) ? IER(692) : (s->own_index >= r->lanes) ? IER(693) : 0)
 	 return _cru_abort (s, NO_POD, err);
   n = s->survivors;
   c = &(r->composer);
@@ -266,7 +266,7 @@ composing_task (s, err)
 	 {
 		KILL_SITE(4);
 		killed = (killed ? 1 : KILLED);
-		if (killed ? 1 : *err ? 1 : n->edges_by ? IER(663) : 0)
+		if (killed ? 1 : *err ? 1 : n->edges_by ? IER(694) : 0)
 		  continue;
 		b = NULL;
 		for (e = n->edges_out; *err ? NULL : e; e = e->next_edge)
@@ -296,7 +296,7 @@ bypassed (n, o, d, err)
   mapex_pair p;
   uintptr_t before, after;
 
-  if ((! n) ? IER(664) : (! o) ? IER(665) : ! (p = n->props))
+  if ((! n) ? IER(695) : (! o) ? IER(696) : ! (p = n->props))
 	 return 0;
   before = _cru_degree (n->edges_out);
   n->edges_out = _cru_cat_edges (n->edges_out, n->edges_by);
@@ -333,7 +333,7 @@ decompose (n, c, visited, z, err)
 {
   node_list t;
 
-  if ((! z) ? IER(666) : n ? 0 : IER(667))
+  if ((! z) ? IER(697) : n ? 0 : IER(698))
 	 return;
   for (t = *n; t; t = t->next_node)
 	 {
@@ -374,11 +374,11 @@ bypassing_task (s, err)
   sample = 0;
   killed = 0;
   changed = 0;
-  if ((! s) ? IER(668) : (s->gruntled != PORT_MAGIC) ? IER(669) : ! _cru_pingback (s, err))
+  if ((! s) ? IER(699) : (s->gruntled != PORT_MAGIC) ? IER(700) : ! _cru_pingback (s, err))
 	 return NULL;
-  if ((! (r = s->local)) ? IER(670) : (r->valid != ROUTER_MAGIC) ? IER(671) : 0)
+  if ((! (r = s->local)) ? IER(701) : (r->valid != ROUTER_MAGIC) ? IER(702) : 0)
 	 return NULL;
-  if ((r->tag != COM) ? IER(672) : 0)
+  if ((r->tag != COM) ? IER(703) : 0)
 	 return NULL;
   for (n = s->survivors; n; n = n->next_node)
 	 {
@@ -424,7 +424,7 @@ _cru_composed (g, k, r, err)
   _cru_disable_killing (k, err);
   if (*err ? 1 : ! g)
 	 goto a;
-  if ((! r) ? IER(673) : (r->valid != ROUTER_MAGIC) ? IER(674) : (r->tag != COM) ? IER(675) : (! (r->ports)) ? IER(676) : 0)
+  if ((! r) ? IER(704) : (r->valid != ROUTER_MAGIC) ? IER(705) : (r->tag != COM) ? IER(706) : (! (r->ports)) ? IER(707) : 0)
 	 goto a;
   if (_cru_half_duplex (g, err))
 	 goto b;
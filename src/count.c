@@ -22,6 +22,7 @@
 #include "count.h"
 #include "edges.h"
 #include "errs.h"
+#include "graph.h"
 #include "killers.h"
 #include "launch.h"
 #include "nodes.h"
@@ -60,23 +61,23 @@ _cru_node_counting_task (s, err)
   count = 0;
   sample = 0;
   seen = NULL;
-  if ((! s) ? IER(691) : (s->gruntled != PORT_MAGIC) ? IER(692) : 0)
+  if ((! s) ? IER(722) : (s->gruntled != PORT_MAGIC) ? IER(723) : 0)
 	 return NULL;
-  if ((! (r = s->local)) ? IER(693) : (r->valid != ROUTER_MAGIC) ? IER(694) : 0)
+  if ((! (r = s->local)) ? IER(724) : (r->valid != ROUTER_MAGIC) ? IER(725) : 0)
 	 return NULL;
-  if (((d = s->peers)) ? 0 : IER(695))
+  if (((d = s->peers)) ? 0 : IER(726))
 	 return _cru_abort (s, d, err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (s, d, err));)
 	 {
 		KILL_SITE(6);
 		killed = (killed ? 1 : KILLED);
-		if ((n = (node_list) incoming->payload) ? (_cru_test_and_set_membership (n, &seen, err) ? 1 : *err) : IER(696))
+		if ((n = (node_list) incoming->payload) ? (_cru_test_and_set_membership (n, &seen, err) ? 1 : *err) : IER(727))
 		  goto a;
 		if (killed ? 1 : *err)
 		  goto a;
 		_cru_scatter_out (n, d, err);
 		if (! ++count)
-		  IER(697);
+		  IER(728);
 	 a: _cru_nack (_cru_popped_packet (&incoming, err), err);
 	 }
   _cru_forget_members (seen);
@@ -111,23 +112,23 @@ _cru_terminus_counting_task (s, err)
   count = 0;
   sample = 0;
   seen = NULL;
-  if ((! s) ? IER(698) : (s->gruntled != PORT_MAGIC) ? IER(699) : 0)
+  if ((! s) ? IER(729) : (s->gruntled != PORT_MAGIC) ? IER(730) : 0)
 	 return NULL;
-  if ((! (r = s->local)) ? IER(700) : (r->valid != ROUTER_MAGIC) ? IER(701) : 0)
+  if ((! (r = s->local)) ? IER(731) : (r->valid != ROUTER_MAGIC) ? IER(732) : 0)
 	 return NULL;
-  if (((d = s->peers)) ? 0 : IER(702))
+  if (((d = s->peers)) ? 0 : IER(733))
 	 return _cru_abort (s, d, err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (s, d, err));)
 	 {
 		KILL_SITE(7);
 		killed = (killed ? 1 : KILLED);
-		if ((n = (node_list) incoming->payload) ? (_cru_test_and_set_membership (n, &seen, err) ? 1 : *err) : IER(703))
+		if ((n = (node_list) incoming->payload) ? (_cru_test_and_set_membership (n, &seen, err) ? 1 : *err) : IER(734))
 		  goto a;
 		if (killed ? 1 : *err)
 		  goto a;
 		_cru_scatter_out (n, d, err);
 		if (n->edges_out ? 0 : ! ++count)
-		  IER(704);
+		  IER(735);
 	 a: _cru_nack (_cru_popped_packet (&incoming, err), err);
 	 }
   _cru_forget_members (seen);
@@ -166,24 +167,24 @@ _cru_edge_counting_task (s, err)
   sample = 0;
   killed = 0;
   seen = NULL;
-  if ((! s) ? IER(705) : (s->gruntled != PORT_MAGIC) ? IER(706) : 0)
+  if ((! s) ? IER(736) : (s->gruntled != PORT_MAGIC) ? IER(737) : 0)
 	 return NULL;
-  if ((! (r = s->local)) ? IER(707) : (r->valid != ROUTER_MAGIC) ? IER(708) : 0)
+  if ((! (r = s->local)) ? IER(738) : (r->valid != ROUTER_MAGIC) ? IER(739) : 0)
 	 return NULL;
-  if (((d = s->peers)) ? 0 : IER(709))
+  if (((d = s->peers)) ? 0 : IER(740))
 	 return _cru_abort (s, d, err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (s, d, err));)
 	 {
 		KILL_SITE(8);
 		killed = (killed ? 1 : KILLED);
-		if ((n = (node_list) incoming->payload) ? (_cru_test_and_set_membership (n, &seen, err) ? 1 : *err) : IER(710))
+		if ((n = (node_list) incoming->payload) ? (_cru_test_and_set_membership (n, &seen, err) ? 1 : *err) : IER(741))
 		  goto a;
 		if (killed ? 1 : *err)
 		  goto a;
 		_cru_scatter_out (n, d, err);
 		for (e = n->edges_out; e; e = e->next_edge)
 		  if (! ++count)
-			 IER(711);
+			 IER(742);
 	 a: _cru_nack (_cru_popped_packet (&incoming, err), err);
 	 }
   _cru_forget_members (seen);
@@ -217,3 +218,113 @@ _cru_counted (count, i, r, err)
 {
   return _cru_count_launched (UNKILLABLE, i, i, _cru_scalar_hash (i), r, count, err);
 }
+
+
+
+
+
+
+
+
+void
+_cru_tally (c, n)
+	  census c;
+	  node_list n;
+
+	  // Add the number of nodes, outgoing edges, and terminal nodes in
+	  // a node list to a census and mark all of them as counted.
+{
+  edge_list e;
+
+  if (! c)
+	 return;
+  for (; n; n = n->next_node)
+	 {
+		c->vertices++;
+		c->termini += ! (n->edges_out);
+		for (e = n->edges_out; e; e = e->next_edge)
+		  c->edges++;
+	 }
+  c->counted = ALL_COUNTED;
+}
+
+
+
+
+
+
+
+
+void
+_cru_gathered_census (r, c)
+	  router r;
+	  census c;
+
+	  // Total the cardinalities tallied by the workers on the ports of
+	  // a router after a build or a pruning pass, which are known only
+	  // if every worker tallied them.
+{
+  unsigned i;
+
+  memset (c, 0, sizeof (*c));
+  c->counted = ALL_COUNTED;
+  for (i = 0; i < r->lanes; i++)
+	 if (r->ports[i])
+		{
+		  c->vertices += r->ports[i]->tally.vertices;
+		  c->edges += r->ports[i]->tally.edges;
+		  c->termini += r->ports[i]->tally.termini;
+		  c->counted &= r->ports[i]->tally.counted;
+		}
+	 else
+		c->counted = 0;
+}
+
+
+
+
+
+
+
+
+int
+_cru_censused (g, flag, count)
+	  cru_graph g;
+	  int flag;
+	  uintptr_t *count;
+
+	  // Fetch a cardinality of a graph selected by a flag if it's
+	  // known. The flags are written only after the fields they
+	  // guard, so this can be done concurrently with other queries.
+{
+  if ((! g) ? 1 : (! count) ? 1 : ! (__atomic_load_n (&(g->g_census.counted), __ATOMIC_ACQUIRE) & flag))
+	 return 0;
+  *count = __atomic_load_n ((flag == VERTICES_COUNTED) ? &(g->g_census.vertices) : (flag == EDGES_COUNTED) ? &(g->g_census.edges) : &(g->g_census.termini), __ATOMIC_RELAXED);
+  return 1;
+}
+
+
+
+
+
+
+
+
+void
+_cru_census_taken (g, flag, count, err)
+	  cru_graph g;
+	  int flag;
+	  uintptr_t count;
+	  int *err;
+
+	  // Record a cardinality of a graph selected by a flag unless
+	  // there's an error, in which case it might be wrong. Concurrent
+	  // queries on the same graph may record the same value.
+{
+  if ((! g) ? 1 : *err)
+	 return;
+  if ((flag == VERTICES_COUNTED) ? 0 : (flag == EDGES_COUNTED) ? 0 : (flag == TERMINI_COUNTED) ? 0 : IER(743))
+	 return;
+  __atomic_store_n ((flag == VERTICES_COUNTED) ? &(g->g_census.vertices) : (flag == EDGES_COUNTED) ? &(g->g_census.edges) : &(g->g_census.termini), count, __ATOMIC_RELAXED);
+  __sync_fetch_and_or (&(g->g_census.counted), flag);
+}
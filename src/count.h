@@ -22,6 +22,26 @@
 #include "ptr.h"
 #include "route.h"
 
+// flags indicating which cardinalities in a census are known
+#define VERTICES_COUNTED 1
+#define EDGES_COUNTED 2
+#define TERMINI_COUNTED 4
+#define ALL_COUNTED (VERTICES_COUNTED | EDGES_COUNTED | TERMINI_COUNTED)
+
+// Graphs cache their cardinalities so that they needn't be counted
+// by a traversal each time they're queried. Builds tally them as they
+// go, and so do the pruning passes at the end of operations that
+// change them. Any other operation that could change them clears the
+// counted flags, and the next query recomputes and records them.
+
+struct census_s
+{
+  uintptr_t vertices;             // the number of nodes
+  uintptr_t edges;                // the number of outgoing edges from all nodes
+  uintptr_t termini;              // the number of nodes with no outgoing edges
+  int counted;                    // a combination of the above flags for whichever fields are valid
+};
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -43,6 +63,22 @@ _cru_edge_counting_task (port s, int *err);
 extern int
 _cru_counted (uintptr_t *count, node_list i, router r, int *err);
 
+// add the cardinalities of a node list to a census
+extern void
+_cru_tally (census c, node_list n);
+
+// total the cardinalities tallied by the workers of a router
+extern void
+_cru_gathered_census (router r, census c);
+
+// fetch a cardinality of a graph selected by a flag if it's known, returning non-zero if so
+extern int
+_cru_censused (cru_graph g, int flag, uintptr_t *count);
+
+// record a cardinality of a graph selected by a flag unless there's an error
+extern void
+_cru_census_taken (cru_graph g, int flag, uintptr_t count, int *err);
+
 #ifdef __cplusplus
 }
 #endif
@@ -86,12 +86,12 @@ _cru_open_crew (err)
 
   if (! _cru_error_checking_mutex_type (&a, err))
 	 goto a;
-  if (pthread_mutex_init (&crew_lock, &a) ? IER(712) : 0)
+  if (pthread_mutex_init (&crew_lock, &a) ? IER(744) : 0)
 	 {
 		pthread_mutexattr_destroy (&a);
 		goto a;
 	 }
-  if (! (pthread_mutexattr_destroy (&a) ? IER(713) : 0))
+  if (! (pthread_mutexattr_destroy (&a) ? IER(745) : 0))
 	 return 1;
   pthread_mutex_destroy (&crew_lock);
  a: return 0;
@@ -115,14 +115,14 @@ _cru_close_crew ()
   err = 0;
   for (c = reserve_crews; (t = ((c == NULL_CREW) ? NULL : c)); _cru_free (t))
 	 {
-		if (crew_count-- ? 0 : (err = THE_IER(714)))
+		if (crew_count-- ? 0 : (err = THE_IER(746)))
 		  break;
 		c = c->c_held;
 	 }
   if (err ? 0 : crew_count)
-	 err = THE_IER(715);
+	 err = THE_IER(747);
   if (pthread_mutex_destroy (&crew_lock) ? (! err) : 0)
-	 err = THE_IER(716);
+	 err = THE_IER(748);
   _cru_globally_throw (err);
 }
 
@@ -144,9 +144,9 @@ _cru_crew_of (err)
 {
   crew c;
 
-  if ((c = crew_of (err)) ? 1 : pthread_mutex_lock (&(crew_lock)) ? IER(717) : 0)
+  if ((c = crew_of (err)) ? 1 : pthread_mutex_lock (&(crew_lock)) ? IER(749) : 0)
 	 goto a;
-  if ((reserve_crews == NULL_CREW) ? 1 : crew_count ? 0 : IER(718))
+  if ((reserve_crews == NULL_CREW) ? 1 : crew_count ? 0 : IER(750))
 	 goto b;
   c = reserve_crews;
   reserve_crews = reserve_crews->c_held;
@@ -154,7 +154,7 @@ _cru_crew_of (err)
   c->created = 0;
   crew_count--;
  b: if (pthread_mutex_unlock (&crew_lock))
-	 IER(719);
+	 IER(751);
  a: return c;
 }
 
@@ -176,17 +176,17 @@ free_crew (c, err)
 
   if (! c)
 	 return;
-  if ((! (c->c_held)) ? 1 : pthread_mutex_lock (&crew_lock) ? IER(720) : 0)
+  if ((! (c->c_held)) ? 1 : pthread_mutex_lock (&crew_lock) ? IER(752) : 0)
 	 goto a;
-  if ((crew_count < RESERVE_CREW_LIMIT) ? 0 : pthread_mutex_unlock (&crew_lock) ? IER(721) : 1)
+  if ((crew_count < RESERVE_CREW_LIMIT) ? 0 : pthread_mutex_unlock (&crew_lock) ? IER(753) : 1)
 	 goto a;
   for (r = &reserve_crews; *r != NULL_CREW; r = &((*r)->c_held))
-	 if ((c == *r) ? IER(722) : *r ? 0 : IER(723))                  // check for a double-free
+	 if ((c == *r) ? IER(754) : *r ? 0 : IER(755))                  // check for a double-free
 		goto b;
   crew_count++;
   *r = c;
  b: if (pthread_mutex_unlock (&crew_lock))
-	 IER(724);
+	 IER(756);
   return;
  a: _cru_free (c);
 }
@@ -206,11 +206,11 @@ _cru_reserved_crews (err)
 {
   uintptr_t result;
 
-  if (pthread_mutex_lock (&crew_lock) ? IER(725) : 0)
+  if (pthread_mutex_lock (&crew_lock) ? IER(757) : 0)
 	 return 0;
   result = crew_count;
   if (pthread_mutex_unlock (&crew_lock))
-	 IER(726);
+	 IER(758);
   return result;
 }
 
@@ -229,7 +229,7 @@ _cru_replenish_crews (err)
   crew c;
   int dblx;
 
-  if (pthread_mutex_lock (&crew_lock) ? IER(727) : 0)
+  if (pthread_mutex_lock (&crew_lock) ? IER(759) : 0)
 	 return;
   for (dblx = 0; (crew_count < RESERVE_CREW_LIMIT) ? ((c = crew_of (&dblx))) : NULL; ++crew_count)
 	 {
@@ -238,7 +238,7 @@ _cru_replenish_crews (err)
 	 }
   RAISE(dblx);
   if (pthread_mutex_unlock (&crew_lock))
-	 IER(728);
+	 IER(760);
 }
 
 
@@ -258,7 +258,7 @@ _cru_crewed (c, m, r, err)
 	  router r;
 	  int *err;
 
-	  // Attempt to create a full crew of worker threads. If
+	  // Attempt to hire a full crew of pooled worker threads. If
 	  // successful, the crew will be left waiting for its first
 	  // packet. If unsuccessful, any partial crew will have been
 	  // instructed to exit and wait only for synchronization.
@@ -266,19 +266,19 @@ _cru_crewed (c, m, r, err)
   int dblx;
 
   dblx = 0;
-  if ((! r) ? IER(729) : (! c) ? IER(730) : (r->valid != ROUTER_MAGIC) ? IER(731) : (! (r->threads)) ? IER(732) : 0)
+  if ((! r) ? IER(761) : (! c) ? IER(762) : (r->valid != ROUTER_MAGIC) ? IER(763) : (! (r->threads)) ? IER(764) : 0)
 	 goto a;
-  if ((r->ports ? 0 : IER(733)) ? (r->valid = MUGGLE(10)) : (r->threads ? 0 : IER(734)) ? (r->valid = MUGGLE(11)) : 0)
+  if ((r->ports ? 0 : IER(765)) ? (r->valid = MUGGLE(10)) : (r->threads ? 0 : IER(766)) ? (r->valid = MUGGLE(11)) : 0)
 	 goto a;
-  if ((pthread_mutex_lock (&(r->lock)) ? IER(735) : 0) ? (r->valid = MUGGLE(12)) : 0)
+  if ((pthread_mutex_lock (&(r->lock)) ? IER(767) : 0) ? (r->valid = MUGGLE(12)) : 0)
 	 goto a;
   c->bays = r->lanes;
   c->ids = r->threads;
   for (c->created = 0; dblx ? 0 : (c->created < c->bays); (c->created)++)
-	 if (_cru_create (&(c->ids[c->created]), m, r->ports[c->created], &dblx))
+	 if (_cru_hired (&(c->ids[c->created]), m, r->ports[c->created], &dblx))
 		break;
   r->running = c->created;
-  if ((pthread_mutex_unlock (&(r->lock)) ? IER(736) : 0) ? (r->valid = MUGGLE(13)) : ! (c->created))
+  if ((pthread_mutex_unlock (&(r->lock)) ? IER(768) : 0) ? (r->valid = MUGGLE(13)) : ! (c->created))
 	 goto a;
   _cru_wait_for_quiescence (UNKILLABLE, r, &dblx);  // let all workers block waiting for their first packet
   if (c->created == r->lanes)                       // if there's a full crew, don't finish the job before it starts
@@ -316,10 +316,10 @@ _cru_status_disjunction (c, err)
   int disjunction;
 
   disjunction = 0;
-  if ((! c) ? 1 : (c->bays < c->created) ? IER(737) : (! (c->ids)) ? IER(738) : 0)
+  if ((! c) ? 1 : (c->bays < c->created) ? IER(769) : (! (c->ids)) ? IER(770) : 0)
 	 return *err;
   for (i = 0; i < c->created; i++)
-	 if (pthread_join (c->ids[i], (void **) &status) ? (! IER(739)) : 1)
+	 if (_cru_join (c->ids[i], (void **) &status, err) ? 0 : 1)
 		{
 		  disjunction = (status ? 1 : disjunction);
 		  RAISE((int) status);
@@ -346,10 +346,10 @@ _cru_summation (c, err)
 {
   uintptr_t sum, n, i;
 
-  if ((! c) ? 1 : (c->bays < c->created) ? IER(740) : (! (c->ids)) ? IER(741) : 0)
+  if ((! c) ? 1 : (c->bays < c->created) ? IER(771) : (! (c->ids)) ? IER(772) : 0)
 	 return 0;
   for (sum = i = 0; i < c->created; i++)
-	 if (pthread_join (c->ids[i], (void **) &n) ? (! IER(742)) : 1)
+	 if (_cru_join (c->ids[i], (void **) &n, err) ? 0 : 1)
 		sum += n;
   free_crew (c, err);
   return sum;
@@ -382,15 +382,15 @@ _cru_node_union (c, base_bay, base, err)
   q = NULL;
   if (base)
 	 *base = NULL;
-  if ((! c) ? 1 : (c->bays < c->created) ? IER(743) : c->ids ? 0 : IER(744))
+  if ((! c) ? 1 : (c->bays < c->created) ? IER(773) : c->ids ? 0 : IER(774))
 	 goto a;
   hit = 0;
   for (i = 0; i < c->created; i++)
 	 {
-		if (pthread_join (c->ids[i], (void **) &r) ? IER(745) : ! r)
+		if (_cru_join (c->ids[i], (void **) &r, err) ? 1 : ! r)
 		  continue;
 		if (base ? (r->basic ? 1 : (i == base_bay)) : 0)
-		  if (hit ? IER(746) : ++hit)
+		  if (hit ? IER(775) : ++hit)
 			 *base = r->front;
 		_cru_append_nodes (&q, r, err);
  	 }
@@ -419,13 +419,13 @@ _cru_maybe_disjunction (c, result, err)
 
   if (result)
 	 *result = NULL;
-  if ((! c) ? 1 : (c->bays < c->created) ? IER(747) : (! (c->ids)) ? IER(748) : (any = 0))
+  if ((! c) ? 1 : (c->bays < c->created) ? IER(776) : (! (c->ids)) ? IER(777) : (any = 0))
 	 return;
   x = NULL;
   for (i = 0; i < c->created; i++)
-	 if (pthread_join (c->ids[i], (void **) &x) ? (! IER(749)) : ! ! x)
+	 if (_cru_join (c->ids[i], (void **) &x, err) ? 0 : ! ! x)
 		{
-		  if (x->extant ? (result ? (any ? (! IER(750)) : ++any) : ! IER(751)) : 0)
+		  if (x->extant ? (result ? (any ? (! IER(778)) : ++any) : ! IER(779)) : 0)
 			 *result = x->value;
 		  RAISE(x->ma_status);
 		  _cru_free_maybe (x, NO_DESTRUCTOR, err);
@@ -463,9 +463,9 @@ _cru_maybe_reduction (c, m, result, s, err)
   next_worker = 0;
   if (result)
 	 *result = NULL;
-  if ((! m) ? IER(752) : (! c) ? 1 : (c->bays < c->created) ? IER(753) : c->ids ? 0 : IER(754))
+  if ((! m) ? IER(780) : (! c) ? 1 : (c->bays < c->created) ? IER(781) : c->ids ? 0 : IER(782))
 	 return;
-  if (((d = m->m_free) != m->r_free) ? IER(755) : 0)
+  if (((d = m->m_free) != m->r_free) ? IER(783) : 0)
 	 return;
   if ((! (c->created)) ? 1 : NOMEM ? 1 : ! nthm_enter_scope (err))
 	 goto a;
@@ -482,7 +482,7 @@ _cru_maybe_reduction (c, m, result, s, err)
 		  if (NOMEM ? 1 : ! nthm_open ((nthm_worker) _cru_maybe_fused, z, err))
 			 _cru_free_maybe_pair (z, err);
 	 }
-  if (*err ? 1 : (! (x ? x->extant : 0)) ? 1 : result ? 0 : IER(756))
+  if (*err ? 1 : (! (x ? x->extant : 0)) ? 1 : result ? 0 : IER(784))
 	 goto b;
   *err = x->ma_status;
   *result = x->value;
@@ -492,7 +492,7 @@ _cru_maybe_reduction (c, m, result, s, err)
 	 _cru_free_maybe ((maybe) nthm_read (p, err), d, err);          // should never happen unless there was an error
   nthm_exit_scope (err);
  a: for (; next_worker < c->created; next_worker++)
-	 if (! pthread_join (c->ids[next_worker], (void **) &x))
+	 if (! _cru_join (c->ids[next_worker], (void **) &x, err))
 		_cru_free_maybe (x, d, err);                                 // should never happen unless there was a worse error
   free_crew (c, err);
 }
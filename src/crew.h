@@ -32,7 +32,7 @@ struct crew_s
   unsigned bays;         // the maximum number of threads that can be on this crew
   unsigned created;      // the number of threads actually on it
   crew c_held;           // non-null means this crew is among those normally held in reserve for heap overflows
-  pthread_t *ids;        // the thread identifiers
+  hand *ids;             // the pooled threads
 };
 
 #ifdef __cplusplus
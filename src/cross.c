@@ -78,7 +78,7 @@ product_of (l, r, err)
 {
   product result;
 
-  if (*err ? 1 : (! l) ? IER(757) : (! r) ? IER(758) : 0)
+  if (*err ? 1 : (! l) ? IER(785) : (! r) ? IER(786) : 0)
 	 return NULL;
   if ((result = (product) _cru_malloc (sizeof (*result))) ? 0 : RAISE(ENOMEM))
 	 return NULL;
@@ -148,7 +148,7 @@ free_productive_packets (p, z, err)
 {
   packet_list o;
 
-  if (z ? 0 : IER(759))
+  if (z ? 0 : IER(787))
 	 return;
   for (o = p; o; o = o->next_packet)
 	 {
@@ -185,9 +185,9 @@ productive_packets_of (i, x, err)
   void *ua;
 
   result = NULL;
-  if ((! i) ? IER(760) : (! x) ? IER(761) : (! (x->e_prod.bop)) ? IER(762) : 0)
+  if ((! i) ? IER(788) : (! x) ? IER(789) : (! (x->e_prod.bop)) ? IER(790) : 0)
 	 return NULL;
-  if ((! (x->e_prod.bpred)) ? IER(763) : (! (i->multiplicand)) ? IER(764) : (! (i->multiplier)) ? IER(765) :  0)
+  if ((! (x->e_prod.bpred)) ? IER(791) : (! (i->multiplicand)) ? IER(792) : (! (i->multiplier)) ? IER(793) :  0)
 	 return NULL;
   for (l = i->multiplicand->edges_out; *err ? NULL : l; l = l->next_edge)
 	 for (r = i->multiplier->edges_out; *err ? NULL : r; r = r->next_edge)
@@ -240,10 +240,10 @@ reach_extant_node (i, c, d, err)
 	  // the graph recorded in a packet c, and connect its sender to
 	  // the latter.
 {
-  if ((! i) ? IER(766) : (! *i) ? IER(767) : (! ((*i)->payload)) ? IER(768) : 0)
+  if ((! i) ? IER(794) : (! *i) ? IER(795) : (! ((*i)->payload)) ? IER(796) : 0)
 	 goto a;
   _cru_free ((product) (*i)->payload);
-  if ((! c) ? IER(769) : (!((*i)->carrier)) ? IER(770) : 0)
+  if ((! c) ? IER(797) : (!((*i)->carrier)) ? IER(798) : 0)
 	 goto a;
   (*i)->carrier->remote.node = c->receiver;                           // overwrite a vertex field with a node field
  a: _cru_nack (_cru_popped_packet (i, err), err);
@@ -279,11 +279,11 @@ reached_new_node (i, x, q, d, err)
   int ux;
   void *ua;
 
-  if ((! i) ? IER(771) : (! *i) ? IER(772) : (! (l = (product) (*i)->payload)) ? IER(773) : 0)
+  if ((! i) ? IER(799) : (! *i) ? IER(800) : (! (l = (product) (*i)->payload)) ? IER(801) : 0)
 	 goto a;
-  if ((! (l->multiplicand)) ? IER(774) : (! (l->multiplier)) ? IER(775) : 0)
+  if ((! (l->multiplicand)) ? IER(802) : (! (l->multiplier)) ? IER(803) : 0)
 	 goto a;
-  if ((! x) ? IER(776) : (! (x->v_prod)) ? IER(777) : 0)
+  if ((! x) ? IER(804) : (! (x->v_prod)) ? IER(805) : 0)
 	 goto a;
   p = productive_packets_of (l, x, err);
   if (*err)
@@ -324,13 +324,11 @@ _cru_crossing_task (source, err)
 	  // and send them to other workers.
 {
 #define UNEQUAL(a,b) \
-(*err ? 0 : (! (a)) ? (! IER(778)) : (! (b)) ? (! IER(779)) : \
+(*err ? 0 : (! (a)) ? (! IER(806)) : (! (b)) ? (! IER(807)) : \
 ((a)->multiplicand != (b)->multiplicand) ? 1 : ((a)->multiplier != (b)->multiplier))
 
   packet_table collisions;    // previous incoming packets
   packet_list incoming;
-  uintptr_t limit;            // maximum number of vertices allowed to be created by this worker
-  uintptr_t count;            // number of vertices created by this worker
   unsigned sample;
   packet_list *c;
   cru_crosser x;
@@ -343,28 +341,25 @@ _cru_crossing_task (source, err)
 
   q = NULL;
   d = NULL;
-  count = 0;
   sample = 0;
   killed = 0;
   collisions = NULL;
-  if ((! source) ? IER(780) : (source->gruntled != PORT_MAGIC) ? IER(781) : 0)
+  if ((! source) ? IER(808) : (source->gruntled != PORT_MAGIC) ? IER(809) : 0)
 	 return NULL;
-  if ((!(r = source->local)) ? IER(782) : (r->valid != ROUTER_MAGIC) ? IER(783) : 0)
+  if ((!(r = source->local)) ? IER(810) : (r->valid != ROUTER_MAGIC) ? IER(811) : 0)
 	 return NULL;
   x = &(r->crosser);
-  if ((!(d = source->peers)) ? IER(784) : (r->tag != CRO) ? IER(785) : ! (s = &(x->cr_sig)))
+  if ((!(d = source->peers)) ? IER(812) : (r->tag != CRO) ? IER(813) : ! (s = &(x->cr_sig)))
 	 goto a;
-  if ((s->orders.v_order.equal) ? 0 : IER(786))
+  if ((s->orders.v_order.equal) ? 0 : IER(814))
 	 goto a;
   _cru_set_storage (r->ro_store, err);
   _cru_set_kill_switch (&(r->killed), err);
-  limit = x->cr_sig.vertex_limit / r->lanes;
-  limit = (limit ? limit : x->cr_sig.vertex_limit ? 1 : 0);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
 		KILL_SITE(9);
 		killed = (killed ? 1 : KILLED);
-		if (*err ? 1 : killed ? 1 : incoming->payload ? 0 : IER(787))
+		if (*err ? 1 : killed ? 1 : incoming->payload ? 0 : IER(815))
 		  goto b;
 		if (! (c = _cru_collision (incoming->hash_value, &collisions, err)))
 		  goto b;
@@ -375,7 +370,7 @@ _cru_crossing_task (source, err)
 		  goto b;
 		if (*c ? (! unequal) : 0)
 		  reach_extant_node (&incoming, *c, d, err);
-		else if (limit ? (count++ < limit) : 1)
+		else if (BUDGETED(s->vertex_limit, r))
 		  _cru_push_packet (reached_new_node (&incoming, x, &q, d, err), *c ? &((*c)->next_packet) : c, err);
 		else 
 		  RAISE(CRU_INTOVF);
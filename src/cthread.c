@@ -17,8 +17,11 @@
 */
 
 #include <errno.h>
+#include <stdlib.h>
+#include <string.h>
 #include "cthread.h"
 #include "errs.h"
+#include "getset.h"
 #include "repl.h"
 #include "wrap.h"
 
@@ -35,6 +38,19 @@ static pthread_attr_t thread_attribute;
 // created mutexes have these attributes
 static pthread_mutexattr_t mutex_attribute;
 
+// the maximum number of idle threads parked in the pool; more are
+// released when they finish their jobs
+#define IDLE_HAND_LIMIT 0x100
+
+// threads parked in the pool waiting to be hired
+static hand idle_hands = NULL;
+
+// the number of them
+static uintptr_t idle_count = 0;
+
+// for exclusive access to the pool
+static pthread_mutex_t pool_lock;
+
 
 
 // --------------- initialization --------------------------------------------------------------------------
@@ -53,7 +69,7 @@ thread_type (a, err)
 
 	  // Initialize the attributes for all created threads.
 {
-  return ! ((! a) ? IER(788) : pthread_attr_init (a) ? IER(789) : 0);
+  return ! ((! a) ? IER(816) : pthread_attr_init (a) ? IER(817) : 0);
 }
 
 
@@ -75,10 +91,13 @@ _cru_open_cthread (err)
   if (! _cru_error_checking_mutex_type (&mutex_attribute, err))
 	 return 0;
   for (i = 0; i < LOCK_POOL_SIZE; i++)
-	 if (pthread_rwlock_init (&(lock_pool[i]), NULL) ? IER(790) : 0)
+	 if (pthread_rwlock_init (&(lock_pool[i]), NULL) ? IER(818) : 0)
 		goto a;
+  if (pthread_mutex_init (&pool_lock, &mutex_attribute) ? IER(819) : 0)
+	 goto a;
   if (thread_type (&thread_attribute, err))
 	 return 1;
+  pthread_mutex_destroy (&pool_lock);
  a: pthread_mutexattr_destroy (&mutex_attribute);
   while (i--)
 	 pthread_rwlock_destroy (&(lock_pool[i]));
@@ -95,6 +114,36 @@ _cru_open_cthread (err)
 
 
 
+static void
+free_hand (h, err)
+	  hand h;
+	  int *err;
+
+	  // Release an idle pooled thread, wait for it to exit, and free
+	  // the hand.
+{
+  if (! h)
+	 return;
+  if (pthread_mutex_lock (&(h->h_lock)) ? IER(820) : 0)
+	 return;
+  h->released = 1;
+  if (pthread_cond_signal (&(h->h_assigned)))
+	 IER(821);
+  if (pthread_mutex_unlock (&(h->h_lock)) ? IER(822) : pthread_join (h->id, NULL) ? IER(823) : 0)
+	 return;
+  if (pthread_cond_destroy (&(h->h_finished)))
+	 IER(824);
+  if (pthread_cond_destroy (&(h->h_assigned)))
+	 IER(825);
+  if (pthread_mutex_destroy (&(h->h_lock)))
+	 IER(826);
+  _cru_free (h);
+}
+
+
+
+
+
 
 
 
@@ -106,14 +155,26 @@ release_pthread_resources (err)
 	  // Release pthread related resources.
 {
   unsigned i;
-
+  hand h;
+
+  while ((h = idle_hands))
+	 {
+		idle_hands = h->h_idle;
+		if (idle_count-- ? 0 : IER(827))
+		  break;
+		free_hand (h, err);
+	 }
+  if (*err ? 0 : idle_count)
+	 IER(828);
+  if (pthread_mutex_destroy (&pool_lock))
+	 IER(829);
   if (pthread_mutexattr_destroy (&mutex_attribute))
-	 IER(791);
+	 IER(830);
   if (pthread_attr_destroy (&thread_attribute))
-	 IER(792);
+	 IER(831);
   for (i = 0; i < LOCK_POOL_SIZE; i++)
 	 if (pthread_rwlock_destroy (&(lock_pool[i])))
-		IER(793);
+		IER(832);
 }
 
 
@@ -145,25 +206,201 @@ _cru_close_cthread ()
 
 
 
+static void *
+parked (h)
+	  hand h;
+
+	  // Run each job assigned to a hand and wait for the next one
+	  // until the hand is released. Jobs are assigned only to idle
+	  // hands, and the outcome of each job stays with the hand until
+	  // the supervising thread joins with it.
+{
+  void *outcome;
+  runner job;
+  int err;
+
+  err = 0;
+  if (pthread_mutex_lock (&(h->h_lock)) ? (err = THE_IER(833)) : 0)
+	 goto a;
+  while (! (h->released))
+	 {
+		if (! (job = h->job))
+		  {
+			 if (pthread_cond_wait (&(h->h_assigned), &(h->h_lock)) ? (err = THE_IER(834)) : 0)
+				break;
+			 continue;
+		  }
+		if (pthread_mutex_unlock (&(h->h_lock)) ? (err = THE_IER(835)) : 0)
+		  goto a;
+		outcome = (job) (h->job_port);
+		_cru_clear_specifics (&err);
+		if (pthread_mutex_lock (&(h->h_lock)) ? (err = (err ? err : THE_IER(836))) : 0)
+		  goto a;
+		h->outcome = outcome;
+		h->job = NULL;
+		h->done = 1;
+		if (pthread_cond_signal (&(h->h_finished)) ? (err = (err ? err : THE_IER(837))) : 0)
+		  break;
+	 }
+  if (pthread_mutex_unlock (&(h->h_lock)) ? (! err) : 0)
+	 err = THE_IER(838);
+ a: _cru_globally_throw (err);
+  return NULL;
+}
+
+
+
+
+
+
+
+static hand
+new_hand (err)
+	  int *err;
+
+	  // Create a hand with a newly created thread parked on it
+	  // using the attributes defined in thread_attribute. Allow
+	  // simulation of memory errors during testing.
+{
+  hand h;
+  int e;
+
+  if ((h = (hand) _cru_malloc (sizeof (*h))) ? 0 : RAISE(ENOMEM))
+	 return NULL;
+  memset (h, 0, sizeof (*h));
+  if (_cru_mutex_init (&(h->h_lock), err))
+	 goto a;
+  if (_cru_cond_init (&(h->h_assigned), err))
+	 goto b;
+  if (_cru_cond_init (&(h->h_finished), err))
+	 goto c;
+  if (NOMEM)
+	 goto d;
+  if (! (e = pthread_create (&(h->id), &thread_attribute, (void *(*) (void *)) parked, (void *) h)))
+	 return h;
+  RAISE((e == ENOMEM) ? e : (e == EAGAIN) ? e : (e == EPERM) ? e : THE_IER(839));
+ d: pthread_cond_destroy (&(h->h_finished));
+ c: pthread_cond_destroy (&(h->h_assigned));
+ b: pthread_mutex_destroy (&(h->h_lock));
+ a: _cru_free (h);
+  return NULL;
+}
+
+
+
+
+
+
+
+static void
+retire (h, err)
+	  hand h;
+	  int *err;
+
+	  // Park a hand in the pool after its job is joined unless the
+	  // pool is full, in which case release it.
+{
+  if (pthread_mutex_lock (&pool_lock) ? IER(840) : 0)
+	 return;
+  if ((idle_count < IDLE_HAND_LIMIT) ? ++idle_count : 0)
+	 {
+		h->h_idle = idle_hands;
+		idle_hands = h;
+		h = NULL;
+	 }
+  if (pthread_mutex_unlock (&pool_lock))
+	 IER(841);
+  free_hand (h, err);
+}
+
+
+
+
+
+
 int
-_cru_create (id, start_routine, arg, err)
-	  pthread_t *id;
+_cru_hired (h, start_routine, arg, err)
+	  hand *h;
 	  runner start_routine;
 	  port arg;
 	  int *err;
 
-	  // Create a thread with attributes defined in
-	  // thread_attribute. Allow simulation of memory errors during
-	  // testing.
+	  // Assign a job to an idle thread from the pool, or to a newly
+	  // created one if none is idle. Allow simulation of memory errors
+	  // during testing.
 {
-  int e;
-
-  if ((! id) ? IER(794) : (! start_routine) ? IER(795) : NOMEM)
+  if ((! h) ? IER(842) : (*h = NULL) ? 1 : (! start_routine) ? IER(843) : NOMEM)
+	 return *err;
+  if (pthread_mutex_lock (&pool_lock) ? IER(844) : 0)
+	 return *err;
+  if ((*h = idle_hands) ? (idle_count-- ? 0 : IER(845)) : 0)
+	 *h = NULL;
+  else if (*h)
+	 idle_hands = (*h)->h_idle;
+  if ((pthread_mutex_unlock (&pool_lock) ? IER(846) : 0) ? 1 : *h ? 0 : ! (*h = new_hand (err)))
+	 return *err;
+  if (pthread_mutex_lock (&((*h)->h_lock)) ? IER(847) : 0)
 	 return *err;
-  if (! (e = pthread_create (id, &thread_attribute, (void *(*) (void *)) start_routine, (void *) arg)))
+  (*h)->h_idle = NULL;
+  (*h)->job = start_routine;
+  (*h)->job_port = arg;
+  if (pthread_cond_signal (&((*h)->h_assigned)))
+	 IER(848);
+  if (pthread_mutex_unlock (&((*h)->h_lock)))
+	 IER(849);
+  return *err;
+}
+
+
+
+
+
+
+
+int
+_cru_join (h, result, err)
+	  hand h;
+	  void **result;
+	  int *err;
+
+	  // Wait for a hired thread to finish its job, assign its result,
+	  // and return the thread to the pool. Return zero if successful.
+{
+  int joined;
+
+  if ((! h) ? IER(850) : pthread_mutex_lock (&(h->h_lock)) ? IER(851) : 0)
+	 return 1;
+  while (h->done ? 0 : pthread_cond_wait (&(h->h_finished), &(h->h_lock)) ? (! IER(852)) : 1);
+  if ((joined = h->done) ? ! ! result : 0)
+	 *result = h->outcome;
+  h->outcome = NULL;
+  h->done = 0;
+  if (pthread_mutex_unlock (&(h->h_lock)) ? IER(853) : ! joined)
+	 return 1;
+  retire (h, err);
+  return 0;
+}
+
+
+
+
+
+
+
+uintptr_t
+_cru_pooled_hands (err)
+	  int *err;
+
+	  // Return the number of idle threads parked in the pool.
+{
+  uintptr_t result;
+
+  if (pthread_mutex_lock (&pool_lock) ? IER(854) : 0)
 	 return 0;
-  RAISE((e == ENOMEM) ? e : (e == EAGAIN) ? e : (e == EPERM) ? e : THE_IER(796));
-  return e;
+  result = idle_count;
+  if (pthread_mutex_unlock (&pool_lock))
+	 IER(855);
+  return result;
 }
 
 
@@ -188,7 +425,7 @@ _cru_mutex_init (m, err)
 	 return *err;
   if (! (e = pthread_mutex_init (m, &mutex_attribute)))
 	 return 0;
-  RAISE((e == ENOMEM) ? e : (e == EAGAIN) ? e : (e == EPERM) ? e : THE_IER(797));
+  RAISE((e == ENOMEM) ? e : (e == EAGAIN) ? e : (e == EPERM) ? e : THE_IER(856));
   return e;
 }
 
@@ -216,7 +453,7 @@ _cru_cond_init (c, err)
 	 return *err;
   if (! (e = pthread_cond_init (c, NULL)))
 	 return 0;
-  RAISE((e == ENOMEM) ? e : (e == EAGAIN) ? e : THE_IER(798));
+  RAISE((e == ENOMEM) ? e : (e == EAGAIN) ? e : THE_IER(857));
   return e;
 }
 
@@ -247,10 +484,10 @@ _cru_read (v, err)
   void *x;
   uintptr_t i;
 
-  if ((! v) ? IER(799) : pthread_rwlock_rdlock (&(lock_pool[i = (_cru_scalar_hash (v) % LOCK_POOL_SIZE)])) ? IER(800) : 0)
+  if ((! v) ? IER(858) : pthread_rwlock_rdlock (&(lock_pool[i = (_cru_scalar_hash (v) % LOCK_POOL_SIZE)])) ? IER(859) : 0)
 	 return NULL;
   x = *v;
-  return ((pthread_rwlock_unlock (&(lock_pool[i])) ? IER(801) : 0) ? NULL : x);
+  return ((pthread_rwlock_unlock (&(lock_pool[i])) ? IER(860) : 0) ? NULL : x);
 }
 
 
@@ -268,11 +505,11 @@ _cru_write (v, x, err)
 {
   uintptr_t i;
 
-  if ((! v) ? IER(802) : pthread_rwlock_wrlock (&(lock_pool[i = ((_cru_scalar_hash (v)) % LOCK_POOL_SIZE)])) ? IER(803) : 0)
+  if ((! v) ? IER(861) : pthread_rwlock_wrlock (&(lock_pool[i = ((_cru_scalar_hash (v)) % LOCK_POOL_SIZE)])) ? IER(862) : 0)
 	 return;
   *v = x;
   if (pthread_rwlock_unlock (&(lock_pool[i])))
-	 IER(804);
+	 IER(863);
 }
 
 
@@ -286,10 +523,10 @@ _cru_lock_for_writing (v, err)
 
 	  // Begin a critical section of write operations that will end with a write to v.
 {
-  if ((! v) ? IER(805) : 0)
+  if ((! v) ? IER(864) : 0)
 	 return;
   if (pthread_rwlock_wrlock (&(lock_pool[_cru_scalar_hash (v) % LOCK_POOL_SIZE])))
-	 IER(806);
+	 IER(865);
 }
 
 
@@ -305,11 +542,11 @@ _cru_unlock_for_reading (v, x, err)
 
 	  // End a critical section of write operations with a write to v.
 {
-  if ((! v) ? IER(807) : 0)
+  if ((! v) ? IER(866) : 0)
 	 return;
   *v = x;
   if (pthread_rwlock_unlock (&(lock_pool[_cru_scalar_hash (v) % LOCK_POOL_SIZE])))
-	 IER(808);
+	 IER(867);
 }
 
 
@@ -328,10 +565,10 @@ _cru_set (lock, f, err)
 
 	  // Safely set a flag.
 {
-  if ((! f) ? IER(809) : *f ? IER(810) : pthread_rwlock_wrlock (lock) ? IER(811) : 0)
+  if ((! f) ? IER(868) : *f ? IER(869) : pthread_rwlock_wrlock (lock) ? IER(870) : 0)
 	 return;
   *f = 1;
   if (pthread_rwlock_unlock (lock))
-	 IER(812);
+	 IER(871);
 }
 
@@ -24,7 +24,27 @@
 #include "runners.h"
 
 // This file declares wrappers around pthread functions with
-// default attributes common to all cru library functions.
+// default attributes common to all cru library functions. Worker
+// threads are kept parked in a process-wide pool between jobs so
+// that short jobs don't pay for thread creation, and each is
+// reachable through a hand that the supervising thread hires for a
+// job and joins with afterwards.
+
+// a pooled worker thread and its current job
+
+struct hand_s
+{
+  pthread_t id;                // the thread permanently attached to this hand
+  pthread_mutex_t h_lock;      // for exclusive access to the remaining fields
+  pthread_cond_t h_assigned;   // signaled when a job is assigned or the hand is released
+  pthread_cond_t h_finished;   // signaled when the job is finished
+  runner job;                  // the runner for the current job if any
+  port job_port;               // the argument to the runner
+  void *outcome;               // the value returned by the runner
+  int done;                    // non-zero when the outcome is ready to be joined
+  int released;                // non-zero when the thread should exit
+  hand h_idle;                 // the next hand in the pool
+};
 
 #ifdef __cplusplus
 extern "C"
@@ -43,9 +63,17 @@ _cru_close_cthread (void);
 
 // --------------- pthread wrappers with specialized attributes and error codes ----------------------------
 
-// create a thread with default attributes
+// hire a pooled thread to run a job, creating one if none is idle
 extern int
-_cru_create (pthread_t *id, runner start_routine, port arg, int *err);
+_cru_hired (hand *h, runner start_routine, port arg, int *err);
+
+// wait for a hired thread to finish its job, get the result, and return it to the pool
+extern int
+_cru_join (hand h, void **result, int *err);
+
+// return the number of idle threads parked in the pool
+extern uintptr_t
+_cru_pooled_hands (int *err);
 
 // initialize a mutex with default attributes
 extern int
@@ -52,7 +52,7 @@ _cru_full_order (o, err)
 	  // Raise an error unless all fields in an order are already
 	  // defined.
 {
-  if (o ? 0 : IER(813))
+  if (o ? 0 : IER(872))
 	 return 0;
   if ((o->hash ? (o->hash == (cru_hash) _cru_undefined_hash) : 1) ? RAISE(CRU_UNDHSH) : 0)
 	 return 0;
@@ -136,7 +136,7 @@ _cru_allow_undefined_fold (f, err)
 
 	  // Assign functions to a fold not intended to be used.
 {
-  if (f ? 0 : IER(814))
+  if (f ? 0 : IER(873))
 	 return;
   if (! (f->m_free))
 	 ALLOW (f->map, (cru_top) _cru_undefined_top);
@@ -159,7 +159,7 @@ _cru_allow_undefined_order (o, err)
 
 	  // Assign order fields not intended to be used.
 {
-  if (o ? 0 : IER(815))
+  if (o ? 0 : IER(874))
 	 return;
   ALLOW (o->hash, (cru_hash) _cru_undefined_hash);
   ALLOW (o->equal, (cru_bpred) _cru_undefined_bpred);
@@ -178,7 +178,7 @@ _cru_allow_scalar_order (o, err)
 
 	  // Assign order fields suitable for endogenous operands.
 {
-  if (o ? 0 : IER(816))
+  if (o ? 0 : IER(875))
 	 return;
   ALLOW (o->hash, (cru_hash) _cru_scalar_hash);
   ALLOW (o->equal, (cru_bpred) _cru_equality_bpred);
@@ -197,7 +197,7 @@ _cru_allow_order (o, n, err)
 
 	  // Overwrite empty fields in o with corresponding fields in n.
 {
-  if ((! n) ? IER(817) : o ? 0 : IER(818))
+  if ((! n) ? IER(876) : o ? 0 : IER(877))
 	 return;
   ALLOW (o->hash, n->hash);
   ALLOW (o->equal, n->equal);
@@ -231,7 +231,7 @@ _cru_filled_fold (m, err)
 	  // have compatible result types, as indicated by having identical
 	  // destructors.
 {
-  if ((! m) ? IER(819) : (m->map ? m->bmap : NULL) ? IER(820) : 0)
+  if ((! m) ? IER(878) : (m->map ? m->bmap : NULL) ? IER(879) : 0)
 	 return 0;
   if (m->m_free ? 0 : ! (m->r_free))
 	 {
@@ -271,7 +271,7 @@ filled_ctop (p, err)
 	  // Check for a defined mark and allow a default always true
 	  // condition in a ctop.
 {
-  if (p ? 0 : IER(821))
+  if (p ? 0 : IER(880))
 	 return 0;
   if (p->top ? 0 : RAISE(CRU_UNDCTO))
 	 return 0;
@@ -291,7 +291,7 @@ _cru_filled_ctops (f, err)
 
 	  // Confirm that a ctops can be initialized with default fields.
 {
-  if (f ? 0 : IER(822))
+  if (f ? 0 : IER(881))
 	 return 0;
   return (filled_ctop (&(f->ana_labeler), err) ? filled_ctop (&(f->cata_labeler), err) : 0);
 }
@@ -308,7 +308,7 @@ _cru_filled_map (f, err)
 
 	  // Infer a fold as above where only the map is required.
 {
-  if (f ? 0 : IER(823))
+  if (f ? 0 : IER(882))
 	 return 0;
   ALLOW (f->reduction, (cru_bop) _cru_undefined_bop);
   return _cru_filled_fold (f, err);
@@ -330,7 +330,7 @@ _cru_filled_prop (p, err)
 	  // edge map reductions is allowed to be empty, in which case it
 	  // is ignored.
 {
-  if (p ? 0 : IER(824))
+  if (p ? 0 : IER(883))
 	 return 0;
   if (_cru_empty_fold (&(p->incident)) ? 0 : ! _cru_filled_fold (&(p->incident), err))
 	 return 0;
@@ -359,7 +359,7 @@ _cru_filled_sig (s, err)
 	  // either case, then the corresponding hashes and relations must
 	  // also be defined by the user.
 {
-  if (s ? 0 : IER(825))
+  if (s ? 0 : IER(884))
 	 return 0;
   if (! (s->destructors.e_free))                                                   // if edge labels are endogenous
 	 _cru_allow_scalar_order (&(s->orders.e_order), err);
@@ -384,7 +384,7 @@ _cru_filled_classifier (c, err)
 	  // Return non-zero if replacement functions are assigned to a
 	  // partially specified classifer.
 {
-  if ((! c) ? IER(826) : 0)
+  if ((! c) ? IER(885) : 0)
 	 return 0;
   ALLOW (c->cl_prop.vertex.reduction, (cru_bop) _cru_undefined_bop);
   if (! _cru_filled_prop (&(c->cl_prop), err))
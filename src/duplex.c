@@ -19,6 +19,7 @@
 #include <string.h>
 #include <strings.h>
 #include <errno.h>
+#include "count.h"
 #include "duplex.h"
 #include "edges.h"
 #include "errs.h"
@@ -68,17 +69,17 @@ _cru_full_duplexing_task (source, err)
   seen = NULL;
   killed = 0;
   sample = 0;
-  if ((! source) ? IER(827) : (source->gruntled != PORT_MAGIC) ? IER(828) : 0)
+  if ((! source) ? IER(886) : (source->gruntled != PORT_MAGIC) ? IER(887) : 0)
 	 return NULL;
-  if ((! (r = source->local)) ? IER(829) : (r->valid != ROUTER_MAGIC) ? IER(830) : 0)
+  if ((! (r = source->local)) ? IER(888) : (r->valid != ROUTER_MAGIC) ? IER(889) : 0)
 	 return NULL;
-  if (((destinations = source->peers)) ? 0 : IER(831))
+  if (((destinations = source->peers)) ? 0 : IER(890))
 	 return _cru_abort_status (source, destinations, err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, destinations, err));)
 	 {
 		KILL_SITE(10);
 		killed = (killed ? 1 : KILLED);
-		if (killed ? 1 : (n = (node_list) incoming->payload) ? 0 : IER(832))
+		if (killed ? 1 : (n = (node_list) incoming->payload) ? 0 : IER(891))
 		  goto a;
 		if (_cru_test_and_set_membership (n, &seen, err))
 		  goto b;
@@ -87,7 +88,7 @@ _cru_full_duplexing_task (source, err)
 		_cru_scatter_out (n, destinations, err);
 		_cru_free_edges (n->edges_in, err);
 		n->edges_in = NULL;
-	 b: if (*err ? 0 : ((!(incoming->carrier)) == !(incoming->sender)) ? (! ! (incoming->carrier)) : ! IER(833))
+	 b: if (*err ? 0 : ((!(incoming->carrier)) == !(incoming->sender)) ? (! ! (incoming->carrier)) : ! IER(892))
 		  if ((e = _cru_edge (NO_SIG, incoming->carrier->label, NO_VERTEX, incoming->sender, NO_NEXT_EDGE, err)))
 			 _cru_push_edge (e, &(n->edges_in), err);
 	 a: _cru_nack (_cru_popped_packet (&incoming, err), err);
@@ -124,17 +125,17 @@ _cru_half_duplexing_task (source, err)
   router r;
 
   seen = NULL;
-  if ((! source) ? IER(834) : (source->gruntled != PORT_MAGIC) ? IER(835) : (killed = 0))
+  if ((! source) ? IER(893) : (source->gruntled != PORT_MAGIC) ? IER(894) : (killed = 0))
 	 return NULL;
-  if ((! (r = source->local)) ? IER(836) : (r->valid != ROUTER_MAGIC) ? IER(837) : (int) (sample = 0))
+  if ((! (r = source->local)) ? IER(895) : (r->valid != ROUTER_MAGIC) ? IER(896) : (int) (sample = 0))
 	 return NULL;
-  if (((destinations = source->peers)) ? 0 : IER(838))
+  if (((destinations = source->peers)) ? 0 : IER(897))
 	 return _cru_abort_status (source, destinations, err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, destinations, err));)
 	 {
 		KILL_SITE(11);
 		killed = (killed ? 1 : KILLED);
-		if ((! (n = (node_list) incoming->payload)) ? IER(839) : _cru_test_and_set_membership (n, &seen, err))
+		if ((! (n = (node_list) incoming->payload)) ? IER(898) : _cru_test_and_set_membership (n, &seen, err))
 		  goto a;
 		if (killed ? 0 : ! *err)
 		  _cru_scatter_out (n, destinations, err);
@@ -185,16 +186,16 @@ populating_task (source, err)
   d = NULL;
   seen = NULL;
   memset (&buffer, 0, sizeof (buffer));
-  if ((! source) ? IER(840) : (source->gruntled != PORT_MAGIC) ? IER(841) : 0)
+  if ((! source) ? IER(899) : (source->gruntled != PORT_MAGIC) ? IER(900) : 0)
 	 return NULL;
-  if ((! (r = source->local)) ? IER(842) : (r->valid != ROUTER_MAGIC) ? IER(843) : 0)
+  if ((! (r = source->local)) ? IER(901) : (r->valid != ROUTER_MAGIC) ? IER(902) : 0)
 	 return NULL;
-  if ((! (d = source->peers)) ? IER(844) : 0)
+  if ((! (d = source->peers)) ? IER(903) : 0)
 	 return _cru_abort_status (source, d, err);
   h = r->ro_sig.orders.v_order.hash;
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
-		if ((n = incoming->receiver) ? RECORDED(n) : IER(845))
+		if ((n = incoming->receiver) ? RECORDED(n) : IER(904))
 		  goto a;
 		if (*err ? 0 : _cru_scattered_by_hashes (n, h, d, BY_TERMINUS, err))
 		  goto b;
@@ -243,9 +244,9 @@ graft (i, c, s, d, e, err)
 	  // and point the outgoing edges from its predecessor nodes to the
 	  // previously stored node.
 {
-  if ((! i) ? IER(846) : (! (i->carrier)) ? IER(847) : (! (i->receiver)) ? IER(848) : (! e) ? IER(849) : 0)
+  if ((! i) ? IER(905) : (! (i->carrier)) ? IER(906) : (! (i->receiver)) ? IER(907) : (! e) ? IER(908) : 0)
 	 return;
-  if ((! c) ? IER(850) : (! (c->receiver)) ? IER(851) : (i == c) ? IER(852) : s ? 0 : IER(853))
+  if ((! c) ? IER(909) : (! (c->receiver)) ? IER(910) : (i == c) ? IER(911) : s ? 0 : IER(912))
 	 return;
   _cru_record_edge (_cru_scalar_hash (i->carrier), EQUAL_CARRIERS, (void *) i->carrier, &(c->seen_carriers), err);
   if (c->receiver == i->receiver)
@@ -281,7 +282,7 @@ deduplicating_task (source, err)
 	  // stored in the hash table.
 {
 #define UNEQUAL(a,b) \
-(*err ? 0 : (! b) ? (! IER(854)) : (a == b->vertex) ? 0 : FAILED(s->orders.v_order.equal, a, b->vertex))
+(*err ? 0 : (! b) ? (! IER(913)) : (a == b->vertex) ? 0 : FAILED(s->orders.v_order.equal, a, b->vertex))
 
   packet_table collisions;    // previous incoming packets
   packet_list incoming;
@@ -298,18 +299,18 @@ deduplicating_task (source, err)
 
   sample = 0;
   collisions = NULL;
-  if ((! source) ? IER(855) : (source->gruntled != PORT_MAGIC) ? IER(856) : 0)
+  if ((! source) ? IER(914) : (source->gruntled != PORT_MAGIC) ? IER(915) : 0)
 	 goto a;
-  if ((!(r = source->local)) ? IER(857) : (r->valid != ROUTER_MAGIC) ? IER(858) : (killed = 0))
+  if ((!(r = source->local)) ? IER(916) : (r->valid != ROUTER_MAGIC) ? IER(917) : (killed = 0))
 	 goto a;
-  if (((d = source->peers)) ? ((r->ro_sig.orders.v_order.equal) ? 0 : IER(859)) : IER(860))
+  if (((d = source->peers)) ? ((r->ro_sig.orders.v_order.equal) ? 0 : IER(918)) : IER(919))
 	 return _cru_abort_status (source, d, err);
   s = &(r->ro_sig);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
 		KILL_SITE(12);
 		killed = (killed ? 1 : KILLED);
-		if (killed ? 1 : *err ? 1 : (! (n = incoming->receiver)) ? IER(861) : 0)
+		if (killed ? 1 : *err ? 1 : (! (n = incoming->receiver)) ? IER(920) : 0)
 		  goto b;
 		if (! (c = _cru_collision (incoming->hash_value, &collisions, err)))
 		  goto b;
@@ -328,8 +329,8 @@ deduplicating_task (source, err)
 			 graft (incoming, *c, s, &(source->deletions), &(source->disconnections), err);
 			 goto c;
 		  }
-		if (_cru_push_packet (_cru_popped_packet (&incoming, err), p = (*c ? &((*c)->next_packet) : c), err) ? 1 : ! IER(862))
-		  if (*p ? 1 : ! IER(863))
+		if (_cru_push_packet (_cru_popped_packet (&incoming, err), p = (*c ? &((*c)->next_packet) : c), err) ? 1 : ! IER(921))
+		  if (*p ? 1 : ! IER(922))
 			 {
 				_cru_record_edge (_cru_scalar_hash ((*p)->carrier), EQUAL_CARRIERS, (*p)->carrier, &((*p)->seen_carriers), err);
 				continue;
@@ -369,11 +370,11 @@ _cru_deduplicated (g, k, r, err)
   packet_list p;
 
   _cru_disable_killing (k, err);
-  if (*err ? 1 : (! g) ? 1 : (! (b = g->base_node)) ? IER(864) : 0)
+  if (*err ? 1 : (! g) ? 1 : (! (b = g->base_node)) ? IER(923) : 0)
 	 goto a;
-  if ((! r) ? IER(865) : (r->valid != ROUTER_MAGIC) ? IER(866) : 0)
+  if ((! r) ? IER(924) : (r->valid != ROUTER_MAGIC) ? IER(925) : 0)
 	 goto a;
-  if ((! (r->ports)) ? IER(867) : ((h = r->ro_sig.orders.v_order.hash)) ? 0 : IER(868))
+  if ((! (r->ports)) ? IER(926) : ((h = r->ro_sig.orders.v_order.hash)) ? 0 : IER(927))
 	 goto a;
   if (_cru_half_duplex (g, err))
 	 goto b;
@@ -386,9 +387,10 @@ _cru_deduplicated (g, k, r, err)
 		  goto a;
 		g->nodes = NULL;
 	 }
-  if (_cru_queue_launched (k, b, q, _cru_reset (r, (task) _cru_pruning_task, err), &(g->nodes), err))
-	 if (g->nodes)
-		g->nodes->previous = &(g->nodes);
+  if (_cru_queue_launched (k, b, q, _cru_reset (r, (task) _cru_pruning_task, err), &(g->nodes), err) ? (! *err) : 0)
+	 _cru_gathered_census (r, &(g->g_census));
+  if (g->nodes)
+	 g->nodes->previous = &(g->nodes);
  a: _cru_sweep (r, err);
   if (*err)
 	 _cru_free_now (g, err);
@@ -19,6 +19,7 @@
 #include <errno.h>
 #include <string.h>
 #include <stdlib.h>
+#include "arena.h"
 #include "brig.h"
 #include "cthread.h"
 #include "errs.h"
@@ -50,6 +51,27 @@ _cru_edge (r, label, remote_vertex, remote_node, next_edge, err)
  	  int *err;
 
 	  // Create a new edge with the vertex value embedded.
+{
+  return _cru_slab_edge (NO_SLABS, r, label, remote_vertex, remote_node, next_edge, err);
+}
+
+
+
+
+
+
+
+edge_list
+_cru_slab_edge (s, r, label, remote_vertex, remote_node, next_edge, err)
+	  slab *s;
+	  cru_destructor_pair r;
+	  void *label;
+	  void *remote_vertex;
+	  node_list remote_node;
+	  edge_list next_edge;
+ 	  int *err;
+
+	  // Create a new edge in a slab if there are any.
 {
   edge_list new_edge;
   struct cru_destructor_pair_s z;
@@ -57,7 +79,7 @@ _cru_edge (r, label, remote_vertex, remote_node, next_edge, err)
 
   if (*err)
 	 goto a;
-  if ((new_edge = (edge_list) _cru_malloc (sizeof (*new_edge))) ? 0 : RAISE(ENOMEM))
+  if ((new_edge = (s ? (edge_list) _cru_carved (s, sizeof (*new_edge), err) : (edge_list) _cru_malloc (sizeof (*new_edge)))) ? 0 : RAISE(ENOMEM))
 	 goto a;
   memset (new_edge, 0, sizeof(*new_edge));
   new_edge->label = label;
@@ -85,6 +107,58 @@ _cru_edge (r, label, remote_vertex, remote_node, next_edge, err)
 
 
 
+edge_list
+_cru_slab_edges (s, r, labels, termini, n, next_edge, err)
+	  slab *s;
+	  cru_destructor_pair r;
+	  void *const *labels;
+	  void *const *termini;
+	  size_t n;
+	  edge_list next_edge;
+	  int *err;
+
+	  // Push n new edges with the given labels and termini onto a list
+	  // in the same order as n calls to _cru_slab_edge. If there are
+	  // slabs, the edges are carved from them in contiguous runs, but
+	  // otherwise each is allocated from the heap so that it can be
+	  // freed individually. Missing labels or termini arrays are taken
+	  // to be NULL. If there's an error, free everything.
+{
+  uintptr_t c, i, j;
+  edge_list e;
+  int ux;
+
+  for (i = 0; *err ? 0 : (i < n); i += c)
+	 if (! s)
+		next_edge = _cru_edge (r, labels ? labels[i] : NULL, termini ? termini[i] : NULL, NO_NODE, next_edge, (c = 1, err));
+	 else if ((e = (edge_list) _cru_carved_run (s, sizeof (*e), (c = (uintptr_t) (n - i), &c), err)) ? 0 : RAISE(ENOMEM))
+		break;
+	 else
+		for (memset (e, 0, (size_t) c * sizeof (*e)), j = 0; j < c; next_edge = &(e[j++]))
+		  {
+			 e[j].label = (labels ? labels[i + j] : NULL);
+			 e[j].remote.vertex = (termini ? termini[i + j] : NULL);
+			 e[j].next_edge = next_edge;
+		  }
+  if (! *err)
+	 return next_edge;
+  _cru_free_edges_and_termini (r, next_edge, err);
+  for (; r ? (i < n) : 0; i++)
+	 {
+		if ((termini ? termini[i] : NULL) ? r->v_free : NULL)
+		  APPLY(r->v_free, termini[i]);
+		if ((labels ? labels[i] : NULL) ? r->e_free : NULL)
+		  APPLY(r->e_free, labels[i]);
+	 }
+  return NULL;
+}
+
+
+
+
+
+
+
 void
 _cru_free_edges (e, err)
 	  edge_list e;
@@ -163,13 +237,13 @@ _cru_free_edges_and_termini (r, e, err)
   int ux;
 
   if ((! r) ? 1 : r->e_free ? 0 : ! (r->v_free))
-	 for (; (t = e); _cru_free (t))
+	 for (; (t = e); RELEASE(t))
 		{
 		  e->label = e->remote.vertex = NULL;
 		  e = e->next_edge;
 		}
   else if (r->v_free ? r->e_free : NULL)
-	 for (; (t = e); _cru_free (t))
+	 for (; (t = e); RELEASE(t))
 		{
 		  if (e->label)
 			 APPLY(r->e_free, e->label);
@@ -179,7 +253,7 @@ _cru_free_edges_and_termini (r, e, err)
 		  e = e->next_edge;
 		}
   else if (r->e_free)
-	 for (; (t = e); _cru_free (t))
+	 for (; (t = e); RELEASE(t))
 		{
 		  if (e->label)
 			 APPLY(r->e_free, e->label);
@@ -187,7 +261,7 @@ _cru_free_edges_and_termini (r, e, err)
 		  e = e->next_edge;
 		}
   else
-	 for (; (t = e); _cru_free (t))
+	 for (; (t = e); RELEASE(t))
 		{
 		  if (e->remote.vertex)
 			 APPLY(r->v_free, e->remote.vertex);
@@ -219,7 +293,7 @@ _cru_push_edge (new_edge, old_edges, err)
 
 	  // Insert a unit edge list at the beginning of an existing edge list.
 {
-  if ((! new_edge) ? 1 : new_edge->next_edge ? IER(869) : old_edges ? 0 : IER(870))
+  if ((! new_edge) ? 1 : new_edge->next_edge ? IER(928) : old_edges ? 0 : IER(929))
 	 return;
   new_edge->next_edge = *old_edges;
   *old_edges = new_edge;
@@ -241,9 +315,9 @@ _cru_enqueue_edge (new_edge, front, back, err)
 
 	  // Append an edge list to an existing edge list.
 {
-  if ((! new_edge) ? 1 : (! front) ? IER(871) : (! back) ? IER(872) : ((! *front) != ! *back) ? IER(873) : 0)
+  if ((! new_edge) ? 1 : (! front) ? IER(930) : (! back) ? IER(931) : ((! *front) != ! *back) ? IER(932) : 0)
 	 return;
-  if ((! *back) ? 0 : (*back)->next_edge ? IER(874) : 0)
+  if ((! *back) ? 0 : (*back)->next_edge ? IER(933) : 0)
 	 return;
   if (*front)
 	 (*back)->next_edge = new_edge;
@@ -302,7 +376,7 @@ _cru_repeating_labels (o, n, err)
 
   r = NULL;
   e = &n;
-  if ((! o) ? IER(875) : (! (o->hash)) ? IER(876) : (! *e) ? 1 : ! ((*e)->next_edge))
+  if ((! o) ? IER(934) : (! (o->hash)) ? IER(935) : (! *e) ? 1 : ! ((*e)->next_edge))
 	 return NULL;
   for (t = NULL; *err ? NULL : *e;)
 	 if (_cru_already_recorded (h = (o->hash) ((*e)->label), o->equal, (*e)->label, t, err))
@@ -332,7 +406,7 @@ _cru_popped_edge (edges, err)
 {
   edge_list o;
 
-  if ((! edges) ? IER(877) : *edges ? 0 : IER(878))
+  if ((! edges) ? IER(936) : *edges ? 0 : IER(937))
 	 return NULL;
   *edges = (o = *edges)->next_edge;
   o->next_edge = NULL;
@@ -354,12 +428,12 @@ _cru_deleted_edge (target, edges, err)
 {
   edge_list *e;
 
-  if ((! edges) ? IER(879) : 0)
+  if ((! edges) ? IER(938) : 0)
 	 return NULL;
   for (e = edges; *e; e = &((*e)->next_edge))
 	 if (*e == target)
 		return _cru_popped_edge (e, err);
-  IER(880);
+  IER(939);
   return NULL;
 }
 
@@ -382,10 +456,10 @@ _cru_minimum_edge (t, edges, err)
   int ux, ut;
 
   m = NULL;
-  if ((! t) ? IER(881) : (! edges) ? IER(882) : *edges ? 0 : IER(883))
+  if ((! t) ? IER(940) : (! edges) ? IER(941) : *edges ? 0 : IER(942))
 	 return NULL;
   for (e = *edges; *err ? NULL : e; e = e->next_edge)
-	 if (! (e->remote.node ? 0 : IER(884)))
+	 if (! (e->remote.node ? 0 : IER(943)))
 		if (m ? PASSED(t, e->label, e->remote.node->vertex, m->label, m->remote.node->vertex) : 1)
 		  m = e;
   return (*err ? NULL : _cru_deleted_edge (m, edges, err));
@@ -411,7 +485,7 @@ _cru_disconnections (terminus, carrier, edges, err)
   edge_list *e;
   edge_list result;
 
-  if (terminus ? (carrier ? (edges ? (carrier->next_edge ? IER(885) : 0) : IER(886)) : 1) : 1)
+  if (terminus ? (carrier ? (edges ? (carrier->next_edge ? IER(944) : 0) : IER(945)) : 1) : 1)
 	 return NULL;
   result = NULL;
   for (e = edges; *e;)
@@ -496,7 +570,7 @@ reduced_edges (m, v, e, by_class, by_accumulator, with_locks, err)
 	  // being run, allow an allocation error to be simulated at each
 	  // call site to the test code.
 {
-#define DANGLING(l,x) (((x = (by_class ? CLASS_OF(l->remote.node) : l->remote.node))) ? 0 : IER(887))
+#define DANGLING(l,x) (((x = (by_class ? CLASS_OF(l->remote.node) : l->remote.node))) ? 0 : IER(946))
 #define VERTEX(x) (by_accumulator ? x->accumulator : with_locks ? _cru_read (&(x->vertex), err) : x->vertex)
 
   int ux;
@@ -506,22 +580,22 @@ reduced_edges (m, v, e, by_class, by_accumulator, with_locks, err)
   void *reduction_result;
   void *previous_reduction_result;
 
-  if (m ? 0 : IER(888))
+  if (m ? 0 : IER(947))
 	 return NULL;
   if (! e)
 	 return ((m->vacuous_case ? 0 : RAISE(CRU_UNDVAC)) ? NULL : CALLED(m->vacuous_case));
-  if ((m->map ? 1 : ! ! (m->bmap)) ? 0 : IER(889))
+  if ((m->map ? 1 : ! ! (m->bmap)) ? 0 : IER(948))
 	 return NULL;
   if (m->vacuous_case)
 	 reduction_result = CALLED(m->vacuous_case);
-  else if ((m->m_free != m->r_free) ? IER(890) : DANGLING(e,n))
+  else if ((m->m_free != m->r_free) ? IER(949) : DANGLING(e,n))
 	 return NULL;
   else
 	 {
 		reduction_result = (m->bmap ? APPLIED(m->bmap, v, e->label) : APPLIED(m->map, v, e->label, VERTEX(n)));
 		e = e->next_edge;
 	 }
-  if ((! e) ? 0 : m->reduction ? 1 : ! IER(891))
+  if ((! e) ? 0 : m->reduction ? 1 : ! IER(950))
 	 for (; *err ? 0 : e ? (! DANGLING(e,n)) : 0; e = e->next_edge)
 		{
 		  previous_reduction_result = reduction_result;
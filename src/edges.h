@@ -68,6 +68,14 @@ extern "C"
 extern edge_list
 _cru_edge (cru_destructor_pair r, void *label, void *remote_vertex, node_list remote_node, edge_list next_edge, int *err);
 
+// create a new edge from a list of slabs or from the heap if s is NULL
+extern edge_list
+_cru_slab_edge (slab *s, cru_destructor_pair r, void *label, void *remote_vertex, node_list remote_node, edge_list next_edge, int *err);
+
+// push n edges with the given labels and termini, carving them in contiguous runs if s isn't NULL
+extern edge_list
+_cru_slab_edges (slab *s, cru_destructor_pair r, void *const *labels, void *const *termini, size_t n, edge_list next_edge, int *err);
+
 // dispose of a list of edges
 extern void
 _cru_free_edges (edge_list e, int *err);
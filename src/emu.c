@@ -43,7 +43,7 @@ _cru_multirecord (e, l, t, err)
   multiset_table_bin *p;
   int ux, ut;
 
-  if ((! t) ? IER(895) : e ? 0 : IER(896))
+  if ((! t) ? IER(954) : e ? 0 : IER(955))
 	 return;
   for (p = t; (! *p) ? 0 : FAILED(e, l, (*p)->edge_label); p = &((*p)->other_edges));
   if (*err ? 1 : *p ? 1 : (*p = (multiset_table_bin) _cru_malloc (sizeof (**p))) ? 0 : RAISE(ENOMEM))
@@ -77,7 +77,7 @@ _cru_multimerge (t, q, e, err)
   uintptr_t m;
   int ux, ut;
 
-  if ((! t) ? 1 : (! q) ? IER(897) : e ? 0 : IER(898))
+  if ((! t) ? 1 : (! q) ? IER(956) : e ? 0 : IER(957))
 	 return;
   while (*q ? (! *err) : 0)
 	 {
@@ -87,7 +87,7 @@ _cru_multimerge (t, q, e, err)
 		if (*p)
 		  {
 			 m = (*p)->multiplicity + (*q)->multiplicity + 1;
-			 if ((m <= (*p)->multiplicity) ? IER(899) : (m <= (*q)->multiplicity) ? IER(900) : 0)
+			 if ((m <= (*p)->multiplicity) ? IER(958) : (m <= (*q)->multiplicity) ? IER(959) : 0)
 				break;
 			 (*p)->multiplicity = m;
 			 *q = (o = *q)->other_edges;
@@ -118,7 +118,7 @@ _cru_multipoint (t, n, err)
 	  // Point the edges in a multiset table bin to a node n.
 {
   for (; t; t = t->other_edges)
-	 if (t->edge ? 1 : ! IER(901))
+	 if (t->edge ? 1 : ! IER(960))
 		t->edge->remote.node = n;
 }
 
@@ -180,7 +180,7 @@ _cru_set_membership_nj (node, seen, err)
 {
   node_set_nj p;
 
-  if ((! seen) ? IER(902) : (p = (node_set_nj) _cru_malloc (sizeof (*p))) ? 0 : RAISE(ENOMEM))
+  if ((! seen) ? IER(961) : (p = (node_set_nj) _cru_malloc (sizeof (*p))) ? 0 : RAISE(ENOMEM))
 	 return 0;
   memset (p, 0, sizeof (*p));
   p->element = node;
@@ -234,7 +234,7 @@ _cru_test_and_set_membership_nj (node, seen, err)
 {
   node_set_nj p;
 
-  if (seen ? 0 : IER(903))
+  if (seen ? 0 : IER(962))
 	 return 0;
   for (p = *seen; p; p = p->subset)
 	 if (p->element == node)
@@ -336,7 +336,7 @@ _cru_associate_nj (m, v, h, err)
 {
   vertex_map_nj *o;
 
-  if ((! h) ? 1 : (h->classed != CLASS_MAGIC) ? IER(904) : m ? 0 : IER(905))
+  if ((! h) ? 1 : (h->classed != CLASS_MAGIC) ? IER(963) : m ? 0 : IER(964))
 	 goto a;
   for (o = m; *o; o = &((*o)->antirefinement))
 	 if ((*o)->preimage == v)
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
+#include "arena.h"
 #include "build.h"
 #include "classes.h"
 #include "compose.h"
@@ -34,10 +35,13 @@
 #include "edges.h"
 #include "emap.h"
 #include "errs.h"
+#include "export.h"
 #include "fab.h"
 #include "filters.h"
+#include "freeze.h"
 #include "getset.h"
 #include "graph.h"
+#include "import.h"
 #include "induce.h"
 #include "infer.h"
 #include "killers.h"
@@ -50,6 +54,7 @@
 #include "postpone.h"
 #include "ptr.h"
 #include "route.h"
+#include "save.h"
 #include "split.h"
 #include "spread.h"
 #include "stretch.h"
@@ -79,7 +84,7 @@ static int initial_error = 0;
 #define TEST_ENTRY                                                         \
   CONTROL_ENTRY;                                                            \
   pthread_once (&once_control, initialization);                              \
-  if (initialized ? 0 : RAISE(initial_error ? initial_error : THE_IER(906)))  \
+  if (initialized ? 0 : RAISE(initial_error ? initial_error : THE_IER(965)))  \
 	 goto x
 
 // done when any user code calls a published API routine
@@ -102,11 +107,11 @@ teardown ()
 	  // Free all static storage. This function is installed by
 	  // atexit () in the initialization routine.
 {
-  _cru_close_killers ();
   _cru_close_getset ();
   _cru_close_cthread ();
   _cru_close_packets ();
   _cru_close_crew ();
+  _cru_close_arena ();
   _cru_close_wrap ();
   _cru_close_graph ();
   _cru_close_copy ();
@@ -127,11 +132,11 @@ initialization ()
 	 goto a;
   if (! _cru_open_cthread (&initial_error))
 	 goto b;
-  if (! _cru_open_killers (&initial_error))
-	 goto c;
   if (! _cru_open_crew (&initial_error))
-	 goto d;
+	 goto c;
   if (! _cru_open_packets (&initial_error))
+	 goto d;
+  if (! _cru_open_arena (&initial_error))
 	 goto e;
   if (! _cru_open_copy (&initial_error))
 	 goto f;
@@ -139,16 +144,16 @@ initialization ()
 	 goto g;
   if (! _cru_open_wrap (&initial_error))
 	 goto h;
-  if (atexit (teardown) ? (initial_error = (initial_error ? initial_error : THE_IER(907))) : 0)
+  if (atexit (teardown) ? (initial_error = (initial_error ? initial_error : THE_IER(966))) : 0)
 	 goto i;
   initialized = 1;
   return;
  i: _cru_close_wrap ();
  h: _cru_close_graph ();
  g: _cru_close_copy ();
- f: _cru_close_packets ();
- e: _cru_close_crew ();
- d: _cru_close_killers ();
+ f: _cru_close_arena ();
+ e: _cru_close_packets ();
+ d: _cru_close_crew ();
  c: _cru_close_cthread ();
  b: _cru_close_getset ();
  a: _cru_close_errs ();
@@ -207,13 +212,68 @@ cru_built (b, v, k, lanes, err)
 	 goto x;
   if ((r = _cru_building_router (b, (task) _cru_building_task, lanes ? lanes : NPROC ? NPROC : 1, err)))
 	 {
-		g = _cru_built (v, k, r, err);
-		g->g_store = b->attribute;
+		if ((g = _cru_built (v, k, r, err)))
+		  g->g_store = b->attribute;
+		v = NULL;
+	 }
+  _cru_free_builder (b);
+ x: if (v ? d : NULL)
+	 APPLY(d, v);
+  return g;
+}
+
+
+
+
+
+
+
+
+cru_graph
+cru_built_from (b, v, labels, termini, n, k, lanes, err)
+	  cru_builder b;
+	  cru_vertex v;
+	  const cru_edge *labels;
+	  const cru_vertex *termini;
+	  size_t n;
+	  cru_kill_switch k;
+ 	  unsigned lanes;
+	  int *err;
+
+	  // Concurrently build the graph of all nodes reachable from the
+	  // base vertex through n given edges, sending each terminus
+	  // directly to the worker that owns it.
+{
+  int ux;
+  router r;
+  cru_graph g;
+  int ignored;
+  size_t i;
+  cru_destructor d, e;
+
+  g = NULL;
+  d = (b ? b->bu_sig.destructors.v_free : NULL);
+  e = (b ? b->bu_sig.destructors.e_free : NULL);
+  API_ENTRY;
+  if (! (b ? (b = _cru_inferred_builder (b, v, err)) : NULL))
+	 goto x;
+  if ((r = _cru_building_router (b, (task) _cru_building_task, lanes ? lanes : NPROC ? NPROC : 1, err)))
+	 {
+		if ((g = _cru_built_from (v, labels, termini, n, k, r, err)))
+		  g->g_store = b->attribute;
 		v = NULL;
+		n = 0;
 	 }
   _cru_free_builder (b);
  x: if (v ? d : NULL)
 	 APPLY(d, v);
+  for (i = 0; i < n; i++)
+	 {
+		if ((termini ? termini[i] : NULL) ? d : NULL)
+		  APPLY(d, termini[i]);
+		if ((labels ? labels[i] : NULL) ? e : NULL)
+		  APPLY(e, labels[i]);
+	 }
   return g;
 }
 
@@ -303,16 +363,49 @@ cru_connect (label, terminus, err)
 	  // this one is passed to cru in a builder struct as the connector
 	  // or subconnector.
 {
-  edge_list *e;
+  struct connection_s f;
   int ignored;
-  context *x;
+  connection c;
 
   CONTROL_ENTRY;
-  if (((! initialized) ? 1 : (! (x = _cru_get_context ())) ? 1 : (*x != BUILDING)) ? RAISE(CRU_INTOOC) : 0)
+  if ((! initialized) ? RAISE(CRU_INTOOC) : ! (c = _cru_connection (&f)) ? IER(967) : 0)
+	 return;
+  if (((! (c->co_context)) ? 1 : (*(c->co_context) != BUILDING)) ? RAISE(CRU_INTOOC) : 0)
 	 return;
-  if ((e = _cru_get_edges ()) ? 0 : IER(908))
+  if ((c->co_edges) ? 0 : IER(968))
 	 return;
-  *e = _cru_edge (_cru_get_destructors (), label, terminus, NO_NODE, *e, err);
+  *(c->co_edges) = _cru_slab_edge (c->co_slabs, c->co_destructors, label, terminus, NO_NODE, *(c->co_edges), err);
+}
+
+
+
+
+
+
+
+void
+cru_connect_many (labels, termini, n, err)
+	  const cru_edge *labels;
+	  const cru_vertex *termini;
+	  size_t n;
+	  int *err;
+
+	  // Assert n edges at once as if by n consecutive calls to
+	  // cru_connect, but resolving the context only once and carving
+	  // the edges contiguously when the graph is built in arena mode.
+{
+  struct connection_s f;
+  int ignored;
+  connection c;
+
+  CONTROL_ENTRY;
+  if ((! initialized) ? RAISE(CRU_INTOOC) : ! (c = _cru_connection (&f)) ? IER(969) : 0)
+	 return;
+  if (((! (c->co_context)) ? 1 : (*(c->co_context) != BUILDING)) ? RAISE(CRU_INTOOC) : 0)
+	 return;
+  if ((c->co_edges) ? 0 : IER(970))
+	 return;
+  *(c->co_edges) = _cru_slab_edges (c->co_slabs, c->co_destructors, labels, termini, n, *(c->co_edges), err);
 }
 
 
@@ -344,7 +437,7 @@ cru_stretch (label_in, new_vertex, label_out, err)
   z = _cru_get_destructors ();
   if (((! initialized) ? 1 : (! (x = _cru_get_context ())) ? 1 : (*x != STRETCHING)) ? RAISE(CRU_INTOOC) : 0)
 	 goto a;
-  if ((! z) ? IER(909) : (e = _cru_get_edge_maps ()) ? 0 : IER(910))
+  if ((! z) ? IER(971) : (e = _cru_get_edge_maps ()) ? 0 : IER(972))
 	 goto a;
   if (! (a = _cru_edge (z, label_in, new_vertex, NO_NODE, NO_NEXT_EDGE, err)))
 	 goto b;
@@ -421,7 +514,7 @@ cru_killed (void)
   err = &ignored;
   TEST_ENTRY;
   if ((k = _cru_get_kill_switch ()))
-	 return ! ! *k;
+	 return ! ! __atomic_load_n (k, __ATOMIC_RELAXED);
  x: return 0;
 }
 
@@ -465,7 +558,8 @@ cru_vertex_count (g, lanes, err)
 	  unsigned lanes;
 	  int *err;
 
-	  // Concurrently compute and return the number of nodes in a graph.
+	  // Concurrently compute and return the number of nodes in a
+	  // graph unless it's already known.
 {
   uintptr_t count;
   int ignored;
@@ -474,13 +568,14 @@ cru_vertex_count (g, lanes, err)
   count = 0;
   API_ENTRY;
   lanes = (lanes ? lanes : NPROC ? NPROC : 1);
-  if ((! g) ? 1 : _cru_bad (g, err))
+  if ((! g) ? 1 : _cru_bad (g, err) ? 1 : _cru_censused (g, VERTICES_COUNTED, &count))
 	 goto x;
   if ((lanes > 1) ? _cru_counted (&count, g->base_node, _cru_router ((task) _cru_node_counting_task, lanes, err), err) : 0)
-	 goto x;
+	 goto a;
   count = 0;
   for (n = g->nodes; n; n = n->next_node)
 	 count++;
+ a: _cru_census_taken (g, VERTICES_COUNTED, count, err);
  x: return count;
 }
 
@@ -495,7 +590,8 @@ cru_terminus_count (g, lanes, err)
 	  unsigned lanes;
 	  int *err;
 
-	  // Concurrently compute and return the number of terminal nodes in a graph.
+	  // Concurrently compute and return the number of terminal nodes
+	  // in a graph unless it's already known.
 {
   uintptr_t count;
   int ignored;
@@ -504,13 +600,14 @@ cru_terminus_count (g, lanes, err)
   count = 0;
   API_ENTRY;
   lanes = (lanes ? lanes : NPROC ? NPROC : 1);
-  if ((! g) ? 1 : _cru_bad (g, err))
+  if ((! g) ? 1 : _cru_bad (g, err) ? 1 : _cru_censused (g, TERMINI_COUNTED, &count))
 	 goto x;
   if ((lanes > 1) ? _cru_counted (&count, g->base_node, _cru_router ((task) _cru_terminus_counting_task, lanes, err), err) : 0)
-	 goto x;
+	 goto a;
   count = 0;
   for (n = g->nodes; n; n = n->next_node)
 	 count += ! (n->edges_out);
+ a: _cru_census_taken (g, TERMINI_COUNTED, count, err);
  x: return count;
 }
 
@@ -525,7 +622,8 @@ cru_edge_count (g, lanes, err)
 	  unsigned lanes;
 	  int *err;
 
-	  // Concurrently compute and return the number of edges in a graph.
+	  // Concurrently compute and return the number of edges in a
+	  // graph unless it's already known.
 {
   uintptr_t count;
   int ignored;
@@ -535,14 +633,15 @@ cru_edge_count (g, lanes, err)
   count = 0;
   API_ENTRY;
   lanes = (lanes ? lanes : NPROC ? NPROC : 1);
-  if ((! g) ? 1 : _cru_bad (g, err))
+  if ((! g) ? 1 : _cru_bad (g, err) ? 1 : _cru_censused (g, EDGES_COUNTED, &count))
 	 goto x;
   if ((lanes > 1) ? _cru_counted (&count, g->base_node, _cru_router ((task) _cru_edge_counting_task, lanes, err), err) : 0)
-	 goto x;
+	 goto a;
   count = 0;
   for (n = g->nodes; n; n = n->next_node)
 	 for (e = n->edges_out; e; e = e->next_edge)
 		count++;
+ a: _cru_census_taken (g, EDGES_COUNTED, count, err);
  x: return count;
 }
 
@@ -582,10 +681,12 @@ cru_mapreduced (g, m, k, lanes, err)
 		initial = _cru_initial_node (g, k, r, err);
 		if (*err)
 		  goto a;
-		if ((lanes != 1) ? 1 : g->g_store ? 1 : (initial != g->nodes))
-		  result = _cru_mapreduce (k, initial, _cru_shared(_cru_reset (r, (task) _cru_mapreducing_task, err)), err);
-		else
+		if ((lanes != 1) ? 0 : g->g_store ? 0 : (initial == g->nodes))
 		  result = _cru_reduced_nodes (&(m->ma_prop), g->nodes, err);
+		else if (m->ma_zone.backwards ? 0 : (initial == g->base_node))
+		  result = _cru_scanned_mapreduce (k, g, _cru_shared (r), err);
+		else
+		  result = _cru_mapreduce (k, initial, _cru_shared(_cru_reset (r, (task) _cru_mapreducing_task, err)), err);
 		a: _cru_free_router (r, err);
 	 }
   if (*err ? (m->ma_prop.vertex.r_free ? result : NULL) : NULL)
@@ -803,7 +904,7 @@ cru_spread (g, b, k, lanes, err)
 
   API_ENTRY;
   _cru_disable_killing (k, err);
-  if (_cru_bad (g, err) ? 1 : *err ? 1 : (! g) ? 1 : (! (g->base_node)) ? IER(911) : 0)
+  if (_cru_bad (g, err) ? 1 : *err ? 1 : (! g) ? 1 : (! (g->base_node)) ? IER(973) : 0)
 	 goto x;
   if (! (b = _cru_inferred_builder (b, g->base_node->vertex, err)))
 	 goto x;
@@ -1020,6 +1121,162 @@ cru_postponed (g, p, k, lanes, err)
 
 
 
+cru_graph
+cru_frozen (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Pack the nodes and edges of a graph into contiguous storage for
+	  // faster traversal.
+{
+  int ignored;
+
+  API_ENTRY;
+  if (_cru_bad (g, err) ? 1 : ! g)
+	 goto x;
+  g = _cru_frozen (g, err);
+ x: if (*err)
+	 cru_free_now (g, 0, err);
+  return (*err ? NULL : g);
+}
+
+
+
+
+// --------------- persistence -----------------------------------------------------------------------------
+
+
+
+
+uintptr_t
+cru_saved (g, fd, c, lanes, err)
+	  cru_graph g;
+	  int fd;
+	  cru_codec_pair c;
+	  unsigned lanes;
+	  int *err;
+
+	  // Write a graph to a file descriptor in sections for the given
+	  // number of lanes and return the number of bytes written.
+{
+  uintptr_t size;
+  int ignored;
+
+  size = 0;
+  API_ENTRY;
+  if (g ? _cru_bad (g, err) : 0)
+	 goto x;
+  size = _cru_saved (g, fd, c, lanes ? lanes : NPROC ? NPROC : 1, err);
+ x: return size;
+}
+
+
+
+
+
+
+
+cru_graph
+cru_loaded (fd, s, c, lanes, err)
+	  int fd;
+	  cru_sig s;
+	  cru_codec_pair c;
+	  unsigned lanes;
+	  int *err;
+
+	  // Concurrently read a graph written by cru_saved. Scalar vertices and edge
+	  // labels get default orders as they would when building.
+{
+  struct cru_sig_s z;
+  int ignored;
+  cru_graph g;
+
+  g = NULL;
+  API_ENTRY;
+  memset (&z, 0, sizeof (z));
+  if (s)
+	 memcpy (&z, s, sizeof (z));
+  if (! (z.destructors.v_free))
+	 _cru_allow_scalar_order (&(z.orders.v_order), err);
+  if (! (z.destructors.e_free))
+	 _cru_allow_scalar_order (&(z.orders.e_order), err);
+  g = _cru_loaded (fd, &z, c, lanes ? lanes : NPROC ? NPROC : 1, err);
+ x: return g;
+}
+
+
+
+
+
+cru_graph
+cru_imported (fd, i, v, lanes, err)
+	  int fd;
+	  cru_importer i;
+	  cru_vertex v;
+	  unsigned lanes;
+	  int *err;
+
+	  // Concurrently build a graph from an edge list in a file. The
+	  // vertices and edge labels are scalars, so they get default
+	  // orders, and a NULL importer means unlabeled edges in text.
+{
+  struct cru_importer_s d;
+  struct cru_sig_s z;
+  int ignored;
+  cru_graph g;
+
+  g = NULL;
+  API_ENTRY;
+  memset (&d, 0, sizeof (d));
+  if (i)
+	 memcpy (&d, i, sizeof (d));
+  memset (&z, 0, sizeof (z));
+  memcpy (&(z.orders), &(d.im_orders), sizeof (z.orders));
+  _cru_allow_scalar_order (&(z.orders.v_order), err);
+  _cru_allow_scalar_order (&(z.orders.e_order), err);
+  g = _cru_imported (fd, &d, &z, (uintptr_t) v, lanes ? lanes : NPROC ? NPROC : 1, err);
+ x: return g;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+cru_exported (g, fd, x, lanes, err)
+	  cru_graph g;
+	  int fd;
+	  cru_exporter x;
+	  unsigned lanes;
+	  int *err;
+
+	  // Concurrently write a graph to a file descriptor as text and
+	  // return the number of bytes written. A NULL exporter means DOT
+	  // with the vertices and edge labels written as scalars.
+{
+  struct cru_exporter_s d;
+  uintptr_t size;
+  int ignored;
+
+  size = 0;
+  API_ENTRY;
+  if (g ? _cru_bad (g, err) : 0)
+	 goto x;
+  memset (&d, 0, sizeof (d));
+  if (x)
+	 memcpy (&d, x, sizeof (d));
+  if (((d.format < DOT_FORMAT) ? 1 : (d.format > CSV_FORMAT)) ? RAISE(CRU_BADFMT) : 0)
+	 goto x;
+  size = _cru_exported (g, fd, &d, lanes ? lanes : NPROC ? NPROC : 1, err);
+ x: return size;
+}
+
+
+
+
 // --------------- reclamation -----------------------------------------------------------------------------
 
 
@@ -1032,17 +1289,22 @@ cru_free_now (g, lanes, err)
 	  int *err;
 
 	  // Reclaim all storage associated with a graph concurrently and
-	  // block until it's done.
+	  // block until it's done. A graph whose nodes and edges are all in
+	  // slabs and that has no destructors is freed sequentially all at
+	  // once without visiting them.
 {
   int ignored;
   router r;
 
   API_ENTRY;
-  if (g ? (! _cru_bad (g, err)) : 0)
+  if (g ? _cru_razable (g) ? 0 : (! _cru_bad (g, err)) : 0)
 	 if ((lanes = (lanes ? lanes : NPROC ? NPROC : 1)) > 1)
 		if ((r = _cru_razing_router (&(g->g_sig.destructors), (task) _cru_freeing_task, lanes, err)))
-		  if (_cru_launched (UNKILLABLE, g->base_node, r, err))
-			 g->nodes = g->base_node = NULL;
+		  {
+			 r->heaped = ! (g->g_slabs);
+			 if (_cru_launched (UNKILLABLE, g->base_node, r, err))
+				g->nodes = g->base_node = NULL;
+		  }
  x: _cru_free_now (g, err);
 }
 
@@ -0,0 +1,534 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// A graph is exported by numbering its nodes in the order of its node
+// list and dividing them into chunks of consecutive nodes, a few per
+// worker, which the workers take in rotation. Each worker formats a
+// chunk into its own buffer and writes it when the turn passes to
+// that chunk, which happens only after every chunk before it has been
+// written, so the file comes out in node list order no matter which
+// worker finishes first. A worker whose buffer fills up before its
+// turn waits for the turn and then writes as it goes until the end of
+// the chunk, so the memory used is bounded by the buffer size times
+// the number of workers regardless of the size of the graph. The
+// worker buffers can be bigger than anything the allocation tracker
+// in wrap.c expects, so their allocation is simulated by NOMEM.
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <nthm/nthm.h>
+#include "cthread.h"
+#include "edges.h"
+#include "errs.h"
+#include "export.h"
+#include "graph.h"
+#include "nodes.h"
+#include "wrap.h"
+
+// like APPLIED in errs.h for a formatter, whose result is a size
+#define FORMATTED(f, ...) (NOMEM ? 0 : *err ? 0 : ( ux = 0, un = (f) (__VA_ARGS__, &ux), RAISE(ux), *err ? 0 : un ))
+
+// written before the first node in each format
+static const char *preamble[] = {
+  "digraph {\n",
+  "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+  "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n"
+  "<key id=\"v\" for=\"node\" attr.name=\"vertex\" attr.type=\"string\"/>\n"
+  "<key id=\"e\" for=\"edge\" attr.name=\"label\" attr.type=\"string\"/>\n"
+  "<graph edgedefault=\"directed\">\n",
+  "source,terminus,label\n"};
+
+// written after the last node in each format
+static const char *postamble[] = {
+  "}\n",
+  "</graph>\n</graphml>\n",
+  ""};
+
+
+
+
+// --------------- turn taking -----------------------------------------------------------------------------
+
+
+
+
+static void
+halt (r, err)
+	  relay r;
+	  int *err;
+
+	  // Tell every worker to stop after one of them fails.
+{
+  if (pthread_mutex_lock (&(r->lock)) ? IER(980) : 0)
+	 return;
+  r->halted = 1;
+  if (pthread_cond_broadcast (&(r->turned)))
+	 IER(981);
+  if (pthread_mutex_unlock (&(r->lock)))
+	 IER(982);
+}
+
+
+
+
+
+
+
+static int
+waited (s, err)
+	  stint s;
+	  int *err;
+
+	  // Wait for the turn of the chunk being formatted by a worker if
+	  // it doesn't have it already, and return non-zero unless a
+	  // worker has failed.
+{
+  relay r;
+
+  if (*err ? 1 : s->holding)
+	 return ! *err;
+  r = s->shared;
+  if (pthread_mutex_lock (&(r->lock)) ? IER(983) : 0)
+	 return 0;
+  while ((r->turn != s->chunk) ? (! r->halted) : 0)
+	 if (pthread_cond_wait (&(r->turned), &(r->lock)) ? IER(984) : 0)
+		break;
+  s->holding = (*err ? 0 : ! r->halted);
+  if (pthread_mutex_unlock (&(r->lock)) ? IER(985) : 0)
+	 s->holding = 0;
+  return s->holding;
+}
+
+
+
+
+
+
+
+static void
+passed (s, err)
+	  stint s;
+	  int *err;
+
+	  // Pass the turn from the chunk formatted by a worker to the next
+	  // one, or stop every worker if this one has failed.
+{
+  relay r;
+
+  r = s->shared;
+  if (*err ? 1 : ! s->holding)
+	 {
+		s->holding = 0;
+		if (*err)
+		  halt (r, err);
+		return;
+	 }
+  s->holding = 0;
+  if (pthread_mutex_lock (&(r->lock)) ? IER(986) : 0)
+	 return;
+  r->turn++;
+  if (pthread_cond_broadcast (&(r->turned)))
+	 IER(987);
+  if (pthread_mutex_unlock (&(r->lock)))
+	 IER(988);
+}
+
+
+
+
+// --------------- formatting ------------------------------------------------------------------------------
+
+
+
+
+static void
+emitted (s, p, n, err)
+	  stint s;
+	  const void *p;
+	  size_t n;
+	  int *err;
+
+	  // Append n bytes to the text of a worker. If there's no room,
+	  // wait for the turn of the chunk being formatted and write out
+	  // what's buffered, writing the bytes directly if they're too
+	  // many to buffer.
+{
+  if (*err ? 1 : (s->w.used + n <= SCRIBE_SIZE) ? 0 : ! waited (s, err))
+	 return;
+  if (s->w.used + n > SCRIBE_SIZE)
+	 {
+		_cru_sent (s->w.fd, s->w.buffer, s->w.used, err);
+		s->w.used = 0;
+	 }
+  s->w.written += n;
+  if (n > SCRIBE_SIZE)
+	 _cru_sent (s->w.fd, (const unsigned char *) p, n, err);
+  else
+	 {
+		memcpy (s->w.buffer + s->w.used, p, n);
+		s->w.used += n;
+	 }
+}
+
+
+
+
+
+
+
+static void
+literal_emitted (s, t, err)
+	  stint s;
+	  const char *t;
+	  int *err;
+
+	  // Append a null terminated string to the text of a worker.
+{
+  emitted (s, t, strlen (t), err);
+}
+
+
+
+
+
+
+
+static void
+number_emitted (s, u, err)
+	  stint s;
+	  uintptr_t u;
+	  int *err;
+
+	  // Append a number in decimal to the text of a worker.
+{
+  char d[24];
+  int n;
+
+  if ((n = snprintf (d, sizeof (d), "%lu", (unsigned long) u)) < 0 ? IER(989) : 0)
+	 return;
+  emitted (s, d, (size_t) n, err);
+}
+
+
+
+
+
+
+
+static const char *
+escape (format, c)
+	  int format;
+	  char c;
+
+	  // Return what a character is written as in a quoted string in a
+	  // given format, or NULL if it's written as itself.
+{
+  if (format == DOT_FORMAT)
+	 return ((c == '"') ? "\\\"" : (c == '\\') ? "\\\\" : (c == '\n') ? "\\n" : NULL);
+  if (format == GRAPHML_FORMAT)
+	 return ((c == '&') ? "&amp;" : (c == '<') ? "&lt;" : (c == '>') ? "&gt;" : (c == '"') ? "&quot;" : NULL);
+  return ((c == '"') ? "\"\"" : NULL);
+}
+
+
+
+
+
+
+
+static void
+text_emitted (s, t, n, err)
+	  stint s;
+	  const char *t;
+	  size_t n;
+	  int *err;
+
+	  // Append n bytes of formatted text to the text of a worker with
+	  // any escapes the format requires. A CSV field is quoted only if
+	  // it contains a comma, a quotation mark, or a line break.
+{
+  const char *e;
+  size_t i, j;
+  int q, f;
+
+  f = s->shared->exporter->format;
+  for (q = 0, j = 0; (f != CSV_FORMAT) ? 0 : (j < n) ? (! q) : 0; j++)
+	 q = ((t[j] == ',') ? 1 : (t[j] == '"') ? 1 : (t[j] == '\n') ? 1 : (t[j] == '\r'));
+  if (q)
+	 emitted (s, "\"", 1, err);
+  for (i = j = 0; *err ? 0 : (j < n); j++)
+	 if ((e = escape (f, t[j])))
+		{
+		  emitted (s, t + i, j - i, err);
+		  literal_emitted (s, e, err);
+		  i = j + 1;
+		}
+  emitted (s, t + i, n - i, err);
+  if (q)
+	 emitted (s, "\"", 1, err);
+}
+
+
+
+
+
+
+
+static void
+item_emitted (s, item, f, err)
+	  stint s;
+	  void *item;
+	  cru_encoder f;
+	  int *err;
+
+	  // Append a vertex or an edge label to the text of a worker using
+	  // the formatter f, or as a scalar in decimal if there is none.
+	  // The formatter writes into a scratch area on the stack if
+	  // there's room, or into a temporary buffer otherwise.
+{
+  char scratch[SCRATCH_SIZE];
+  size_t n, m, un;
+  char *t;
+  int ux;
+
+  if (*err)
+	 return;
+  if (! f)
+	 {
+		number_emitted (s, (uintptr_t) item, err);
+		return;
+	 }
+  if ((n = FORMATTED(f, item, scratch, sizeof (scratch))) <= sizeof (scratch))
+	 {
+		text_emitted (s, scratch, n, err);
+		return;
+	 }
+  if (*err ? 1 : NOMEM ? 1 : (t = (char *) malloc (n)) ? 0 : RAISE(ENOMEM))
+	 return;
+  m = FORMATTED(f, item, t, n);
+  text_emitted (s, t, (m < n) ? m : n, err);
+  free (t);
+}
+
+
+
+
+
+
+
+static void
+node_emitted (s, n, err)
+	  stint s;
+	  node_list n;
+	  int *err;
+
+	  // Append a node and its outgoing edges to the text of a worker.
+	  // Nodes are identified by their indices, which are held in their
+	  // marked fields, except in CSV, which lists only the edges.
+{
+  cru_exporter x;
+  edge_list e;
+
+  x = s->shared->exporter;
+  if (x->format == DOT_FORMAT)
+	 {
+		literal_emitted (s, "  ", err);
+		number_emitted (s, (uintptr_t) n->marked, err);
+		literal_emitted (s, " [label=\"", err);
+		item_emitted (s, n->vertex, x->v_format, err);
+		literal_emitted (s, "\"];\n", err);
+	 }
+  else if (x->format == GRAPHML_FORMAT)
+	 {
+		literal_emitted (s, "<node id=\"n", err);
+		number_emitted (s, (uintptr_t) n->marked, err);
+		literal_emitted (s, "\"><data key=\"v\">", err);
+		item_emitted (s, n->vertex, x->v_format, err);
+		literal_emitted (s, "</data></node>\n", err);
+	 }
+  for (e = n->edges_out; *err ? NULL : e; e = e->next_edge)
+	 if (x->format == DOT_FORMAT)
+		{
+		  literal_emitted (s, "  ", err);
+		  number_emitted (s, (uintptr_t) n->marked, err);
+		  literal_emitted (s, " -> ", err);
+		  number_emitted (s, (uintptr_t) e->remote.node->marked, err);
+		  literal_emitted (s, " [label=\"", err);
+		  item_emitted (s, e->label, x->e_format, err);
+		  literal_emitted (s, "\"];\n", err);
+		}
+	 else if (x->format == GRAPHML_FORMAT)
+		{
+		  literal_emitted (s, "<edge source=\"n", err);
+		  number_emitted (s, (uintptr_t) n->marked, err);
+		  literal_emitted (s, "\" target=\"n", err);
+		  number_emitted (s, (uintptr_t) e->remote.node->marked, err);
+		  literal_emitted (s, "\"><data key=\"e\">", err);
+		  item_emitted (s, e->label, x->e_format, err);
+		  literal_emitted (s, "</data></edge>\n", err);
+		}
+	 else
+		{
+		  item_emitted (s, n->vertex, x->v_format, err);
+		  literal_emitted (s, ",", err);
+		  item_emitted (s, e->remote.node->vertex, x->v_format, err);
+		  literal_emitted (s, ",", err);
+		  item_emitted (s, e->label, x->e_format, err);
+		  literal_emitted (s, "\n", err);
+		}
+}
+
+
+
+
+// --------------- exporting -------------------------------------------------------------------------------
+
+
+
+
+static stint
+stint_exported (s, err)
+	  stint s;
+	  int *err;
+
+	  // Format the nodes in every chunk assigned to a worker and write
+	  // the text of each chunk in its turn.
+{
+  node_list n;
+  relay r;
+  uintptr_t i;
+
+  r = s->shared;
+  for (i = 0, n = r->nodes, s->chunk = s->own; *err ? 0 : (s->chunk < r->chunks); s->chunk += r->lanes)
+	 {
+		for (; n ? (i < s->chunk * r->chunk_size) : 0; i++)
+		  n = n->next_node;
+		for (; (*err ? NULL : n) ? (i < (s->chunk + 1) * r->chunk_size) : 0; i++)
+		  {
+			 node_emitted (s, n, err);
+			 n = n->next_node;
+		  }
+		if (! waited (s, err))
+		  break;
+		_cru_sent (s->w.fd, s->w.buffer, s->w.used, err);
+		s->w.used = 0;
+		passed (s, err);
+	 }
+  if (*err)
+	 passed (s, err);
+  return s;
+}
+
+
+
+
+
+
+
+static void
+stints_exported (s, r, err)
+	  stint s;
+	  relay r;
+	  int *err;
+
+	  // Run every worker concurrently, or in the calling thread if
+	  // there's only one.
+{
+  nthm_pipe t;
+  unsigned j;
+
+  if (*err ? 1 : (r->lanes > 1) ? 0 : ! ! stint_exported (s, err))
+	 return;
+  if (NOMEM ? 1 : ! nthm_enter_scope (err))
+	 return;
+  for (j = 0; j < r->lanes; j++)
+	 if (NOMEM ? 1 : ! nthm_open ((nthm_worker) stint_exported, &(s[j]), err))
+		break;
+  if (j < r->lanes)
+	 halt (r, err);
+  while ((t = nthm_select (err)))
+	 nthm_read (t, err);
+  nthm_exit_scope (err);
+}
+
+
+
+
+
+
+
+uintptr_t
+_cru_exported (g, fd, x, lanes, err)
+	  cru_graph g;
+	  int fd;
+	  cru_exporter x;
+	  unsigned lanes;
+	  int *err;
+
+	  // Write a graph to a file descriptor in the format specified by
+	  // the exporter and return the number of bytes written, using the
+	  // marked field of each node temporarily to hold its index. An
+	  // empty graph is written as a preamble and a postamble with
+	  // nothing in between.
+{
+  uintptr_t count, written;
+  struct relay_s r;
+  node_list n;
+  unsigned j;
+  stint s;
+
+  if (*err ? 1 : (! x) ? IER(990) : (x->format < DOT_FORMAT) ? IER(991) : (x->format > CSV_FORMAT) ? IER(992) : 0)
+	 return 0;
+  memset (&r, 0, sizeof (r));
+  r.exporter = x;
+  r.nodes = (g ? g->nodes : NULL);
+  for (count = 0, n = r.nodes; n; n = n->next_node)
+	 n->marked = (void *) count++;
+  lanes = (lanes ? lanes : 1);
+  r.chunk_size = count / ((uintptr_t) lanes * CHUNKS_PER_LANE) + 1;
+  r.chunks = (count + r.chunk_size - 1) / r.chunk_size;
+  r.lanes = ((r.chunks < (uintptr_t) lanes) ? (r.chunks ? (unsigned) r.chunks : 1) : lanes);
+  written = strlen (preamble[x->format]);
+  _cru_sent (fd, (const unsigned char *) preamble[x->format], written, err);
+  if (*err ? 1 : _cru_mutex_init (&(r.lock), err))
+	 goto a;
+  if (_cru_cond_init (&(r.turned), err))
+	 goto b;
+  if (NOMEM ? 1 : (s = (stint) malloc ((size_t) r.lanes * sizeof (*s))) ? 0 : RAISE(ENOMEM))
+	 goto c;
+  memset (s, 0, (size_t) r.lanes * sizeof (*s));
+  for (j = 0; j < r.lanes; j++)
+	 {
+		s[j].shared = &r;
+		s[j].own = j;
+		s[j].w.fd = fd;
+	 }
+  stints_exported (s, &r, err);
+  for (j = 0; j < r.lanes; j++)
+	 written += s[j].w.written;
+  free (s);
+  _cru_sent (fd, (const unsigned char *) postamble[x->format], strlen (postamble[x->format]), err);
+  written += strlen (postamble[x->format]);
+ c: pthread_cond_destroy (&(r.turned));
+ b: pthread_mutex_destroy (&(r.lock));
+ a: for (n = r.nodes; n; n = n->next_node)
+	 n->marked = NULL;
+  return (*err ? 0 : written);
+}
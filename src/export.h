@@ -0,0 +1,72 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CRU_EXPORT_H
+#define CRU_EXPORT_H 1
+
+// functions for writing graphs to files as text for other tools
+
+#include <pthread.h>
+#include "ptr.h"
+#include "save.h"
+
+// the number of chunks of nodes taken in turn by each worker
+#define CHUNKS_PER_LANE 4
+
+// the number of bytes of formatted text held on the stack before resorting to the heap
+#define SCRATCH_SIZE 0x100
+
+// the state shared by all workers exporting a graph
+
+struct relay_s
+{
+  cru_exporter exporter;            // the format and the formatters
+  node_list nodes;                  // the nodes of the graph being exported
+  uintptr_t chunk_size;             // the number of consecutive nodes in each chunk
+  uintptr_t chunks;                 // the total number of chunks
+  uintptr_t turn;                   // the index of the chunk whose text is next to be written
+  unsigned lanes;                   // the number of workers
+  int halted;                       // non-zero if a worker has failed
+  pthread_mutex_t lock;             // guards the turn and halted fields
+  pthread_cond_t turned;            // signaled when either of them changes
+};
+
+// the state of one worker exporting a graph
+
+struct stint_s
+{
+  relay shared;                     // the state shared with the other workers
+  unsigned own;                     // the index of this worker
+  uintptr_t chunk;                  // the index of the chunk being formatted
+  int holding;                      // non-zero if it's the turn of the chunk being formatted
+  struct scribe_s w;                // text formatted but not yet written
+};
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// write a graph to a file descriptor as text using concurrent workers and return the number of bytes written
+extern uintptr_t
+_cru_exported (cru_graph g, int fd, cru_exporter x, unsigned lanes, int *err);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
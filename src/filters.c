@@ -20,6 +20,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "brig.h"
+#include "count.h"
 #include "defo.h"
 #include "duplex.h"
 #include "edges.h"
@@ -80,18 +81,18 @@ _cru_populating_task (source, err)
   d = NULL;
   seen = NULL;
   memset (&buffer, 0, sizeof (buffer));
-  if ((! source) ? IER(932) : (source->gruntled != PORT_MAGIC) ? IER(933) : 0)
+  if ((! source) ? IER(1007) : (source->gruntled != PORT_MAGIC) ? IER(1008) : 0)
 	 return NULL;
-  if ((! (r = source->local)) ? IER(934) : (r->valid != ROUTER_MAGIC) ? IER(935) : 0)
+  if ((! (r = source->local)) ? IER(1009) : (r->valid != ROUTER_MAGIC) ? IER(1010) : 0)
 	 return NULL;
-  if ((! (d = source->peers)) ? IER(936) : 0)
+  if ((! (d = source->peers)) ? IER(1011) : 0)
 	 return _cru_abort_status (source, d, err);
   i = ((r->tag == EXT) ? &(r->stretcher.st_prop) : (r->tag == SPL) ? &(r->splitter.sp_prop) : NULL);
   _cru_set_storage (r->ro_store, err);
   _cru_set_kill_switch (&(r->killed), err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
-		if ((n = (node_list) incoming->payload) ? RECORDED(n) : IER(937))
+		if ((n = (node_list) incoming->payload) ? RECORDED(n) : IER(1012))
 		  goto a;
 		if (*err ? 0 : _cru_scattered (n->edges_out, d, err))
 		  goto b;
@@ -147,7 +148,7 @@ is_deletable (v, n, err)
   void *undeletable;
   int ux;
 
-  if (*err ? 1 : _cru_empty_prop (v) ? 1 : v ? 0 : IER(938))
+  if (*err ? 1 : _cru_empty_prop (v) ? 1 : v ? 0 : IER(1013))
 	 return 0;
   if ((undeletable = _cru_mapped_node (v, n, err)) ? v->vertex.m_free : NULL)
 	 APPLY(v->vertex.m_free, undeletable);
@@ -182,11 +183,11 @@ node_filtering_task (source, err)
 
   sample = 0;
   seen = NULL;
-  if ((! source) ? IER(939) : (source->gruntled != PORT_MAGIC) ? IER(940) : 0)
+  if ((! source) ? IER(1014) : (source->gruntled != PORT_MAGIC) ? IER(1015) : 0)
 	 goto a;
-  if ((!(r = source->local)) ? IER(941) : (r->valid != ROUTER_MAGIC) ? IER(942) : (killed = 0))
+  if ((!(r = source->local)) ? IER(1016) : (r->valid != ROUTER_MAGIC) ? IER(1017) : (killed = 0))
 	 goto a;
-  if ((!(d = source->peers)) ? IER(943) : (r->tag != FIL) ? IER(944) : 0)
+  if ((!(d = source->peers)) ? IER(1018) : (r->tag != FIL) ? IER(1019) : 0)
 	 return _cru_abort_status (source, d, err);
   _cru_set_storage (r->ro_store, err);
   _cru_set_kill_switch (&(r->killed), err);
@@ -194,7 +195,7 @@ node_filtering_task (source, err)
 	 {
 		KILL_SITE(14);
 		killed = (killed ? 1 : KILLED);
-		if (*err ? 1 : killed ? 1 : (! (n = incoming->receiver)) ? IER(945) : 0)
+		if (*err ? 1 : killed ? 1 : (! (n = incoming->receiver)) ? IER(1020) : 0)
 		  goto c;
 		if (source->reachable ? (! _cru_member (n, source->reachable)) : 0)
 		  goto c;
@@ -237,7 +238,7 @@ disconnection_acknowledged (incoming, c, err)
 {
   edge_list e;
 
-  if ((! incoming) ? IER(946) : (! (incoming->receiver)) ? IER(947) : (! c) ? IER(948) : 0)
+  if ((! incoming) ? IER(1021) : (! (incoming->receiver)) ? IER(1022) : (! c) ? IER(1023) : 0)
 	 return 0;
   if (incoming->payload == CUT_FORWARD)
 	 e = _cru_deleted_edge (incoming->carrier, &(incoming->receiver->edges_out), err);
@@ -279,10 +280,10 @@ individually_filtered (test, t, v, e, c, err)
   void *ua;
   int ux;
 
-  if ((! e) ? IER(949) : (! c) ? IER(950) : (! test) ? IER(951) : (test->map ? 1 : ! ! (test->bmap)) ? 0 : IER(952))
+  if ((! e) ? IER(1024) : (! c) ? IER(1025) : (! test) ? IER(1026) : (test->map ? 1 : ! ! (test->bmap)) ? 0 : IER(1027))
 	 return 0;
   for (p = NULL; *e;)
-	 if (((*e)->remote.node ? 0 : IER(953)) ? 1 : ! (pass = MAP(test, v, (*e)->label, (*e)->remote.node->vertex)))
+	 if (((*e)->remote.node ? 0 : IER(1028)) ? 1 : ! (pass = MAP(test, v, (*e)->label, (*e)->remote.node->vertex)))
 		*c = _cru_cat_edges (_cru_popped_edge (e, err), *c);
 	 else if ((p = _cru_cat_edges (_cru_popped_edge (e, err), p)) ? test->m_free : NULL)
 		APPLY(test->m_free, pass);
@@ -321,7 +322,7 @@ jointly_filtered (test, n, b, c, err)
   int ux;
 
   o = b;
-  if ((! n) ? IER(954) : n->edges_out ? IER(955) : (! test) ? IER(956) : (! c) ? IER(957) : 0)
+  if ((! n) ? IER(1029) : n->edges_out ? IER(1030) : (! test) ? IER(1031) : (! c) ? IER(1032) : 0)
 	 return 0;
   for (e = NULL; b; b = b->other_buckets)
 	 if (! (pass = _cru_reduced_edges (test, n->vertex, b->bucket, err)))
@@ -359,7 +360,7 @@ jointly_thinned (test, t, n, b, c, err)
   void *ua;
   int ux;
 
-  if ((! n) ? IER(958) : n->edges_out ? IER(959) : (! test) ? IER(960) : (! c) ? IER(961) : (! t) ? IER(962) : 0)
+  if ((! n) ? IER(1033) : n->edges_out ? IER(1034) : (! test) ? IER(1035) : (! c) ? IER(1036) : (! t) ? IER(1037) : 0)
 	 return 0;
   for (passing = NULL; b;)
 	 if (! (pass = _cru_reduced_edges (test, n->vertex, b->bucket, err)))
@@ -410,7 +411,7 @@ filtered (n, f, d, c, err)
   cru_fold test;
   int unordered;
 
-  if ((! n) ? IER(963) : (! f) ? IER(964) : (! c) ? IER(965) : *err)
+  if ((! n) ? IER(1038) : (! f) ? IER(1039) : (! c) ? IER(1040) : *err)
 	 return 0;
   if (_cru_empty_fold (test = &(f->fi_kernel.e_op)) ? (! (f->thinner)) : 0)       // no edges are to be deleted
 	 return 1;
@@ -458,7 +459,7 @@ request_disconnection (incoming, backwards, d, err)
 {
   edge_list e;
 
-  if ((! incoming) ? IER(966) : (! (incoming->receiver)) ? IER(967) : 0)
+  if ((! incoming) ? IER(1041) : (! (incoming->receiver)) ? IER(1042) : 0)
 	 return;
   if (! backwards)
 	 _cru_received_by (CUT_FORWARD, incoming->carrier, incoming->sender, d, err);
@@ -497,11 +498,11 @@ edge_filtering_task (source, err)
   sample = 0;
   killed = 0;
   seen = NULL;
-  if ((! source) ? IER(968) : (source->gruntled != PORT_MAGIC) ? IER(969) : 0)
+  if ((! source) ? IER(1043) : (source->gruntled != PORT_MAGIC) ? IER(1044) : 0)
 	 goto a;
-  if ((!(r = source->local)) ? IER(970) : (r->valid != ROUTER_MAGIC) ? IER(971) : 0)
+  if ((!(r = source->local)) ? IER(1045) : (r->valid != ROUTER_MAGIC) ? IER(1046) : 0)
 	 goto a;
-  if ((!(d = source->peers)) ? IER(972) : (r->tag != FIL) ? IER(973) : 0)
+  if ((!(d = source->peers)) ? IER(1047) : (r->tag != FIL) ? IER(1048) : 0)
 	 return _cru_abort (source, d, err);
   _cru_set_storage (r->ro_store, err);
   _cru_set_kill_switch (&(r->killed), err);
@@ -583,13 +584,13 @@ _cru_filtered (g, r, k, err)
   task t;
 
   _cru_disable_killing (k, err);
-  if (*err ? 1 : (! g) ? IER(974) : (! *g) ? IER(975) : (! r) ? IER(976) : (r->valid != ROUTER_MAGIC) ? IER(977) : 0)
+  if (*err ? 1 : (! g) ? IER(1049) : (! *g) ? IER(1050) : (! r) ? IER(1051) : (r->valid != ROUTER_MAGIC) ? IER(1052) : 0)
 	 goto a;
-  if (((! (r->ports)) ? IER(978) : (! (r->lanes)) ? IER(979) : 0) ? (r->valid = MUGGLE(14)) : 0)
+  if (((! (r->ports)) ? IER(1053) : (! (r->lanes)) ? IER(1054) : 0) ? (r->valid = MUGGLE(14)) : 0)
 	 goto a;
-  if ((r->tag != FIL) ? IER(980) : ! (i = _cru_initial_node (*g, k, r, err)))
+  if ((r->tag != FIL) ? IER(1055) : ! (i = _cru_initial_node (*g, k, r, err)))
 	 goto a;
-  s = (r->ports[MOD(_cru_scalar_hash (b = (*g)->base_node), r->lanes)])->reachable;
+  s = (r->ports[LANE(_cru_scalar_hash (b = (*g)->base_node), r->partitioner, r->lanes)])->reachable;
   if (! ((s ? _cru_member (b, s) : 1) ? r->filter.thinner ? 0 : is_deletable (&(r->filter.fi_kernel.v_op), b, err) : 0))
 	 goto b;
   if (r->lanes == 1)
@@ -641,7 +642,7 @@ pruning_task (source, err)
 	  int *err;
 
 	  // Return a queue of every received node, severing each from the
-	  // port's list of survivors.
+	  // port's list of survivors, and tally them in the port's census.
 {
   router r;
   int killed;
@@ -656,19 +657,20 @@ pruning_task (source, err)
   d = NULL;
   sample = 0;
   seen = NULL;
-  if ((! source) ? IER(981) : (source->gruntled != PORT_MAGIC) ? IER(982) : (killed = 0))
+  if ((! source) ? IER(1056) : (source->gruntled != PORT_MAGIC) ? IER(1057) : (killed = 0))
 	 return NULL;
-  if ((!(r = source->local)) ? IER(983) : (r->valid != ROUTER_MAGIC) ? IER(984) : 0)
+  if ((!(r = source->local)) ? IER(1058) : (r->valid != ROUTER_MAGIC) ? IER(1059) : 0)
 	 return NULL;
-  if (((d = source->peers)) ? 0 : IER(985))
+  if (((d = source->peers)) ? 0 : IER(1060))
 	 return (node_queue) _cru_abort (source, d, err);
+  memset (&(source->tally), 0, sizeof (source->tally));
   _cru_set_storage (r->ro_store, err);
   _cru_set_kill_switch (&(r->killed), err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
 		KILL_SITE(16);
 		killed = (killed ? 1 : KILLED);
-		if (*err ? 1 : killed ? 1 : (n = (node_list) incoming->payload) ? 0 : IER(986))
+		if (*err ? 1 : killed ? 1 : (n = (node_list) incoming->payload) ? 0 : IER(1061))
 		  goto a;
 		if (_cru_member (n, seen) ? 1 : ! _cru_set_membership (n, &seen, err))
 		  goto a;
@@ -679,7 +681,10 @@ pruning_task (source, err)
 	 a: _cru_nack (_cru_popped_packet (&incoming, err), err);
 	 }
   if (killed ? 0 : ! *err)
-	 goto d;
+	 {
+		_cru_tally (&(source->tally), q ? q->front : NULL);
+		goto d;
+	 }
   _cru_free_node_queue (q, &(r->ro_sig.destructors), err);
   _cru_free_nodes (source->survivors, &(r->ro_sig.destructors), err);
   source->survivors = NULL;
@@ -712,9 +717,9 @@ _cru_pruned (g, r, k, err)
 {
   router z;
 
-  if (*err ? 1 : (! r) ? IER(987) : (r->valid != ROUTER_MAGIC) ? IER(988) : (! g) ? 1 : g->base_node ? 0 : IER(989))
+  if (*err ? 1 : (! r) ? IER(1062) : (r->valid != ROUTER_MAGIC) ? IER(1063) : (! g) ? 1 : g->base_node ? 0 : IER(1064))
 	 goto a;
-  if (((! (r->ports)) ? IER(990) : (! (r->lanes)) ? IER(991) : 0) ? (r->valid = MUGGLE(15)) : 0)
+  if (((! (r->ports)) ? IER(1065) : (! (r->lanes)) ? IER(1066) : 0) ? (r->valid = MUGGLE(15)) : 0)
 	 goto a;
   if (_cru_half_duplex (g, err))
 	 goto b;
@@ -722,9 +727,10 @@ _cru_pruned (g, r, k, err)
   if (_cru_launched (k, g->base_node, z, err))
 	 goto a;
  b: _cru_reset (r, (task) pruning_task, err);
-  if (_cru_queue_launched (k, g->base_node, _cru_scalar_hash (g->base_node), r, &(g->nodes), err))
-	 if (g->nodes)
-		g->nodes->previous = &(g->nodes);
+  if (_cru_queue_launched (k, g->base_node, _cru_scalar_hash (g->base_node), r, &(g->nodes), err) ? (! *err) : 0)
+	 _cru_gathered_census (r, &(g->g_census));
+  if (g->nodes)
+	 g->nodes->previous = &(g->nodes);
  a: _cru_sweep (r, err);
   return ! *err;
 }
@@ -0,0 +1,138 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// A frozen graph keeps the same linked representation as any other
+// so that every operation still applies to it, but its nodes are
+// packed into slabs in list order and the edges of each node are
+// packed consecutively after those of the node preceding it, which
+// is the same memory layout as a compressed sparse row
+// representation. Traversals over a frozen graph therefore touch
+// memory sequentially instead of chasing pointers across the heap.
+
+#include <errno.h>
+#include <string.h>
+#include "arena.h"
+#include "edges.h"
+#include "errs.h"
+#include "freeze.h"
+#include "graph.h"
+#include "nodes.h"
+
+
+
+
+static edge_list
+packed_edges (cursor, e, err)
+	  slab *cursor;
+	  edge_list e;
+	  int *err;
+
+	  // Copy a list of edges into consecutive locations in preallocated
+	  // slabs, redirecting each to the copy of its remote node, which
+	  // is assumed to have been recorded in the marked field of the
+	  // original.
+{
+  edge_list f, *t;
+
+  for (f = NULL, t = &f; *err ? NULL : e; e = e->next_edge)
+	 {
+		if (! (*t = (edge_list) _cru_taken (cursor, sizeof (**t), err)))
+		  break;
+		memcpy (*t, e, sizeof (**t));
+		(*t)->remote.node = (node_list) e->remote.node->marked;
+		t = &((*t)->next_edge);
+	 }
+  *t = NULL;
+  return f;
+}
+
+
+
+
+
+
+
+
+cru_graph
+_cru_frozen (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Repack the nodes and edges of a graph into slabs allocated for
+	  // the exact number needed and free the originals. If there isn't
+	  // enough memory, the graph is left as it was.
+{
+  uintptr_t node_count, edge_count;
+  slab node_slabs, edge_slabs, cursor;
+  node_list n, m, old_nodes, *t;
+  edge_list e;
+
+  if ((! g) ? 1 : *err)
+	 return g;
+  node_count = edge_count = 0;
+  for (n = g->nodes; n; n = n->next_node)
+	 {
+		node_count++;
+		for (e = n->edges_out; e; e = e->next_edge)
+		  edge_count++;
+		for (e = n->edges_in; e; e = e->next_edge)
+		  edge_count++;
+	 }
+  if (! (node_slabs = _cru_slabs_for (node_count, sizeof (struct node_list_s), err)))
+	 return g;
+  if ((! edge_count) ? 0 : ! (edge_slabs = _cru_slabs_for (edge_count, sizeof (struct edge_list_s), err)))
+	 goto a;
+  if (! edge_count)
+	 edge_slabs = NULL;
+  cursor = node_slabs;
+  old_nodes = g->nodes;
+  for (t = &(g->nodes), n = old_nodes; n; n = n->next_node)
+	 {
+		if (! (m = (node_list) _cru_taken (&cursor, sizeof (*m), err)))
+		  goto b;
+		memcpy (m, n, sizeof (*m));
+		*(m->previous = t) = m;
+		*(t = &(m->next_node)) = NULL;
+		n->marked = m;
+	 }
+  g->base_node = (g->base_node ? (node_list) g->base_node->marked : NULL);
+  cursor = edge_slabs;
+  for (m = g->nodes; m; m = m->next_node)
+	 {
+		m->edges_out = packed_edges (&cursor, m->edges_out, err);
+		m->edges_in = packed_edges (&cursor, m->edges_in, err);
+		m->marked = NULL;
+	 }
+  for (n = old_nodes; n; n = n->next_node)
+	 {
+		_cru_free_edges (n->edges_out, err);
+		_cru_free_edges (n->edges_in, err);
+		n->vertex = NULL;
+		n->edges_out = n->edges_in = NULL;
+	 }
+  _cru_free_nodes (old_nodes, NO_DESTRUCTORS, err);
+  _cru_free_slabs (g->g_slabs, err);
+  g->g_slabs = _cru_cat_slabs (node_slabs, edge_slabs);
+  g->g_mixed = 0;
+  _cru_census_taken (g, VERTICES_COUNTED, node_count, err);
+  return g;
+ b: g->nodes = old_nodes;
+  _cru_free_slabs (edge_slabs, err);
+ a: _cru_free_slabs (node_slabs, err);
+  return g;
+}
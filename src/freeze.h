@@ -0,0 +1,36 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CRU_FREEZE_H
+#define CRU_FREEZE_H 1
+
+#include "ptr.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// repack all nodes and edges of a graph consecutively into slabs
+extern cru_graph
+_cru_frozen (cru_graph g, int *err);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -21,12 +21,6 @@
 #include "getset.h"
 #include "wrap.h"
 
-// used to retrieve thread-local edge storage for edges created in cru_connect
-static pthread_key_t edge_storage;
-
-// used to retrieve thread-local graph specification storage so that it's not needed as a parameter to cru_connect
-static pthread_key_t destructors_storage;
-
 // used to retrieve thread-local kill switch storage so that it's not needed as a parameter to cru_connect
 static pthread_key_t killed_storage;
 
@@ -36,9 +30,36 @@ static pthread_key_t graph_specific_storage;
 // used to retrieve thread-local edge map storage so that it's not needed as a parameter to cru_stretch
 static pthread_key_t edge_map_storage;
 
+#ifdef THREAD_LOCAL
+
+// the context, edges, destructors and slabs consulted by cru_connect,
+// which can be reached without a function call when the compiler
+// supports thread-local storage
+static _Thread_local struct connection_s connected;
+
+// non-zero while the calling thread frees only nodes and edges of a
+// graph owning no slabs, so they needn't be looked up in the arena
+static _Thread_local int heaped;
+
+#else
+
+// used to retrieve thread-local edge storage for edges created in cru_connect
+static pthread_key_t edge_storage;
+
+// used to retrieve thread-local graph specification storage so that it's not needed as a parameter to cru_connect
+static pthread_key_t destructors_storage;
+
 // used to retrieve thread-local context storage for sanity checking in cru_connect and cru_stretch
 static pthread_key_t context_storage;
 
+// used to retrieve thread-local slabs for edges created in cru_connect when a graph is built in arena mode
+static pthread_key_t slab_storage;
+
+// used to retrieve a thread-local flag meaning the nodes and edges being freed can't be in slabs
+static pthread_key_t heap_storage;
+
+#endif
+
 
 
 
@@ -55,24 +76,34 @@ _cru_open_getset (err)
 
 	  // Initialize static storage.
 {
-  if (pthread_key_create (&edge_storage, NULL) ? IER(992) : 0)
+  if (pthread_key_create (&killed_storage, NULL) ? IER(1067) : 0)
 	 return 0;
-  if (pthread_key_create (&killed_storage, NULL) ? IER(993) : 0)
+  if (pthread_key_create (&graph_specific_storage, NULL) ? IER(1068) : 0)
 	 goto a;
-  if (pthread_key_create (&graph_specific_storage, NULL) ? IER(994) : 0)
+  if (pthread_key_create (&edge_map_storage, NULL) ? IER(1069) : 0)
 	 goto b;
-  if (pthread_key_create (&destructors_storage, NULL) ? IER(995) : 0)
+#ifndef THREAD_LOCAL
+  if (pthread_key_create (&edge_storage, NULL) ? IER(1070) : 0)
 	 goto c;
-  if (pthread_key_create (&edge_map_storage, NULL) ? IER(996) : 0)
+  if (pthread_key_create (&destructors_storage, NULL) ? IER(1071) : 0)
 	 goto d;
-  if (pthread_key_create (&context_storage, NULL) ? IER(997) : 0)
+  if (pthread_key_create (&context_storage, NULL) ? IER(1072) : 0)
 	 goto e;
+  if (pthread_key_create (&slab_storage, NULL) ? IER(1073) : 0)
+	 goto f;
+  if (pthread_key_create (&heap_storage, NULL) ? IER(1074) : 0)
+	 goto g;
+#endif
   return 1;
- e: pthread_key_delete (edge_map_storage);
- d: pthread_key_delete (destructors_storage);
- c: pthread_key_delete (graph_specific_storage);
- b: pthread_key_delete (killed_storage);
- a: pthread_key_delete (edge_storage);
+#ifndef THREAD_LOCAL
+ g: pthread_key_delete (slab_storage);
+ f: pthread_key_delete (context_storage);
+ e: pthread_key_delete (destructors_storage);
+ d: pthread_key_delete (edge_storage);
+ c: pthread_key_delete (edge_map_storage);
+#endif
+ b: pthread_key_delete (graph_specific_storage);
+ a: pthread_key_delete (killed_storage);
   return 0;
 }
 
@@ -88,18 +119,24 @@ release_pthread_resources (err)
 
 	  // Release pthread related resources.
 {
+#ifndef THREAD_LOCAL
+  if (pthread_key_delete (heap_storage))
+	 IER(1075);
+  if (pthread_key_delete (slab_storage))
+	 IER(1076);
   if (pthread_key_delete (context_storage))
-	 IER(998);
-  if (pthread_key_delete (edge_map_storage))
-	 IER(999);
+	 IER(1077);
   if (pthread_key_delete (edge_storage))
-	 IER(1000);
+	 IER(1078);
+  if (pthread_key_delete (destructors_storage))
+	 IER(1079);
+#endif
+  if (pthread_key_delete (edge_map_storage))
+	 IER(1080);
   if (pthread_key_delete (graph_specific_storage))
-	 IER(1001);
+	 IER(1081);
   if (pthread_key_delete (killed_storage))
-	 IER(1002);
-  if (pthread_key_delete (destructors_storage))
-	 IER(1003);
+	 IER(1082);
 }
 
 
@@ -138,7 +175,12 @@ _cru_set_context (c, err)
 {
   if (NOMEM)
 	 return *err;
-  return (pthread_setspecific (context_storage, (void *) c) ? IER(1004) : 0);
+#ifdef THREAD_LOCAL
+  connected.co_context = c;
+  return 0;
+#else
+  return (pthread_setspecific (context_storage, (void *) c) ? IER(1083) : 0);
+#endif
 }
 
 
@@ -154,7 +196,12 @@ _cru_set_edges (edge, err)
 {
   if (NOMEM)
 	 return *err;
-  return (pthread_setspecific (edge_storage, (void *) edge) ? IER(1005) : 0);
+#ifdef THREAD_LOCAL
+  connected.co_edges = edge;
+  return 0;
+#else
+  return (pthread_setspecific (edge_storage, (void *) edge) ? IER(1084) : 0);
+#endif
 }
 
 
@@ -171,7 +218,7 @@ _cru_set_edge_maps (pair, err)
 {
   if (NOMEM)
 	 return *err;
-  return (pthread_setspecific (edge_map_storage, (void *) pair) ? IER(1006) : 0);
+  return (pthread_setspecific (edge_map_storage, (void *) pair) ? IER(1085) : 0);
 }
 
 
@@ -189,7 +236,12 @@ _cru_set_destructors (destructors, err)
 {
   if (NOMEM)
 	 return *err;
-  return (pthread_setspecific (destructors_storage, (void *) destructors) ? IER(1007) : 0);
+#ifdef THREAD_LOCAL
+  connected.co_destructors = destructors;
+  return 0;
+#else
+  return (pthread_setspecific (destructors_storage, (void *) destructors) ? IER(1086) : 0);
+#endif
 }
 
 
@@ -208,7 +260,7 @@ _cru_set_kill_switch (killed, err)
 {
   if (NOMEM)
          return *err;
-  return (pthread_setspecific (killed_storage, (void *) killed) ? IER(1008) : 0);
+  return (pthread_setspecific (killed_storage, (void *) killed) ? IER(1087) : 0);
 }
 
 
@@ -226,7 +278,94 @@ _cru_set_storage (t, err)
 {
   if (NOMEM)
 	 return *err;
-  return (pthread_setspecific (graph_specific_storage, t) ? IER(1009) : 0);
+  return (pthread_setspecific (graph_specific_storage, t) ? IER(1088) : 0);
+}
+
+
+
+
+
+
+
+int
+_cru_set_slabs (s, err)
+	  slab *s;
+	  int *err;
+
+	  // Store a list of slabs in the thread specific storage area for slabs.
+{
+  if (NOMEM)
+	 return *err;
+#ifdef THREAD_LOCAL
+  connected.co_slabs = s;
+  return 0;
+#else
+  return (pthread_setspecific (slab_storage, (void *) s) ? IER(1089) : 0);
+#endif
+}
+
+
+
+
+
+
+
+int
+_cru_set_heaped (h, err)
+	  int h;
+	  int *err;
+
+	  // Store a flag meaning that nodes and edges freed by the calling
+	  // thread are known to be from the heap. Unlike the other setters,
+	  // this one isn't subject to simulated allocation failures because
+	  // leaving the flag clear is always safe.
+{
+#ifdef THREAD_LOCAL
+  heaped = h;
+  return 0;
+#else
+  return (pthread_setspecific (heap_storage, h ? (void *) &heap_storage : NULL) ? IER(1090) : 0);
+#endif
+}
+
+
+
+
+
+
+
+void
+_cru_clear_specifics (err)
+	  int *err;
+
+	  // Clear all thread specific storage so that a pooled thread
+	  // starting its next job doesn't inherit pointers into the stack
+	  // frame of its previous one.
+{
+#ifdef THREAD_LOCAL
+  connected.co_context = NULL;
+  connected.co_slabs = NULL;
+  connected.co_edges = NULL;
+  connected.co_destructors = NULL;
+  heaped = 0;
+#else
+  if (pthread_setspecific (heap_storage, NULL) ? IER(1091) : 0)
+	 return;
+  if (pthread_setspecific (context_storage, NULL) ? IER(1092) : 0)
+	 return;
+  if (pthread_setspecific (slab_storage, NULL) ? IER(1093) : 0)
+	 return;
+  if (pthread_setspecific (edge_storage, NULL) ? IER(1094) : 0)
+	 return;
+  if (pthread_setspecific (destructors_storage, NULL) ? IER(1095) : 0)
+	 return;
+#endif
+  if (pthread_setspecific (edge_map_storage, NULL) ? IER(1096) : 0)
+	 return;
+  if (pthread_setspecific (killed_storage, NULL) ? IER(1097) : 0)
+	 return;
+  if (pthread_setspecific (graph_specific_storage, NULL))
+	 IER(1098);
 }
 
 
@@ -238,12 +377,16 @@ _cru_set_storage (t, err)
 context *
 _cru_get_context (void)
 
-	  // Retrieve the edge list from thread specific storage.
+	  // Retrieve the context from thread specific storage.
 {
+#ifdef THREAD_LOCAL
+  return connected.co_context;
+#else
   uintptr_t s;
 
   s = (uintptr_t) pthread_getspecific (context_storage);
   return (context *) s;
+#endif
 }
 
 
@@ -256,7 +399,11 @@ _cru_get_edges (void)
 
 	  // Retrieve the edge list from thread specific storage.
 {
+#ifdef THREAD_LOCAL
+  return connected.co_edges;
+#else
   return (edge_list *) pthread_getspecific (edge_storage);
+#endif
 }
 
 
@@ -284,7 +431,11 @@ _cru_get_destructors (void)
 
 	  // Retrieve the destructors from thread specific storage.
 {
+#ifdef THREAD_LOCAL
+  return connected.co_destructors;
+#else
   return (cru_destructor_pair) pthread_getspecific (destructors_storage);
+#endif
 }
 
 
@@ -313,3 +464,68 @@ _cru_get_storage (void)
 {
   return (void *) pthread_getspecific (graph_specific_storage);
 }
+
+
+
+
+
+
+
+slab *
+_cru_get_slabs (void)
+
+	  // Retrieve the slabs from thread specific storage.
+{
+#ifdef THREAD_LOCAL
+  return connected.co_slabs;
+#else
+  return (slab *) pthread_getspecific (slab_storage);
+#endif
+}
+
+
+
+
+
+
+
+int
+_cru_get_heaped (void)
+
+	  // Retrieve the flag meaning nodes and edges being freed are from the heap.
+{
+#ifdef THREAD_LOCAL
+  return heaped;
+#else
+  return ! ! pthread_getspecific (heap_storage);
+#endif
+}
+
+
+
+
+
+
+
+connection
+_cru_connection (fallback)
+	  connection fallback;
+
+	  // Return the state consulted by cru_connect in one step. With
+	  // compiler supported thread-local storage it's the address of
+	  // the calling thread's own copy and the fallback is ignored, but
+	  // otherwise it's gathered from thread specific storage into the
+	  // fallback.
+{
+#ifdef THREAD_LOCAL
+  return &connected;
+#else
+  if (! fallback)
+	 return NULL;
+  fallback->co_context = (context *) pthread_getspecific (context_storage);
+  fallback->co_edges = (edge_list *) pthread_getspecific (edge_storage);
+  fallback->co_destructors = (cru_destructor_pair) pthread_getspecific (destructors_storage);
+  fallback->co_slabs = (slab *) pthread_getspecific (slab_storage);
+  return fallback;
+#endif
+}
@@ -34,6 +34,16 @@ extern "C"
 
 typedef enum {IDLE, BUILDING, STRETCHING, GENERAL} context;
 
+// everything cru_connect consults on each call, fetched together
+
+struct connection_s
+{
+  context *co_context;                  // should be BUILDING when cru_connect is called
+  edge_list *co_edges;                  // where cru_connect pushes new edges
+  cru_destructor_pair co_destructors;   // for labels and termini of edges that can't be created
+  slab *co_slabs;                       // where new edges are carved in arena mode, if not NO_SLABS
+};
+
 extern int
 _cru_open_getset (int *err);
 
@@ -73,6 +83,24 @@ _cru_set_storage (void *t, int *err);
 extern void *
 _cru_get_storage (void);
 
+extern int
+_cru_set_slabs (slab *s, int *err);
+
+extern slab *
+_cru_get_slabs (void);
+
+extern int
+_cru_set_heaped (int h, int *err);
+
+extern int
+_cru_get_heaped (void);
+
+extern connection
+_cru_connection (connection fallback);
+
+extern void
+_cru_clear_specifics (int *err);
+
 extern void
 _cru_close_getset (void);
 
@@ -20,8 +20,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <nthm/nthm.h>
+#include "arena.h"
 #include "edges.h"
 #include "errs.h"
+#include "getset.h"
 #include "graph.h"
 #include "nodes.h"
 #include "pack.h"
@@ -48,7 +50,7 @@ _cru_open_graph (err)
 
 	  // Initialize pthread resources.
 {
-  return ! (pthread_rwlock_init (&graph_lock, NULL) ? IER(1010) : 0);
+  return ! (pthread_rwlock_init (&graph_lock, NULL) ? IER(1099) : 0);
 }
 
 
@@ -61,7 +63,7 @@ _cru_close_graph (void)
 	  // Do this when the process exits.
 {
   if (pthread_rwlock_destroy (&graph_lock))
-	 _cru_globally_throw (THE_IER(1011));
+	 _cru_globally_throw (THE_IER(1100));
 }
 
 
@@ -85,9 +87,9 @@ _cru_graph_of (s, base, n, err)
 {
   cru_graph g;
 
-  if (*err ? 1 : (! base) ? IER(1012) : (! *base) ? 1 : (! n) ? 0 : n->previous ? IER(1013) : 0)
+  if (*err ? 1 : (! base) ? IER(1101) : (! *base) ? 1 : (! n) ? 0 : n->previous ? IER(1102) : 0)
 	 goto a;
-  if ((! s) ? IER(1014) : (g = (cru_graph) _cru_malloc (sizeof (*g))) ? 0 : RAISE(ENOMEM))
+  if ((! s) ? IER(1103) : (g = (cru_graph) _cru_malloc (sizeof (*g))) ? 0 : RAISE(ENOMEM))
 	 goto a;
   memset (g, 0, sizeof (*g));
   memcpy (&(g->g_sig), s, sizeof (g->g_sig));
@@ -116,13 +118,23 @@ _cru_free_now (g, err)
 	  cru_graph g;
 	  int *err;
 
-	  // Free a graph sequentially.
+	  // Free a graph sequentially. If it's razable, its nodes and
+	  // edges needn't be visited because they're all in its slabs, and
+	  // if it owns no slabs, they needn't be looked up in the arena.
 {
+  int h;
 
   if ((! g) ? 1 : (*err == CRU_BADGPH))
 	 return;
- if ((g->glad == GRAPH_MAGIC) ? 1 : ! IER(1015))
-	_cru_free_nodes (g->nodes, &(g->g_sig.destructors), err);
+  h = _cru_get_heaped ();
+ if ((g->glad == GRAPH_MAGIC) ? (! _cru_razable (g)) : ! IER(1104))
+	{
+	  _cru_set_heaped (! (g->g_slabs), err);
+	  _cru_free_nodes (g->nodes, &(g->g_sig.destructors), err);
+	  _cru_set_heaped (h, err);
+	}
+  _cru_free_slabs (g->g_slabs, err);
+  g->g_slabs = NULL;
   g->glad = MUGGLE(16);
   _cru_free (g);
 }
@@ -134,6 +146,32 @@ _cru_free_now (g, err)
 
 
 
+int
+_cru_razable (g)
+	  cru_graph g;
+
+	  // Return non-zero if a graph was built in arena mode, hasn't
+	  // been altered by any operation that could have allocated nodes
+	  // or edges outside of its slabs, has no back edges left over
+	  // from a read-only operation, and has no destructors.
+{
+  int err;
+
+  err = 0;
+  if ((! g) ? 1 : (g->glad != GRAPH_MAGIC) ? 1 : (! (g->g_slabs)) ? 1 : g->g_mixed)
+	 return 0;
+  if (g->g_sig.destructors.v_free ? 1 : ! ! (g->g_sig.destructors.e_free))
+	 return 0;
+  return (_cru_half_duplex (g, &err) ? (! err) : 0);
+}
+
+
+
+
+
+
+
+
 static void
 freeing_slacker (g)
 	  cru_graph g;
@@ -195,16 +233,16 @@ _cru_freeing_task (s, err)
 
   seen = NULL;
   memset (&buffer, 0, sizeof (buffer));
-  if ((! s) ? IER(1016) : (s->gruntled != PORT_MAGIC) ? IER(1017) : 0)
+  if ((! s) ? IER(1105) : (s->gruntled != PORT_MAGIC) ? IER(1106) : 0)
 	 goto a;
-  if ((! (r = s->local)) ? IER(1018) : (r->valid != ROUTER_MAGIC) ? IER(1019) : 0)
+  if ((! (r = s->local)) ? IER(1107) : (r->valid != ROUTER_MAGIC) ? IER(1108) : 0)
 	 goto a;
-  if (((destinations = s->peers)) ? 0 : IER(1020))
+  if (((destinations = s->peers)) ? 0 : IER(1109))
 	 goto b;
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (s, destinations, err));)
 	 {
 		_cru_free_edges_and_labels (r->ro_sig.destructors.e_free, incoming->carrier, err);
-		if ((n = (node_list) incoming->payload) ? RECORDED(n) : IER(1021))
+		if ((n = (node_list) incoming->payload) ? RECORDED(n) : IER(1110))
 		  goto c;
 		if (! _cru_unscatterable (&(n->edges_out), n, r->ro_sig.destructors.e_free, destinations, err))
 		  goto d;
@@ -286,13 +324,13 @@ _cru_half_duplex (g, err)
 
   if (! g)
 	 return 1;
-  if ((g->glad != GRAPH_MAGIC) ? IER(1022) : 0)
+  if ((g->glad != GRAPH_MAGIC) ? IER(1111) : 0)
 	 return 1;
-  if (((n = g->base_node) ? 0 : IER(1023)) ? (g->glad = MUGGLE(18)) : 0)
+  if (((n = g->base_node) ? 0 : IER(1112)) ? (g->glad = MUGGLE(18)) : 0)
 	 return 0;
   if (! (e = n->edges_out))
-	 return (n->edges_in ? IER(1024) : 1);
-  if ((m = e->remote.node) ? 0 : IER(1025))
+	 return (n->edges_in ? IER(1113) : 1);
+  if ((m = e->remote.node) ? 0 : IER(1114))
 	 return 0;
   return (! (m->edges_in));
 }
@@ -313,7 +351,7 @@ _cru_compatible (g, b, err)
 {
   if (! b)
 	 return 1;
-  if (g ? 0 : IER(1026))
+  if (g ? 0 : IER(1115))
 	 return 0;
   if (g->g_sig.destructors.v_free != b->v_op.vertex.m_free)
 	 return 0;
@@ -339,7 +377,7 @@ _cru_identical (l, r, err)
 {
   if (l == r)
 	 return 1;
-  if ((! l) ? IER(1027) : (! r) ? IER(1028) : 0)
+  if ((! l) ? IER(1116) : (! r) ? IER(1117) : 0)
 	 return 0;
   if ((l->orders.v_order.hash == r->orders.v_order.hash) ? 0 : RAISE(CRU_INCSPB))
 	 return 0;
@@ -377,13 +415,13 @@ _cru_store (g, s, err)
 
 	  // Associate arbitrary user-defined data with a graph.
 {
-  if ((! g) ? IER(1029) : (g->glad != GRAPH_MAGIC) ? IER(1030) : 0)
+  if ((! g) ? IER(1118) : (g->glad != GRAPH_MAGIC) ? IER(1119) : 0)
 	 return;
-  if (pthread_rwlock_wrlock (&graph_lock) ? IER(1031) : 0)
+  if (pthread_rwlock_wrlock (&graph_lock) ? IER(1120) : 0)
 	 return;
   g->g_store = s;
   if (pthread_rwlock_unlock (&graph_lock))
-	 IER(1032);
+	 IER(1121);
 }
 
 
@@ -400,13 +438,13 @@ _cru_retrieval (g, err)
 {
   void *s;
 
-  if ((! g) ? IER(1033) : (g->glad != GRAPH_MAGIC) ? IER(1034) : 0)
+  if ((! g) ? IER(1122) : (g->glad != GRAPH_MAGIC) ? IER(1123) : 0)
 	 return NULL;
-  if (pthread_rwlock_rdlock (&graph_lock) ? IER(1035) : 0)
+  if (pthread_rwlock_rdlock (&graph_lock) ? IER(1124) : 0)
 	 return NULL;
   s = g->g_store;
   if (pthread_rwlock_unlock (&graph_lock))
-	 IER(1036);
+	 IER(1125);
   return s;
 }
 
@@ -19,6 +19,7 @@
 #ifndef CRU_GRAPH_H
 #define CRU_GRAPH_H 1
 
+#include "count.h"
 #include "ptr.h"
 
 // arbitrary magic number for consistency checks
@@ -33,6 +34,9 @@ struct cru_graph_s
   node_list nodes;                // a list whereby all nodes in the graph are accessible in an unspecified order
   struct cru_sig_s g_sig;         // description of the graph to be updated when built, merged, or mutated
   void *g_store;                  // user defined storage associated with a graph
+  slab g_slabs;                   // storage for nodes and edges if the graph was built in arena mode
+  int g_mixed;                    // non-zero if nodes or edges may have been allocated outside of the slabs
+  struct census_s g_census;       // cached cardinalities of the graph
 };
 
 #ifdef __cplusplus
@@ -66,6 +70,10 @@ _cru_free_now (cru_graph g, int *err);
 extern void
 _cru_free_later (cru_graph g, int *err);
 
+// return non-zero if a graph can be freed by releasing its slabs without visiting its nodes
+extern int
+_cru_razable (cru_graph g);
+
 // cru worker for freeing a graph concurrently
 extern void *
 _cru_freeing_task (port s, int *err);
@@ -0,0 +1,981 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// An edge list is a text file with one edge per line. Each line has
+// the source and the terminus of an edge followed by its label if the
+// edges are labeled, as unsigned numbers in decimal or in hexadecimal
+// with a leading 0x, separated by spaces, tabs, or commas. Blank
+// lines and lines starting with a # are ignored. A binary edge list
+// has the same fields as 64 bit words in native byte order with
+// nothing in between. The file is mapped into memory and split into
+// parcels at line or record boundaries, which are parsed and sorted
+// by their sources concurrently in separate threads. The parcels are
+// then merged into a graph whose nodes are in ascending order of their
+// vertices and allocated in slabs laid out like those of a frozen
+// graph, with the edges of each node following those of the node
+// before it. The merging is also concurrent, with each thread taking
+// a separate range of vertices sampled from the parcels, and the
+// terminus of every edge is found by a binary search over an index of
+// the nodes of all ranges. The arrays used here are sized by the file
+// and can be bigger than anything the allocation tracker in wrap.c
+// expects, so their allocations are simulated by NOMEM.
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <nthm/nthm.h>
+#include "arena.h"
+#include "count.h"
+#include "edges.h"
+#include "errs.h"
+#include "graph.h"
+#include "import.h"
+#include "nodes.h"
+#include "save.h"
+#include "wrap.h"
+
+// the number of words in a record of a binary edge list
+#define FIELDS(i) ((i)->labeled ? 3 : 2)
+
+// non-zero if a character can precede or follow a field
+#define BLANK(c) (((c) == ' ') ? 1 : ((c) == '\t') ? 1 : ((c) == '\r'))
+
+// non-zero if a character can separate two fields
+#define SEPARATOR(c) (BLANK(c) ? 1 : ((c) == ','))
+
+
+
+
+// --------------- parsing ---------------------------------------------------------------------------------
+
+
+
+
+static void *
+bought (n, err)
+	  size_t n;
+	  int *err;
+
+	  // Allocate an array of n bytes.
+{
+  void *p;
+
+  if (*err ? 1 : NOMEM ? RAISE(ENOMEM) : (p = malloc (n ? n : 1)) ? 0 : RAISE(ENOMEM))
+	 return NULL;
+  return p;
+}
+
+
+
+
+
+
+
+static int
+by_source (a, b)
+	  const void *a;
+	  const void *b;
+
+	  // Compare two edges by their sources and then by their termini
+	  // for qsort.
+{
+  const struct arc_s *x = (const struct arc_s *) a;
+  const struct arc_s *y = (const struct arc_s *) b;
+
+  if (x->source != y->source)
+	 return ((x->source < y->source) ? -1 : 1);
+  return ((x->terminus < y->terminus) ? -1 : (x->terminus > y->terminus) ? 1 : 0);
+}
+
+
+
+
+
+
+
+static int
+ascending (a, b)
+	  const void *a;
+	  const void *b;
+
+	  // Compare two vertices for qsort.
+{
+  uintptr_t x = *(const uintptr_t *) a;
+  uintptr_t y = *(const uintptr_t *) b;
+
+  return ((x < y) ? -1 : (x > y) ? 1 : 0);
+}
+
+
+
+
+
+
+
+static const char *
+number_read (p, end, n, err)
+	  const char *p;
+	  const char *end;
+	  uintptr_t *n;
+	  int *err;
+
+	  // Parse an unsigned decimal or hexadecimal number at p into *n
+	  // and return the address following it.
+{
+  uintptr_t b, d, x;
+  const char *q;
+
+  b = 10;
+  if ((end - p > 2) ? ((p[0] == '0') ? ((p[1] == 'x') ? 1 : (p[1] == 'X')) : 0) : 0)
+	 {
+		b = 16;
+		p += 2;
+	 }
+  for (x = d = 0, q = p; *err ? 0 : (p < end); p++, x = x * b + d)
+	 {
+		if ((*p >= '0') ? (*p <= '9') : 0)
+		  d = (uintptr_t) (*p - '0');
+		else if ((b != 16) ? 0 : (*p >= 'a') ? (*p <= 'f') : 0)
+		  d = (uintptr_t) (*p - 'a' + 10);
+		else if ((b != 16) ? 0 : (*p >= 'A') ? (*p <= 'F') : 0)
+		  d = (uintptr_t) (*p - 'A' + 10);
+		else
+		  break;
+		if (x > (UINTPTR_MAX - d) / b)
+		  RAISE(CRU_BADFIL);
+	 }
+  if (*err ? 1 : (p == q) ? RAISE(CRU_BADFIL) : 0)
+	 return end;
+  *n = x;
+  return p;
+}
+
+
+
+
+
+
+
+static const char *
+separated (p, end, err)
+	  const char *p;
+	  const char *end;
+	  int *err;
+
+	  // Return the address following the separator between two fields
+	  // at p.
+{
+  const char *q;
+
+  for (q = p; (q < end) ? SEPARATOR(*q) : 0; q++);
+  return (((q == p) ? RAISE(CRU_BADFIL) : 0) ? end : q);
+}
+
+
+
+
+
+
+
+static int
+arc_read (p, end, labeled, a, err)
+	  const char **p;
+	  const char *end;
+	  int labeled;
+	  arc a;
+	  int *err;
+
+	  // Parse a line of a text edge list starting at *p into an edge and
+	  // advance *p to the next line. Return non-zero if the line
+	  // wasn't blank or a comment.
+{
+  const char *q;
+  int found;
+
+  for (q = *p; (q < end) ? BLANK(*q) : 0; q++);
+  if ((found = ((q < end) ? ((*q == '\n') ? 0 : (*q != '#')) : 0)))
+	 {
+		q = number_read (q, end, &(a->source), err);
+		q = number_read (separated (q, end, err), end, &(a->terminus), err);
+		a->label = 0;
+		if (labeled)
+		  q = number_read (separated (q, end, err), end, &(a->label), err);
+		for (; (q < end) ? BLANK(*q) : 0; q++);
+		if ((q < end) ? (*q != '\n') : 0)
+		  RAISE(CRU_BADFIL);
+	 }
+  for (; (q < end) ? (*q != '\n') : 0; q++);
+  *p = ((q < end) ? (q + 1) : end);
+  return (*err ? 0 : found);
+}
+
+
+
+
+
+
+
+static parcel
+parcel_parsed (p, err)
+	  parcel p;
+	  int *err;
+
+	  // Parse and sort the edges in a parcel and collect their
+	  // distinct termini. This function runs in a separate thread for
+	  // each parcel.
+{
+  uintptr_t lines, i, j;
+  uint64_t w[3];
+  const char *q;
+  size_t width;
+
+  if ((! p) ? IER(1126) : (! (p->importer)) ? IER(1127) : 0)
+	 return p;
+  width = (size_t) FIELDS(p->importer) * sizeof (uint64_t);
+  if (p->importer->binary)
+	 lines = (uintptr_t) ((size_t) (p->end - p->start) / width);
+  else
+	 for (lines = 1, q = p->start; q < p->end; q++)
+		lines += (*q == '\n');
+  if (! (p->arcs = (arc) bought (lines * sizeof (*(p->arcs)), err)))
+	 return p;
+  if (p->importer->binary)
+	 for (w[2] = 0, q = p->start; *err ? 0 : (q < p->end); q += width)
+		{
+		  memcpy (w, q, width);
+		  if ((w[0] != (uint64_t) (uintptr_t) w[0]) ? 1 : (w[1] != (uint64_t) (uintptr_t) w[1]) ? 1 : (w[2] != (uint64_t) (uintptr_t) w[2]))
+			 RAISE(CRU_BADFIL);
+		  p->arcs[p->arc_count].source = (uintptr_t) w[0];
+		  p->arcs[p->arc_count].terminus = (uintptr_t) w[1];
+		  p->arcs[p->arc_count++].label = (uintptr_t) w[2];
+		}
+  else
+	 for (q = p->start; *err ? 0 : (q < p->end);)
+		p->arc_count += (uintptr_t) arc_read (&q, p->end, p->importer->labeled, &(p->arcs[p->arc_count]), err);
+  if (*err ? 1 : ! (p->arc_count))
+	 return p;
+  qsort (p->arcs, (size_t) p->arc_count, sizeof (*(p->arcs)), by_source);
+  if (! (p->termini = (uintptr_t *) bought ((size_t) p->arc_count * sizeof (*(p->termini)), err)))
+	 return p;
+  for (i = 0; i < p->arc_count; i++)
+	 p->termini[i] = p->arcs[i].terminus;
+  qsort (p->termini, (size_t) p->arc_count, sizeof (*(p->termini)), ascending);
+  for (i = j = 0; i < p->arc_count; i++)
+	 if (j ? (p->termini[j - 1] != p->termini[i]) : 1)
+		p->termini[j++] = p->termini[i];
+  p->terminus_count = j;
+  return p;
+}
+
+
+
+
+
+
+
+static parcel
+parcels_of (i, start, end, lanes, n, err)
+	  cru_importer i;
+	  const char *start;
+	  const char *end;
+	  unsigned lanes;
+	  uintptr_t *n;              // set to the number of parcels
+	  int *err;
+
+	  // Split a mapped file into parcels of roughly equal size at line
+	  // or record boundaries, at most one per lane, and not so many
+	  // that any is smaller than PARCEL_SIZE.
+{
+  uintptr_t records, j;
+  const char *q;
+  size_t width;
+  size_t size;
+  parcel p;
+
+  size = (size_t) (end - start);
+  width = (i->binary ? ((size_t) FIELDS(i) * sizeof (uint64_t)) : 1);
+  if ((size % width) ? RAISE(CRU_BADFIL) : 0)
+	 return NULL;
+  records = (uintptr_t) (size / width);
+  if ((*n = (uintptr_t) (size / PARCEL_SIZE + 1)) > lanes)
+	 *n = lanes;
+  if (! (p = (parcel) bought ((size_t) *n * sizeof (*p), err)))
+	 return NULL;
+  memset (p, 0, (size_t) *n * sizeof (*p));
+  for (q = start, j = 0; j < *n; j++)
+	 {
+		p[j].importer = i;
+		p[j].start = q;
+		if ((q = start + (size_t) ((records * (j + 1)) / *n) * width) < p[j].start)
+		  q = p[j].start;
+		for (; i->binary ? 0 : (q == p[j].start) ? 0 : (q < end) ? (q[-1] != '\n') : 0; q++);
+		p[j].end = q;
+	 }
+  return p;
+}
+
+
+
+
+
+
+
+static void
+parcels_parsed (p, n, err)
+	  parcel p;
+	  uintptr_t n;
+	  int *err;
+
+	  // Parse every parcel concurrently, or in the calling thread if
+	  // there's only one.
+{
+  nthm_pipe t;
+  uintptr_t j;
+
+  if (*err ? 1 : (! n) ? 1 : (! p) ? IER(1128) : (n > 1) ? 0 : ! ! parcel_parsed (p, err))
+	 return;
+  if (NOMEM ? 1 : ! nthm_enter_scope (err))
+	 return;
+  for (j = 0; j < n; j++)
+	 if (NOMEM ? 1 : ! nthm_open ((nthm_worker) parcel_parsed, &(p[j]), err))
+		break;
+  while ((t = nthm_select (err)))
+	 nthm_read (t, err);
+  nthm_exit_scope (err);
+}
+
+
+
+
+
+
+
+static void
+parcels_freed (p, n)
+	  parcel p;
+	  uintptr_t n;
+
+	  // Free the parcels and everything parsed from them.
+{
+  uintptr_t j;
+
+  for (j = 0; p ? (j < n) : 0; j++)
+	 {
+		free (p[j].arcs);
+		free (p[j].termini);
+	 }
+  free (p);
+}
+
+
+
+
+// --------------- assembly --------------------------------------------------------------------------------
+
+
+
+
+static uintptr_t
+arc_bound (a, c, v)
+	  arc a;                     // edges in ascending order of their sources
+	  uintptr_t c;               // the number of edges
+	  uintptr_t v;
+
+	  // Return the position of the first edge whose source isn't less
+	  // than v, or c if there isn't one.
+{
+  uintptr_t l, h, m;
+
+  for (l = 0, h = c; l < h;)
+	 if (a[m = l + (h - l) / 2].source < v)
+		l = m + 1;
+	 else
+		h = m;
+  return l;
+}
+
+
+
+
+
+
+
+static uintptr_t
+vertex_bound (x, c, v)
+	  uintptr_t *x;              // vertices in ascending order
+	  uintptr_t c;               // the number of vertices
+	  uintptr_t v;
+
+	  // Return the position of the first vertex that isn't less than
+	  // v, or c if there isn't one.
+{
+  uintptr_t l, h, m;
+
+  for (l = 0, h = c; l < h;)
+	 if (x[m = l + (h - l) / 2] < v)
+		l = m + 1;
+	 else
+		h = m;
+  return l;
+}
+
+
+
+
+
+
+
+static void
+spanned (t)
+	  tract t;
+
+	  // Position the span of every parcel at the first of its edges
+	  // and termini in a tract and limit it to the last of them.
+{
+  uintptr_t j;
+  parcel p;
+  span s;
+
+  for (j = 0; j < t->parcel_count; j++)
+	 {
+		p = &(t->parcels[j]);
+		s = &(t->spans[j]);
+		s->arcs_taken = arc_bound (p->arcs, p->arc_count, t->low);
+		s->arc_limit = (t->last ? p->arc_count : arc_bound (p->arcs, p->arc_count, t->high));
+		s->termini_taken = vertex_bound (p->termini, p->terminus_count, t->low);
+		s->terminus_limit = (t->last ? p->terminus_count : vertex_bound (p->termini, p->terminus_count, t->high));
+	 }
+}
+
+
+
+
+
+
+
+static int
+next_vertex (t, base, x)
+	  tract t;
+	  int *base;                 // non-zero if the base vertex hasn't been taken
+	  uintptr_t *x;              // set to the least vertex not yet taken
+
+	  // Find the least vertex not yet taken from the sources or termini
+	  // of the parcels in a tract or the base, take it from all of
+	  // them, and return non-zero if there was one.
+{
+  uintptr_t j, y;
+  parcel p;
+  span s;
+  int found;
+
+  found = *base;
+  *x = t->base;
+  for (j = 0; j < t->parcel_count; j++)
+	 {
+		p = &(t->parcels[j]);
+		s = &(t->spans[j]);
+		if ((s->arcs_taken < s->arc_limit) ? ((y = p->arcs[s->arcs_taken].source), (found ? (y < *x) : 1)) : 0)
+		  {
+			 *x = y;
+			 found = 1;
+		  }
+		if ((s->termini_taken < s->terminus_limit) ? ((y = p->termini[s->termini_taken]), (found ? (y < *x) : 1)) : 0)
+		  {
+			 *x = y;
+			 found = 1;
+		  }
+	 }
+  if (! found)
+	 return 0;
+  *base = (*base ? (t->base != *x) : 0);
+  for (j = 0; j < t->parcel_count; j++)
+	 {
+		p = &(t->parcels[j]);
+		s = &(t->spans[j]);
+		while ((s->arcs_taken < s->arc_limit) ? (p->arcs[s->arcs_taken].source == *x) : 0)
+		  s->arcs_taken++;
+		if ((s->termini_taken < s->terminus_limit) ? (p->termini[s->termini_taken] == *x) : 0)
+		  s->termini_taken++;
+	 }
+  return 1;
+}
+
+
+
+
+
+
+
+static arc
+next_arc (t)
+	  tract t;
+
+	  // Take and return the edge with the least source not yet taken
+	  // from any parcel in a tract, if any.
+{
+  uintptr_t j, k;
+  span s;
+
+  for (k = t->parcel_count, s = t->spans, j = 0; j < t->parcel_count; j++)
+	 if ((s[j].arcs_taken < s[j].arc_limit) ? ((k == t->parcel_count) ? 1 : (t->parcels[j].arcs[s[j].arcs_taken].source < t->parcels[k].arcs[s[k].arcs_taken].source)) : 0)
+		k = j;
+  return ((k == t->parcel_count) ? NULL : &(t->parcels[k].arcs[s[k].arcs_taken++]));
+}
+
+
+
+
+
+
+
+static node_list
+node_search (k, c, v)
+	  node_list *k;              // nodes in ascending order of their vertices
+	  uintptr_t c;               // the number of nodes
+	  uintptr_t v;
+
+	  // Return the node with vertex v if any.
+{
+  uintptr_t l, h, m;
+
+  for (l = 0, h = c; l < h;)
+	 if ((uintptr_t) k[m = l + (h - l) / 2]->vertex < v)
+		l = m + 1;
+	 else
+		h = m;
+  return (((l < c) ? ((uintptr_t) k[l]->vertex == v) : 0) ? k[l] : NULL);
+}
+
+
+
+
+
+
+
+static int
+based (t)
+	  tract t;
+
+	  // Return non-zero if the base vertex is in a tract.
+{
+  return ((t->base < t->low) ? 0 : t->last ? 1 : (t->base < t->high));
+}
+
+
+
+
+
+
+
+static tract
+tract_counted (t, err)
+	  tract t;
+	  int *err;
+
+	  // Count the distinct vertices in a tract and the edges from
+	  // them. This function runs in a separate thread for each tract.
+{
+  uintptr_t j, x;
+  int base;
+
+  if ((! t) ? IER(1129) : 0)
+	 return t;
+  spanned (t);
+  for (j = 0; j < t->parcel_count; j++)
+	 t->edges += t->spans[j].arc_limit - t->spans[j].arcs_taken;
+  for (base = based (t); next_vertex (t, &base, &x); t->vertices++);
+  return t;
+}
+
+
+
+
+
+
+
+static tract
+tract_noded (t, err)
+	  tract t;
+	  int *err;
+
+	  // Create the nodes in a tract in ascending order of their
+	  // vertices and enter them into the index at their positions. This
+	  // function runs in a separate thread for each tract.
+{
+  node_list *n;
+  uintptr_t x, c;
+  slab cursor;
+  int base;
+
+  if ((! t) ? IER(1130) : (! (t->index)) ? IER(1131) : (! (t->vertices)) ? 1 : *err)
+	 return t;
+  if (! (cursor = t->node_slabs = _cru_slabs_for (t->vertices, sizeof (struct node_list_s), err)))
+	 return t;
+  spanned (t);
+  for (n = &(t->nodes), base = based (t), c = t->first; *err ? 0 : next_vertex (t, &base, &x); c++)
+	 {
+		if (! (*n = t->index[c] = (node_list) _cru_taken (&cursor, sizeof (**n), err)))
+		  break;
+		memset (*n, 0, sizeof (**n));
+		(*n)->vertex = (void *) x;
+		(*n)->previous = ((n == &(t->nodes)) ? NULL : n);
+		n = &((*n)->next_node);
+	 }
+  return t;
+}
+
+
+
+
+
+
+
+static tract
+tract_linked (t, err)
+	  tract t;
+	  int *err;
+
+	  // Create the edges from the nodes in a tract in ascending order
+	  // of their sources, find the terminus of each in the index, and
+	  // count the nodes in the tract with no outgoing edges. This
+	  // function runs in a separate thread for each tract.
+{
+  uintptr_t c, end;
+  edge_list *u;
+  slab cursor;
+  arc a;
+
+  if ((! t) ? IER(1132) : (! (t->index)) ? IER(1133) : *err)
+	 return t;
+  cursor = NULL;
+  if (t->edges ? (! (cursor = t->edge_slabs = _cru_slabs_for (t->edges, sizeof (struct edge_list_s), err))) : 0)
+	 return t;
+  spanned (t);
+  for (u = NULL, c = t->first, end = t->first + t->vertices; *err ? NULL : (a = next_arc (t));)
+	 {
+		if (u ? ((uintptr_t) t->index[c]->vertex != a->source) : 1)
+		  {
+			 while ((c < end) ? ((uintptr_t) t->index[c]->vertex != a->source) : 0)
+				c++;
+			 u = ((c < end) ? &(t->index[c]->edges_out) : NULL);
+		  }
+		if ((! u) ? IER(1134) : ! (*u = (edge_list) _cru_taken (&cursor, sizeof (**u), err)))
+		  break;
+		memset (*u, 0, sizeof (**u));
+		(*u)->label = (void *) a->label;
+		if (! ((*u)->remote.node = node_search (t->index, t->indexed, a->terminus)))
+		  IER(1135);
+		u = &((*u)->next_edge);
+	 }
+  for (c = t->first, end = t->first + t->vertices; *err ? 0 : (c < end); c++)
+	 t->termini += ! (t->index[c]->edges_out);
+  return t;
+}
+
+
+
+
+
+
+
+static void
+tracts_worked (t, m, w, err)
+	  tract t;
+	  uintptr_t m;
+	  nthm_worker w;
+	  int *err;
+
+	  // Apply a worker function to every tract concurrently, or in
+	  // the calling thread if there's only one.
+{
+  nthm_pipe q;
+  uintptr_t j;
+
+  if (*err ? 1 : (! m) ? 1 : (! t) ? IER(1136) : (m > 1) ? 0 : ! ! w (t, err))
+	 return;
+  if (NOMEM ? 1 : ! nthm_enter_scope (err))
+	 return;
+  for (j = 0; j < m; j++)
+	 if (NOMEM ? 1 : ! nthm_open (w, &(t[j]), err))
+		break;
+  while ((q = nthm_select (err)))
+	 nthm_read (q, err);
+  nthm_exit_scope (err);
+}
+
+
+
+
+
+
+
+static tract
+tracts_of (p, n, v, m, err)
+	  parcel p;
+	  uintptr_t n;
+	  uintptr_t v;               // the base vertex
+	  uintptr_t *m;              // set to the number of tracts
+	  int *err;
+
+	  // Divide the range of vertices into at most one tract per parcel
+	  // at vertices sampled evenly from the sorted edges and termini of
+	  // every parcel so that the tracts are of roughly equal size.
+{
+  uintptr_t *x, c, i, j;
+  tract t;
+  span s;
+
+  *m = 0;
+  if (! (x = (uintptr_t *) bought ((size_t) (n * 2 * SAMPLES) * sizeof (*x), err)))
+	 return NULL;
+  for (c = j = 0; j < n; j++)
+	 for (i = 0; i < SAMPLES; i++)
+		{
+		  if (p[j].arc_count)
+			 x[c++] = p[j].arcs[(p[j].arc_count * i) / SAMPLES].source;
+		  if (p[j].terminus_count)
+			 x[c++] = p[j].termini[(p[j].terminus_count * i) / SAMPLES];
+		}
+  qsort (x, (size_t) c, sizeof (*x), ascending);
+  t = (tract) bought ((size_t) n * sizeof (*t), err);
+  s = (span) bought ((size_t) (n * n) * sizeof (*s), err);
+  if (*err)
+	 goto a;
+  memset (t, 0, (size_t) n * sizeof (*t));
+  for (i = 1; i <= n; i++)
+	 if ((i == n) ? 1 : (! c) ? 0 : (x[(c * i) / n] > (*m ? t[*m - 1].high : 0)))
+		{
+		  t[*m].parcels = p;
+		  t[*m].parcel_count = n;
+		  t[*m].spans = &(s[*m * n]);
+		  t[*m].base = v;
+		  t[*m].low = (*m ? t[*m - 1].high : 0);
+		  if (! (t[*m].last = (i == n)))
+			 t[*m].high = x[(c * i) / n];
+		  ++*m;
+		}
+  free (x);
+  return t;
+ a: free (x);
+  free (t);
+  free (s);
+  return NULL;
+}
+
+
+
+
+
+
+
+static void
+tracts_freed (t, m, err)
+	  tract t;
+	  uintptr_t m;
+	  int *err;
+
+	  // Free the tracts and any slabs they still own.
+{
+  uintptr_t j;
+
+  for (j = 0; t ? (j < m) : 0; j++)
+	 {
+		_cru_free_slabs (t[j].edge_slabs, err);
+		_cru_free_slabs (t[j].node_slabs, err);
+	 }
+  if (t)
+	 free (t->spans);
+  free (t);
+}
+
+
+
+
+
+
+
+static uintptr_t
+reached (b, err)
+	  node_list b;
+	  int *err;
+
+	  // Return the number of nodes reachable from b by a breadth first
+	  // search that queues nodes through their marked fields. The
+	  // caller is responsible for clearing them.
+{
+  node_list q, t;
+  edge_list e;
+  uintptr_t c;
+
+  if ((! b) ? IER(1137) : 0)
+	 return 0;
+  for (c = 1, b->marked = SEEN, t = q = b; q != SEEN; q = (node_list) q->marked)
+	 for (e = q->edges_out; e; e = e->next_edge)
+		if (! (e->remote.node->marked))
+		  {
+			 c++;
+			 e->remote.node->marked = SEEN;
+			 t = (node_list) (t->marked = e->remote.node);
+		  }
+  return c;
+}
+
+
+
+
+
+
+
+static cru_graph
+graph_assembled (p, n, s, v, strays, err)
+	  parcel p;
+	  uintptr_t n;
+	  cru_sig s;
+	  uintptr_t v;
+	  uintptr_t *strays;         // if non-NULL, where to store the number of unreachable vertices dropped
+	  int *err;
+
+	  // Merge the sorted parcels into a graph with one node for each
+	  // distinct source, terminus, or base vertex. The range of
+	  // vertices is divided into tracts, each of which is counted,
+	  // given its nodes, and given their edges concurrently with the
+	  // others, with the nodes of all tracts indexed in between so
+	  // that the terminus of every edge can be found by a binary
+	  // search. Reject the graph if any node is unreachable from the
+	  // base unless there's a place to report them, and then drop
+	  // them instead, leaving their storage in the slabs until the
+	  // graph is freed.
+{
+  uintptr_t vertices, edges, termini, x, j, m;
+  slab node_slabs, edge_slabs;
+  node_list *k, b, nodes, *u;
+  cru_graph g;
+  edge_list e;
+  tract t;
+
+  g = NULL;
+  k = NULL;
+  if (! (t = tracts_of (p, n, v, &m, err)))
+	 return NULL;
+  tracts_worked (t, m, (nthm_worker) tract_counted, err);
+  for (vertices = edges = 0, j = 0; j < m; j++)
+	 {
+		t[j].first = vertices;
+		vertices += t[j].vertices;
+		edges += t[j].edges;
+	 }
+  if (! (k = (node_list *) bought ((size_t) vertices * sizeof (*k), err)))
+	 goto a;
+  for (j = 0; j < m; j++)
+	 {
+		t[j].index = k;
+		t[j].indexed = vertices;
+	 }
+  tracts_worked (t, m, (nthm_worker) tract_noded, err);
+  tracts_worked (t, m, (nthm_worker) tract_linked, err);
+  if (*err ? 1 : (b = node_search (k, vertices, v)) ? 0 : IER(1138))
+	 goto a;
+  for (termini = 0, j = 0; j < m; j++)
+	 termini += t[j].termini;
+  x = reached (b, err);
+  if (*err ? 1 : (x == vertices) ? 0 : strays ? 0 : RAISE(CRU_BADBAS))
+	 goto b;
+  for (nodes = NULL, u = &nodes, j = 0; j < vertices; j++)
+	 if (k[j]->marked)
+		{
+		  *(k[j]->previous = u) = k[j];
+		  u = &(k[j]->next_node);
+		}
+	 else
+		{
+		  if (! (k[j]->edges_out))
+			 termini--;
+		  for (e = k[j]->edges_out; e; e = e->next_edge)
+			 edges--;
+		}
+  *u = NULL;
+  nodes->previous = NULL;
+  if (strays)
+	 *strays = vertices - x;
+  if (! (g = _cru_graph_of (s, &b, nodes, err)))
+	 goto b;
+  for (node_slabs = edge_slabs = NULL, j = 0; j < m; t[j].node_slabs = t[j].edge_slabs = NULL, j++)
+	 {
+		node_slabs = _cru_cat_slabs (node_slabs, t[j].node_slabs);
+		edge_slabs = _cru_cat_slabs (edge_slabs, t[j].edge_slabs);
+	 }
+  g->g_slabs = _cru_cat_slabs (node_slabs, edge_slabs);
+  _cru_census_taken (g, VERTICES_COUNTED, x, err);
+  _cru_census_taken (g, EDGES_COUNTED, edges, err);
+  _cru_census_taken (g, TERMINI_COUNTED, termini, err);
+ b: for (j = 0; j < vertices; j++)
+	 k[j]->marked = NULL;
+ a: tracts_freed (t, m, err);
+  free (k);
+  return g;
+}
+
+
+
+
+// --------------- public ----------------------------------------------------------------------------------
+
+
+
+
+cru_graph
+_cru_imported (fd, i, s, v, lanes, err)
+	  int fd;
+	  cru_importer i;
+	  cru_sig s;
+	  uintptr_t v;
+	  unsigned lanes;
+	  int *err;
+
+	  // Map the rest of a file from its current offset into memory,
+	  // parse it as an edge list, and build a graph from it with the
+	  // base vertex v. An empty file makes a graph of only the base.
+{
+  const unsigned char *start, *end;
+  cru_graph g;
+  parcel p;
+  uintptr_t n;
+  void *m;
+
+  g = NULL;
+  p = NULL;
+  n = 0;
+  if ((! i) ? IER(1139) : (! s) ? IER(1140) : 0)
+	 return NULL;
+  start = end = NULL;
+  if ((m = _cru_mapped (fd, &start, &end, err)))
+	 p = parcels_of (i, (const char *) start, (const char *) end, lanes ? lanes : 1, &n, err);
+  parcels_parsed (p, n, err);
+  if (! *err)
+	 g = graph_assembled (p, n, s, v, i->strays, err);
+  parcels_freed (p, n);
+  if (m ? munmap (m, (size_t) (end - (const unsigned char *) m)) : 0)
+	 IER(1141);
+  if (*err ? 1 : (lseek (fd, (off_t) 0, SEEK_END) < 0) ? RAISE(errno) : 0)
+	 goto a;
+  return g;
+ a: _cru_free_now (g, err);
+  return NULL;
+}
@@ -0,0 +1,98 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CRU_IMPORT_H
+#define CRU_IMPORT_H 1
+
+// functions for building graphs from edge lists in files
+
+#include "ptr.h"
+
+// the least number of bytes worth parsing in a separate thread
+#define PARCEL_SIZE 0x1000
+
+// the number of vertices sampled from each parcel to choose the ranges assembled in separate threads
+#define SAMPLES 0x40
+
+// an edge parsed from a file
+
+struct arc_s
+{
+  uintptr_t source;                 // the vertex the edge leaves
+  uintptr_t terminus;               // the vertex the edge reaches
+  uintptr_t label;                  // zero for an unlabeled edge list
+};
+
+// a part of a mapped file parsed by one worker
+
+struct parcel_s
+{
+  const char *start;                // the first byte of the part
+  const char *end;                  // one past the last byte
+  cru_importer importer;            // how to parse it
+  arc arcs;                         // the edges parsed from it sorted by their sources
+  uintptr_t arc_count;
+  uintptr_t *termini;               // the distinct termini of the edges in ascending order
+  uintptr_t terminus_count;
+};
+
+// the edges and termini of a parcel falling within a tract
+
+struct span_s
+{
+  uintptr_t arcs_taken;             // the number of edges merged so far
+  uintptr_t arc_limit;              // one past the last edge whose source is in the tract
+  uintptr_t termini_taken;          // the number of termini merged so far
+  uintptr_t terminus_limit;         // one past the last terminus in the tract
+};
+
+// a range of vertices assembled into nodes by one worker
+
+struct tract_s
+{
+  parcel parcels;                   // every parcel
+  uintptr_t parcel_count;
+  span spans;                       // one for each parcel
+  uintptr_t base;                   // the base vertex
+  uintptr_t low;                    // the least vertex in the tract
+  uintptr_t high;                   // one past the greatest vertex in the tract unless it's the last
+  int last;                         // non-zero for the tract with no upper bound
+  node_list *index;                 // the nodes of every tract in ascending order of their vertices
+  uintptr_t indexed;                // the number of nodes in the index
+  uintptr_t first;                  // the position in the index of the first node in this tract
+  uintptr_t vertices;               // the number of nodes in this tract
+  uintptr_t edges;                  // the number of edges from them
+  uintptr_t termini;                // the number of them with no outgoing edges
+  node_list nodes;                  // the nodes in this tract in ascending order of their vertices
+  slab node_slabs;
+  slab edge_slabs;
+};
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// build a graph from an edge list read from a file descriptor by concurrent workers
+extern cru_graph
+_cru_imported (int fd, cru_importer i, cru_sig s, uintptr_t v, unsigned lanes, int *err);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -60,7 +60,7 @@ _cru_inferred_builder (b, v, err)
   if (! _cru_full_order (&(b_copy->bu_sig.orders.e_order), err))
 	 goto a;
   _cru_allow_undefined_order (&(b_copy->bu_sig.orders.e_order), err);
-  if (b_copy->bu_sig.orders.v_order.equal ? 0 : IER(1058))
+  if (b_copy->bu_sig.orders.v_order.equal ? 0 : IER(1163))
 	 goto a;
   if (FAILED(b_copy->bu_sig.orders.v_order.equal, v, v) ? RAISE(CRU_INCVEL) : 0)
 	 goto a;
@@ -246,7 +246,7 @@ _cru_inferred_splitter (x, s, err)
 {
   cru_splitter x_copy;
 
-  if ((! _cru_filled_sig (s, err)) ? 1 : (! s) ? IER(1059) : ! (x_copy = _cru_splitter_copy (x, err)))
+  if ((! _cru_filled_sig (s, err)) ? 1 : (! s) ? IER(1164) : ! (x_copy = _cru_splitter_copy (x, err)))
 	 return NULL;
   ALLOW (x_copy->fissile, (cru_bpred) _cru_true_bpred);
   if (! (_cru_filled_map (&(x_copy->sp_prop.vertex), err) ? _cru_filled_prop (&(x_copy->sp_prop), err) : 0))
@@ -316,7 +316,7 @@ inferred_merger (c, s, err)
 {
   cru_merger c_copy;
 
-  if ((! s) ? IER(1060) : ! (c_copy = _cru_merger_copy (c, err)))
+  if ((! s) ? IER(1165) : ! (c_copy = _cru_merger_copy (c, err)))
 	 return NULL;
   if (_cru_empty_prop (&(c_copy->me_kernel.v_op)))                                // if vertices are not to be fused
 	 {
@@ -376,7 +376,7 @@ _cru_inferred_merger (c, s, err)
 	  // as above but with extra validation not applicable to
 	  // deduplicators
 {
-  if ((! c) ? IER(1061) : 0)
+  if ((! c) ? IER(1166) : 0)
 	 return NULL;
   if ((_cru_empty_prop (&(c->me_kernel.v_op)) == _cru_empty_classifier (&(c->me_classifier))) ? 0 : RAISE(CRU_INCMRG))
 	 return NULL;
@@ -403,7 +403,7 @@ inferred_sig (s, o, k, err)
 {
   struct cru_sig_s n;
 
-  if ((! s) ? IER(1062) : (! o) ? IER(1063) : (! k) ? IER(1064) : 0)
+  if ((! s) ? IER(1167) : (! o) ? IER(1168) : (! k) ? IER(1169) : 0)
 	 return 0;
   memset (&n, 0, sizeof (n));
   memcpy (&(n.destructors), &(s->destructors), sizeof (n.destructors));
@@ -536,7 +536,7 @@ _cru_inferred_filter (f, s, err)
 {
   cru_filter f_copy;
 
-  if ((! s) ? IER(1065) : ! (f_copy = _cru_filter_copy (f, err)))
+  if ((! s) ? IER(1170) : ! (f_copy = _cru_filter_copy (f, err)))
 	 return NULL;
   if (f_copy->thinner ? _cru_empty_prop (&(f_copy->fi_kernel.v_op)) : 0)
 	 ALLOW (f_copy->fi_kernel.v_op.vertex.map, (cru_top) _cru_false_top);
@@ -586,7 +586,7 @@ _cru_deduplicator (s, err)
 {
   struct cru_merger_s c;
 
-  if (*err ? 1 : s ? 0 : IER(1066))
+  if (*err ? 1 : s ? 0 : IER(1171))
 	 goto a;
   memset (&c, 0, sizeof (c));
   memcpy (&(c.me_orders), &(s->orders), sizeof (c.me_orders));
@@ -626,7 +626,7 @@ _cru_inferred_postponer (p, s, err)
 {
   cru_postponer p_copy;
 
-  if ((! s) ? IER(1067) : ! (p_copy = _cru_postponer_copy (p, err)))
+  if ((! s) ? IER(1172) : ! (p_copy = _cru_postponer_copy (p, err)))
 	 return NULL;
   if (! (s->destructors.e_free))
 	 ALLOW (p_copy->postponement.bop, (cru_bop) _cru_identity_bop);
@@ -667,7 +667,7 @@ _cru_inferred_fabricator (a, s, err)
 {
   cru_fabricator a_copy;
 
-  if ((! s) ? IER(1068) : (! a) ? IER(1069) : ! (a_copy = _cru_fabricator_copy (a, err)))
+  if ((! s) ? IER(1173) : (! a) ? IER(1174) : ! (a_copy = _cru_fabricator_copy (a, err)))
 	 return NULL;
   if (a_copy->e_fab ? (! (a_copy->fa_sig.destructors.e_free)) : 0)
 	 {
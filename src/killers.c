@@ -30,46 +30,11 @@
 // arbitrary magic number for sanity checks
 #define KILL_MAGIC 1551557419
 
-// for exclusive access to routers' killed fields; the same one locks all of them
-static pthread_mutex_t killer_lock;
-
 #define CONTROL_ENTRY                  \
   if (err ? NULL : (err = &ignored))    \
     ignored = 0;                         \
 
 
-// --------------- initialization and teardown -------------------------------------------------------------
-
-
-
-
-int
-_cru_open_killers (err)
-	  int *err;
-
-	  // Initialize pthread resources.
-{
-  return ! _cru_mutex_init (&killer_lock, err);
-}
-
-
-
-
-
-
-
-void
-_cru_close_killers ()
-
-	  // Do this when the process exits.
-{
-  _cru_globally_throw (pthread_mutex_destroy (&killer_lock) ? THE_IER(1070) : 0);
-}
-
-
-
-
-
 // --------------- kill switch operations ------------------------------------------------------------------
 
 
@@ -91,7 +56,7 @@ _cru_new_kill_switch (err)
 	 goto a;
   memset (k, 0, sizeof (*k));
   k->deadly = KILL_MAGIC;
-  if (! (_cru_mutex_init (&(k->safety), err) ? IER(1071) : *err))
+  if (! (_cru_mutex_init (&(k->safety), err) ? IER(1175) : *err))
 	 goto a;
   k->deadly = MUGGLE(19);
   _cru_free (k);
@@ -118,12 +83,12 @@ _cru_enable_killing (k, r, err)
 
   if ((! k) ? 1 : (k->deadly != KILL_MAGIC) ? RAISE(CRU_BADKIL) : 0)
 	 return;
-  if ((pthread_mutex_lock (&(k->safety)) ? IER(1072) : 0) ? (k->deadly = MUGGLE(20)) : 0)
+  if ((pthread_mutex_lock (&(k->safety)) ? IER(1176) : 0) ? (k->deadly = MUGGLE(20)) : 0)
 	 return;
   k->killed = r;
   t = k->killable;
   k->killable = 0;
-  if (pthread_mutex_unlock (&(k->safety)) ? IER(1073) : 0)
+  if (pthread_mutex_unlock (&(k->safety)) ? IER(1177) : 0)
 	 k->deadly = MUGGLE(21);
   if (t)
 	 _cru_kill (r, err);
@@ -145,10 +110,10 @@ _cru_disable_killing (k, err)
 {
   if ((! k) ? 1 : (k->deadly != KILL_MAGIC) ? RAISE(CRU_BADKIL) : 0)
 	 return;
-  if ((! k) ? 1 : (pthread_mutex_lock (&(k->safety)) ? IER(1074) : 0) ? (k->deadly = MUGGLE(22)) : 0)
+  if ((! k) ? 1 : (pthread_mutex_lock (&(k->safety)) ? IER(1178) : 0) ? (k->deadly = MUGGLE(22)) : 0)
 	 return;
   k->killed = NULL;
-  if (pthread_mutex_unlock (&(k->safety)) ? IER(1075) : 0)
+  if (pthread_mutex_unlock (&(k->safety)) ? IER(1179) : 0)
 	 k->deadly = MUGGLE(23);
 }
 
@@ -164,13 +129,11 @@ _cru_kill (k, err)
 	  int *k;
 	  int *err;
 
-	  // Safely set the killed field in a router.
+	  // Atomically set the killed field in a router.
 {
-  if ((! k) ? 1 : pthread_mutex_lock (&killer_lock) ? IER(1076) : 0)
+  if (! k)
 	 return;
-  *k = KILLED_BY_USER;
-  if (pthread_mutex_unlock (&killer_lock))
-	 IER(1077);
+  __atomic_store_n (k, KILLED_BY_USER, __ATOMIC_RELAXED);
   RAISE(CRU_INTKIL);
 }
 
@@ -185,14 +148,11 @@ _cru_kill_internally (k, err)
 	  int *k;
 	  int *err;
 
-	  // Safely set the killed field in a router without raising a
+	  // Atomically set the killed field in a router without raising a
 	  // user-facing error.
 {
-  if ((! k) ? 1 : pthread_mutex_lock (&killer_lock) ? IER(1078) : 0)
-	 return;
-  *k = KILLED_INTERNALLY;
-  if (pthread_mutex_unlock (&killer_lock))
-	 IER(1079);
+  if (k)
+	 __atomic_store_n (k, KILLED_INTERNALLY, __ATOMIC_RELAXED);
 }
 
 
@@ -206,17 +166,10 @@ _cru_killed (k, err)
 	  int *k;
 	  int *err;
 
-	  // Safely poll the killed field in a router.
+	  // Poll the killed field in a router. Relaxed ordering is enough
+	  // because nothing else is published along with it.
 {
-  int t;
-
-  t = 0;
-  if ((! k) ? 1 : pthread_mutex_lock (&killer_lock) ? IER(1080) : 0)
-	 return 0;
-  t = *k;
-  if (pthread_mutex_unlock (&killer_lock))
-	 IER(1081);
-  return t;
+  return (k ? __atomic_load_n (k, __ATOMIC_RELAXED) : 0);
 }
 
 
@@ -231,18 +184,10 @@ _cru_killed_internally (k, err)
 	  int *k;
 	  int *err;
 
-	  // Safely poll the killed field in a router specifically for
-	  // internal kill events.
+	  // Poll the killed field in a router specifically for internal
+	  // kill events.
 {
-  int t;
-
-  t = 0;
-  if ((! k) ? 1 : pthread_mutex_lock (&killer_lock) ? IER(1082) : 0)
-	 return 0;
-  t = *k;
-  if (pthread_mutex_unlock (&killer_lock))
-	 IER(1083);
-  return (t == KILLED_INTERNALLY);
+  return (k ? (__atomic_load_n (k, __ATOMIC_RELAXED) == KILLED_INTERNALLY) : 0);
 }
 
 
@@ -273,10 +218,10 @@ cru_kill (k, err)
 	 return;
   if (((k->deadly != KILL_MAGIC)) ? RAISE(CRU_BADKIL) : 0)
 	 return;
-  if ((pthread_mutex_lock (&(k->safety)) ? IER(1084) : 0) ? (k->deadly = MUGGLE(24)) : 0)
+  if ((pthread_mutex_lock (&(k->safety)) ? IER(1180) : 0) ? (k->deadly = MUGGLE(24)) : 0)
 	 return;
   dblx = k->killable = ! (k->killed);
-  if (pthread_mutex_unlock (&(k->safety)) ? IER(1085) : 0)
+  if (pthread_mutex_unlock (&(k->safety)) ? IER(1181) : 0)
 	 k->deadly = MUGGLE(25);
   if (dblx)
 	 return;
@@ -308,7 +253,7 @@ cru_free_kill_switch (k, err)
   if (((k->deadly != KILL_MAGIC)) ? RAISE(CRU_BADKIL) : 0)
 	 return;
   if (pthread_mutex_destroy (&(k->safety)))
-	 IER(1086);
+	 IER(1182);
   k->deadly = MUGGLE(26);
   _cru_free (k);
 }
@@ -29,11 +29,16 @@
 // implemented mainly as pointers to a field in a router, which
 // workers poll during their main event loops.
 
-// bitmask specifying infrequency of kill switch sampling; bigger numbers mean less often
+// bitmask specifying how many iterations pass before a simulated kill at a test site
 #define PERIOD 0x1f
 
-// macro for polling the killed status of a router r using local variables in a task event loop
-#define KILLED ((++sample & PERIOD) ? 0 : _cru_killed (&(r->killed), err))
+// macro for polling the killed status of a router r using local variables in a task event loop;
+// the killed field is only ever read or written atomically, so it's cheap enough to poll every time
+#define KILLED ((++sample, __atomic_load_n (&(r->killed), __ATOMIC_RELAXED)) ? 1 : 0)
+
+// non-zero if a killed router r is for a partial build or spread and wasn't killed by an error, so the
+// vertices already reached are finished without outgoing edges and the graph is kept rather than reclaimed
+#define STOPPED(r) (((r)->tag != BUI) ? 0 : (r)->builder.partial ? (! _cru_killed_internally (&((r)->killed), err)) : 0)
 
 // macro to simulate a kill request at the active site at the end of the first sampling period
 #define KILL_SITE(n) if ((n != ACTIVE_SITE) ? 0 : (! sample) ? 0 : ! (sample & PERIOD)) _cru_kill (&(r->killed), err)
@@ -48,7 +53,7 @@ struct cru_kill_switch_s
   int deadly;                   // holds a magic number if the structure is valid
   int *killed;                  // address of the killed field in an associated router
   int killable;                 // requests killing when next enabled
-  pthread_mutex_t safety;       // locks the killed field
+  pthread_mutex_t safety;       // locks the killed and killable fields of the kill switch
 };
 
 #ifdef __cplusplus
@@ -56,16 +61,6 @@ extern "C"
 {
 #endif
 
-// --------------- initialization and teardown -------------------------------------------------------------
-
-// initialize static storage
-extern int
-_cru_open_killers (int *err);
-
-// release static storage
-extern void
-_cru_close_killers (void);
-
 // --------------- kill switch operations ------------------------------------------------------------------
 
 // create a new kill switch
@@ -80,7 +75,7 @@ _cru_enable_killing (cru_kill_switch k, int *r, int *err);
 extern void
 _cru_disable_killing (cru_kill_switch k, int *err);
 
-// safely poll the killed field in a router
+// atomically poll the killed field in a router
 extern int
 _cru_killed (int *k, int *err);
 
@@ -88,11 +83,11 @@ _cru_killed (int *k, int *err);
 extern int
 _cru_killed_internally (int *k, int *err);
 
-// safely set the killed field in a router
+// atomically set the killed field in a router
 extern void
 _cru_kill (int *k, int *err);
 
-// safely set the killed field in a router specifying an internal kill request
+// atomically set the killed field in a router specifying an internal kill request
 extern void
 _cru_kill_internally (int *k, int *err);
 
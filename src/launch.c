@@ -16,7 +16,12 @@
   along with cru. If not, see <https://www.gnu.org/licenses/>.
 */
 
+#include <string.h>
+#include "arena.h"
+#include "build.h"
+#include "count.h"
 #include "crew.h"
+#include "edges.h"
 #include "errs.h"
 #include "graph.h"
 #include "launch.h"
@@ -54,14 +59,14 @@ _cru_launched (k, i, r, err)
   crew c;
 
   started = dblx = 0;
-  if ((! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(1087) : r->ports ? 0 : IER(1088))
+  if ((! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(1183) : r->ports ? 0 : IER(1184))
 	 goto a;
   if (! _cru_crewed (c = _cru_crew_of (&dblx), (runner) _cru_status_runner, r, &dblx))
 	 goto b;
   if (! i)
 	 started = _cru_ping (r->ports[0], &dblx);
   else if ((p = _cru_initial_packet_of (i, q = _cru_scalar_hash (i), &dblx)))
-	 started = _cru_assigned (r->ports[MOD(q, r->lanes)], &p, &dblx);
+	 started = _cru_assigned (r->ports[LANE(q, r->partitioner, r->lanes)], &p, &dblx);
   if (started)
 	 _cru_wait_for_quiescence (k, r, &dblx);
   _cru_dismiss (r, &dblx);
@@ -98,14 +103,14 @@ _cru_status_launched (k, i, h, r, err)
   packet_list p;
 
   started = dblx = 0;
-  if ((! r) ? IER(1089) : (r->valid != ROUTER_MAGIC) ? IER(1090) : 0)
+  if ((! r) ? IER(1185) : (r->valid != ROUTER_MAGIC) ? IER(1186) : 0)
 	 return 0;
-  if (((! (r->ports)) ? IER(1091) : (! (r->lanes)) ? IER(1092) : 0) ? (r->valid = MUGGLE(27)) : 0)
+  if (((! (r->ports)) ? IER(1187) : (! (r->lanes)) ? IER(1188) : 0) ? (r->valid = MUGGLE(27)) : 0)
 	 return 0;
   if (! _cru_crewed (c = _cru_crew_of (&dblx), (runner) _cru_status_runner, r, &dblx))
 	 goto a;
   if (((p = _cru_packet_of ((r->tag == BUI) ? NULL : i, h, NO_SENDER, NO_CARRIER, &dblx))) ? (p->receiver = i) : NULL)
-	 if ((started = _cru_assigned (r->ports[MOD(h, r->lanes)], &p, &dblx)))
+	 if ((started = _cru_assigned (r->ports[LANE(h, r->partitioner, r->lanes)], &p, &dblx)))
 		_cru_wait_for_quiescence (k, r, &dblx);
   _cru_dismiss (r, &dblx);
  a: _cru_status_disjunction (c, &dblx);
@@ -144,9 +149,9 @@ _cru_count_launched (k, i, a, q, r, count, err)
   crew c;
 
   started = dblx = 0;
-  if ((! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(1093) : count ? 0 : IER(1094))
+  if ((! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(1189) : count ? 0 : IER(1190))
 	 goto a;
-  if (((! (r->ports)) ? IER(1095) : (! (r->lanes)) ? IER(1096) : 0) ? (r->valid = MUGGLE(28)) : 0)
+  if (((! (r->ports)) ? IER(1191) : (! (r->lanes)) ? IER(1192) : 0) ? (r->valid = MUGGLE(28)) : 0)
 	 goto a;
   *count = 0;
   if (! _cru_crewed (c = _cru_crew_of (&dblx), (runner) _cru_count_runner, r, &dblx))
@@ -154,7 +159,7 @@ _cru_count_launched (k, i, a, q, r, count, err)
   if (! i)
 	 started = _cru_ping (r->ports[0], &dblx);
   else if (((p = _cru_packet_of (a, q, NO_SENDER, NO_CARRIER, &dblx))) ? (a ? 1 : ! ! (p->receiver = i)) : 0)
-	 started = _cru_assigned (r->ports[MOD(q,  r->lanes)], &p, err);
+	 started = _cru_assigned (r->ports[LANE(q, r->partitioner, r->lanes)], &p, err);
   if (started)
 	 _cru_wait_for_quiescence (k, r, &dblx);
   _cru_dismiss (r, &dblx);
@@ -192,11 +197,11 @@ _cru_queue_launched (k, i, q, r, u, err)
   crew c;
 
   started = dblx = 0;
-  if ((! r) ? IER(1097) : (r->valid != ROUTER_MAGIC) ? IER(1098) : 0)
+  if ((! r) ? IER(1193) : (r->valid != ROUTER_MAGIC) ? IER(1194) : 0)
 	 return 0;
-  if (((! (r->ports)) ? IER(1099) : (! (r->lanes)) ? IER(1100) : 0) ? (r->valid = MUGGLE(29)) : 0)
+  if (((! (r->ports)) ? IER(1195) : (! (r->lanes)) ? IER(1196) : 0) ? (r->valid = MUGGLE(29)) : 0)
 	 return 0;
-  if ((! i) ? IER(1101) : (! u) ? IER(1102) : *u ? IER(1103) : 0)
+  if ((! i) ? IER(1197) : (! u) ? IER(1198) : *u ? IER(1199) : 0)
 	 return 0;
   if (! _cru_crewed (c = _cru_crew_of (&dblx), (runner) _cru_queue_runner, r, &dblx))
 	 goto a;
@@ -204,7 +209,7 @@ _cru_queue_launched (k, i, q, r, u, err)
 	 p = _cru_initial_packet_of (i, q, &dblx);
   else if ((p = _cru_packet_of (i->vertex, q, NO_SENDER, NO_CARRIER, &dblx)))
 	 p->receiver = i;
-  if (p ? ((started = _cru_assigned (r->ports[MOD(q, r->lanes)], &p, &dblx))) : 0)
+  if (p ? ((started = _cru_assigned (r->ports[LANE(q, r->partitioner, r->lanes)], &p, &dblx))) : 0)
 	 _cru_wait_for_quiescence (k, r, &dblx);
   _cru_dismiss (r, &dblx);
  a: *u = _cru_node_union (c, NO_BASE_BAY, NO_BASE, &dblx);
@@ -238,17 +243,17 @@ _cru_maybe_disjunction_launched (k, i, r, result, err)
   crew c;
 
   dblx = started = 0;
-  if ((! result) ? IER(1104) : 0)
+  if ((! result) ? IER(1200) : 0)
 	 goto a;
   *result = NULL;
-  if ((! r) ? IER(1105) : (r->valid != ROUTER_MAGIC) ? IER(1106) : 0)
+  if ((! r) ? IER(1201) : (r->valid != ROUTER_MAGIC) ? IER(1202) : 0)
 	 goto a;
-  if (((! (r->ports)) ? IER(1107) : (! (r->lanes)) ? IER(1108) : 0) ? (r->valid = MUGGLE(30)) : 0)
+  if (((! (r->ports)) ? IER(1203) : (! (r->lanes)) ? IER(1204) : 0) ? (r->valid = MUGGLE(30)) : 0)
 	 return 0;
   if (! _cru_crewed (c = _cru_crew_of (&dblx), (runner) _cru_maybe_runner, r, &dblx))
 	 goto b;
   if ((p = _cru_initial_packet_of (i, q = _cru_scalar_hash (i), &dblx)))
-	 if ((started = _cru_assigned (r->ports[MOD(q, r->lanes)], &p, &dblx)))
+	 if ((started = _cru_assigned (r->ports[LANE(q, r->partitioner, r->lanes)], &p, &dblx)))
 		_cru_wait_for_quiescence (k, r, &dblx);
   _cru_dismiss (r, &dblx);
  b: _cru_maybe_disjunction (c, result, &dblx);
@@ -282,17 +287,17 @@ _cru_maybe_reduction_launched (k, i, r, result, err)
   crew c;
 
   dblx = started = 0;
-  if ((! result) ? IER(1109) : 0)
+  if ((! result) ? IER(1205) : 0)
 	 goto a;
   *result = NULL;
-  if ((! r) ? IER(1110) : (r->valid != ROUTER_MAGIC) ? IER(1111) : (r->tag != MAP) ? IER(1112) : 0)
+  if ((! r) ? IER(1206) : (r->valid != ROUTER_MAGIC) ? IER(1207) : (r->tag != MAP) ? IER(1208) : 0)
 	 goto a;
-  if (((! (r->ports)) ? IER(1113) : (! (r->lanes)) ? IER(1114) : 0) ? (r->valid = MUGGLE(31)) : 0)
+  if (((! (r->ports)) ? IER(1209) : (! (r->lanes)) ? IER(1210) : 0) ? (r->valid = MUGGLE(31)) : 0)
 	 return 0;
   if (! _cru_crewed (c = _cru_crew_of (&dblx), (runner) _cru_maybe_runner, r, &dblx))
 	 goto b;
   if ((p = _cru_initial_packet_of (i, q = _cru_scalar_hash (i), &dblx)))
-	 if ((started = _cru_assigned (r->ports[MOD(q,  r->lanes)], &p, &dblx)))
+	 if ((started = _cru_assigned (r->ports[LANE(q, r->partitioner, r->lanes)], &p, &dblx)))
 		_cru_wait_for_quiescence (k, r, &dblx);
   _cru_dismiss (r, &dblx);
  b: _cru_maybe_reduction (c, &(r->mapreducer.ma_prop.vertex), result, r->ro_store, &dblx);
@@ -309,9 +314,159 @@ _cru_maybe_reduction_launched (k, i, r, result, err)
 
 
 
+int
+_cru_maybe_scan_launched (k, i, n, r, result, err)
+	  cru_kill_switch k;
+	  node_list i;         // the first of a list of nodes to be divided among the workers
+	  uintptr_t n;         // the number of nodes in the list
+	  router r;
+	  void **result;
+	  int *err;
+
+	  // Return a combination of the results from a router whose
+	  // workers return maybe types by splitting the node list into a
+	  // run of consecutive nodes for each worker and sending each one
+	  // a packet with the start of its run as the payload and the
+	  // length as the hash. Each worker is sent its packet as soon as
+	  // its start is found so that it needn't wait for the others.
+{
+  int started, dblx;
+  packet_list p;
+  uintptr_t q, j, l;
+  crew c;
+
+  dblx = started = 0;
+  if ((! result) ? IER(1211) : 0)
+	 goto a;
+  *result = NULL;
+  if ((! r) ? IER(1212) : (r->valid != ROUTER_MAGIC) ? IER(1213) : (r->tag != MAP) ? IER(1214) : 0)
+	 goto a;
+  if (((! (r->ports)) ? IER(1215) : (! (r->lanes)) ? IER(1216) : 0) ? (r->valid = MUGGLE(32)) : 0)
+	 return 0;
+  if (! _cru_crewed (c = _cru_crew_of (&dblx), (runner) _cru_maybe_runner, r, &dblx))
+	 goto b;
+  _cru_swell (r, &dblx);
+  q = (n + r->lanes - 1) / r->lanes;
+  for (j = 0; (j < r->lanes) ? (j ? (n ? ! dblx : 0) : 1) : 0; j++)
+	 {
+		if (! (p = _cru_initial_packet_of (i, l = ((n < q) ? n : q), &dblx)))
+		  break;
+		if (! _cru_assigned (r->ports[j], &p, &dblx))
+		  break;
+		for (started = 1, n -= l; i ? l-- : 0;)
+		  i = i->next_node;
+	 }
+  _cru_dwindled (r, &dblx);
+  if (started)
+	 _cru_wait_for_quiescence (k, r, &dblx);
+  _cru_dismiss (r, &dblx);
+ b: _cru_maybe_reduction (c, &(r->mapreducer.ma_prop.vertex), result, r->ro_store, &dblx);
+  RAISE(r->ro_status);
+ a: RAISE(dblx);
+  return started;
+}
+
+
+
+
+
+
+
+
+
+
+
+static slab
+gathered_slabs (r)
+	  router r;
+
+	  // Take all slabs from the ports of a router after a build.
+{
+  slab s;
+  unsigned i;
+
+  for (s = NULL, i = 0; i < r->lanes; i++)
+	 if (r->ports[i])
+		{
+		  s = _cru_cat_slabs (r->ports[i]->slabs, s);
+		  r->ports[i]->slabs = NULL;
+		}
+  return s;
+}
+
+
+
+
+
+
+
+
+static int
+advanced (r, err)
+	  router r;
+	  int *err;
+
+	  // If any worker is holding packets for the next level of a
+	  // depth limited build after the router has become quiescent,
+	  // advance the level and release the packets to their workers,
+	  // keeping the router from becoming quiescent again until all of
+	  // them have been released. Otherwise return zero.
+{
+  packet_list p;
+  unsigned i;
+  int held;
+
+  for (held = 0, i = 0; i < r->lanes; i++)
+	 held = (held ? 1 : r->ports[i] ? ! ! (r->ports[i]->frontier) : 0);
+  if (! held)
+	 return 0;
+  r->level++;
+  _cru_swell (r, err);
+  r->quiescent = 0;
+  for (i = 0; i < r->lanes; i++)
+	 if (r->ports[i] ? (p = r->ports[i]->frontier) : NULL)
+		{
+		  r->ports[i]->frontier = NULL;
+		  _cru_assigned (r->ports[i], &p, err);
+		}
+  _cru_dwindled (r, err);
+  return 1;
+}
 
 
-extern int
+
+
+
+
+
+
+static void
+prune (r, n, c, err)
+	  router r;
+	  node_list n;
+	  census c;
+	  int *err;
+
+	  // Remove the edges to any vertices left out of a partial build
+	  // or spread by the vertex limit, which can have happened only if
+	  // more vertices than the limit were attempted.
+{
+  cru_builder b;
+
+  if ((r->tag != BUI) ? 1 : ! ((b = &(r->builder))->partial))
+	 return;
+  if (b->bu_sig.vertex_limit ? (r->created > b->bu_sig.vertex_limit) : 0)
+	 _cru_prune_truncations (n, b->bu_sig.destructors.e_free, c, err);
+}
+
+
+
+
+
+
+
+
+int
 _cru_graph_launched (k, v, q, r, g, err)
 	  cru_kill_switch k;
 	  void *v;
@@ -328,14 +483,15 @@ _cru_graph_launched (k, v, q, r, g, err)
   node_list n, b;
   packet_list p;
   int started;
+  slab s;
   crew c;
   int ux;
 
   b = NULL;
   started = 0;
-  if ((! r) ? IER(1115) : (r->valid != ROUTER_MAGIC) ? IER(1116) : 0)
+  if ((! r) ? IER(1217) : (r->valid != ROUTER_MAGIC) ? IER(1218) : 0)
 	 return 0;
-  if (((! (r->ports)) ? IER(1117) : (! (r->lanes)) ? IER(1118) : 0) ? (r->valid = MUGGLE(32)) : (! g) ? IER(1119) : 0)
+  if (((! (r->ports)) ? IER(1219) : (! (r->lanes)) ? IER(1220) : 0) ? (r->valid = MUGGLE(33)) : (! g) ? IER(1221) : 0)
 	 return 0;
   if (*err)
 	 goto a;
@@ -345,19 +501,22 @@ _cru_graph_launched (k, v, q, r, g, err)
 	 {
 		if (*g)
 		  p->receiver = (*g)->base_node;
-		if ((started = _cru_assigned (r->ports[MOD(q,  r->lanes)], &p, err)))
+		if ((started = _cru_assigned (r->ports[LANE(q, r->partitioner, r->lanes)], &p, err)))
 		  {
 			 v = NULL;
 			 if (*g)
 				(*g)->nodes = NULL;
-			 _cru_wait_for_quiescence (k, r, err);
+			 do
+				_cru_wait_for_quiescence (k, r, err);
+			 while (advanced (r, err));
 		  }
 	 }
   _cru_dismiss (r, err);
- b: n = _cru_node_union (c, (unsigned) MOD(q, r->lanes), &b, err);
+ b: n = _cru_node_union (c, LANE(q, r->partitioner, r->lanes), &b, err);
   RAISE(r->ro_status);
+  s = gathered_slabs (r);
   if (*err ? NULL : *g)
-	 (*g)->nodes = n;
+	 prune (r, (*g)->nodes = n, NO_CENSUS, err);
   else if (*err ? 1 : ! (*g = _cru_graph_of (&(r->ro_sig), &b, n, err)))
 	 {
 		_cru_free_nodes (n, &(r->ro_sig.destructors), err);
@@ -368,8 +527,115 @@ _cru_graph_launched (k, v, q, r, g, err)
 		  }
 		*g = NULL;
 	 }
+  else
+	 {
+		_cru_gathered_census (r, &((*g)->g_census));
+		prune (r, (*g)->nodes, &((*g)->g_census), err);
+	 }
+  if (*g)
+	 (*g)->g_slabs = _cru_cat_slabs (s, (*g)->g_slabs);
+  else
+	 _cru_free_slabs (s, err);
  a: if ((r->tag == FAB) ? NULL : (r->tag == CRO) ? NULL : (r->tag == BUI) ? NULL : r->ro_sig.destructors.v_free ? v : NULL)
 	 APPLY(r->ro_sig.destructors.v_free, v);
   _cru_free_router (r, err);
   return started;
 }
+
+
+
+
+
+
+
+
+int
+_cru_graph_seeded (k, b, r, g, err)
+	  cru_kill_switch k;
+	  node_list b;
+	  router r;
+	  cru_graph *g;
+	  int *err;
+
+	  // Launch a traversal to build a graph from a base node b whose
+	  // outgoing edges are already known, by sending the terminus of
+	  // each edge directly to the worker that owns it. Consume the base
+	  // node and the router unless there's an internal error. The
+	  // router is kept from becoming quiescent until all of the
+	  // termini have been sent. The base node is recorded on the port
+	  // that owns it so that edges leading back to it aren't taken to
+	  // lead to a new vertex.
+{
+  struct census_s t;
+  packet_list p;
+  edge_list e;
+  cru_hash h;
+  node_list n;
+  uintptr_t q;
+  int started;
+  slab s;
+  crew c;
+
+  started = 0;
+  if ((! b) ? IER(1222) : (! g) ? IER(1223) : (! r) ? IER(1224) : (r->valid != ROUTER_MAGIC) ? IER(1225) : 0)
+	 goto a;
+  if (((! (r->ports)) ? IER(1226) : (! (r->lanes)) ? IER(1227) : 0) ? (r->valid = MUGGLE(34)) : 0)
+	 goto a;
+  e = b->edges_out;
+  b->edges_out = NULL;
+  if (*err ? 1 : (h = r->ro_sig.orders.v_order.hash) ? 0 : IER(1228))
+	 goto b;
+  if (! (p = _cru_packet_of (b->vertex, q = h (b->vertex), NO_SENDER, NO_CARRIER, err)))
+	 goto b;
+  p->receiver = b;
+  r->ports[LANE(q, r->partitioner, r->lanes)]->extant = p;
+  if (*err)
+	 goto b;
+  if (! _cru_crewed (c = _cru_crew_of (err), (runner) _cru_queue_runner, r, err))
+	 goto c;
+  _cru_swell (r, err);
+  for (; *err ? NULL : e; started++)
+	 {
+		if (! (p = _cru_packet_of (e->remote.vertex, q = h (e->remote.vertex), b, e, err)))
+		  break;
+		p->receiver = NULL;
+		p->depth = 1;
+		_cru_push_edge (_cru_popped_edge (&e, err), &(b->edges_out), err);
+		if (! _cru_assigned (r->ports[LANE(q, r->partitioner, r->lanes)], &p, err))
+		  break;
+	 }
+  _cru_dwindled (r, err);
+  do
+	 _cru_wait_for_quiescence (k, r, err);
+  while (advanced (r, err));
+  _cru_dismiss (r, err);
+ c: n = _cru_node_union (c, NO_BASE_BAY, NO_BASE, err);
+  RAISE(r->ro_status);
+  s = gathered_slabs (r);
+  memset (&t, 0, sizeof (t));
+  _cru_tally (&t, b);
+  if (*err ? 1 : ! (*g = _cru_graph_of (&(r->ro_sig), &b, n, err)))
+	 goto d;
+  if (! _cru_pushed_node (b, &((*g)->nodes), err))
+	 goto e;
+  _cru_gathered_census (r, &((*g)->g_census));
+  (*g)->g_census.vertices += t.vertices;
+  (*g)->g_census.edges += t.edges;
+  (*g)->g_census.termini += t.termini;
+  prune (r, (*g)->nodes, &((*g)->g_census), err);
+  (*g)->g_slabs = s;
+  (*g)->g_mixed = ! ! s;
+  _cru_free_router (r, err);
+  return started;
+ e: _cru_free_now (*g, err);
+  *g = NULL;
+  n = NULL;
+ d: _cru_free_nodes (n, &(r->ro_sig.destructors), err);
+  _cru_free_slabs (s, err);
+ b: _cru_free_edges_and_termini (&(r->ro_sig.destructors), e, err);
+  _cru_free_nodes (b, &(r->ro_sig.destructors), err);
+  _cru_free_router (r, err);
+  return 0;
+ a: _cru_free_router (r, err);
+  return 0;
+}
@@ -50,10 +50,18 @@ _cru_maybe_disjunction_launched (cru_kill_switch k, node_list i, router r, void
 extern int
 _cru_maybe_reduction_launched (cru_kill_switch k, node_list i, router r, void **result, int *err);
 
+// launch a job whose workers each return a maybe type after scanning their share of n consecutive nodes from a list
+extern int
+_cru_maybe_scan_launched (cru_kill_switch k, node_list i, uintptr_t n, router r, void **result, int *err);
+
 // launch a traversal to build a graph from the base v
 extern int
 _cru_graph_launched (cru_kill_switch k, void *v, uintptr_t q, router r, cru_graph *g, int *err);
 
+// launch a traversal to build a graph from the termini of the outgoing edges of a base node b
+extern int
+_cru_graph_seeded (cru_kill_switch k, node_list b, router r, cru_graph *g, int *err);
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,8 +18,10 @@
 
 #include <strings.h>
 #include <stdlib.h>
+#include "count.h"
 #include "errs.h"
 #include "getset.h"
+#include "graph.h"
 #include "killers.h"
 #include "mapreduce.h"
 #include "maybe.h"
@@ -59,9 +61,9 @@ visit (n, p, result, err)
   void *right;
   cru_destructor d;
 
-  if (*err ? 1 : (! p) ? IER(1120) : (! result) ? IER(1121) : p->vertex.reduction ? 0 : IER(1122))
+  if (*err ? 1 : (! p) ? IER(1229) : (! result) ? IER(1230) : p->vertex.reduction ? 0 : IER(1231))
 	 return;
-  if (((d = p->vertex.m_free) != p->vertex.r_free) ? IER(1123) : 0)
+  if (((d = p->vertex.m_free) != p->vertex.r_free) ? IER(1232) : 0)
 	 return;
   if (*result)
 	 goto a;
@@ -107,11 +109,11 @@ _cru_mapreducing_task (source, err)
   killed = 0;
   seen = NULL;
   result = NULL;
-  if ((! source) ? IER(1124) : (source->gruntled != PORT_MAGIC) ? IER(1125) : 0)
+  if ((! source) ? IER(1233) : (source->gruntled != PORT_MAGIC) ? IER(1234) : 0)
 	 return NULL;
-  if ((! (r = source->local)) ? IER(1126) : (r->valid != ROUTER_MAGIC) ? IER(1127) : 0)
+  if ((! (r = source->local)) ? IER(1235) : (r->valid != ROUTER_MAGIC) ? IER(1236) : 0)
 	 return NULL;
-  if ((!(destinations = source->peers)) ? IER(1128) : (r->tag != MAP) ? IER(1129) : 0)
+  if ((!(destinations = source->peers)) ? IER(1237) : (r->tag != MAP) ? IER(1238) : 0)
 	 {
 		_cru_abort (source, destinations, err);
 		goto a;
@@ -124,7 +126,7 @@ _cru_mapreducing_task (source, err)
 		killed = (killed ? 1 : KILLED);
 		if (*err ? 1 : killed)
 		  goto b;
-		if ((n = (node_list) incoming->payload) ? (_cru_test_and_set_membership (n, &seen, err) ? 1 : *err) : IER(1130))
+		if ((n = (node_list) incoming->payload) ? (_cru_test_and_set_membership (n, &seen, err) ? 1 : *err) : IER(1239))
 		  goto b;
 		_cru_scattered (r->mapreducer.ma_zone.backwards ? n->edges_in : n->edges_out, destinations, err);
 		visit (n, &(r->mapreducer.ma_prop), &result, err);
@@ -134,7 +136,7 @@ _cru_mapreducing_task (source, err)
 	 goto a;
   if (r->mapreducer.ma_prop.vertex.r_free == r->mapreducer.ma_prop.vertex.m_free)
 	 _cru_free_maybe (result, r->mapreducer.ma_prop.vertex.r_free, err);
-  else if (IER(1131))
+  else if (IER(1240))
 	 _cru_free_maybe (result, NO_DESTRUCTOR, err);
   result = NULL;
  a: if (*err)
@@ -151,6 +153,71 @@ _cru_mapreducing_task (source, err)
 
 
 
+maybe
+_cru_map_scanning_task (source, err)
+	  port source;
+	  int *err;
+
+	  // Apply the map to a run of consecutive nodes from the graph's
+	  // node list and return their reduction. The run starts with the
+	  // payload of the only incoming packet and its length is the
+	  // packet's hash value.
+{
+  packet_list incoming;
+  unsigned sample;
+  uintptr_t count;
+  maybe result;
+  node_list n;
+  int killed;
+  router r;
+
+  sample = 0;
+  killed = 0;
+  result = NULL;
+  if ((! source) ? IER(1241) : (source->gruntled != PORT_MAGIC) ? IER(1242) : 0)
+	 return NULL;
+  if ((! (r = source->local)) ? IER(1243) : (r->valid != ROUTER_MAGIC) ? IER(1244) : 0)
+	 return NULL;
+  if ((r->tag != MAP) ? IER(1245) : (! (r->lanes)) ? IER(1246) : (source->own_index >= r->lanes) ? IER(1247) : 0)
+	 {
+		_cru_abort (source, NO_POD, err);
+		goto a;
+	 }
+  _cru_set_storage (r->ro_store, err);
+  _cru_set_kill_switch (&(r->killed), err);
+  for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, NO_POD, err));)
+	 {
+		if (*err ? 1 : killed)
+		  goto b;
+		count = incoming->hash_value;
+		for (n = (node_list) incoming->payload; (n ? count-- : 0) ? (*err ? 0 : ! killed) : 0; n = n->next_node)
+		  {
+			 KILL_SITE(20);
+			 killed = (killed ? 1 : KILLED);
+			 visit (n, &(r->mapreducer.ma_prop), &result, err);
+		  }
+	 b: _cru_nack (_cru_popped_packet (&incoming, err), err);
+	 }
+  if ((*err ? 1 : killed) ? (! result) : 1)
+	 goto a;
+  if (r->mapreducer.ma_prop.vertex.r_free == r->mapreducer.ma_prop.vertex.m_free)
+	 _cru_free_maybe (result, r->mapreducer.ma_prop.vertex.r_free, err);
+  else if (IER(1248))
+	 _cru_free_maybe (result, NO_DESTRUCTOR, err);
+  result = NULL;
+ a: if (*err)
+	 result = _cru_new_maybe (ABSENT, NULL, err);
+  return result;
+}
+
+
+
+
+
+
+
+
+
 
 void *
 _cru_mapreduce (k, i, r, err)
@@ -170,3 +237,43 @@ _cru_mapreduce (k, i, r, err)
   _cru_free_router (r, err);
   return result;
 }
+
+
+
+
+
+
+
+
+
+void *
+_cru_scanned_mapreduce (k, g, r, err)
+	  cru_kill_switch k;
+	  cru_graph g;
+	  router r;
+	  int *err;
+
+	  // Launch a map-reduction over the whole node list of a graph
+	  // without traversing any edges by dividing the list into a run
+	  // of consecutive nodes for each worker, block until finished,
+	  // and consume the router. Every node in the list is visited, even
+	  // one unreachable from the base node as a loaded or imported
+	  // graph may have. The count is taken from the census if known.
+{
+  void *result;
+  uintptr_t count;
+  node_list n;
+
+  result = NULL;
+  _cru_disable_killing (k, err);
+  if ((! g) ? IER(1249) : (! r) ? IER(1250) : (r->valid != ROUTER_MAGIC) ? IER(1251) : (! (r->lanes)) ? IER(1252) : 0)
+	 goto a;
+  if (_cru_censused (g, VERTICES_COUNTED, &count))
+	 goto b;
+  for (count = 0, n = g->nodes; n; n = n->next_node)
+	 count++;
+  _cru_census_taken (g, VERTICES_COUNTED, count, err);
+ b: _cru_maybe_scan_launched (k, g->nodes, count, _cru_reset (r, (task) _cru_map_scanning_task, err), (void **) &result, err);
+ a: _cru_free_router (r, err);
+  return result;
+}
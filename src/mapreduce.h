@@ -32,10 +32,18 @@ extern "C"
 extern maybe
 _cru_mapreducing_task (port source, int *err);
 
+// apply the map to a run of consecutive nodes and return their reduction when quiescent
+extern maybe
+_cru_map_scanning_task (port source, int *err);
+
 // launch a concurrent mapreduce operation allowing for constrained order traversal and block until finished
 extern void *
 _cru_mapreduce (cru_kill_switch k, node_list i, router r, int *err);
 
+// launch a concurrent mapreduce operation over a whole graph without traversing edges and block until finished
+extern void *
+_cru_scanned_mapreduce (cru_kill_switch k, cru_graph g, router r, int *err);
+
 #ifdef __cplusplus
 }
 #endif
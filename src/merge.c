@@ -19,6 +19,7 @@
 #include <string.h>
 #include <errno.h>
 #include "brig.h"
+#include "count.h"
 #include "defo.h"
 #include "duplex.h"
 #include "edges.h"
@@ -59,9 +60,9 @@ assimilated (incoming, extant_class, err)
 	  // the class. Pushing into the tail is necessary to preserve the
 	  // base node in the graph.
 {
-  if ((! extant_class) ? IER(1136) : (! incoming) ? IER(1137) : (! (incoming->receiver)) ? IER(1138) : 0)
+  if ((! extant_class) ? IER(1257) : (! incoming) ? IER(1258) : (! (incoming->receiver)) ? IER(1259) : 0)
 	 return 0;
-  if ((incoming == extant_class) ? IER(1139) : extant_class->receiver ? 0 : IER(1140))
+  if ((incoming == extant_class) ? IER(1260) : extant_class->receiver ? 0 : IER(1261))
 	 return 0;
   _cru_pushed_node (_cru_half_severed (incoming->receiver), &(extant_class->receiver->next_node), err);
   incoming->receiver = NULL;
@@ -91,12 +92,12 @@ fuse_vertices (incoming, c, s, err)
   node_list n;
   void *composite_vertex;
 
-  if ((! c) ? IER(1141) : (! s) ? IER(1142) : 0)
+  if ((! c) ? IER(1262) : (! s) ? IER(1263) : 0)
 	 return;
   for (; incoming; incoming = incoming->next_packet)
-	 if (incoming->receiver ? 1 : ! IER(1143))
+	 if (incoming->receiver ? 1 : ! IER(1264))
 		{
-		  if (*err ? 1 : (c->me_kernel.v_op.vertex.map != _cru_undefined_top) ? 1 : incoming->receiver->next_node ? IER(1144) : 0)
+		  if (*err ? 1 : (c->me_kernel.v_op.vertex.map != _cru_undefined_top) ? 1 : incoming->receiver->next_node ? IER(1265) : 0)
 			 {
 				composite_vertex = (*err ? NULL : _cru_reduced_nodes (&(c->me_kernel.v_op), incoming->receiver, err));
 				_cru_free_vertices (incoming->receiver, s->destructors.v_free, err);
@@ -129,7 +130,7 @@ vertex_merging_task (s, err)
 	  // cleared.
 {
 #define UNEQUAL(a,b) \
-(*err ? 0 : (! b) ? (! IER(1145)) : (a->vertex_property == b->vertex_property) ? 0 : \
+(*err ? 0 : (! b) ? (! IER(1266)) : (a->vertex_property == b->vertex_property) ? 0 : \
 FAILED(r->merger.me_classifier.cl_order.equal, a->vertex_property, b->vertex_property))
 
 #define RECORDED(x) (_cru_member (x, seen) ? 1 : (*err ? 0 : ! killed) ? 0 : _cru_listed (x, s->deletions))
@@ -154,21 +155,21 @@ FAILED(r->merger.me_classifier.cl_order.equal, a->vertex_property, b->vertex_pro
   seen = NULL;
   collisions = NULL;
   memset (&buffer, 0, sizeof (buffer));
-  if ((! s) ? IER(1146) : (s->gruntled != PORT_MAGIC) ? IER(1147) : 0)
+  if ((! s) ? IER(1267) : (s->gruntled != PORT_MAGIC) ? IER(1268) : 0)
 	 goto a;
-  if ((!(r = s->local)) ? IER(1148) : (r->valid != ROUTER_MAGIC) ? IER(1149) : (killed = 0))
+  if ((!(r = s->local)) ? IER(1269) : (r->valid != ROUTER_MAGIC) ? IER(1270) : (killed = 0))
 	 goto a;
-  if ((! (d = s->peers)) ? IER(1150) : (r->tag != CLU) ? IER(1151) : 0)
+  if ((! (d = s->peers)) ? IER(1271) : (r->tag != CLU) ? IER(1272) : 0)
 	 goto b;
-  if (r->merger.me_classifier.cl_order.equal ? 0 : IER(1152))
+  if (r->merger.me_classifier.cl_order.equal ? 0 : IER(1273))
 	 goto b;
   _cru_set_storage (r->ro_store, err);
   _cru_set_kill_switch (&(r->killed), err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (s, d, err));)
 	 {
-		KILL_SITE(20);
+		KILL_SITE(21);
 		killed = (killed ? 1 : KILLED);
-		if ((! (n = incoming->receiver)) ? IER(1153) : RECORDED(n))
+		if ((! (n = incoming->receiver)) ? IER(1274) : RECORDED(n))
 		  goto c;
 		if (*err ? 1 : killed ? 1 : _cru_set_membership (n, &seen, err) ? *err : 1)
 		  goto d;
@@ -179,10 +180,10 @@ FAILED(r->merger.me_classifier.cl_order.equal, a->vertex_property, b->vertex_pro
 		  goto d;
 		if (*c)
 		  for (; (unequal = UNEQUAL(n, (*c)->receiver)) ? (*c)->next_packet : NULL; c = &((*c)->next_packet));
-		if ((*c ? (! unequal) : 0) ? (assimilated (incoming, *c, err) ? 1 : IER(1154)) : 0)
+		if ((*c ? (! unequal) : 0) ? (assimilated (incoming, *c, err) ? 1 : IER(1275)) : 0)
 		  goto c;
 		p = (*c ? &((*c)->next_packet) : c);
-		if ((((*p = _cru_popped_packet (&incoming, err))) ? (n = _cru_half_severed ((*p)->receiver)) : NULL) ? 1 : ! IER(1155))
+		if ((((*p = _cru_popped_packet (&incoming, err))) ? (n = _cru_half_severed ((*p)->receiver)) : NULL) ? 1 : ! IER(1276))
 		  n->previous = &((*p)->receiver);
 		continue;
 	 c: _cru_nack (_cru_popped_packet (&incoming, err), err);
@@ -222,7 +223,7 @@ demerge_vertices (s, c, r, err)
 {
   struct cru_destructor_pair_s z;
 
-  if ((! s) ? IER(1156) : (s->gruntled != PORT_MAGIC) ? IER(1157) : (! c) ? IER(1158) : (! r) ? IER(1159) : 0)
+  if ((! s) ? IER(1277) : (s->gruntled != PORT_MAGIC) ? IER(1278) : (! c) ? IER(1279) : (! r) ? IER(1280) : 0)
 	 return;
   memset (&z, 0, sizeof (z));
   z.e_free = r->e_free;
@@ -267,9 +268,9 @@ filter_edges (f, t, s, edges, o, d, err)
   int ux, ut, e;
 
   q = NULL;
-  if ((! (l = edges)) ? IER(1160) : 0)
+  if ((! (l = edges)) ? IER(1281) : 0)
 	 goto a;
-  if ((! f) ? 1 : (! s--) ? IER(1161) : (! s) ? 0 : (! o) ? IER(1162) : (h = o->hash) ? 0 : IER(1163))
+  if ((! f) ? 1 : (! s--) ? IER(1282) : (! s) ? 0 : (! o) ? IER(1283) : (h = o->hash) ? 0 : IER(1284))
 	 goto a;
   while (*l)
 	 {
@@ -310,7 +311,7 @@ fused_edges (n, c, d, o, err)
 
   t = NULL;
   e = NULL;
-  if ((! c) ? IER(1164) : (! o) ? IER(1165) : (! n) ? IER(1166) : 0)
+  if ((! c) ? IER(1285) : (! o) ? IER(1286) : (! n) ? IER(1287) : 0)
 	 return NULL;
   v = n->vertex;
   for (class_size = 0; n ? ++class_size : 0; n = n->next_node)
@@ -318,7 +319,7 @@ fused_edges (n, c, d, o, err)
 		for (q = NULL; n->edges_out;)
 		  {
 			 _cru_push_edge (_cru_popped_edge (&(n->edges_out), err), &e, err);
-			 if (*err ? 0 : (! (c->pruner)) ? 0 : ! ((! e) ? IER(1167) : (! (o->hash)) ? IER(1168) : 0))
+			 if (*err ? 0 : (! (c->pruner)) ? 0 : ! ((! e) ? IER(1288) : (! (o->hash)) ? IER(1289) : 0))
 				_cru_record_edge ((o->hash) (e->label), o->equal, e->label, &q, err);
 		  }
 		_cru_merge (&t, q, o->equal, err);
@@ -363,15 +364,15 @@ edge_merging_task (s, err)
 
   killed = 0;
   sample = 0;
-  if ((! s) ? IER(1169) : (s->gruntled != PORT_MAGIC) ? IER(1170) : ! _cru_pingback (s, err))
+  if ((! s) ? IER(1290) : (s->gruntled != PORT_MAGIC) ? IER(1291) : ! _cru_pingback (s, err))
 	 return NULL;
-  if ((! (r = s->local)) ? IER(1171) : (r->valid != ROUTER_MAGIC) ? IER(1172) : (r->tag != CLU) ? IER(1173) : 0)
+  if ((! (r = s->local)) ? IER(1292) : (r->valid != ROUTER_MAGIC) ? IER(1293) : (r->tag != CLU) ? IER(1294) : 0)
 	 return NULL;
   z = &(r->ro_sig);
   d = &(z->destructors);
   for (c = &(r->merger); s->deferred; _cru_nack (_cru_popped_packet (&(s->deferred), err), err))
 	 {
-		KILL_SITE(21);
+		KILL_SITE(22);
 		killed = (killed ? 1 : KILLED);
 		if (*err)
 		  _cru_free_outgoing_edges_and_labels (s->deferred->receiver, d->e_free, err);
@@ -406,7 +407,7 @@ demerge_edges (s, c, r, err)
 {
   struct cru_destructor_pair_s z;
 
-  if ((! s) ? IER(1174) : (s->gruntled != PORT_MAGIC) ? IER(1175) : (! c) ? IER(1176) : 0)
+  if ((! s) ? IER(1295) : (s->gruntled != PORT_MAGIC) ? IER(1296) : (! c) ? IER(1297) : 0)
 	 return;
   memset (&z, 0, sizeof (z));
   z.v_free = c->me_kernel.v_op.vertex.r_free;
@@ -436,9 +437,9 @@ demerging_task (s, err)
 {
   router r;
 
-  if ((! s) ? IER(1177) : (s->gruntled != PORT_MAGIC) ? IER(1178) : ! _cru_pingback (s, err))
+  if ((! s) ? IER(1298) : (s->gruntled != PORT_MAGIC) ? IER(1299) : ! _cru_pingback (s, err))
 	 return NULL;
-  if ((! (r = s->local)) ? IER(1179) : (r->valid != ROUTER_MAGIC) ? IER(1180) : (r->tag != CLU) ? IER(1181) : 0)
+  if ((! (r = s->local)) ? IER(1300) : (r->valid != ROUTER_MAGIC) ? IER(1301) : (r->tag != CLU) ? IER(1302) : 0)
 	 return NULL;
   demerge_vertices (s, &(r->merger), &(r->ro_sig.destructors), err);
   demerge_edges (s, &(r->merger), &(r->ro_sig.destructors), err);
@@ -468,11 +469,11 @@ merge (g, k, r, s, err)
   unsigned i;
   uintptr_t q;
 
-  if ((! r) ? IER(1182) : (r->valid != ROUTER_MAGIC) ? IER(1183) : (! g) ? IER(1184) : (! (g->base_node)) ? IER(1185) : *err)
+  if ((! r) ? IER(1303) : (r->valid != ROUTER_MAGIC) ? IER(1304) : (! g) ? IER(1305) : (! (g->base_node)) ? IER(1306) : *err)
 	 return;
-  if (((! (r->ports)) ? IER(1186) : (! (r->lanes)) ? IER(1187) : 0) ? (r->valid = MUGGLE(33)) : s ? 0 : IER(1188))
+  if (((! (r->ports)) ? IER(1307) : (! (r->lanes)) ? IER(1308) : 0) ? (r->valid = MUGGLE(35)) : s ? 0 : IER(1309))
 	 return;
-  if ((r->tag != CLU) ? IER(1189) : (! (h = r->merger.me_classifier.cl_order.hash)) ? IER(1190) : 0)
+  if ((r->tag != CLU) ? IER(1310) : (! (h = r->merger.me_classifier.cl_order.hash)) ? IER(1311) : 0)
 	 return;
   _cru_reset (r, (task) vertex_merging_task, err);
   if (! _cru_status_launched (k, g->base_node, q = h (g->base_node->vertex_property), r, err))
@@ -482,9 +483,10 @@ merge (g, k, r, s, err)
   if (*err ? 1 : _cru_status_launched (k, g->base_node, q, _cru_reset (r, (task) edge_merging_task, err), err) ? *err : 1)
 	 goto a;
   memcpy (&(r->ro_sig.orders.v_order), &(r->merger.me_classifier.cl_order), sizeof (r->ro_sig.orders.v_order));
-  if (_cru_queue_launched (k, g->base_node, q, _cru_reset (r, (task) _cru_pruning_task, err), &(g->nodes), err))
-	 if (g->nodes)
-		g->nodes->previous = &(g->nodes);
+  if (_cru_queue_launched (k, g->base_node, q, _cru_reset (r, (task) _cru_pruning_task, err), &(g->nodes), err) ? (! *err) : 0)
+	 _cru_gathered_census (r, &(g->g_census));
+  if (g->nodes)
+	 g->nodes->previous = &(g->nodes);
  a: if (*err)
 	 g->base_node = NULL;
   if (_cru_launched (UNKILLABLE, NO_BASE, _cru_shared (_cru_reset (r, (task) demerging_task, err)), err))
@@ -518,7 +520,7 @@ _cru_merged (g, k, r, s, err)
   _cru_disable_killing (k, err);
   if (*err ? 1 : ! g)
 	 goto a;
-  if ((! r) ? IER(1191) : (r->valid != ROUTER_MAGIC) ? IER(1192) : (r->tag != CLU) ? IER(1193) : (! (r->ports)) ? IER(1194) : 0)
+  if ((! r) ? IER(1312) : (r->valid != ROUTER_MAGIC) ? IER(1313) : (r->tag != CLU) ? IER(1314) : (! (r->ports)) ? IER(1315) : 0)
 	 goto a;
   if (_cru_half_duplex (g, err))
 	 goto b;
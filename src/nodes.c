@@ -19,6 +19,7 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#include "arena.h"
 #include "cthread.h"
 #include "defo.h"
 #include "edges.h"
@@ -45,11 +46,31 @@ _cru_node_of (z, vertex, edges_in, edges_out, err)
 	  int *err;
 
 	  // Create a new graph node.
+{
+  return _cru_slab_node_of (NO_SLABS, z, vertex, edges_in, edges_out, err);
+}
+
+
+
+
+
+
+
+node_list
+_cru_slab_node_of (s, z, vertex, edges_in, edges_out, err)
+	  slab *s;
+	  cru_destructor_pair z;
+	  void *vertex;
+	  edge_list edges_in;
+	  edge_list edges_out;
+	  int *err;
+
+	  // Create a new graph node in a slab if there are any.
 {
   node_list new_node;
   int ux;
 
-  if (*err ? 1 : (new_node = (node_list) _cru_malloc (sizeof (*new_node))) ? 0 : RAISE(ENOMEM))
+  if (*err ? 1 : (new_node = (s ? (node_list) _cru_carved (s, sizeof (*new_node), err) : (node_list) _cru_malloc (sizeof (*new_node)))) ? 0 : RAISE(ENOMEM))
 	 {
 		if ((! z) ? NULL : z->v_free ? vertex : NULL)
 		  APPLY(z->v_free, vertex);
@@ -84,7 +105,7 @@ _cru_free_nodes (nodes, r, err)
   node_list t;
   int ux;
 
-  for (; (t = nodes); _cru_free (t))
+  for (; (t = nodes); RELEASE(t))
 	 {
 		_cru_free_edges (nodes->edges_in, err);
 		_cru_free_edges_and_labels (r ? r->e_free : NO_LABEL_DESTRUCTOR, nodes->edges_out, err);
@@ -112,9 +133,9 @@ _cru_free_adjacencies (nodes, r, err)
   node_list t, n;
   int ux;
 
-  if (nodes ? 0 : IER(1265))
+  if (nodes ? 0 : IER(1386))
 	 return;
-  for (n = *nodes; (t = n); _cru_free (t))
+  for (n = *nodes; (t = n); RELEASE(t))
 	 {
 		_cru_free_edges (n->edges_in, err);
 		_cru_free_edges_and_termini (r, n->edges_out, err);
@@ -216,7 +237,7 @@ _cru_pushed_node (n, nodes, err)
 
 	  // Insert a unit node list into the front of an existing node list.
 {
-  if ((! n) ? IER(1266) : (! nodes) ? IER(1267) : n->previous ? IER(1268) : n->next_node ? IER(1269) : 0)
+  if ((! n) ? IER(1387) : (! nodes) ? IER(1388) : n->previous ? IER(1389) : n->next_node ? IER(1390) : 0)
 	 return 0;
   if (*(n->previous = nodes))
 	 (*nodes)->previous = &(n->next_node);
@@ -240,7 +261,7 @@ _cru_severed (n, err)
 	  // Separate a node from its neighboring nodes in a list. If the
 	  // neighbors are already separated, leave them that way.
 {
-  if ((! n) ? IER(1270) : (!(n->previous)) ? IER(1271) : 0)
+  if ((! n) ? IER(1391) : (!(n->previous)) ? IER(1392) : 0)
 	 return NULL;
   if (*(n->previous) == n)
 	 *(n->previous) = n->next_node;
@@ -315,7 +336,7 @@ _cru_transplanted_in (l, r, err)
 	  // Return non-zero of the edges into the right node can be
 	  // transplanted to the left node, and if so, transplant them.
 {
-  if ((! l) ? IER(1272) : (! r) ? IER(1273) : (l == r))
+  if ((! l) ? IER(1393) : (! r) ? IER(1394) : (l == r))
 	 return 0;
   l->edges_in = _cru_cat_edges (r->edges_in, l->edges_in);
   r->edges_in = NULL;
@@ -338,7 +359,7 @@ _cru_transplanted_out (l, r, err)
 	  // Return non-zero of the edges from the right node can be
 	  // transplanted to the left node, and if so, transplant them.
 {
-  if ((! l) ? IER(1274) : (! r) ? IER(1275) : (l == r))
+  if ((! l) ? IER(1395) : (! r) ? IER(1396) : (l == r))
 	 return 0;
   l->edges_out = _cru_cat_edges (r->edges_out, l->edges_out);
   r->edges_out = NULL;
@@ -396,7 +417,7 @@ mapped_node (p, n, with_locks, err)
   void *ua;
   void *map_result;
 
-  if ((! n) ? IER(1276) : (! p) ? IER(1277) : (! (p->vertex.map ? 1 : ! ! (p->vertex.bmap))) ? IER(1278) : *err)
+  if ((! n) ? IER(1397) : (! p) ? IER(1398) : (! (p->vertex.map ? 1 : ! ! (p->vertex.bmap))) ? IER(1399) : *err)
 	 return NULL;
   v = (with_locks ? _cru_read (&(n->vertex), err) : n->vertex);
   if (_cru_empty_fold (&(p->incident)) ? (i = NULL) : NON_NULL)
@@ -471,20 +492,20 @@ _cru_reduced_nodes (p, n, err)
   void *reduction_result;
   void *previous_reduction_result;
 
-  if (p ? 0 : IER(1279))
+  if (p ? 0 : IER(1400))
 	 return NULL;
   if (! n)
 	 return ((p->vertex.vacuous_case ? 0 : RAISE(CRU_UNDVAC)) ? NULL : CALLED(p->vertex.vacuous_case));
   if (p->vertex.vacuous_case)
 	 reduction_result = CALLED(p->vertex.vacuous_case);
-  else if ((p->vertex.m_free != p->vertex.r_free) ? IER(1280) : 0)
+  else if ((p->vertex.m_free != p->vertex.r_free) ? IER(1401) : 0)
 	 return NULL;
   else
 	 {
 		reduction_result = mapped_node (p, n, WITHOUT_LOCKS, err);
 		n = n->next_node;
 	 }
-  if ((! n) ? 0 : p->vertex.reduction ? 1 : ! IER(1281))
+  if ((! n) ? 0 : p->vertex.reduction ? 1 : ! IER(1402))
 	 for (; *err ? NULL : n; n = n->next_node)
 		{
 		  previous_reduction_result = reduction_result;
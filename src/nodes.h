@@ -83,6 +83,10 @@ extern "C"
 extern node_list
 _cru_node_of (cru_destructor_pair z, void *vertex, edge_list edges_in, edge_list edges_out, int *err);
 
+// allocate a new node from a list of slabs or from the heap if s is NULL
+extern node_list
+_cru_slab_node_of (slab *s, cru_destructor_pair z, void *vertex, edge_list edges_in, edge_list edges_out, int *err);
+
 // free a node list along with its edges and vertices
 extern void
 _cru_free_nodes (node_list nodes, cru_destructor_pair r, int *err);
@@ -46,9 +46,247 @@ static packet_list reserve_packets = NULL;
 // the number of packets in reserve
 static uintptr_t packet_count = 0;
 
-// for exclusive access to the reserve packets and the packet count
+// for exclusive access to the reserve packets, the depot, the cache
+// registry, and their counts
 static pthread_rwlock_t packet_lock;
 
+// Freed packets go to the freeing thread's cache unless the reserve
+// is running low. When a cache fills up, a batch of its packets is
+// moved to a shared depot, and when a cache runs dry, it is refilled
+// by a batch from the depot before the heap is tried. The lock is
+// therefore taken at most once per batch rather than once per packet
+// in the usual case, and the reserve is touched only when the heap
+// overflows.
+
+// number of packets moved at a time between a cache and the depot
+#define PACKET_BATCH 0x20
+
+// maximum number of packets in a thread's cache
+#define CACHE_PACKET_LIMIT (PACKET_BATCH << 1)
+
+// maximum number of packets in the depot
+#define DEPOT_PACKET_LIMIT 0x400
+
+// packets drained from caches awaiting reuse by any thread
+static packet_list depot_packets = NULL;
+
+// the number of packets in the depot
+static uintptr_t depot_count = 0;
+
+// the most recently created cache of a live thread
+static packet_cache caches = NULL;
+
+// the number of registered caches
+static uintptr_t cache_count = 0;
+
+// per-thread storage for the cache of the current thread
+static pthread_key_t cache_key;
+
+
+// --------------- caching ---------------------------------------------------------------------------------
+
+
+
+
+
+static void
+drained (c, n, err)
+	  packet_cache c;
+	  uintptr_t n;
+	  int *err;
+
+	  // Move up to n packets from a cache to the depot, or free them
+	  // if the depot is full. The lock is taken once for the batch.
+{
+  packet_list b;
+  packet_list t;
+
+  for (b = NULL; n-- ? (t = c->cached) : NULL; c->size--)
+	 {
+		c->cached = t->next_packet;
+		t->next_packet = b;
+		b = t;
+	 }
+  if (b ? pthread_rwlock_wrlock (&packet_lock) ? IER(1403) : 0 : 1)
+	 goto a;
+  while (b ? (depot_count < DEPOT_PACKET_LIMIT) : 0)
+	 {
+		t = b;
+		b = b->next_packet;
+		t->next_packet = depot_packets;
+		depot_packets = t;
+		depot_count++;
+	 }
+  if (pthread_rwlock_unlock (&packet_lock))
+	 IER(1404);
+ a: while ((t = b))
+	 {
+		b = b->next_packet;
+		_cru_free (t);
+	 }
+}
+
+
+
+
+
+
+
+static int
+refilled (c, err)
+	  packet_cache c;
+	  int *err;
+
+	  // Move a batch of packets from the depot to an empty cache and
+	  // return non-zero if any were moved. The lock isn't taken if
+	  // the depot appears to be empty.
+{
+  packet_list t;
+  uintptr_t n;
+
+  if (__atomic_load_n (&depot_count, __ATOMIC_RELAXED) ? pthread_rwlock_wrlock (&packet_lock) ? IER(1405) : 0 : 1)
+	 return 0;
+  for (n = PACKET_BATCH; n-- ? (t = depot_packets) : NULL; c->size++)
+	 {
+		depot_packets = t->next_packet;
+		depot_count--;
+		t->next_packet = c->cached;
+		c->cached = t;
+	 }
+  if (pthread_rwlock_unlock (&packet_lock))
+	 IER(1406);
+  return ! ! (c->cached);
+}
+
+
+
+
+
+
+
+static void
+discarded (c)
+	  void *c;
+
+	  // Drain and unregister the cache of an exiting thread.
+{
+  packet_cache d;
+  int err;
+
+  if (! (d = (packet_cache) c))
+	 return;
+  err = 0;
+  drained (d, d->size, &err);
+  if (pthread_rwlock_wrlock (&packet_lock) ? (err = THE_IER(1407)) : 0)
+	 goto a;
+  if (d->newer)
+	 d->newer->older = d->older;
+  if (d->older)
+	 d->older->newer = d->newer;
+  else
+	 caches = d->newer;
+  cache_count--;
+  if (pthread_rwlock_unlock (&packet_lock))
+	 err = (err ? err : THE_IER(1408));
+  _cru_free (d);
+ a: _cru_globally_throw (err);
+}
+
+
+
+
+
+
+
+static packet_cache
+cache_of (err)
+	  int *err;
+
+	  // Return the cache of the current thread, creating and
+	  // registering it if necessary. If there is insufficient memory
+	  // for a cache, return NULL without raising an error because the
+	  // thread can manage without one.
+{
+  packet_cache c;
+
+  if ((c = (packet_cache) pthread_getspecific (cache_key)))
+	 return c;
+  if (! (c = (packet_cache) _cru_malloc (sizeof (*c))))
+	 return NULL;
+  memset (c, 0, sizeof (*c));
+  if (pthread_rwlock_wrlock (&packet_lock) ? IER(1409) : 0)
+	 goto a;
+  if (pthread_setspecific (cache_key, c) ? IER(1410) : 0)
+	 goto b;
+  if ((c->newer = caches))
+	 caches->older = c;
+  caches = c;
+  cache_count++;
+  if (pthread_rwlock_unlock (&packet_lock) ? IER(1411) : 1)
+	 return c;
+ b: pthread_rwlock_unlock (&packet_lock);
+ a: _cru_free (c);
+  return NULL;
+}
+
+
+
+
+
+
+
+static int
+cached (t, c, err)
+	  packet_list t;
+	  packet_cache c;
+	  int *err;
+
+	  // Put a cleared packet in a cache if there is one and drain a
+	  // batch from it if it's full.
+{
+  if (! c)
+	 return 0;
+  t->next_packet = c->cached;
+  c->cached = t;
+  if (++(c->size) >= CACHE_PACKET_LIMIT)
+	 drained (c, PACKET_BATCH, err);
+  return 1;
+}
+
+
+
+
+
+
+
+
+static int
+reserved (t, err)
+	  packet_list t;
+	  int *err;
+
+	  // Put a cleared packet in the reserve list if it's running low.
+{
+  int ok;             // non-zero means there are adequately many reserve packets
+
+  if (pthread_rwlock_wrlock (&packet_lock) ? IER(1412) : 0)
+	 return 0;
+  if (! (ok = (packet_count >= RESERVE_PACKET_LIMIT)))
+	 {
+		t->next_packet = reserve_packets;
+		reserve_packets = t;
+		packet_count++;
+	 }
+  if (pthread_rwlock_unlock (&packet_lock))
+	 IER(1413);
+  return ! ok;
+}
+
+
+
+
+
+
 
 // --------------- initialization and teardown -------------------------------------------------------------
 
@@ -60,7 +298,12 @@ _cru_open_packets (err)
 
 	  // Initialize pthread resources.
 {
-  return ! (pthread_rwlock_init (&packet_lock, NULL) ? IER(1282) : 0);
+  if (pthread_rwlock_init (&packet_lock, NULL) ? IER(1414) : 0)
+	 return 0;
+  if (! (pthread_key_create (&cache_key, discarded) ? IER(1415) : 0))
+	 return 1;
+  pthread_rwlock_destroy (&packet_lock);
+  return 0;
 }
 
 
@@ -72,21 +315,40 @@ _cru_open_packets (err)
 void
 _cru_close_packets ()
 
-	  // Release pthread resources.
+	  // Release pthread resources and reclaim all reserved, depot,
+	  // and cached packets. Caches of threads that are still running
+	  // are reclaimed here because their destructors won't be called.
 {
   packet_list t;
+  packet_cache c;
   int err;
 
   for (err = 0; (t = reserve_packets); _cru_free (t))
 	 {
 		_cru_discount (t->seen_carriers);
 		reserve_packets = t->next_packet;
-		err = (packet_count-- ? err : THE_IER(1283));
+		err = (packet_count-- ? err : THE_IER(1416));
 	 }
   if (packet_count ? (! err) : 0)
-	 err = THE_IER(1284);
+	 err = THE_IER(1417);
+  for (; (t = depot_packets); _cru_free (t))
+	 {
+		depot_packets = t->next_packet;
+		err = (depot_count-- ? err : err ? err : THE_IER(1418));
+	 }
+  for (; (c = caches); _cru_free (c))
+	 {
+		caches = c->newer;
+		err = (cache_count-- ? err : err ? err : THE_IER(1419));
+		for (; (t = c->cached); _cru_free (t))
+		  c->cached = t->next_packet;
+	 }
+  if ((depot_count ? 1 : ! ! cache_count) ? (! err) : 0)
+	 err = THE_IER(1420);
+  if (pthread_key_delete (cache_key) ? (! err) : 0)
+	 err = THE_IER(1421);
   if (pthread_rwlock_destroy (&packet_lock) ? (! err) : 0)
-	 err = THE_IER(1285);
+	 err = THE_IER(1422);
   _cru_globally_throw (err);
 }
 
@@ -109,16 +371,26 @@ static packet_list
 new_packet (err)
 	  int *err;
 
-	  // Allocate a packet from the heap or the reserve list if
-	  // possible. Raise an out-of-memory error if it's necessary to
+	  // Allocate a packet from the current thread's cache, the depot,
+	  // the heap, or the reserve list if possible, in that order of
+	  // preference. Raise an out-of-memory error if it's necessary to
 	  // dip into the reserves regardless of whether they're exhausted.
 {
+  packet_cache c;
   packet_list l;
 
-  if ((l = (packet_list) _cru_malloc (sizeof (*l))) ? 1 : pthread_rwlock_wrlock (&packet_lock) ? IER(1286) : 0)
+  if ((c = cache_of (err)) ? (c->cached ? 1 : refilled (c, err)) : 0)
+	 {
+		l = c->cached;
+		c->cached = l->next_packet;
+		c->size--;
+		l->next_packet = NULL;
+		goto a;
+	 }
+  if ((l = (packet_list) _cru_malloc (sizeof (*l))) ? 1 : pthread_rwlock_wrlock (&packet_lock) ? IER(1423) : 0)
 	 goto a;
-  l = (((! reserve_packets) ? 1 : packet_count-- ? 0 : IER(1287)) ? NULL : _cru_popped_packet (&reserve_packets, err));
-  if (pthread_rwlock_unlock (&packet_lock) ? IER(1288) : 1)
+  l = (((! reserve_packets) ? 1 : packet_count-- ? 0 : IER(1424)) ? NULL : _cru_popped_packet (&reserve_packets, err));
+  if (pthread_rwlock_unlock (&packet_lock) ? IER(1425) : 1)
 	 RAISE(ENOMEM);
  a: return l;
 }
@@ -208,33 +480,27 @@ _cru_free_packets (p, v, err)
 
 	  // Tear down a packet list and its payloads. If the reserve
 	  // packets are running low, put the excess packets directly into
-	  // the reserve packet list instead of freeing them. The latter
+	  // the reserve packet list instead of caching them. The latter
 	  // event should be rare if the reserve packet limit is defined
 	  // appropriately, but is relatively more expensive due to the
-	  // need for a write lock on the packet count.
+	  // need for a write lock on the packet count. The packet count is
+	  // read without locking because an occasional stale value only
+	  // delays replenishing the reserve until the next packet is freed.
 {
+  packet_cache c;
   packet_list t;
-  int ok;             // non-zero means there are adequately many reserve packets
   int ux;
 
-  while ((t = p))
+  for (c = (p ? cache_of (err) : NULL); (t = p);)
 	 {
 		if (v ? p->payload : NULL)
 		  APPLY(v, p->payload);
 		_cru_discount (p->seen_carriers);
 		p = p->next_packet;
-		if (pthread_rwlock_rdlock (&packet_lock) ? IER(1289) : 0)
-		  goto a;
-		ok = (packet_count >= RESERVE_PACKET_LIMIT);
-		if (pthread_rwlock_unlock (&packet_lock) ? IER(1290) : ok ? 1 : pthread_rwlock_wrlock (&packet_lock) ? IER(1291) : 0)
-		  goto a;
 		memset (t, 0, sizeof (*t));
-		t->next_packet = reserve_packets;
-		reserve_packets = t;
-		packet_count++;
-		if (pthread_rwlock_unlock (&packet_lock) ? IER(1292) : 1)
+		if ((__atomic_load_n (&packet_count, __ATOMIC_RELAXED) >= RESERVE_PACKET_LIMIT) ? cached (t, c, err) : reserved (t, err))
 		  continue;
-	 a: _cru_free (t);
+		_cru_free (t);
 	 }
 }
 
@@ -248,15 +514,19 @@ uintptr_t
 _cru_reserved_packets (err)
 	  int *err;
 
-	  // Return the current number of packets held in reserve.
+	  // Return the current number of packets held in reserve, in the
+	  // depot, or in caches, plus the number of caches.
 {
+  packet_cache c;
   uintptr_t result;
 
-  if (pthread_rwlock_rdlock (&packet_lock) ? IER(1293) : 0)
+  if (pthread_rwlock_rdlock (&packet_lock) ? IER(1426) : 0)
 	 return 0;
-  result = packet_count;
+  result = packet_count + depot_count + cache_count;
+  for (c = caches; c; c = c->newer)
+	 result += c->size;
   if (pthread_rwlock_unlock (&packet_lock))
-	 IER(1294);
+	 IER(1427);
   return result;
 }
 
@@ -265,6 +535,7 @@ _cru_reserved_packets (err)
 
 
 
+
 void
 _cru_replenish_packets (err)
 	  int *err;
@@ -274,7 +545,7 @@ _cru_replenish_packets (err)
   packet_list l;
   int dblx;
 
-  if (pthread_rwlock_wrlock (&packet_lock) ? IER(1295) : 0)
+  if (pthread_rwlock_wrlock (&packet_lock) ? IER(1428) : 0)
 	 return;
   for (dblx = 0; dblx ? 0 : (packet_count < RESERVE_PACKET_LIMIT);)
 	 if ((l = (packet_list) _cru_malloc (sizeof (*l))) ? 1 : ! (dblx = ENOMEM))
@@ -285,7 +556,7 @@ _cru_replenish_packets (err)
 		}
   RAISE(dblx);
   if (pthread_rwlock_unlock (&packet_lock))
-	 IER(1296);
+	 IER(1429);
 }
 
 
@@ -354,7 +625,7 @@ _cru_push_packet (h, t, err)
 
 	  // Concatenate a unit packet list with another packet list.
 {
-  if ((! h) ? 1 : h->next_packet ? IER(1297) : (! t) ? IER(1298) : 0)
+  if ((! h) ? 1 : h->next_packet ? IER(1430) : (! t) ? IER(1431) : 0)
 	 return 0;
   h->next_packet = *t;
   *t = h;
@@ -376,7 +647,7 @@ _cru_popped_packet (p, err)
 {
   packet_list t;
 
-  if ((! p) ? IER(1299) : (! *p) ? IER(1300) : 0)
+  if ((! p) ? IER(1432) : (! *p) ? IER(1433) : 0)
 	 return NULL;
   t = *p;
   *p = (*p)->next_packet;
@@ -389,6 +660,107 @@ _cru_popped_packet (p, err)
 
 
 
+// --------------- priority inboxes ------------------------------------------------------------------------
+
+// A priority inbox is a pairing heap of packets in which the root has
+// the least priority value. The children of each packet are linked
+// through their next_packet fields from its outranked field, and the
+// root has no siblings.
+
+
+
+
+static packet_list
+melded (a, b)
+	  packet_list a;
+	  packet_list b;
+
+	  // Combine two non-empty heaps by making the root with the
+	  // greater priority value the first child of the other.
+{
+  packet_list t;
+
+  if (b->priority < a->priority)
+	 {
+		t = a;
+		a = b;
+		b = t;
+	 }
+  b->next_packet = a->outranked;
+  a->outranked = b;
+  return a;
+}
+
+
+
+
+
+
+
+
+void
+_cru_rank_packet (p, h, err)
+	  packet_list p;
+	  packet_list *h;
+	  int *err;
+
+	  // Insert a unit packet list p with its priority already set into
+	  // the heap h.
+{
+  if ((! h) ? IER(1434) : (! p) ? IER(1435) : p->next_packet ? IER(1436) : p->outranked ? IER(1437) : 0)
+	 return;
+  *h = (*h ? melded (*h, p) : p);
+}
+
+
+
+
+
+
+
+
+packet_list
+_cru_best_packet (h, err)
+	  packet_list *h;
+	  int *err;
+
+	  // Remove and return the packet with the least priority value
+	  // from a heap, or NULL if it's empty. Its children are melded in
+	  // pairs from left to right and then the pairs are melded from
+	  // right to left, which keeps later removals cheap.
+{
+  packet_list t, a, b, c, pairs;
+
+  if ((! h) ? IER(1438) : ! (t = *h))
+	 return NULL;
+  c = t->outranked;
+  t->outranked = NULL;
+  for (pairs = NULL; (a = c); pairs = a)
+	 {
+		c = a->next_packet;
+		a->next_packet = NULL;
+		if ((b = c))
+		  {
+			 c = b->next_packet;
+			 b->next_packet = NULL;
+			 a = melded (a, b);
+		  }
+		a->next_packet = pairs;
+	 }
+  for (*h = NULL; (a = pairs);)
+	 {
+		pairs = a->next_packet;
+		a->next_packet = NULL;
+		*h = (*h ? melded (*h, a) : a);
+	 }
+  return t;
+}
+
+
+
+
+
+
 int
 _cru_buffered (b, i, d, err)
 	  packet_list b;
@@ -403,7 +775,7 @@ _cru_buffered (b, i, d, err)
 	  // in their direction because there isn't enough memory to
 	  // allocate a packet for each one.
 {
-  if ((! b) ? IER(1301) : (! i) ? IER(1302) : b->payload ? 1 : ! ! (b->receiver))
+  if ((! b) ? IER(1439) : (! i) ? IER(1440) : b->payload ? 1 : ! ! (b->receiver))
 	 return 0;
   b->payload = i->payload;
   b->receiver = i->receiver;
@@ -435,7 +807,7 @@ _cru_spun (b, i, d, err)
 	  // payload transplanted because they already are, so the packet
 	  // has to be deferred until after others are freed.
 {
-  if ((! i) ? IER(1303) : (*i != b))
+  if ((! i) ? IER(1441) : (*i != b))
 	 return 0;
   _cru_push_packet (_cru_popped_packet (i, err), d, err);
   return 1;
@@ -458,7 +830,7 @@ _cru_unbuffered (b, i, err)
 	  // messages have been successfully scattered along all outgoing
 	  // edges associated with a previously buffered packet.
 {
-  if ((! i) ? IER(1304) : (! b) ? IER(1305) : (b != *i) ? 1 : _cru_popped_packet (i, err) ? 0 : IER(1306))
+  if ((! i) ? IER(1442) : (! b) ? IER(1443) : (b != *i) ? 1 : _cru_popped_packet (i, err) ? 0 : IER(1444))
 	 return 0;
   memset (b, 0, sizeof (*b));
   return 1;
@@ -28,6 +28,14 @@
 // repeated instances of the same packet payload are acted upon
 // provided they arrive by different carriers, hence the need to store
 // previously seen carriers in a multiset table as defined in table.h.
+// A packet is held in the table for every vertex until the build
+// finishes, so the link used to rank packets in a priority inbox
+// before they're processed shares storage with the carriers seen
+// afterwards. This is safe only because a packet leaves a priority
+// inbox solely by way of _cru_best_packet, which clears the link,
+// and _cru_free_port drains any inbox that way before its packets
+// are freed. Freeing a packet still in an inbox would pass the link
+// to _cru_discount as a table.
 
 #include "ptr.h"
 
@@ -48,8 +56,27 @@ struct packet_list_s
   edge_list carrier;             // the edge whose terminus is the receiver, if any
   node_list receiver;            // the node at the other end of the carrier edge, if any
   uintptr_t hash_value;          // used for establishing inequality between payloads
+  uintptr_t depth;               // number of edges from the initial vertex to the payload during depth limited building
+  uintptr_t priority;            // the value of the builder's priority function on the payload when building best first
   packet_list next_packet;       // next packet to be processed after this one
-  multiset_table seen_carriers;  // carriers previously associated with packets delivering the same payload
+  union                          // see above for why these can share storage
+  {
+	 packet_list outranked;       // the first of the packets below this one in a priority inbox
+	 multiset_table seen_carriers; // carriers previously associated with packets delivering the same payload
+  };
+};
+
+// Each thread that frees packets keeps the most recent ones in a
+// cache of its own so that it can allocate and free them without
+// locking. Caches are registered globally only so that they can be
+// counted and reclaimed at teardown.
+
+struct packet_cache_s
+{
+  packet_list cached;            // packets available for allocation by the owning thread
+  uintptr_t size;                // number of cached packets
+  packet_cache newer;            // next cache in the registry
+  packet_cache older;            // previous cache in the registry
 };
 
 #ifdef __cplusplus
@@ -123,6 +150,16 @@ _cru_spun (packet_list b, packet_list *i, packet_list *d, int *err);
 extern int
 _cru_unbuffered (packet_list b, packet_list *i, int *err);
 
+// --------------- priority inboxes ------------------------------------------------------------------------
+
+// insert a packet into a priority inbox
+extern void
+_cru_rank_packet (packet_list p, packet_list *h, int *err);
+
+// remove and return the packet with the least priority value from a priority inbox
+extern packet_list
+_cru_best_packet (packet_list *h, int *err);
+
 #ifdef __cplusplus
 }
 #endif
@@ -36,16 +36,17 @@ _cru_pod_of (a, err)
 	  int *err;
 
 	  // Create a new packet pod with the given arity on the heap if
-	  // possible.
+	  // possible, with the tails of its lists allocated along with
+	  // the lists.
 {
   packet_pod p;
   packet_list *d;
   size_t pod_size;
 
-  if (a ? 0 : IER(1307))
+  if (a ? 0 : IER(1445))
 	 return NULL;
-  pod_size = a * sizeof (*d);
-  if ((pod_size < a) ? IER(1308) : (pod_size < sizeof (*d)) ? IER(1309) : 0)
+  pod_size = 2 * a * sizeof (*d);
+  if ((pod_size < a) ? IER(1446) : (pod_size < sizeof (*d)) ? IER(1447) : 0)
 	 return NULL;
   if ((d = (packet_list *) _cru_malloc (pod_size)) ? 0 : RAISE(ENOMEM))
 	 return NULL;
@@ -62,6 +63,7 @@ _cru_pod_of (a, err)
   memset (p, 0, sizeof (*p));
   p->arity = a;
   p->pod = d;
+  p->tails = d + a;
   return p;
 }
 
@@ -79,13 +81,13 @@ _cru_free_pod (p, err)
 {
   unsigned i;
 
-  if ((! p) ? 1 : (! (p->pod)) ? IER(1310) : 0)
+  if ((! p) ? 1 : (! (p->pod)) ? IER(1448) : 0)
 	 return;
   for (i = 0; i < p->arity; i++)
 	 _cru_free_packets (p->pod[i], NO_VERTEX_DESTRUCTOR, err);
   _cru_free_packets (p->deferrals, NO_VERTEX_DESTRUCTOR, err);
 #ifdef WRAP
-  _cru_free_wrapper (__LINE__, __FILE__, p->arity * sizeof (p->pod[0]), p->pod);
+  _cru_free_wrapper (__LINE__, __FILE__, 2 * p->arity * sizeof (p->pod[0]), p->pod);
 #else
   free (p->pod);
 #endif
@@ -116,9 +118,33 @@ _cru_recycled (s, i, err)
 {
   packet_list r;
 
-  if ((! s) ? 1 : (! (s->pod)) ? IER(1311) : (i >= s->arity))
+  if ((! s) ? 1 : (! (s->pod)) ? IER(1449) : (i >= s->arity))
 	 return NULL;
   r = s->pod[i];
   s->pod[i] = NULL;
   return r;
 }
+
+
+
+
+
+
+
+int
+_cru_pod_pushed (h, t, l, err)
+	  packet_list h;
+	  packet_pod t;
+	  unsigned l;
+	  int *err;
+
+	  // Push a unit packet list onto a list in a pod, and note it as
+	  // the last packet in the list if the list was empty so that the
+	  // whole list can be posted without walking it.
+{
+  if ((! t) ? IER(1450) : (! (t->pod)) ? IER(1451) : (l >= t->arity) ? IER(1452) : 0)
+	 return 0;
+  if (! (t->pod[l]))
+	 t->tails[l] = h;
+  return _cru_push_packet (h, &(t->pod[l]), err);
+}
@@ -29,6 +29,8 @@ struct packet_pod_s
   unsigned arity;               // the number of packet lists in the pod
   packet_list deferrals;        // previously received packets that should be retried after something changes
   packet_list *pod;             // an array with one packet list for each worker associated with the current router
+  packet_list *tails;           // the last packet in each non-empty packet list in the pod
+  cru_partitioner partitioner;  // if non-null, assigns packets to locations in the pod by their hash values
 };
 
 #ifdef __cplusplus
@@ -52,6 +54,10 @@ _cru_free_pod (packet_pod p, int *err);
 extern packet_list
 _cru_recycled (packet_pod s, unsigned i, int *err);
 
+// push a unit packet list onto the l-th location in the pod, noting it as the last packet if the location was empty
+extern int
+_cru_pod_pushed (packet_list h, packet_pod t, unsigned l, int *err);
+
 #ifdef __cplusplus
 }
 #endif
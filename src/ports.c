@@ -17,8 +17,12 @@
 */
 
 #include <errno.h>
+#include <limits.h>
+#include <sched.h>
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
+#include "arena.h"
 #include "cthread.h"
 #include "errs.h"
 #include "pack.h"
@@ -27,6 +31,7 @@
 #include "route.h"
 #include "sync.h"
 #include "table.h"
+#include "transport.h"
 #include "wrap.h"
 
 
@@ -50,9 +55,9 @@ _cru_new_port (o, l, err)
   port p;
   packet_pod d;
 
-  if ((! l) ? IER(1312) : (l->valid != ROUTER_MAGIC) ? IER(1313) : 0)
+  if ((! l) ? IER(1453) : (l->valid != ROUTER_MAGIC) ? IER(1454) : 0)
 	 return NULL;
-  if ((o >= l->lanes) ? IER(1314) : 0)
+  if ((o >= l->lanes) ? IER(1455) : 0)
 	 return NULL;
   if ((p = (port) _cru_malloc (sizeof (*p))) ? 0 : RAISE(ENOMEM))
 	 return NULL;
@@ -61,10 +66,11 @@ _cru_new_port (o, l, err)
 	 goto a;
   if (_cru_cond_init (&(p->resumable), err))
 	 goto b;
-  if (pthread_rwlock_init (&(p->p_lock), NULL) ? IER(1315) : 0)
+  if (pthread_rwlock_init (&(p->p_lock), NULL) ? IER(1456) : 0)
 	 goto c;
   if (! (p->peers = _cru_pod_of (l->lanes, err)))
 	 goto d;
+  p->peers->partitioner = l->partitioner;
   p->local = l;
   p->own_index = o;
   p->gruntled = PORT_MAGIC;
@@ -91,20 +97,25 @@ _cru_free_port (p, err)
 
 	  // Tear down a port.
 {
-  if ((! p) ? IER(1316) : ! *p)
+  if ((! p) ? IER(1457) : ! *p)
 	 return;
   if (pthread_mutex_destroy (&((*p)->suspension)))
-	 IER(1317);
+	 IER(1458);
   if (pthread_cond_destroy (&((*p)->resumable)))
-	 IER(1318);
+	 IER(1459);
   if (pthread_rwlock_destroy (&((*p)->p_lock)))
-	 IER(1319);
+	 IER(1460);
   _cru_free_pod ((*p)->peers, err);
   _cru_forget_members ((*p)->reachable);
   _cru_forget_members ((*p)->visited);
   _cru_nack ((*p)->assigned, err);
   _cru_nack ((*p)->deferred, err);
-  (*p)->gruntled = MUGGLE(35);
+  _cru_nack ((*p)->frontier, err);
+  _cru_nack ((*p)->extant, err);
+  while ((*p)->ranked)
+	 _cru_nack (_cru_best_packet (&((*p)->ranked), err), err);
+  _cru_free_slabs ((*p)->slabs, err);
+  (*p)->gruntled = MUGGLE(37);
   _cru_free (*p);
   *p = NULL;
 }
@@ -237,26 +248,13 @@ assignment (source, err)
 	  int *err;
 
 	  // Retrieve the incoming packets assigned to a port and not yet
-	  // processed. This function runs in the context of the thread
-	  // that receives the assigned packets. Experimental use of
-	  // concurrency kit functions hasn't demonstrated any performance
-	  // benefit and is disabled by default.
+	  // processed by way of the transport of its router.
 {
-  packet_list incoming;
-
-  if ((! source) ? IER(1320) : (source->gruntled != PORT_MAGIC) ? IER(1321) : 0)
+  if ((! source) ? IER(1461) : (source->gruntled != PORT_MAGIC) ? IER(1462) : 0)
 	 return NULL;
-#ifdef CK_F_PR_FAS_PTR
-  incoming = ck_pr_fas_ptr (&(source->assigned), NULL);
-  return incoming;
-#endif
-  if ((pthread_mutex_lock (&(source->suspension)) ? IER(1322) : 0) ? (source->gruntled = MUGGLE(36)) : 0)
+  if ((! (source->local)) ? IER(1463) : (source->local->valid != ROUTER_MAGIC) ? IER(1464) : 0)
 	 return NULL;
-  incoming = source->assigned;
-  source->assigned = NULL;
-  if (pthread_mutex_unlock (&(source->suspension)) ? IER(1323) : 0)
-	 source->gruntled = MUGGLE(37);
-  return incoming;
+  return (source->local->transport->taken) (source, err);
 }
 
 
@@ -266,42 +264,24 @@ assignment (source, err)
 
 
 
-
 static int
-assigned (destination, more_packets, err)
+assigned (destination, more_packets, last, err)
 	  port destination;
 	  packet_list *more_packets;
+	  packet_list last;          // the last of the packets if known, or NULL
 	  int *err;
 
 	  // Put more packets into the queue of packets assigned to a
-	  // destination port. If the destination port's worker was
-	  // waiting, send a signal to resume it. If packets are assigned
-	  // to a running worker, return non-zero.
+	  // destination port by way of the transport of its router, and
+	  // return non-zero if they're assigned to a running worker.
 {
-  packet_list last_packet;
-  int unassigned, running;
-
-  if ((! more_packets) ? IER(1324) : ! (last_packet = *more_packets))
+  if ((! more_packets) ? IER(1465) : ! *more_packets)
 	 return 0;
-  if ((! destination) ? IER(1325) : (destination->gruntled != PORT_MAGIC) ? IER(1326) : 0)
+  if ((! destination) ? IER(1466) : (destination->gruntled != PORT_MAGIC) ? IER(1467) : 0)
 	 goto a;
-  while (last_packet->next_packet)
-	 last_packet = last_packet->next_packet;
-  if ((pthread_mutex_lock (&(destination->suspension)) ? IER(1327) : 0) ? (destination->gruntled = MUGGLE(38)) : 0)
+  if ((! (destination->local)) ? IER(1468) : (destination->local->valid != ROUTER_MAGIC) ? IER(1469) : 0)
 	 goto a;
-  unassigned = ! (last_packet->next_packet = destination->assigned);
-  destination->assigned = *more_packets;
-  running = ! (destination->waiting);
-  if (destination->waiting ? unassigned : 0)
-	 {
-		_cru_swell (destination->local, err);
-		if (pthread_cond_signal (&(destination->resumable)) ? IER(1328) : 0)
-		  destination->gruntled = MUGGLE(39);
-	 }
-  if (pthread_mutex_unlock (&(destination->suspension)) ? IER(1329) : 0)
-	 destination->gruntled = MUGGLE(40);
-  *more_packets = NULL;
-  return running;
+  return (destination->local->transport->posted) (destination, more_packets, last, err);
  a: _cru_free_packets (*more_packets, NO_VERTEX_DESTRUCTOR, err);
   *more_packets = NULL;
   return 0;
@@ -312,6 +292,35 @@ assigned (destination, more_packets, err)
 
 
 
+unsigned
+_cru_partitioned (h, p, n, err)
+	  uintptr_t h;
+	  cru_partitioner p;
+	  unsigned n;
+	  int *err;
+
+	  // Return the lane assigned to a hash by a user-defined
+	  // partitioner, reducing it to the number of lanes if it's out
+	  // of range. The partitioner is called even if there's already
+	  // an error so that every packet with the same hash still goes
+	  // to the same lane, but if it reports an error of its own, the
+	  // first lane is used.
+{
+  unsigned l;
+  int ux;
+
+  ux = 0;
+  l = (p) (h, n, &ux);
+  RAISE(ux);
+  return (ux ? 0 : (l < n) ? l : (l % n));
+}
+
+
+
+
+
+
+
 
 int
 _cru_ping (destination, err)
@@ -325,7 +334,7 @@ _cru_ping (destination, err)
 
   dblx = tplx = 0;
   if ((done = ! ! (p = _cru_initial_packet_of (NO_PAYLOAD, NO_HASH, &dblx))))
-	 running = assigned (destination, &p, &tplx);
+	 running = assigned (destination, &p, p, &tplx);
   RAISE(dblx);
   RAISE(tplx);
   return done;
@@ -336,6 +345,8 @@ _cru_ping (destination, err)
 
 
 
+
+
 int
 _cru_pingback (source, err)
 	  port source;
@@ -346,11 +357,11 @@ _cru_pingback (source, err)
   packet_list incoming;
   router r;
 
-  if ((! source) ? IER(1330) : (source->gruntled != PORT_MAGIC) ? IER(1331) : 0)
+  if ((! source) ? IER(1470) : (source->gruntled != PORT_MAGIC) ? IER(1471) : 0)
 	 goto a;
-  if ((! (r = source->local)) ? IER(1332) : (r->valid != ROUTER_MAGIC) ? IER(1333) : (! (r->ports)) ? IER(1334) : 0)
+  if ((! (r = source->local)) ? IER(1472) : (r->valid != ROUTER_MAGIC) ? IER(1473) : (! (r->ports)) ? IER(1474) : 0)
 	 goto a;
-  if ((! (r->lanes)) ? IER(1335) : (source->own_index >= r->lanes) ? IER(1336) : 0)
+  if ((! (r->lanes)) ? IER(1475) : (source->own_index >= r->lanes) ? IER(1476) : 0)
 	 goto a;
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, NO_POD, err));)
 	 {
@@ -380,7 +391,7 @@ _cru_assigned (destination, more_packets, err)
   int dblx;
 
   dblx = 0;
-  running = assigned (destination, more_packets, &dblx);
+  running = assigned (destination, more_packets, NULL, &dblx);
   RAISE(dblx);
   return ! dblx;
 }
@@ -409,18 +420,18 @@ expose (source, deferrals, err)
 {
   packet_list s;
 
-  if (deferrals ? (!(s = *deferrals)) : IER(1337))
+  if (deferrals ? (!(s = *deferrals)) : IER(1477))
 	 return;
-  if ((!source) ? IER(1338) : (source->gruntled != PORT_MAGIC) ? IER(1339) : 0)
+  if ((!source) ? IER(1478) : (source->gruntled != PORT_MAGIC) ? IER(1479) : 0)
 	 return;
   while (s->next_packet)
 	 s = s->next_packet;
-  if ((pthread_mutex_lock (&(source->suspension)) ? IER(1340) : 0) ? (source->gruntled = MUGGLE(41)) : 0)
+  if ((pthread_mutex_lock (&(source->suspension)) ? IER(1480) : 0) ? (source->gruntled = MUGGLE(38)) : 0)
 	 return;
   s->next_packet = source->deferred;
   source->deferred = *deferrals;
-  if (pthread_mutex_unlock (&(source->suspension)) ? IER(1341) : 0)
-	 source->gruntled = MUGGLE(42);
+  if (pthread_mutex_unlock (&(source->suspension)) ? IER(1481) : 0)
+	 source->gruntled = MUGGLE(39);
   *deferrals = NULL;
 }
 
@@ -433,6 +444,111 @@ expose (source, deferrals, err)
 
 
 
+static void
+park (source, k, limit, err)
+	  port source;
+	  unsigned k;               // the number of previous rounds parked since the most recent progress
+	  unsigned limit;           // the maximum number of microseconds to stay parked
+	  int *err;
+
+	  // Block until more packets are assigned to the port or until a
+	  // timeout twice as long as the previous one up to the limit. The
+	  // transport has to be checked for pending packets while the port
+	  // is locked so that a producer finding none will see the idling
+	  // flag and signal the port directly.
+{
+#define MILLION 1000000
+#define BILLION 1000000000
+
+  struct timespec t;
+  uintptr_t u;
+  int e;
+
+  u = ((uintptr_t) 1 << ((k < PARK_SCALE) ? k : PARK_SCALE));
+  u = ((u < limit) ? u : limit);
+  if (clock_gettime (CLOCK_REALTIME, &t) ? IER(1482) : 0)
+	 return;
+  t.tv_sec += (time_t) (u / MILLION);
+  if ((t.tv_nsec += (long) ((u % MILLION) * 1000)) >= BILLION)
+	 {
+		t.tv_sec++;
+		t.tv_nsec -= BILLION;
+	 }
+  if ((pthread_mutex_lock (&(source->suspension)) ? IER(1483) : 0) ? (source->gruntled = MUGGLE(40)) : 0)
+	 return;
+  if (source->dismissed ? 0 : ! (source->local->transport->pending) (source))
+	 {
+		source->idling = 1;
+		e = pthread_cond_timedwait (&(source->resumable), &(source->suspension), &t);
+		source->idling = 0;
+		if (((e == ETIMEDOUT) ? 0 : e ? IER(1484) : 0) ? (source->gruntled = MUGGLE(41)) : 0)
+		  return;
+	 }
+  if (pthread_mutex_unlock (&(source->suspension)) ? IER(1485) : 0)
+	 source->gruntled = MUGGLE(42);
+}
+
+
+
+
+
+
+
+
+static void
+idle (source, err)
+	  port source;
+	  int *err;
+
+	  // Wait for other workers to make progress according to the
+	  // idle policy of the local router. Spin for a number of rounds
+	  // after the most recent progress, then yield the processor for
+	  // a number of rounds, and thereafter park for increasing
+	  // intervals up to a limit unless signaled sooner by the arrival
+	  // of more packets. Record the time spent in each state.
+{
+  unsigned spins, yields, round, i;
+  struct timespec start, stop;
+  uintptr_t elapsed;
+  cru_idler p;
+
+  p = &(source->local->ro_plan.idler);
+  spins = (p->spins ? p->spins : SPIN_LIMIT);
+  yields = (p->yields ? p->yields : YIELD_LIMIT);
+  if (clock_gettime (CLOCK_MONOTONIC, &start) ? IER(1486) : 0)
+	 return;
+  if ((round = source->idle - 1) < spins)
+	 for (i = 0; i < SPIN_PAUSES; i++)
+		CPU_RELAX;
+  else if ((round - spins) < yields)
+	 sched_yield ();
+  else
+	 park (source, round - spins - yields, p->park_limit ? p->park_limit : PARK_LIMIT, err);
+  if (clock_gettime (CLOCK_MONOTONIC, &stop) ? IER(1487) : 0)
+	 return;
+  elapsed = (uintptr_t) ((stop.tv_sec - start.tv_sec) * BILLION + (stop.tv_nsec - start.tv_nsec));
+  if ((pthread_mutex_lock (&(source->suspension)) ? IER(1488) : 0) ? (source->gruntled = MUGGLE(43)) : 0)
+	 return;
+  if (round < spins)
+	 source->idled.spinning += elapsed;
+  else if ((round - spins) < yields)
+	 source->idled.yielding += elapsed;
+  else
+	 source->idled.parked += elapsed;
+  if (source->idle < UINT_MAX)
+	 source->idle++;
+  if (pthread_mutex_unlock (&(source->suspension)) ? IER(1489) : 0)
+	 source->gruntled = MUGGLE(44);
+}
+
+
+
+
+
+
+
+
+
 static void
 circulate (source, destinations, err)
 	  port source;
@@ -441,44 +557,31 @@ circulate (source, destinations, err)
 
 	  // Dispatch all packet lists buffered in the pod to the input
 	  // ports of other workers. If the job shows no other progress,
-	  // recycle the deferred packets for all workers. Back off
-	  // exponentially if the worker is spinning too much.
+	  // recycle the deferred packets for all workers. Idle according
+	  // to the router's policy if the worker is spinning too much.
 {
-#define MAX_PORTABLE_USLEEP_PARAMETER 999999
-#define MIN(a,b) (a < b ? a : (unsigned) b)
-
   uintptr_t i, enabled, runners;
 
-  if ((! destinations) ? 1 : (! (destinations->pod)) ? IER(1342) : 0)
+  if ((! destinations) ? 1 : (! (destinations->pod)) ? IER(1490) : 0)
 	 return;
-  if ((! source) ? IER(1343) : (source->gruntled != PORT_MAGIC) ? IER(1344) : 0)
+  if ((! source) ? IER(1491) : (source->gruntled != PORT_MAGIC) ? IER(1492) : 0)
 	 return;
-  if ((!(source->local)) ? IER(1345) : (source->local->valid != ROUTER_MAGIC) ? IER(1346) : 0)
+  if ((!(source->local)) ? IER(1493) : (source->local->valid != ROUTER_MAGIC) ? IER(1494) : 0)
 	 {
-		source->gruntled = MUGGLE(43);
+		source->gruntled = MUGGLE(45);
 		return;
 	 }
-  if ((source->local->ports ? 0 : IER(1347)) ? (source->local->valid = MUGGLE(44)) : 0)
+  if ((source->local->ports ? 0 : IER(1495)) ? (source->local->valid = MUGGLE(46)) : 0)
 	 return;
   expose (source, &(destinations->deferrals), err);
   for (runners = enabled = i = 0; i < destinations->arity; i++)
 	 if (destinations->pod[i])
-		if ((i < source->local->lanes) ? (enabled = 1) : ! IER(1348))
-		  runners += ! ! assigned (source->local->ports[i], &(destinations->pod[i]), err);
+		if ((i < source->local->lanes) ? (enabled = 1) : ! IER(1496))
+		  runners += ! ! assigned (source->local->ports[i], &(destinations->pod[i]), destinations->tails[i], err);
   if (enabled ? 0 : (runners <= 1))
 	 _cru_undefer (source->local, err);
-  if (source->backoff ? *err : 1)
-	 return;
-  if (source->backoff > 1)
-	 usleep (MIN(MAX_PORTABLE_USLEEP_PARAMETER, 1 << source->backoff));
-  if (source->backoff == BACKOFF_LIMIT)
-	 return;
-  if ((pthread_mutex_lock (&(source->suspension)) ? IER(1349) : 0) ? (source->gruntled = MUGGLE(45)) : 0)
-	 return;
-  if (++(source->backoff) ? 0 : IER(1350))
-	 source->gruntled = MUGGLE(46);
-  if (pthread_mutex_unlock (&(source->suspension)) ? IER(1351) : 0)
-	 source->gruntled = MUGGLE(47);
+  if (source->idle ? (! *err) : 0)
+	 idle (source, err);
 }
 
 
@@ -494,34 +597,14 @@ blocking_assignment (source, err)
 	  port source;
 	  int *err;
 
-	  // Wait until at least one new packet arrives and is signaled
-	  // from some other thread unless the worker has been dismissed or
-	  // there are packets available without waiting. Then return the
+	  // Wait for at least one new packet to arrive by way of the
+	  // transport of the router unless the worker has been dismissed
+	  // or there are packets available without waiting, and return the
 	  // new packets if any.
 {
-  packet_list s;
-
-  if ((! source) ? IER(1352) : (source->gruntled != PORT_MAGIC) ? IER(1353) : 0)
+  if ((! source) ? IER(1497) : (source->gruntled != PORT_MAGIC) ? IER(1498) : 0)
 	 return NULL;
-  if ((pthread_mutex_lock (&(source->suspension)) ? IER(1354) : 0) ? (source->gruntled = MUGGLE(48)) : 0)
-	 return NULL;
-  if ((s = source->assigned) ? (!(source->assigned = NULL)) : source->dismissed)
-	 {
-		if (pthread_mutex_unlock (&(source->suspension)) ? IER(1355) : 0)
- 		  source->gruntled = MUGGLE(49);
-		return s;
-	 }
-  if (! _cru_dwindled (source->local, err))
-	 goto a;
-  source->waiting = 1;
-  if (pthread_cond_wait (&(source->resumable), &(source->suspension)) ? IER(1356) : 0)
-	 source->gruntled = MUGGLE(50);
-  s = source->assigned;
-  source->assigned = NULL;
-  source->waiting = 0;
- a: if (pthread_mutex_unlock (&(source->suspension)) ? IER(1357) : 0)
-	 source->gruntled = MUGGLE(51);
-  return s;
+  return (source->local->transport->awaited) (source, err);
 }
 
 
@@ -532,7 +615,6 @@ blocking_assignment (source, err)
 
 
 
-
 packet_list
 _cru_exchanged (source, destinations, err)
 	  port source;
@@ -550,10 +632,46 @@ _cru_exchanged (source, destinations, err)
 {
   packet_list s;
 
-  if ((! source) ? IER(1358) : (source->gruntled != PORT_MAGIC) ? IER(1359) : 0)
+  if ((! source) ? IER(1499) : (source->gruntled != PORT_MAGIC) ? IER(1500) : 0)
 	 return NULL;
   if ((s = _cru_recycled (destinations, source->own_index, err)) ? s : (s = assignment (source, err)))
 	 return s;
   circulate (source, destinations, err);
   return blocking_assignment (source, err);
 }
+
+
+
+
+
+
+
+
+
+packet_list
+_cru_polled (source, destinations, err)
+	  port source;
+	  packet_pod destinations;
+	  int *err;
+
+	  // Acquire more packets on behalf of a worker that still has
+	  // others to process, so it needn't wait or idle. Dispatch the
+	  // packets buffered in the pod to keep the other workers busy,
+	  // and then return any packets recycled from the worker's own
+	  // entry in the pod or already queued for it, if any.
+{
+  packet_list s;
+  uintptr_t i;
+
+  if ((! source) ? IER(1501) : (source->gruntled != PORT_MAGIC) ? IER(1502) : 0)
+	 return NULL;
+  if ((!(source->local)) ? IER(1503) : (source->local->valid != ROUTER_MAGIC) ? IER(1504) : 0)
+	 return NULL;
+  if ((! destinations) ? 0 : destinations->pod ? 0 : IER(1505))
+	 return NULL;
+  s = _cru_recycled (destinations, source->own_index, err);
+  for (i = 0; destinations ? (i < destinations->arity) : 0; i++)
+	 if (destinations->pod[i] ? (i < source->local->lanes) : 0)
+		assigned (source->local->ports[i], &(destinations->pod[i]), destinations->tails[i], err);
+  return (s ? s : assignment (source, err));
+}
@@ -22,37 +22,79 @@
 // This file declares functions relevent to sending and receiving
 // packets by worker threads.
 
+#include "count.h"
 #include "ptr.h"
 
 // arbitrary magic number for consistency checks
 #define PORT_MAGIC 664161206
 
-// a prime number exceeding the THREAD_LIMIT constant defined in route.c
-#define LARGE_PRIME 1031
+// an odd constant close to 2^64 divided by the golden ratio for multiplicative hashing
+#define GOLDEN_MULTIPLIER (uint64_t) 0x9e3779b97f4a7c15
 
-// a modified mod operator for better load balancing
-#define MOD(a,b) (((a) % LARGE_PRIME) % (b))
+// map a hash h uniformly onto the range 0 through n - 1 by scrambling it with a multiplication,
+// keeping the high 32 bits, and scaling them to the range without a division
+#define RANGE(h,n) ((unsigned) ((((((uint64_t) (h)) * GOLDEN_MULTIPLIER) >> 32) * (uint64_t) (n)) >> 32))
+
+// the lane for a hash h among n lanes according to a partitioner p if any or the default otherwise
+#define LANE(h,p,n) ((p) ? _cru_partitioned (h, p, n, err) : RANGE(h, n))
 
 // a kill switch parameter to _cru_exchanged for workers that are killed but have to run anyway to avoid deadlock
 #define IGNORE_KILL_SWITCH 0
 
-// log of the maximum microsleep parameter used in an exponential backoff protocol
-#define BACKOFF_LIMIT 18
+// default number of rounds an idle worker spins before yielding during an ordered traversal
+#define SPIN_LIMIT 0x40
+
+// default number of rounds an idle worker yields before parking
+#define YIELD_LIMIT 0x10
+
+// default maximum number of microseconds an idle worker stays parked per round
+#define PARK_LIMIT 0x400
+
+// number of pause instructions in each spinning round
+#define SPIN_PAUSES 0x20
+
+// log of the longest park in microseconds considered before the limit applies
+#define PARK_SCALE 20
+
+// a hint to the processor that the caller is busy waiting
+#if defined(__x86_64__) || defined(__i386__)
+#define CPU_RELAX __builtin_ia32_pause ()
+#elif defined(__aarch64__) || defined(__arm__)
+#define CPU_RELAX __asm__ __volatile__ ("yield" ::: "memory")
+#else
+#define CPU_RELAX __asm__ __volatile__ ("" ::: "memory")
+#endif
 
 // default value for the destinations parameter to abort functions
 #define NO_POD NULL
 
+// In the local transport, incoming packets are pushed onto the
+// assigned list of a port by any number of producers without locking
+// and taken all at once by its consumer. Only the sleeping and waking
+// of the consumer require the suspension mutex.
+
+// atomically take all packets assigned to a port
+#define INBOX_TAKEN(p) __atomic_exchange_n (&((p)->assigned), NULL, __ATOMIC_ACQ_REL)
+
+// atomically replace the assigned packets of a port with s and return non-zero if e is its current value
+#define INBOX_SWAPPED(p,e,s) __sync_bool_compare_and_swap (&((p)->assigned), e, s)
+
 // persistent data associated with an individual worker thread
 
 struct port_s
 {
   int gruntled;                 // holds PORT_MAGIC if no pthread operation has failed
-  int waiting;                  // set to non-zero when a worker is waiting to be resumed
+  int waiting;                  // set to non-zero when a worker is waiting to be resumed and cleared by the resumer
   int dismissed;                // set to non-zero when a worker needn't wait to be resumed
-  unsigned backoff;             // log of the number of microseconds to wait before retrying if non-zero
+  int idling;                   // set to non-zero when a worker is parked until more packets arrive or a timeout
+  unsigned idle;                // one more than the number of unproductive rounds if idling is enabled, zero otherwise
+  struct cru_idling_s idled;    // the time spent by the worker on this port in each idle state
   unsigned own_index;           // the position of this port in the array of the local router's ports
-  packet_list assigned;         // incoming packets waiting to be processed on this port
+  packet_list assigned;         // incoming packets waiting to be processed on this port in the local transport, accessed only atomically
   packet_list deferred;         // incoming packets whose prerequisites are not yet available
+  packet_list frontier;         // incoming packets held for the next level of a depth limited build
+  packet_list ranked;           // incoming packets in a priority inbox when building best first
+  packet_list extant;           // the base node of a graph built from given edges if this port owns it
   union
   {
 	 edge_list disconnections;   // edges that don't survive filtering
@@ -64,6 +106,8 @@ struct port_s
   node_list survivors;          // temporary storage for nodes that survive being filtered
   node_list deletions;          // temporary storage for nodes that don't survive being filtered
   node_set reachable;           // set of nodes assigned to this port that are reachable by the current traversal
+  slab slabs;                   // storage for nodes and edges created by this worker when building in arena mode
+  struct census_s tally;        // cardinalities of the nodes created by this worker when building
   packet_pod peers;
   union
   {
@@ -109,6 +153,10 @@ _cru_abort_new_packets (port source, packet_pod destinations, cru_destructor_pai
 
 // --------------- dataflow --------------------------------------------------------------------------------
 
+// return the lane assigned to a hash h among n lanes by a user-defined partitioner p
+extern unsigned
+_cru_partitioned (uintptr_t h, cru_partitioner p, unsigned n, int *err);
+
 // send an empty packet to the given port
 extern int
 _cru_ping (port destination, int *err);
@@ -125,6 +173,10 @@ _cru_assigned (port destination, packet_list *more_packets, int *err);
 extern packet_list
 _cru_exchanged (port source, packet_pod destinations, int *err);
 
+// receive any packets available to the source without blocking after sending others to the destinations
+extern packet_list
+_cru_polled (port source, packet_pod destinations, int *err);
+
 #ifdef __cplusplus
 }
 #endif
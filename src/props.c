@@ -71,15 +71,15 @@ property_unsetting_task (source, err)
   int ux;
 
   seen = NULL;
-  if ((! source) ? IER(1390) : (source->gruntled != PORT_MAGIC) ? IER(1391) : 0)
+  if ((! source) ? IER(1536) : (source->gruntled != PORT_MAGIC) ? IER(1537) : 0)
 	 goto a;
-  if ((!(r = source->local)) ? IER(1392) : (r->valid != ROUTER_MAGIC) ? IER(1393) : 0)
+  if ((!(r = source->local)) ? IER(1538) : (r->valid != ROUTER_MAGIC) ? IER(1539) : 0)
 	 goto a;
-  if ((d = source->peers) ? ((! (p = PROBE_OF(r))) ? IER(1394) : *err) : IER(1395))
+  if ((d = source->peers) ? ((! (p = PROBE_OF(r))) ? IER(1540) : *err) : IER(1541))
 	 return _cru_abort_status (source, d, err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
-		if ((! (n = (node_list) incoming->payload)) ? IER(1396) : _cru_test_and_set_membership (n, &seen, err) ? 1 : *err)
+		if ((! (n = (node_list) incoming->payload)) ? IER(1542) : _cru_test_and_set_membership (n, &seen, err) ? 1 : *err)
 		  goto b;
 		_cru_scatter_out (n, d, err);
 		if (n->vertex_property ? p->vertex.m_free : NULL)
@@ -158,7 +158,7 @@ _cru_unset_properties (g, r, err)
 {
   cru_prop p;
 
-  if ((! g) ? IER(1397) : (! r) ? IER(1398) : (r->valid != ROUTER_MAGIC) ? IER(1399) : ((p = PROBE_OF(r))) ? 0 : IER(1400))
+  if ((! g) ? IER(1543) : (! r) ? IER(1544) : (r->valid != ROUTER_MAGIC) ? IER(1545) : ((p = PROBE_OF(r))) ? 0 : IER(1546))
 	 return;
   if (((*err == CRU_INTKIL) ? 1 : ! *err) ? _cru_reset (r, (task) property_unsetting_task, err) : NULL)
 	 if (_cru_launched (UNKILLABLE, g->base_node, _cru_shared (r), err) ? (! *err) : 0)
@@ -196,7 +196,7 @@ _cru_propped (n, i, o, p, err)
   void *v;
   struct node_list_s s;
 
-  if (*err ? 1 : (! n) ? IER(1401) : (! p) ? IER(1402) : n->vertex_property ? IER(1403) : 0)
+  if (*err ? 1 : (! n) ? IER(1547) : (! p) ? IER(1548) : n->vertex_property ? IER(1549) : 0)
 	 goto a;
   memcpy (&s, n, sizeof (s));
   s.edges_in = i;
@@ -240,19 +240,19 @@ property_setting_task (source, err)
   killed = 0;
   sample = 0;
   seen = NULL;
-  if ((! source) ? IER(1404) : (source->gruntled != PORT_MAGIC) ? IER(1405) : 0)
+  if ((! source) ? IER(1550) : (source->gruntled != PORT_MAGIC) ? IER(1551) : 0)
 	 return NULL;
-  if ((!(r = source->local)) ? IER(1406) : (r->valid != ROUTER_MAGIC) ? IER(1407) : 0)
+  if ((!(r = source->local)) ? IER(1552) : (r->valid != ROUTER_MAGIC) ? IER(1553) : 0)
 	 return NULL;
-  if ((!(d = source->peers)) ? IER(1408) : (! (p = PROBE_OF(r))) ? IER(1409) : 0)
+  if ((!(d = source->peers)) ? IER(1554) : (! (p = PROBE_OF(r))) ? IER(1555) : 0)
 	 return _cru_abort_status (source, d, err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
-		KILL_SITE(27);
+		KILL_SITE(28);
 		killed = (killed ? 1 : KILLED);
 		if (*err ? 1 : killed)
 		  goto a;
-		if ((! (n = (node_list) incoming->payload)) ? IER(1410) : _cru_test_and_set_membership (n, &seen, err) ? 1 : *err)
+		if ((! (n = (node_list) incoming->payload)) ? IER(1556) : _cru_test_and_set_membership (n, &seen, err) ? 1 : *err)
 		  goto a;
 		_cru_scatter_out (n, d, err);
 		if (! *err)
@@ -288,7 +288,7 @@ _cru_set_properties (g, k, r, err)
   node_list n;
   router z;
 
-  if ((! g) ? IER(1411) : (! r) ? IER(1412) : (r->valid != ROUTER_MAGIC) ? IER(1413) : ((p = PROBE_OF(r))) ? 0 : IER(1414))
+  if ((! g) ? IER(1557) : (! r) ? IER(1558) : (r->valid != ROUTER_MAGIC) ? IER(1559) : ((p = PROBE_OF(r))) ? 0 : IER(1560))
 	 return 0;
   if (_cru_empty_fold (&(p->incident)) ? 0 : _cru_half_duplex (g, err))
 	 if (! _cru_launched (k, g->base_node, _cru_router ((task) _cru_full_duplexing_task, r->lanes, err), err))
@@ -341,9 +341,9 @@ property_clearing_task (source, err)
   cru_prop p;
   router r;
 
-  if ((! source) ? IER(1415) : (source->gruntled != PORT_MAGIC) ? IER(1416) : ! _cru_pingback (source, err))
+  if ((! source) ? IER(1561) : (source->gruntled != PORT_MAGIC) ? IER(1562) : ! _cru_pingback (source, err))
 	 goto a;
-  if ((! (r = source->local)) ? IER(1417) : (r->valid != ROUTER_MAGIC) ? IER(1418) : ((p = PROBE_OF(r))) ? 0 : IER(1419))
+  if ((! (r = source->local)) ? IER(1563) : (r->valid != ROUTER_MAGIC) ? IER(1564) : ((p = PROBE_OF(r))) ? 0 : IER(1565))
 	 goto a;
   unprop (source->survivors, p->vertex.m_free, DOPPLEGANGERS_TOO, err);
  a: status = *err;
@@ -369,9 +369,9 @@ _cru_clear_properties (r, err)
   cru_prop p;
   unsigned port_number;
 
-  if ((! r) ? IER(1420) : (r->valid != ROUTER_MAGIC) ? IER(1421) : (! (r->ports)) ? IER(1422) : 0)
+  if ((! r) ? IER(1566) : (r->valid != ROUTER_MAGIC) ? IER(1567) : (! (r->ports)) ? IER(1568) : 0)
 	 return;
-  if (((p = PROBE_OF(r))) ? 0 : IER(1423))
+  if (((p = PROBE_OF(r))) ? 0 : IER(1569))
 	 return;
   if ((! *err) ? 1 : (*err == CRU_INTKIL))
 	 if (_cru_launched (UNKILLABLE, NO_BASE, _cru_shared (_cru_reset (r, (task) property_clearing_task, err)), err))
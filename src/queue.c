@@ -74,7 +74,7 @@ _cru_nodes_of (q, err)
   if ((result = q->front))
 	 result->previous = NULL;
   RAISE(q->qu_status);
-  q->qu_status = THE_IER(1424);
+  q->qu_status = THE_IER(1570);
   _cru_free (q);
   return result;
 }
@@ -120,15 +120,15 @@ _cru_enqueued_node (new_node, q, err)
 
 	  // Put a new node into a node queue at the end.
 {
-  if ((! q) ? IER(1425) : 0)
+  if ((! q) ? IER(1571) : 0)
 	 return 0;
-  if ((! new_node) ? 1 : new_node->next_node ? IER(1426) : new_node->previous ? IER(1427) : 0)
+  if ((! new_node) ? 1 : new_node->next_node ? IER(1572) : new_node->previous ? IER(1573) : 0)
 	 return 0;
   if (*q ? NULL : (*q = (node_queue) _cru_malloc (sizeof (**q))))
 	 memset (*q, 0, sizeof (**q));
   else if (*q ? 0 : RAISE(ENOMEM))
 	 return 0;
-  if (((!((*q)->front)) != !((*q)->back)) ? IER(1428) : (!((*q)->back)) ? 0 : (*q)->back->next_node ? IER(1429) : 0)
+  if (((!((*q)->front)) != !((*q)->back)) ? IER(1574) : (!((*q)->back)) ? 0 : (*q)->back->next_node ? IER(1575) : 0)
 	 return 0;
   if ((*q)->back)
 	 {
@@ -159,11 +159,11 @@ _cru_append_nodes (q, r, err)
 
 	  // Append one node queue to another.
 {
-  if (q ? 0 : IER(1430))
+  if (q ? 0 : IER(1576))
 	 return 0;
   if ((! r) ? 1 : *q ? 0 : ! ! (*q = r))
 	 return 1;
-  if (((!(r->front)) != ! (r->back)) ? IER(1431) : ((!((*q)->front)) != !((*q)->back)) ? IER(1432) : 0)
+  if (((!(r->front)) != ! (r->back)) ? IER(1577) : ((!((*q)->front)) != !((*q)->back)) ? IER(1578) : 0)
 	 return 0;
   (*q)->qu_status = ((*q)->qu_status ? (*q)->qu_status : r->qu_status);
   if ((! (r->front)) ? (! ((*q)->front)) : 0)
@@ -175,7 +175,7 @@ _cru_append_nodes (q, r, err)
 		(*q)->front->previous = &((*q)->front);
 		goto a;
 	 }
-  if (r->back->next_node ? IER(1433) : (*q)->back->next_node ? IER(1434) : (r->front->previous != &(r->front)) ? IER(1435) : 0)
+  if (r->back->next_node ? IER(1579) : (*q)->back->next_node ? IER(1580) : (r->front->previous != &(r->front)) ? IER(1581) : 0)
 	 return 0;
   (*q)->back->next_node = r->front;
   r->front->previous = &((*q)->back->next_node);
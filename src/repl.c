@@ -33,7 +33,7 @@ _cru_undefined_hash (v)
 
 	  // Complain and return no hash at all.
 {
-  _cru_globally_throw (THE_IER(1436));
+  _cru_globally_throw (THE_IER(1582));
   return 0;
 }
 
@@ -77,7 +77,7 @@ _cru_undefined_bpred (x, y, err)
 
 	  // Always raise an error and return zero.
 {
-  IER(1437);
+  IER(1583);
   return 0;
 }
 
@@ -186,7 +186,7 @@ _cru_undefined_nop (err)
 
 	  // Unconditionally raise an error.
 {
-  IER(1438);
+  IER(1584);
   return NULL;
 }
 
@@ -233,7 +233,7 @@ _cru_undefined_bop (x, y, err)
 {
   cru_destructor d;
 
-  IER(1439);
+  IER(1585);
   return NULL;
 }
 
@@ -313,7 +313,7 @@ _cru_undefined_top (l, m, r, err)
 
 	  // Unconditionally raise an internal error and return NULL.
 {
-  IER(1440);
+  IER(1586);
   return NULL;
 }
 
@@ -24,6 +24,7 @@
 #include "edges.h"
 #include "errs.h"
 #include "graph.h"
+#include "killers.h"
 #include "nodes.h"
 #include "launch.h"
 #include "pack.h"
@@ -31,6 +32,7 @@
 #include "ports.h"
 #include "repl.h"
 #include "route.h"
+#include "transport.h"
 #include "wrap.h"
 
 // default values for unspecified router fields
@@ -64,7 +66,7 @@ pointer_array_size (l, err)
   size_t size;
   void *pointer;
 
-  if (((size = (l * sizeof (pointer))) < l) ? IER(1441) : (size < sizeof (pointer)) ? IER(1442) : 0)
+  if (((size = (l * sizeof (pointer))) < l) ? IER(1587) : (size < sizeof (pointer)) ? IER(1588) : 0)
 	 return 0;
   return size;
 }
@@ -78,12 +80,12 @@ thread_id_array_size (l, err)
 	  unsigned l;
 	  int *err;
 
-	  // Return the size in bytes of an array of l thread ids.
+	  // Return the size in bytes of an array of l pooled threads.
 {
   size_t size;
-  pthread_t thread;
+  hand thread;
 
-  if (((size = (l * sizeof (thread))) < l) ? IER(1443) : (size < sizeof (thread)) ? IER(1444) : 0)
+  if (((size = (l * sizeof (thread))) < l) ? IER(1589) : (size < sizeof (thread)) ? IER(1590) : 0)
 	 return 0;
   return size;
 }
@@ -128,7 +130,7 @@ router_of (b, w, m, c, f, y, i, x, n, p, e, a, t, s, lanes, err)
 	 lanes = THREAD_LIMIT;
   port_size = pointer_array_size (lanes, err);
   thread_size = thread_id_array_size (lanes, err);
-  if (*err ? 1 : (! lanes) ? IER(1445) : 0)
+  if (*err ? 1 : (! lanes) ? IER(1591) : 0)
 	 goto a;
   if ((r = (router) _cru_malloc (sizeof (*r))) ? 0 : RAISE(ENOMEM))
 	 goto a;
@@ -140,37 +142,39 @@ router_of (b, w, m, c, f, y, i, x, n, p, e, a, t, s, lanes, err)
 	 goto b;
   if (_cru_cond_init (&(r->transition), err))
 	 goto c;
-  if (((r->threads = (pthread_t *) _cru_malloc (thread_size))) ? 0 : RAISE(ENOMEM))
+  if (((r->threads = (hand *) _cru_malloc (thread_size))) ? 0 : RAISE(ENOMEM))
 	 goto d;
   memset (r->threads, 0, thread_size);
   if ((u = ((r->ports = (port *) _cru_malloc (port_size)) ? 0 : RAISE(ENOMEM))))
 	 goto d;
   memset (r->ports, 0, port_size);
-  if ((f ? (r->tag = FIL) : 0) ? (u++ ? IER(1446) : ! memcpy (&(r->filter), f, sizeof (r->filter))) : 0)
+  if ((f ? (r->tag = FIL) : 0) ? (u++ ? IER(1592) : ! memcpy (&(r->filter), f, sizeof (r->filter))) : 0)
 	 goto d;
-  if ((w ? (r->tag = MUT) : 0) ? (u++ ? IER(1447) : ! memcpy (&(r->mutator), w, sizeof (r->mutator))) : 0)
+  if ((w ? (r->tag = MUT) : 0) ? (u++ ? IER(1593) : ! memcpy (&(r->mutator), w, sizeof (r->mutator))) : 0)
 	 goto d;
-  if ((i ? (r->tag = IND) : 0) ? (u++ ? IER(1448) : ! memcpy (&(r->inducer), i, sizeof (r->inducer))) : 0)
+  if ((i ? (r->tag = IND) : 0) ? (u++ ? IER(1594) : ! memcpy (&(r->inducer), i, sizeof (r->inducer))) : 0)
 	 goto d;
-  if ((b ? (r->tag = BUI) : 0) ? (u++ ? IER(1449) : ! memcpy (&(r->builder), b, sizeof (r->builder))) : 0)
+  if ((b ? (r->tag = BUI) : 0) ? (u++ ? IER(1595) : ! memcpy (&(r->builder), b, sizeof (r->builder))) : 0)
 	 goto d;
-  if ((e ? (r->tag = CRO) : 0) ? (u++ ? IER(1450) : ! memcpy (&(r->crosser), e, sizeof (r->crosser))) : 0)
+  if ((e ? (r->tag = CRO) : 0) ? (u++ ? IER(1596) : ! memcpy (&(r->crosser), e, sizeof (r->crosser))) : 0)
 	 goto d;
-  if ((x ? (r->tag = EXT) : 0) ? (u++ ? IER(1451) : ! memcpy (&(r->stretcher), x, sizeof (r->stretcher))) : 0)
+  if ((x ? (r->tag = EXT) : 0) ? (u++ ? IER(1597) : ! memcpy (&(r->stretcher), x, sizeof (r->stretcher))) : 0)
 	 goto d;
-  if ((n ? (r->tag = SPL) : 0) ? (u++ ? IER(1452) : ! memcpy (&(r->splitter), n, sizeof (r->splitter))) : 0)
+  if ((n ? (r->tag = SPL) : 0) ? (u++ ? IER(1598) : ! memcpy (&(r->splitter), n, sizeof (r->splitter))) : 0)
 	 goto d;
-  if ((y ? (r->tag = COM) : 0) ? (u++ ? IER(1453) : ! memcpy (&(r->composer), y, sizeof (r->composer))) : 0)
+  if ((y ? (r->tag = COM) : 0) ? (u++ ? IER(1599) : ! memcpy (&(r->composer), y, sizeof (r->composer))) : 0)
 	 goto d;
-  if ((p ? (r->tag = POS) : 0) ? (u++ ? IER(1454) : ! memcpy (&(r->postponer), p, sizeof (r->postponer))) : 0)
+  if ((p ? (r->tag = POS) : 0) ? (u++ ? IER(1600) : ! memcpy (&(r->postponer), p, sizeof (r->postponer))) : 0)
 	 goto d;
-  if ((c ? (r->tag = CLU) : 0) ? (u++ ? IER(1455) : ! memcpy (&(r->merger), c, sizeof (r->merger))) : 0)
+  if ((c ? (r->tag = CLU) : 0) ? (u++ ? IER(1601) : ! memcpy (&(r->merger), c, sizeof (r->merger))) : 0)
 	 goto d;
-  if ((m ? (r->tag = MAP) : 0) ? (u++ ? IER(1456) : ! memcpy (&(r->mapreducer), m, sizeof (r->mapreducer))) : 0)
+  if ((m ? (r->tag = MAP) : 0) ? (u++ ? IER(1602) : ! memcpy (&(r->mapreducer), m, sizeof (r->mapreducer))) : 0)
 	 goto d;
-  if ((a ? (r->tag = FAB) : 0) ? (u++ ? IER(1457) : ! memcpy (&(r->fabricator), a, sizeof (r->fabricator))) : 0)
+  if ((a ? (r->tag = FAB) : 0) ? (u++ ? IER(1603) : ! memcpy (&(r->fabricator), a, sizeof (r->fabricator))) : 0)
 	 goto d;
   r->work = t;
+  r->partitioner = (b ? b->partitioner : NULL);
+  r->transport = &_cru_local_transport;
   r->valid = ROUTER_MAGIC;
   for (o = 0; o < r->lanes; o++)
 	 if (!(r->ports[o] = _cru_new_port (o, r, err)))
@@ -179,7 +183,7 @@ router_of (b, w, m, c, f, y, i, x, n, p, e, a, t, s, lanes, err)
  d: _cru_free_router (r, err);
   return NULL;
  c: pthread_mutex_destroy (&(r->lock));
- b: r->valid = MUGGLE(52);
+ b: r->valid = MUGGLE(47);
   _cru_free (r);
  a: return NULL;
 }
@@ -197,21 +201,21 @@ plan (p, r, err)
 	  router r;
 	  int *err;
 
-	  // Enable an exponential backoff protocol if a traversal order is
-	  // specified.
+	  // Enable the idle policy given by the plan if a traversal order
+	  // is specified.
 {
   uintptr_t i;
 
-  if ((! p) ? IER(1458) : (! r) ? IER(1459) : (r->ports ? 0 : IER(1460)) ? (r->valid = MUGGLE(53)) : 0)
+  if ((! p) ? IER(1604) : (! r) ? IER(1605) : (r->ports ? 0 : IER(1606)) ? (r->valid = MUGGLE(48)) : 0)
 	 return;
   memcpy (&(r->ro_plan), p, sizeof (r->ro_plan));
   if (! (p->remote_first ? 1 : p->local_first))
 	 return;
   for (i = 0; i < r->lanes; i++)
 	 {
-		if ((r->ports[i] ? 0 : IER(1461)) ? (r->valid = MUGGLE(54)) : 0)
+		if ((r->ports[i] ? 0 : IER(1607)) ? (r->valid = MUGGLE(49)) : 0)
 		  return;
-		(r->ports[i])->backoff = 1;
+		(r->ports[i])->idle = 1;
 	 }
 }
 
@@ -418,7 +422,7 @@ _cru_classifying_router (c, b, s, lanes, err)
   cru_partition h;
   router r;
 
-  if ((! c) ? IER(1462) : (! s) ? IER(1463) : 0)
+  if ((! c) ? IER(1608) : (! s) ? IER(1609) : 0)
 	 return NULL;
   if (! (h = _cru_partition (lanes, err)))
 	 return NULL;
@@ -496,20 +500,22 @@ _cru_reset (r, t, err)
   uintptr_t i;
   port s;
 
-  if ((! r) ? IER(1464) : (r->valid != ROUTER_MAGIC) ? IER(1465) : r->ports ? 0 : IER(1466))
+  if ((! r) ? IER(1610) : (r->valid != ROUTER_MAGIC) ? IER(1611) : r->ports ? 0 : IER(1612))
 	 return NULL;
   for (i = 0; i < r->lanes; i++)
-	 if ((s = r->ports[i]) ? ((s->gruntled == PORT_MAGIC) ? 0 : IER(1467)) : IER(1468))
-		r->valid = MUGGLE(55);
+	 if ((s = r->ports[i]) ? ((s->gruntled == PORT_MAGIC) ? 0 : IER(1613)) : IER(1614))
+		r->valid = MUGGLE(50);
 	 else
 		{
 		  s->dismissed = s->waiting = 0;
-		  s->backoff = (s->backoff ? 1 : 0);
+		  s->idle = (s->idle ? 1 : 0);
 		}
   r->quiescent = 0;
   r->running = 0;
   r->ro_status = 0;
-  r->killed = 0;
+  r->level = 0;
+  r->created = 0;
+  __atomic_store_n (&(r->killed), 0, __ATOMIC_RELAXED);
   r->work = t;
   return r;
 }
@@ -623,11 +629,24 @@ _cru_stored (g, r, err)
 	  router r;
 	  int *err;
 
-	  // Store the user-defined storage of a graph in a router.
+	  // Store the user-defined storage of a graph in a router. Any
+	  // operation other than a read-only one may add nodes or edges
+	  // from the heap to a graph built in arena mode. Mutation and
+	  // classification, whose routers are the only merging routers
+	  // with a partition, leave its cardinalities unchanged, but other
+	  // operations invalidate them until they're tallied again by a
+	  // pruning pass or a query. If the graph owns no slabs and the operation
+	  // makes none, its workers can free nodes and edges without
+	  // looking them up in the arena.
 {
-  if ((! g) ? IER(1469) : (g->glad != GRAPH_MAGIC) ? IER(1470) : (! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(1471) : 0)
+  if ((! g) ? IER(1615) : (g->glad != GRAPH_MAGIC) ? IER(1616) : (! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(1617) : 0)
 	 return NULL;
+  if ((r->tag == MAP) ? 0 : (r->tag == IND) ? 0 : (r->tag == CRO) ? 0 : (r->tag != FAB))
+	 g->g_mixed = 1;
+  if ((r->tag == MAP) ? 0 : (r->tag == IND) ? 0 : (r->tag == CRO) ? 0 : (r->tag == FAB) ? 0 : (r->tag == MUT) ? 0 : (r->tag != CLU) ? 1 : ! (r->partition))
+	 g->g_census.counted = 0;
   r->ro_store = g->g_store;
+  r->heaped = ((r->tag == BUI) ? (! (r->builder.bu_sig.arena)) : 1) ? ! (g->g_slabs) : 0;
   return r;
 }
 
@@ -660,8 +679,10 @@ _cru_free_router (r, err)
 	  router r;
 	  int *err;
 
-	  // Tear down a router.
+	  // Tear down a router and report the idle times of its workers
+	  // if requested.
 {
+  cru_idling t;
   uintptr_t o;
 
   if (r ? (r->shared)-- : 1)
@@ -674,6 +695,14 @@ _cru_free_router (r, err)
 #endif
   if (! (r->ports))
 	 goto a;
+  if ((t = r->ro_plan.idler.idled))
+	 for (o = 0; o < r->lanes; o++)
+		if (r->ports[o])
+		  {
+			 t->spinning += r->ports[o]->idled.spinning;
+			 t->yielding += r->ports[o]->idled.yielding;
+			 t->parked += r->ports[o]->idled.parked;
+		  }
   for (o = 0; o < r->lanes; o++)
 	 _cru_free_port (&(r->ports[o]), err);
 #ifdef WRAP
@@ -682,14 +711,14 @@ _cru_free_router (r, err)
   free (r->ports);
 #endif
  a: if (pthread_mutex_destroy (&(r->lock)))
-	 IER(1472);
+	 IER(1618);
   if (pthread_cond_destroy (&(r->transition)))
-	 IER(1473);
+	 IER(1619);
   RAISE(r->ro_status);
-  if (*err ? 0 : r->killed)
+  if (*err ? 0 : r->killed ? (! STOPPED(r)) : 0)
 	 RAISE(CRU_INTKIL);
-  r->ro_status = THE_IER(1474);
-  r->valid = MUGGLE(56);
+  r->ro_status = THE_IER(1620);
+  r->valid = MUGGLE(51);
   _cru_free (r);
 }
 
@@ -707,7 +736,7 @@ sweep (s, z, err)
 
 	  // Free the deleted nodes in the port.
 {
-  if ((! s) ? IER(1475) : (s->gruntled != PORT_MAGIC) ? IER(1476) : (! z) ? IER(1477) : 0)
+  if ((! s) ? IER(1621) : (s->gruntled != PORT_MAGIC) ? IER(1622) : (! z) ? IER(1623) : 0)
 	 return;
   _cru_free_edges_and_labels (z->e_free, s->disconnections, err);
   _cru_free_nodes (s->survivors, z, err);
@@ -733,9 +762,9 @@ sweeping_task (source, err)
   intptr_t status;
   router r;
 
-  if ((! source) ? IER(1478) : (source->gruntled != PORT_MAGIC) ? IER(1479) : ! _cru_pingback (source, err))
+  if ((! source) ? IER(1624) : (source->gruntled != PORT_MAGIC) ? IER(1625) : ! _cru_pingback (source, err))
 	 goto a;
-  if ((! (r = source->local)) ? IER(1480) : (r->valid != ROUTER_MAGIC) ? IER(1481) : 0)
+  if ((! (r = source->local)) ? IER(1626) : (r->valid != ROUTER_MAGIC) ? IER(1627) : 0)
 	 goto a;
   sweep (source, &(r->ro_sig.destructors), err);
  a: status = *err;
@@ -763,11 +792,11 @@ _cru_sweep (r, err)
 
   if (r ? r->shared : 0)
 	 goto a;
-  if ((! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(1482) : r->ports ? 0 : IER(1483))
+  if ((! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(1628) : r->ports ? 0 : IER(1629))
 	 goto a;
   sweepable = 0;
   for (i = 0; sweepable ? 0 : (i < r->lanes); i++)
-	 if (((s = r->ports[i])) ? 1 : ! IER(1484))
+	 if (((s = r->ports[i])) ? 1 : ! IER(1630))
 		sweepable = (s->survivors ? 1 : s->deletions ? 1 : ! ! (s->disconnections));
   if (! sweepable)
 	 goto a;
@@ -31,6 +31,9 @@
 // identifies the struct type in the router union
 typedef enum {NON, FIL, BUI, MUT, COM, CLU, MAP, IND, EXT, SPL, POS, CRO, FAB, DED} router_tag;
 
+// non-zero if router r can create another vertex without exceeding a vertex limit l, which counts it as created
+#define BUDGETED(l,r) ((l) ? (__atomic_add_fetch (&((r)->created), 1, __ATOMIC_RELAXED) <= (l)) : 1)
+
 // the type of function called by a runner passed to _cru_create
 typedef void *(*task)(port, int *);
 
@@ -65,12 +68,17 @@ struct router_s
   cru_partition partition;               // used for constructing equivalence classes of vertices
   node_list base_register;               // used during partitioning and induction
   pthread_mutex_t lock;                  // secures mutually exclusive access to this structure during non-atomic operations
-  pthread_t *threads;                    // pointer to an array of one thread id for each port
+  hand *threads;                         // pointer to an array of one pooled thread for each port
   unsigned running;                      // the number worker threads currently running with this router and not waiting
   uintptr_t shared;                      // reference count for shared routers
   unsigned lanes;                        // the number of ports in the array, with one for each possible worker
   port *ports;                           // an array of ports for all workers associated with this router
   task work;                             // the function that runs in each worker thread
+  cru_partitioner partitioner;           // if non-null, assigns packets to ports by their hash values
+  transport transport;                   // the way packets travel between the ports
+  uintptr_t level;                       // the depth of the vertices being reached during a depth limited build
+  uintptr_t created;                     // the number of vertices created so far against a vertex limit
+  int heaped;                            // non-zero if no node or edge the workers free can be in a slab
 };
 
 #ifdef __cplusplus
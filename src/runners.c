@@ -18,6 +18,7 @@
 
 #include <errno.h>
 #include <strings.h>
+#include "cthread.h"
 #include "errs.h"
 #include "getset.h"
 #include "maybe.h"
@@ -41,20 +42,21 @@ void *
 _cru_status_runner (s)
 	  port s;
 
-	  // Run a worker in a newly created thread and return its error status on exit.
+	  // Run a worker in a pooled thread and return its error status.
 {
   uintptr_t status;
   router r;
   int err;
 
-  if ((err = ((s ? (s->gruntled == PORT_MAGIC) : 0) ? 0 : THE_IER(1485))))
+  if ((err = ((s ? (s->gruntled == PORT_MAGIC) : 0) ? 0 : THE_IER(1631))))
 	 goto a;
-  if ((err = (((r = s->local) ? ((r->valid == ROUTER_MAGIC) ? r->work : NULL) : 0) ? 0 : THE_IER(1486))))
+  if ((err = (((r = s->local) ? ((r->valid == ROUTER_MAGIC) ? r->work : NULL) : 0) ? 0 : THE_IER(1632))))
 	 goto a;
+  _cru_set_heaped (r->heaped, &err);
   status = (uintptr_t) (r->work) (s, &err);
   _cru_throw (r, &err);
  a: _cru_globally_throw (err);
-  pthread_exit ((void *) status);
+  return (void *) status;
 }
 
 
@@ -68,23 +70,24 @@ void *
 _cru_maybe_runner (s)
 	  port s;
 
-	  // Run a worker returning a maybe and exit the thread.
+	  // Run a worker returning a maybe and return it to the pool.
 {
   router r;
   maybe m;
   int err;
 
   m = NULL;
-  if ((err = ((s ? (s->gruntled == PORT_MAGIC) : 0) ? 0 : THE_IER(1487))))
+  if ((err = ((s ? (s->gruntled == PORT_MAGIC) : 0) ? 0 : THE_IER(1633))))
 	 goto a;
-  if ((err = (((r = s->local) ? ((r->valid == ROUTER_MAGIC) ? r->work : NULL) : 0) ? 0 : THE_IER(1488))))
+  if ((err = (((r = s->local) ? ((r->valid == ROUTER_MAGIC) ? r->work : NULL) : 0) ? 0 : THE_IER(1634))))
 	 goto a;
   _cru_set_storage (r->ro_store, &err);
+  _cru_set_heaped (r->heaped, &err);
   if ((m = (maybe) (r->work) (s, &err)) ? 0 : err)
 	 m = _cru_new_maybe (ABSENT, NULL, &err);             // report the error through the result if possible
   _cru_throw (r, &err);
  a: _cru_globally_throw (err);                           // report the error globally otherwise
-  pthread_exit ((void *) m);
+  return (void *) m;
 }
 
 
@@ -100,22 +103,23 @@ void *
 _cru_queue_runner (s)
 	  port s;
 
-	  // Run a worker returning a queue and return it by exiting the thread.
+	  // Run a worker returning a queue and return it to the pool.
 {
   int err;
   router r;
   node_queue q;
 
   q = NULL;
-  if ((err = ((s ? (s->gruntled == PORT_MAGIC) : 0) ? 0 : THE_IER(1489))))
+  if ((err = ((s ? (s->gruntled == PORT_MAGIC) : 0) ? 0 : THE_IER(1635))))
 	 goto a;
-  if ((err = (((r = s->local) ? ((r->valid == ROUTER_MAGIC) ? r->work : NULL) : 0) ? 0 : THE_IER(1490))))
+  if ((err = (((r = s->local) ? ((r->valid == ROUTER_MAGIC) ? r->work : NULL) : 0) ? 0 : THE_IER(1636))))
 	 goto a;
+  _cru_set_heaped (r->heaped, &err);
   if ((q = (r->work) (s, &err)) ? 0 : err)
 	 q = _cru_queue_of (NO_NODES, &err);            // report the error through the result if possible
   _cru_throw (r, &err);
  a: _cru_globally_throw (err);
-  pthread_exit ((void *) q);
+  return (void *) q;
 }
 
 
@@ -131,20 +135,21 @@ void *
 _cru_count_runner (s)
 	  port s;
 
-	  // Run a worker returning a count and return it by exiting the thread.
+	  // Run a worker returning a count and return it to the pool.
 {
   router r;
   uintptr_t c;
   int err;
 
-  if ((err = ((s ? (s->gruntled == PORT_MAGIC) : 0) ? 0 : THE_IER(1491))))
+  if ((err = ((s ? (s->gruntled == PORT_MAGIC) : 0) ? 0 : THE_IER(1637))))
 	 goto a;
-  if ((err = (((r = s->local) ? ((r->valid == ROUTER_MAGIC) ? r->work : NULL) : 0) ? 0 : THE_IER(1492))))
+  if ((err = (((r = s->local) ? ((r->valid == ROUTER_MAGIC) ? r->work : NULL) : 0) ? 0 : THE_IER(1638))))
 	 goto a;
+  _cru_set_heaped (r->heaped, &err);
   c = (uintptr_t) (r->work) (s, &err);
   _cru_throw (r, &err);
  a: _cru_globally_throw (err);
-  pthread_exit ((void *) c);
+  return (void *) c;
 }
 
 
@@ -162,7 +167,7 @@ _cru_count_runner (s)
 
 maybe
 _cru_maybe_joiner (id, err)
-	  pthread_t *id;
+	  hand *id;
 	  int *err;
 
 	  // Join with a thread returning a maybe.
@@ -170,7 +175,7 @@ _cru_maybe_joiner (id, err)
   maybe result;
 
   result = NULL;
-  if ((! id) ? IER(1493) : pthread_join (*id, (void **) &result) ? IER(1494) : 0)
+  if ((! id) ? IER(1639) : _cru_join (*id, (void **) &result, err) ? IER(1640) : 0)
 	 return NULL;
   RAISE(result ? result->ma_status : 0);
   return result;
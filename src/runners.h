@@ -23,7 +23,8 @@
 #include "ptr.h"
 
 // This file declares runner functions to run a worker task in a
-// thread and to exit the thread when the worker returns. Different
+// pooled thread and to return its result when the worker returns,
+// leaving the thread parked for the next job. Different
 // runners depend on the result types and other variations. All of
 // them are meant to be cast to a runner and passed to _cru_crewed
 // along with a router whose task has been initialized to the worker
@@ -37,32 +38,32 @@ extern "C"
 {
 #endif
 
-// the type of function passed to _cru_create
+// the type of function passed to _cru_hired
 typedef void *(*runner) (port);
 
 // --------------- runners ---------------------------------------------------------------------------------
 
-// run a worker in a newly created thread and return its error status on exit
+// run a worker in a pooled thread and return its error status
 extern void *
 _cru_status_runner (port s);
 
-// run a worker returning a maybe and exit the thread
+// run a worker returning a maybe
 extern void *
 _cru_maybe_runner (port s);
 
-// run a worker returning a queue and return it by exiting the thread
+// run a worker returning a queue
 extern void *
 _cru_queue_runner (port s);
 
-// run a worker returning a count and return it by exiting the thread
+// run a worker returning a count
 extern void *
 _cru_count_runner (port s);
 
 // --------------- joiners ---------------------------------------------------------------------------------
 
-// join with a thread returning a maybe
+// join with a pooled thread returning a maybe
 extern maybe
-_cru_maybe_joiner (pthread_t *id, int *err);
+_cru_maybe_joiner (hand *id, int *err);
 
 #ifdef __cplusplus
 }
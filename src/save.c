@@ -0,0 +1,861 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// A saved graph is a sequence of 64 bit words in native byte order.
+// The header holds a magic number, a format version, flags telling
+// which of the vertices and edge labels were encoded, the numbers of
+// vertices and edges, the index of the base vertex, the number of
+// lanes, and the offset of the trailer. The vertices are grouped by
+// the lanes their hashes select, and a table following the header
+// gives the numbers of vertices and edges in each lane and the
+// offsets of its vertices and edges. Then come the vertices of every
+// lane in order, each followed by the number of its outgoing edges,
+// and then the edges of every vertex in the same order, each followed
+// by the index of its terminus. A vertex or label is stored either as
+// a single word holding a scalar or as a word holding the length of
+// its encoding followed by the encoding padded to a whole number of
+// words, so that every decoder is passed an aligned address. The
+// trailer repeats the magic number. All offsets are in bytes from the
+// start of the header. A graph is loaded by mapping the file into
+// memory so that decoders read it in place, with the lanes read
+// concurrently, and the nodes and edges of each lane allocated in
+// slabs of its own laid out the same as those of a frozen graph.
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <nthm/nthm.h>
+#include "arena.h"
+#include "count.h"
+#include "edges.h"
+#include "errs.h"
+#include "graph.h"
+#include "nodes.h"
+#include "ports.h"
+#include "save.h"
+#include "wrap.h"
+
+// identifies a saved graph and the byte order it was saved in
+#define SAVE_MAGIC ((uint64_t) 7166083271465315617)
+
+// incremented whenever the format changes
+#define SAVE_VERSION 2
+
+// flags in the header telling which items are encoded
+#define ENCODED_VERTICES 1
+#define ENCODED_LABELS 2
+
+// header fields in order
+#define MAGIC_WORD 0
+#define VERSION_WORD 1
+#define FLAGS_WORD 2
+#define VERTEX_WORD 3
+#define EDGE_WORD 4
+#define BASE_WORD 5
+#define LANE_WORD 6
+#define TRAILER_WORD 7
+#define HEADER_WORDS 8
+
+// fields of each entry in the lane table in order
+#define LANE_VERTICES 0
+#define LANE_EDGES 1
+#define LANE_VERTEX_OFFSET 2
+#define LANE_EDGE_OFFSET 3
+#define LANE_ENTRY_WORDS 4
+
+// the smallest number of bytes taken by a vertex with its edge count or an edge with its terminus
+#define MIN_ENTRY (2 * sizeof (uint64_t))
+
+// the number of bytes n rounded up to a whole number of words
+#define PADDED(n) (((n) + sizeof (uint64_t) - 1) & ~(sizeof (uint64_t) - 1))
+
+// like APPLIED in errs.h for an encoder, whose result is a size
+#define ENCODED(e, ...) (NOMEM ? 0 : *err ? 0 : ( ux = 0, un = (e) (__VA_ARGS__, &ux), RAISE(ux), *err ? 0 : un ))
+
+
+
+
+// --------------- saving ----------------------------------------------------------------------------------
+
+
+
+
+void
+_cru_sent (fd, p, n, err)
+	  int fd;
+	  const unsigned char *p;
+	  size_t n;
+	  int *err;
+
+	  // Write n bytes from p to a file descriptor, retrying after
+	  // partial writes and interruptions.
+{
+  ssize_t w;
+
+  for (; *err ? 0 : n; p += w, n -= (size_t) w)
+	 if ((w = write (fd, p, n)) < 0)
+		w = ((errno == EINTR) ? 0 : (RAISE(errno), 0));
+}
+
+
+
+
+
+
+
+static void
+flushed (w, err)
+	  scribe w;
+	  int *err;
+
+	  // Write out and empty the buffer of a scribe.
+{
+  _cru_sent (w->fd, w->buffer, w->used, err);
+  w->used = 0;
+}
+
+
+
+
+
+
+
+static void
+written (w, p, n, err)
+	  scribe w;
+	  const void *p;
+	  size_t n;
+	  int *err;
+
+	  // Pass n bytes to a scribe, writing them directly if they're too
+	  // many to buffer.
+{
+  if (*err)
+	 return;
+  w->written += n;
+  if (w->used + n > SCRIBE_SIZE)
+	 flushed (w, err);
+  if (n > SCRIBE_SIZE)
+	 _cru_sent (w->fd, (const unsigned char *) p, n, err);
+  else
+	 {
+		memcpy (w->buffer + w->used, p, n);
+		w->used += n;
+	 }
+}
+
+
+
+
+
+
+
+static void
+worded (w, u, err)
+	  scribe w;
+	  uintptr_t u;
+	  int *err;
+
+	  // Pass a number to a scribe as a word.
+{
+  uint64_t x;
+
+  x = (uint64_t) u;
+  written (w, &x, sizeof (x), err);
+}
+
+
+
+
+
+
+
+static void
+recorded (w, item, e, err)
+	  scribe w;
+	  void *item;
+	  cru_encoder e;
+	  int *err;
+
+	  // Pass a vertex or edge label to a scribe, encoding it directly
+	  // into the buffer if there's room after its length or into a
+	  // temporary buffer otherwise. The temporary buffer can be bigger
+	  // than anything the allocation tracker in wrap.c expects, so its
+	  // allocation is simulated by NOMEM. If there's no encoder, pass
+	  // the item as a scalar.
+{
+  size_t n, room, un;
+  unsigned char *t;
+  uint64_t x;
+  int ux;
+
+  if (! e)
+	 {
+		worded (w, (uintptr_t) item, err);
+		return;
+	 }
+  if (*err)
+	 return;
+  if (SCRIBE_SIZE - w->used < MIN_ENTRY)
+	 flushed (w, err);
+  room = SCRIBE_SIZE - w->used - sizeof (x);
+  if (((n = ENCODED(e, item, w->buffer + w->used + sizeof (x), room)) <= room) ? (! *err) : 0)
+	 {
+		x = (uint64_t) n;
+		memcpy (w->buffer + w->used, &x, sizeof (x));
+		memset (w->buffer + w->used + sizeof (x) + n, 0, PADDED(n) - n);
+		w->used += sizeof (x) + PADDED(n);
+		w->written += sizeof (x) + PADDED(n);
+		return;
+	 }
+  if (*err ? 1 : NOMEM ? RAISE(ENOMEM) : (t = (unsigned char *) malloc (PADDED(n))) ? 0 : RAISE(ENOMEM))
+	 return;
+  memset (t, 0, PADDED(n));
+  (void) ENCODED(e, item, t, n);
+  worded (w, (uintptr_t) n, err);
+  written (w, t, PADDED(n), err);
+  free (t);
+}
+
+
+
+
+
+
+
+static uintptr_t
+item_size (item, e, err)
+	  void *item;
+	  cru_encoder e;
+	  int *err;
+
+	  // Return the number of bytes that recorded passes to a scribe for
+	  // a vertex or edge label, asking the encoder for the size by
+	  // giving it no room.
+{
+  size_t un;
+  int ux;
+
+  if (! e)
+	 return sizeof (uint64_t);
+  return (uintptr_t) (sizeof (uint64_t) + PADDED(ENCODED(e, item, NULL, (size_t) 0)));
+}
+
+
+
+
+
+
+
+uintptr_t
+_cru_saved (g, fd, c, lanes, err)
+	  cru_graph g;
+	  int fd;
+	  cru_codec_pair c;
+	  unsigned lanes;
+	  int *err;
+
+	  // Write a graph to a file descriptor in the format described at
+	  // the top of this file and return the number of bytes written.
+	  // The lanes are those that the default partitioner would assign
+	  // to the vertices, or contiguous runs of nodes if the vertices
+	  // have no hash function. The marked field of each node is used
+	  // temporarily to hold its lane and then its index. An empty
+	  // graph is written as a header with no vertices.
+{
+  uintptr_t vertices, edges, degree, at, i, l;
+  struct scribe_s w;
+  cru_encoder v, e;
+  node_list n, *k;
+  edge_list x;
+  uint64_t *t;
+  cru_hash h;
+
+  k = NULL;
+  t = NULL;
+  if (*err ? 1 : (! lanes) ? IER(1641) : 0)
+	 return 0;
+  w.fd = fd;
+  w.used = 0;
+  w.written = 0;
+  v = (c ? c->v_codec.encoder : NULL);
+  e = (c ? c->e_codec.encoder : NULL);
+  h = (g ? g->g_sig.orders.v_order.hash : NULL);
+  vertices = edges = 0;
+  for (n = (g ? g->nodes : NULL); n; n = n->next_node)
+	 {
+		vertices++;
+		for (x = n->edges_out; x; x = x->next_edge)
+		  edges++;
+	 }
+  lanes = (vertices ? ((uintptr_t) lanes > vertices) ? (unsigned) vertices : lanes : 1);
+  // the lane table with an extra field per entry for the next index to assign in the lane
+  if (NOMEM ? RAISE(ENOMEM) : (t = (uint64_t *) calloc ((size_t) lanes * (LANE_ENTRY_WORDS + 1), sizeof (*t))) ? 0 : RAISE(ENOMEM))
+	 goto a;
+  if (vertices ? (NOMEM ? RAISE(ENOMEM) : (k = (node_list *) malloc ((size_t) vertices * sizeof (*k))) ? 0 : RAISE(ENOMEM)) : 0)
+	 goto a;
+  for (i = 0, n = (g ? g->nodes : NULL); *err ? NULL : n; i++, n = n->next_node)
+	 {
+		l = (h ? RANGE(h (n->vertex), lanes) : (i * lanes) / vertices) * (LANE_ENTRY_WORDS + 1);
+		n->marked = (void *) l;
+		t[l + LANE_VERTICES]++;
+		t[l + LANE_VERTEX_OFFSET] += item_size (n->vertex, v, err) + sizeof (uint64_t);
+		for (x = n->edges_out; x; x = x->next_edge)
+		  {
+			 t[l + LANE_EDGES]++;
+			 t[l + LANE_EDGE_OFFSET] += item_size (x->label, e, err) + sizeof (uint64_t);
+		  }
+	 }
+  if (*err)
+	 goto b;
+  at = (HEADER_WORDS + lanes * LANE_ENTRY_WORDS) * sizeof (uint64_t);
+  for (i = 0, l = 0; l < lanes * (LANE_ENTRY_WORDS + 1); l += LANE_ENTRY_WORDS + 1)
+	 {
+		degree = (uintptr_t) t[l + LANE_VERTEX_OFFSET];
+		t[l + LANE_VERTEX_OFFSET] = at;
+		at += degree;
+		t[l + LANE_ENTRY_WORDS] = i;
+		i += t[l + LANE_VERTICES];
+	 }
+  for (l = 0; l < lanes * (LANE_ENTRY_WORDS + 1); l += LANE_ENTRY_WORDS + 1)
+	 {
+		degree = (uintptr_t) t[l + LANE_EDGE_OFFSET];
+		t[l + LANE_EDGE_OFFSET] = at;
+		at += degree;
+	 }
+  for (n = (g ? g->nodes : NULL); n; n = n->next_node)
+	 {
+		i = (uintptr_t) t[(uintptr_t) n->marked + LANE_ENTRY_WORDS]++;
+		n->marked = (void *) i;
+		k[i] = n;
+	 }
+  worded (&w, (uintptr_t) SAVE_MAGIC, err);
+  worded (&w, SAVE_VERSION, err);
+  worded (&w, (uintptr_t) ((v ? ENCODED_VERTICES : 0) | (e ? ENCODED_LABELS : 0)), err);
+  worded (&w, vertices, err);
+  worded (&w, edges, err);
+  worded (&w, (g ? g->base_node : NULL) ? (uintptr_t) g->base_node->marked : 0, err);
+  worded (&w, (uintptr_t) lanes, err);
+  worded (&w, at, err);
+  for (l = 0; l < lanes * (LANE_ENTRY_WORDS + 1); l += LANE_ENTRY_WORDS + 1)
+	 for (i = 0; i < LANE_ENTRY_WORDS; i++)
+		worded (&w, (uintptr_t) t[l + i], err);
+  for (i = 0; *err ? 0 : (i < vertices); i++)
+	 {
+		recorded (&w, k[i]->vertex, v, err);
+		for (degree = 0, x = k[i]->edges_out; x; x = x->next_edge)
+		  degree++;
+		worded (&w, degree, err);
+	 }
+  for (i = 0; *err ? 0 : (i < vertices); i++)
+	 for (x = k[i]->edges_out; *err ? NULL : x; x = x->next_edge)
+		{
+		  recorded (&w, x->label, e, err);
+		  worded (&w, (uintptr_t) x->remote.node->marked, err);
+		}
+  worded (&w, (uintptr_t) SAVE_MAGIC, err);
+  flushed (&w, err);
+  if (*err ? 0 : (w.written != at + sizeof (uint64_t)))
+	 RAISE(CRU_BADFIL);
+ b: for (n = (g ? g->nodes : NULL); n; n = n->next_node)
+	 n->marked = NULL;
+ a: free (k);
+  free (t);
+  return (*err ? 0 : w.written);
+}
+
+
+
+
+// --------------- loading ---------------------------------------------------------------------------------
+
+
+
+
+static uint64_t
+word_read (p, end, err)
+	  const unsigned char **p;
+	  const unsigned char *end;
+	  int *err;
+
+	  // Return the word at *p and advance *p past it unless it's
+	  // beyond the end of the file.
+{
+  uint64_t x;
+
+  if (*err ? 1 : ((size_t) (end - *p) < sizeof (x)) ? RAISE(CRU_BADFIL) : 0)
+	 return 0;
+  memcpy (&x, *p, sizeof (x));
+  *p += sizeof (x);
+  return x;
+}
+
+
+
+
+
+
+
+static void *
+item_read (p, end, d, err)
+	  const unsigned char **p;
+	  const unsigned char *end;
+	  cru_decoder d;
+	  int *err;
+
+	  // Return the vertex or edge label at *p, decoding it if there's
+	  // a decoder, and advance *p past it.
+{
+  const unsigned char *q;
+  uint64_t n;
+  void *ua;
+  int ux;
+
+  n = word_read (p, end, err);
+  if (*err ? 1 : ! d)
+	 return (void *) (uintptr_t) n;
+  if ((n > (uint64_t) (end - *p)) ? 1 : (PADDED(n) > (uint64_t) (end - *p)) ? 1 : (n != (uint64_t) (size_t) n))
+	 {
+		RAISE(CRU_BADFIL);
+		return NULL;
+	 }
+  q = *p;
+  *p += PADDED((size_t) n);
+  return APPLIED(d, q, (size_t) n);
+}
+
+
+
+
+
+
+
+static section
+sections_of (q, s, c, h, workers, k, err)
+	  const unsigned char *q;   // the start of the header
+	  cru_sig s;
+	  cru_codec_pair c;
+	  uint64_t *h;              // the header
+	  uintptr_t workers;        // the number of workers to read the sections
+	  node_list *k;             // an array to be filled with the nodes by their indices
+	  int *err;
+
+	  // Read the lane table into an array of sections and check that
+	  // the counts add up to those in the header and the sections are
+	  // aligned, contiguous, and in order.
+{
+  const unsigned char *p, *t;
+  uint64_t l, m, x, y, vertices, edges;
+  section r;
+
+  m = h[LANE_WORD];
+  if (*err ? 1 : NOMEM ? RAISE(ENOMEM) : (r = (section) calloc ((size_t) m, sizeof (*r))) ? 0 : RAISE(ENOMEM))
+	 return NULL;
+  p = q + HEADER_WORDS * sizeof (uint64_t);
+  t = q + h[TRAILER_WORD];
+  for (vertices = edges = 0, l = 0; l < m; l++)
+	 {
+		r[l].vertex_count = word_read (&p, t, err);
+		r[l].edge_count = word_read (&p, t, err);
+		x = word_read (&p, t, err);
+		y = word_read (&p, t, err);
+		if (*err ? 1 : (r[l].vertex_count > h[VERTEX_WORD] - vertices) ? 1 : (r[l].edge_count > h[EDGE_WORD] - edges))
+		  goto a;
+		if ((x > h[TRAILER_WORD]) ? 1 : (y > h[TRAILER_WORD]) ? 1 : ((x | y) % sizeof (uint64_t)))
+		  goto a;
+		r[l].vertices_at = q + x;
+		r[l].edges_at = q + y;
+		r[l].first = vertices;
+		vertices += r[l].vertex_count;
+		edges += r[l].edge_count;
+		r[l].header = h;
+		r[l].index = k;
+		r[l].sig = s;
+		r[l].codecs = c;
+		r[l].limit = r + m;
+		r[l].stride = workers;
+	 }
+  if ((vertices != h[VERTEX_WORD]) ? 1 : (edges != h[EDGE_WORD]) ? 1 : (r[0].vertices_at != p))
+	 goto a;
+  for (l = 0; l < m; l++)
+	 {
+		r[l].vertices_end = ((l + 1 < m) ? r[l + 1].vertices_at : r[0].edges_at);
+		r[l].edges_end = ((l + 1 < m) ? r[l + 1].edges_at : t);
+		if ((r[l].vertices_end < r[l].vertices_at) ? 1 : (r[l].edges_end < r[l].edges_at))
+		  goto a;
+	 }
+  return r;
+ a: RAISE(CRU_BADFIL);
+  free (r);
+  return NULL;
+}
+
+
+
+
+
+
+
+static void
+section_noded (r, err)
+	  section r;
+	  int *err;
+
+	  // Read the vertex table of a section into a list of nodes allocated
+	  // in slabs of its own, enter them into the index, and temporarily
+	  // store the number of outgoing edges of each in its marked field.
+{
+  const unsigned char *p;
+  node_list n, *t;
+  uint64_t degree, i;
+  cru_decoder d;
+  slab cursor;
+  void *v;
+  int ux;
+
+  p = r->vertices_at;
+  d = (r->codecs ? r->codecs->v_codec.decoder : NULL);
+  if (*err ? 1 : (! r->vertex_count) ? 0 : ! (cursor = r->node_slabs = _cru_slabs_for ((uintptr_t) r->vertex_count, sizeof (*n), err)))
+	 return;
+  for (t = &(r->nodes), i = 0; *err ? 0 : (i < r->vertex_count); i++)
+	 {
+		if ((v = item_read (&p, r->vertices_end, d, err)), *err)
+		  break;
+		degree = word_read (&p, r->vertices_end, err);
+		if (*err ? 1 : (degree > r->edge_count) ? RAISE(CRU_BADFIL) : ! (n = (node_list) _cru_taken (&cursor, sizeof (*n), err)))
+		  {
+			 if (d ? v : NULL)
+				APPLY(r->sig->destructors.v_free, v);
+			 break;
+		  }
+		memset (n, 0, sizeof (*n));
+		n->vertex = v;
+		n->marked = (void *) (uintptr_t) degree;
+		*(n->previous = t) = r->index[r->first + i] = n;
+		r->tail = t = &(n->next_node);
+	 }
+  if (*err ? 0 : (p != r->vertices_end))
+	 RAISE(CRU_BADFIL);
+}
+
+
+
+
+
+
+
+static void
+section_linked (r, err)
+	  section r;
+	  int *err;
+
+	  // Read the outgoing edges of each node in a section made by
+	  // section_noded into slabs of its own and clear its marked field.
+{
+  const unsigned char *p;
+  uint64_t remaining, degree, i;
+  cru_decoder d;
+  edge_list *e;
+  node_list n;
+  slab cursor;
+  void *l;
+  int ux;
+
+  p = r->edges_at;
+  cursor = NULL;
+  remaining = r->edge_count;
+  d = (r->codecs ? r->codecs->e_codec.decoder : NULL);
+  if (remaining ? (! *err) : 0)
+	 cursor = r->edge_slabs = _cru_slabs_for ((uintptr_t) remaining, sizeof (**e), err);
+  for (n = r->nodes; n; n = n->next_node)
+	 {
+		degree = (uint64_t) (uintptr_t) n->marked;
+		n->marked = NULL;
+		for (e = &(n->edges_out); *err ? 0 : degree--; e = &((*e)->next_edge))
+		  {
+			 if ((remaining-- ? 0 : RAISE(CRU_BADFIL)) ? 1 : ((l = item_read (&p, r->edges_end, d, err)), *err))
+				break;
+			 i = word_read (&p, r->edges_end, err);
+			 if (*err ? 1 : (i >= r->header[VERTEX_WORD]) ? RAISE(CRU_BADFIL) : ! (*e = (edge_list) _cru_taken (&cursor, sizeof (**e), err)))
+				{
+				  if (d ? l : NULL)
+					 APPLY(r->sig->destructors.e_free, l);
+				  break;
+				}
+			 memset (*e, 0, sizeof (**e));
+			 (*e)->label = l;
+			 (*e)->remote.node = r->index[i];
+		  }
+	 }
+  if (*err ? 0 : remaining ? 1 : (p != r->edges_end))
+	 RAISE(CRU_BADFIL);
+}
+
+
+
+
+
+
+
+static section
+sections_noded (s, err)
+	  section s;
+	  int *err;
+
+	  // Create the nodes of a section and of every section a stride
+	  // apart from it up to the limit. This function runs in a separate
+	  // thread for each worker.
+{
+  section r;
+
+  for (r = s; r ? (! *err) : 0; r = ((uintptr_t) (s->limit - r) > s->stride) ? (r + s->stride) : NULL)
+	 section_noded (r, err);
+  return s;
+}
+
+
+
+
+
+
+
+static section
+sections_linked (s, err)
+	  section s;
+	  int *err;
+
+	  // Create the edges of a section and of every section a stride
+	  // apart from it up to the limit after all nodes are created. This
+	  // function runs in a separate thread for each worker.
+{
+  section r;
+
+  for (r = s; r ? (! *err) : 0; r = ((uintptr_t) (s->limit - r) > s->stride) ? (r + s->stride) : NULL)
+	 section_linked (r, err);
+  return s;
+}
+
+
+
+
+
+
+
+static void
+sections_worked (r, w, err)
+	  section r;
+	  nthm_worker w;
+	  int *err;
+
+	  // Apply a worker function to the first section of each worker
+	  // concurrently, or in the calling thread if there's only one.
+{
+  nthm_pipe q;
+  uintptr_t j;
+
+  if (*err ? 1 : (! r) ? IER(1642) : (r->stride > 1) ? 0 : ! ! w (r, err))
+	 return;
+  if (NOMEM ? 1 : ! nthm_enter_scope (err))
+	 return;
+  for (j = 0; j < r->stride; j++)
+	 if (NOMEM ? 1 : ! nthm_open (w, &(r[j]), err))
+		break;
+  while ((q = nthm_select (err)))
+	 nthm_read (q, err);
+  nthm_exit_scope (err);
+}
+
+
+
+
+
+
+
+static cru_graph
+graph_read (q, s, c, h, lanes, err)
+	  const unsigned char *q;   // the start of the header
+	  cru_sig s;
+	  cru_codec_pair c;
+	  uint64_t *h;              // the header
+	  unsigned lanes;
+	  int *err;
+
+	  // Read the vertices and edges of a non-empty graph into nodes and
+	  // edges allocated in slabs for the exact numbers needed in each
+	  // section, using at most one worker per lane, and concatenate
+	  // the nodes of the sections in order.
+{
+  node_list nodes, *k, *t;
+  uint64_t l, m;
+  cru_graph g;
+  section r;
+  slab slabs;
+
+  g = NULL;
+  slabs = NULL;
+  nodes = NULL;
+  if ((k = (node_list *) _cru_malloc ((size_t) h[VERTEX_WORD] * sizeof (*k))) ? 0 : RAISE(ENOMEM))
+	 return NULL;
+  m = h[LANE_WORD];
+  if (! (r = sections_of (q, s, c, h, ((uint64_t) lanes < m) ? (uintptr_t) lanes : (uintptr_t) m, k, err)))
+	 goto a;
+  sections_worked (r, (nthm_worker) sections_noded, err);
+  sections_worked (r, (nthm_worker) sections_linked, err);
+  for (t = &nodes, l = 0; l < m; l++)
+	 {
+		slabs = _cru_cat_slabs (slabs, _cru_cat_slabs (r[l].node_slabs, r[l].edge_slabs));
+		if (! (r[l].nodes))
+		  continue;
+		*(r[l].nodes->previous = t) = r[l].nodes;
+		t = r[l].tail;
+	 }
+  free (r);
+  if (*err ? 1 : nodes ? 0 : IER(1643))
+	 goto b;
+  nodes->previous = NULL;
+  if (! (g = _cru_graph_of (s, &(k[h[BASE_WORD]]), nodes, err)))
+	 goto b;
+  g->g_slabs = slabs;
+  _cru_census_taken (g, VERTICES_COUNTED, (uintptr_t) h[VERTEX_WORD], err);
+  _cru_census_taken (g, EDGES_COUNTED, (uintptr_t) h[EDGE_WORD], err);
+  goto a;
+ b: _cru_free_nodes (nodes, &(s->destructors), err);
+  _cru_free_slabs (slabs, err);
+ a:
+#ifdef WRAP
+  _cru_free_wrapper (__LINE__, __FILE__, (size_t) h[VERTEX_WORD] * sizeof (*k), k);
+#else
+  free (k);
+#endif
+  return g;
+}
+
+
+
+
+
+
+
+void *
+_cru_mapped (fd, p, end, err)
+	  int fd;
+	  const unsigned char **p;
+	  const unsigned char **end;
+	  int *err;
+
+	  // Map the rest of a file from its current offset into memory
+	  // without moving the offset, point *p at the first byte past the
+	  // offset and *end past the last, and return the mapping. Return
+	  // NULL without an error if the rest of the file is empty.
+{
+  off_t start, base;
+  struct stat st;
+  size_t size;
+  long page;
+  void *m;
+
+  if ((! p) ? IER(1644) : (! end) ? IER(1645) : *err)
+	 return NULL;
+  if (((start = lseek (fd, (off_t) 0, SEEK_CUR)) < 0) ? 1 : fstat (fd, &st) ? 1 : ((page = sysconf (_SC_PAGESIZE)) <= 0))
+	 {
+		RAISE(errno ? errno : CRU_BADFIL);
+		return NULL;
+	 }
+  if (st.st_size <= start)
+	 return NULL;
+  base = start - start % page;
+  size = (size_t) (st.st_size - base);
+  if ((m = mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, base)) == MAP_FAILED)
+	 {
+		RAISE(errno);
+		return NULL;
+	 }
+  *p = (const unsigned char *) m + (start - base);
+  *end = (const unsigned char *) m + size;
+  return m;
+}
+
+
+
+
+
+
+
+cru_graph
+_cru_loaded (fd, s, c, lanes, err)
+	  int fd;
+	  cru_sig s;
+	  cru_codec_pair c;
+	  unsigned lanes;
+	  int *err;
+
+	  // Map the rest of a file from its current offset into memory,
+	  // read a graph from it in the format described at the top of
+	  // this file, and leave the offset just past the graph. Return
+	  // NULL without an error for an empty graph.
+{
+  const unsigned char *p, *q, *end;
+  uint64_t h[HEADER_WORDS];
+  uint64_t entries, flags;
+  cru_graph g;
+  void *m;
+  int i;
+
+  g = NULL;
+  if ((! s) ? IER(1646) : (! lanes) ? IER(1647) : *err)
+	 return NULL;
+  if (! (m = _cru_mapped (fd, &p, &end, err)))
+	 {
+		RAISE(CRU_BADFIL);
+		return NULL;
+	 }
+  q = p;
+  for (i = 0; i < HEADER_WORDS; i++)
+	 h[i] = word_read (&p, end, err);
+  flags = (uint64_t) (((c ? c->v_codec.decoder : NULL) ? ENCODED_VERTICES : 0) | ((c ? c->e_codec.decoder : NULL) ? ENCODED_LABELS : 0));
+  if (*err ? 1 : (h[MAGIC_WORD] != SAVE_MAGIC) ? 1 : (h[VERSION_WORD] != SAVE_VERSION) ? 1 : (h[FLAGS_WORD] != flags))
+	 goto a;
+  if ((! h[LANE_WORD]) ? 1 : (h[LANE_WORD] > (uint64_t) (end - p) / (LANE_ENTRY_WORDS * sizeof (uint64_t))))
+	 goto a;
+  p += h[LANE_WORD] * LANE_ENTRY_WORDS * sizeof (uint64_t);
+  if ((h[TRAILER_WORD] < (uint64_t) (p - q)) ? 1 : (h[TRAILER_WORD] > (uint64_t) (end - q) - sizeof (uint64_t)))
+	 goto a;
+  entries = (h[TRAILER_WORD] - (uint64_t) (p - q)) / MIN_ENTRY;
+  if ((h[VERTEX_WORD] > entries) ? 1 : (h[EDGE_WORD] > entries - h[VERTEX_WORD]))
+	 goto a;
+  if (h[VERTEX_WORD] ? (h[BASE_WORD] >= h[VERTEX_WORD]) : (h[EDGE_WORD] ? 1 : (h[TRAILER_WORD] != (uint64_t) (p - q))))
+	 goto a;
+  if (h[VERTEX_WORD] ? (! (g = graph_read (q, s, c, h, lanes, err))) : 0)
+	 goto b;
+  p = q + h[TRAILER_WORD];
+  if (word_read (&p, end, err) != SAVE_MAGIC)
+	 goto a;
+  if (lseek (fd, (off_t) (p - q), SEEK_CUR) < 0)
+	 RAISE(errno);
+  goto b;
+ a: RAISE(CRU_BADFIL);
+ b: if (munmap (m, (size_t) (end - (const unsigned char *) m)))
+	 IER(1648);
+  if (! *err)
+	 return g;
+  _cru_free_now (g, err);
+  return NULL;
+}
@@ -0,0 +1,85 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CRU_SAVE_H
+#define CRU_SAVE_H 1
+
+// functions for writing graphs to files and reading them back
+
+#include "ptr.h"
+
+// the number of bytes buffered before they're written to a file
+#define SCRIBE_SIZE 0x4000
+
+// buffered output to a file descriptor
+struct scribe_s
+{
+  int fd;                           // the file descriptor being written
+  size_t used;                      // the number of bytes in the buffer not yet written
+  uintptr_t written;                // the total number of bytes passed to the scribe so far
+  unsigned char buffer[SCRIBE_SIZE];
+};
+
+// the part of a saved graph belonging to one lane, read by one worker
+
+struct section_s
+{
+  const unsigned char *vertices_at; // the first byte of the vertex table of the lane
+  const unsigned char *vertices_end; // where the vertex table has to end
+  const unsigned char *edges_at;    // the first byte of the edges of the lane
+  const unsigned char *edges_end;   // where the edges have to end
+  uint64_t vertex_count;            // the number of vertices in the lane
+  uint64_t edge_count;              // the number of edges from them
+  uint64_t first;                   // the index of the first vertex in the lane
+  uint64_t *header;                 // the header of the saved graph
+  node_list *index;                 // the nodes of all lanes by their indices
+  cru_sig sig;                      // destructors for the vertices and edge labels
+  cru_codec_pair codecs;            // decoders for the vertices and edge labels
+  section limit;                    // one past the last section
+  uintptr_t stride;                 // the number of sections between those read by the same worker
+  node_list nodes;                  // the nodes of the lane in the order they were saved
+  node_list *tail;                  // the address of the last next_node field in the nodes
+  slab node_slabs;
+  slab edge_slabs;
+};
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// write n bytes to a file descriptor retrying after partial writes
+extern void
+_cru_sent (int fd, const unsigned char *p, size_t n, int *err);
+
+// write a graph to a file descriptor and return the number of bytes written
+extern uintptr_t
+_cru_saved (cru_graph g, int fd, cru_codec_pair c, unsigned lanes, int *err);
+
+// map the rest of a file into memory from its current offset
+extern void *
+_cru_mapped (int fd, const unsigned char **p, const unsigned char **end, int *err);
+
+// read a graph from a file descriptor using a memory mapping
+extern cru_graph
+_cru_loaded (int fd, cru_sig s, cru_codec_pair c, unsigned lanes, int *err);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
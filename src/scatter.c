@@ -50,10 +50,10 @@ _cru_scatter (p, t, err)
 {
   packet_list o;
 
-  if ((! t) ? IER(1495) : (! (t->pod)) ? IER(1496) : (! (t->arity)) ? IER(1497) : 0)
+  if ((! t) ? IER(1649) : (! (t->pod)) ? IER(1650) : (! (t->arity)) ? IER(1651) : 0)
 	 return;
   while (*err ? NULL : p ? (o = _cru_popped_packet (&p, err)) : NULL)
-	 if (! _cru_push_packet (o, &(t->pod[MOD(o->hash_value, t->arity)]), err))
+	 if (! _cru_pod_pushed (o, t, LANE(o->hash_value, t->partitioner, t->arity), err))
 		_cru_nack (o, err);
   _cru_nack (p, err);
 }
@@ -77,12 +77,12 @@ _cru_scattered (e, t, err)
   packet_list p;
   uintptr_t q;
 
-  if ((! t) ? IER(1498) : (! (t->arity)) ? IER(1499) : t->pod ? 0 : IER(1500))
+  if ((! t) ? IER(1652) : (! (t->arity)) ? IER(1653) : t->pod ? 0 : IER(1654))
 	 return 0;
   for (; e; e = e->next_edge)
 	 {
 		p = _cru_initial_packet_of (e->remote.node, q = _cru_scalar_hash (e->remote.node), err);
-		if (! _cru_push_packet (p, &(t->pod[MOD(q, t->arity)]), err))
+		if (! _cru_pod_pushed (p, t, LANE(q, t->partitioner, t->arity), err))
 		  return 0;
 	 }
   return 1;
@@ -109,11 +109,11 @@ _cru_scatter_out (n, t, err)
   edge_list e;
   uintptr_t q;
 
-  if ((! n) ? IER(1501) : (! t) ? IER(1502) : (! (t->pod)) ? IER(1503) : (! (t->arity)) ? IER(1504) : 0)
+  if ((! n) ? IER(1655) : (! t) ? IER(1656) : (! (t->pod)) ? IER(1657) : (! (t->arity)) ? IER(1658) : 0)
 	 return NULL;
   for (e = n->edges_out; e; e = e->next_edge)
 	 if ((p = _cru_packet_of (e->remote.node, q = _cru_scalar_hash (e->remote.node), n, e, err)))
-		_cru_push_packet (p, &(t->pod[MOD(q, t->arity)]), err);
+		_cru_pod_pushed (p, t, LANE(q, t->partitioner, t->arity), err);
 	 else
 		break;
   return e;
@@ -139,11 +139,11 @@ _cru_scatter_in (n, t, err)
   edge_list e;
   uintptr_t q;
 
-  if ((! n) ? IER(1505) : (! t) ? IER(1506) : (!(t->pod)) ? IER(1507) : (! (t->arity)) ? IER(1508) : 0)
+  if ((! n) ? IER(1659) : (! t) ? IER(1660) : (!(t->pod)) ? IER(1661) : (! (t->arity)) ? IER(1662) : 0)
 	 return;
   for (e = n->edges_in; e; e = e->next_edge)
 	 if ((p = _cru_packet_of (e->remote.node, q = _cru_scalar_hash (e->remote.node), n, e, err)))
-		_cru_push_packet (p, &(t->pod[MOD(q, t->arity)]), err);
+		_cru_pod_pushed (p, t, LANE(q, t->partitioner, t->arity), err);
 	 else
 		break;
 }
@@ -167,10 +167,10 @@ _cru_send_from (v, c, sender, t, err)
   packet_list p;
   uintptr_t q;
 
-  if ((! t) ? IER(1509) : (! (t->pod)) ? IER(1510) : (! (t->arity)) ? IER(1511) : 0)
+  if ((! t) ? IER(1663) : (! (t->pod)) ? IER(1664) : (! (t->arity)) ? IER(1665) : 0)
 	 return;
   if ((p = _cru_packet_of (v, q = _cru_scalar_hash (c ? c->remote.node : sender), sender, c, err)))
-	 _cru_push_packet (p, &(t->pod[MOD(q, t->arity)]), err);
+	 _cru_pod_pushed (p, t, LANE(q, t->partitioner, t->arity), err);
 }
 
 
@@ -195,12 +195,12 @@ _cru_received_by (v, c, recipient, t, err)
   packet_list p;
   uintptr_t q;
 
-  if ((! t) ? IER(1512) : (! (t->pod)) ? IER(1513) : (! (t->arity)) ? IER(1514) : 0)
+  if ((! t) ? IER(1666) : (! (t->pod)) ? IER(1667) : (! (t->arity)) ? IER(1668) : 0)
 	 return 0;
   if (! (p = _cru_packet_of (v, q = _cru_scalar_hash (recipient), NO_SENDER, c, err)))
 	 return 0;
   p->receiver = recipient;
-  _cru_push_packet (p, &(t->pod[MOD(q, t->arity)]), err);
+  _cru_pod_pushed (p, t, LANE(q, t->partitioner, t->arity), err);
   return 1;
 }
 
@@ -230,17 +230,17 @@ _cru_scattered_by_hashes (n, h, t, by_class, err)
   edge_list e;
   packet_list p;
 
-  if ((! n) ? IER(1515) : (! t) ? IER(1516) : (!(t->pod)) ? IER(1517) : (! (t->arity)) ? IER(1518) : h ? 0 : IER(1519))
+  if ((! n) ? IER(1669) : (! t) ? IER(1670) : (!(t->pod)) ? IER(1671) : (! (t->arity)) ? IER(1672) : h ? 0 : IER(1673))
 	 return 0;
   for (e = n->edges_out; e; e = e->next_edge)
-	 if ((m = e->remote.node) ? 0 : IER(1520))
+	 if ((m = e->remote.node) ? 0 : IER(1674))
 		return 0;
 	 else if (((c = _cru_read (&(m->class_mark), err))) ? MARKED(c) : 0)
 		continue;
 	 else if (! (p = _cru_packet_of (NO_PAYLOAD, q = h (by_class ? m->vertex_property : m->vertex), NO_SENDER, e, err)))
 		return 0;
 	 else
-		_cru_push_packet (p, &(t->pod[MOD(q, t->arity)]), err);
+		_cru_pod_pushed (p, t, LANE(q, t->partitioner, t->arity), err);
   return 1;
 }
 
@@ -277,17 +277,17 @@ _cru_unscatterable_by_hashes (n, h, d, t, is_initial, err)
   edge_list *e;
   packet_list p;
 
-  if ((! n) ? IER(1521) : (! t) ? IER(1522) : (!(t->pod)) ? IER(1523) : (! (t->arity)) ? IER(1524) : h ? 0 : IER(1525))
+  if ((! n) ? IER(1675) : (! t) ? IER(1676) : (!(t->pod)) ? IER(1677) : (! (t->arity)) ? IER(1678) : h ? 0 : IER(1679))
 	 return 1;
   for (e = &(n->edges_out); *e; _cru_free_edges_and_labels (d, _cru_popped_edge (e, err), err))
-	 if ((m = (*e)->remote.node) ? 0 : IER(1526))
+	 if ((m = (*e)->remote.node) ? 0 : IER(1680))
 		return 1;
 	 else if (! (p = _cru_packet_of ((void *) (uintptr_t) *err, q = h (m->vertex), NO_SENDER, *e, err)))
 		return 1;
 	 else
 		{
 		  p->initial = is_initial;
-		  _cru_push_packet (p, &(t->pod[MOD(q, t->arity)]), err);
+		  _cru_pod_pushed (p, t, LANE(q, t->partitioner, t->arity), err);
 		}
   return 0;
 }
@@ -319,11 +319,11 @@ _cru_unscatterable (e, n, d, t, err)
   edge_list c;
   packet_list p;
 
-  if (e ? 0 : IER(1527))
+  if (e ? 0 : IER(1681))
 	 return 0;
-  if ((! t) ? IER(1528) : (! (t->arity)) ? IER(1529) : t->pod ? 0 : IER(1530))
+  if ((! t) ? IER(1682) : (! (t->arity)) ? IER(1683) : t->pod ? 0 : IER(1684))
 	 goto a;
-  for (; (! *e) ? 0 : (c = _cru_popped_edge (e, err)) ? 1 : ! IER(1531); _cru_free_edges_and_labels (d, c, err))
+  for (; (! *e) ? 0 : (c = _cru_popped_edge (e, err)) ? 1 : ! IER(1685); _cru_free_edges_and_labels (d, c, err))
 	 if (c->remote.node != n)
 		{
 		  if (! (p = _cru_packet_of (c->remote.node, q = _cru_scalar_hash (c->remote.node), n, NO_CARRIER, err)))
@@ -332,7 +332,7 @@ _cru_unscatterable (e, n, d, t, err)
 				break;
 			 }
 		  p->receiver = c->remote.node;
-		  _cru_push_packet (p, &(t->pod[MOD(q, t->arity)]), err);
+		  _cru_pod_pushed (p, t, LANE(q, t->partitioner, t->arity), err);
 		}
  a: return ! ! *e;
 }
@@ -345,28 +345,31 @@ _cru_unscatterable (e, n, d, t, err)
 
 
 void
-_cru_scatter_out_or_consume (n, h, z, t, err)
+_cru_scatter_out_or_consume (n, h, z, t, depth, err)
 	  node_list n;
 	  cru_hash h;
 	  cru_destructor_pair z;
 	  packet_pod t;
+	  uintptr_t depth;     // the depth of the termini in a depth limited build
 	  int *err;
 
 	  // Send a packet to another worker for each outgoing edge *e from
-	  // n, setting the packet's carrier to *e, its sender to n, and
-	  // its payload to the vertex at the other end of *e.
+	  // n, setting the packet's carrier to *e, its sender to n, its
+	  // payload to the vertex at the other end of *e, and its depth to
+	  // the given depth.
 {
   packet_list p;
   edge_list *e;
   uintptr_t q;
 
-  if ((! h) ? IER(1532) : (! t) ? IER(1533) : (! (t->arity)) ? IER(1534) : (! (t->pod)) ? IER(1535) :  (! n) ? IER(1536) : 0)
+  if ((! h) ? IER(1686) : (! t) ? IER(1687) : (! (t->arity)) ? IER(1688) : (! (t->pod)) ? IER(1689) :  (! n) ? IER(1690) : 0)
 	 return;
   for (e = &(n->edges_out); *err ? NULL : *e; e = &((*e)->next_edge))
 	 if ((p = _cru_packet_of ((*e)->remote.vertex, q = h ((*e)->remote.vertex), n, *e, err)))
 		{
 		  p->receiver = NULL;
-		  _cru_push_packet (p, &(t->pod[MOD(q, t->arity)]), err);
+		  p->depth = depth;
+		  _cru_pod_pushed (p, t, LANE(q, t->partitioner, t->arity), err);
 		}
 	 else
 		break;
@@ -400,12 +403,12 @@ _cru_scatter_and_stretch (z, e, m, h, t, err)
   node_list i;
   uintptr_t q;
 
-  if ((! h) ? IER(1537) : (! t) ? IER(1538) : (! (t->pod)) ? IER(1539) : (! (t->arity)) ? IER(1540) : 0)
+  if ((! h) ? IER(1691) : (! t) ? IER(1692) : (! (t->pod)) ? IER(1693) : (! (t->arity)) ? IER(1694) : 0)
 	 return NULL;
   i = NULL;
   for (l = NULL; *err ? NULL : e;)
 	 {
-		if ((! (e->ante)) ? IER(1541) : (! (e->post)) ? IER(1542) : e->post->remote.node ? IER(1543) : *err)
+		if ((! (e->ante)) ? IER(1695) : (! (e->post)) ? IER(1696) : e->post->remote.node ? IER(1697) : *err)
 		  break;
 		q = h (e->ante->remote.vertex);
 		if (! (i = _cru_node_of (NO_DESTRUCTORS, e->ante->remote.vertex, NO_EDGES_IN, NO_EDGES_OUT, err)))
@@ -420,7 +423,7 @@ _cru_scatter_and_stretch (z, e, m, h, t, err)
 		  goto a;
 		if ((p = _cru_packet_of (NO_PAYLOAD, q, NO_SENDER, e->ante, err)) ? *err : 1)
 		  goto b;
-		if (! _cru_push_packet (p, &(t->pod[MOD(q, t->arity)]), err))
+		if (! _cru_pod_pushed (p, t, LANE(q, t->partitioner, t->arity), err))
 		  goto c;
 		e->ante->remote.node->class_mark = STRETCHED;
 		e->ante = NULL;
@@ -81,7 +81,7 @@ _cru_unscatterable (edge_list *e, node_list n, cru_destructor d, packet_pod t, i
 
 // scatter outgoing edges from n routed by vertex hashes and consume unscatterable edges 
 extern void
-_cru_scatter_out_or_consume (node_list n, cru_hash h, cru_destructor_pair z, packet_pod t, int *err);
+_cru_scatter_out_or_consume (node_list n, cru_hash h, cru_destructor_pair z, packet_pod t, uintptr_t depth, int *err);
 
 // scatter and consume the edges in a list of edge maps
 extern edge_list
@@ -18,6 +18,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include "arena.h"
 #include "brig.h"
 #include "build.h"
 #include "edges.h"
@@ -41,7 +42,7 @@
 #define INITIAL 1
 #define NOT_INITIAL 0
 
-#define UNEQUAL(a,b) ((b ? 0 : IER(1580)) ? 0 : (a == b->vertex) ? 0 : FAILED(s->orders.v_order.equal, a, b->vertex))
+#define UNEQUAL(a,b) ((b ? 0 : IER(1734)) ? 0 : (a == b->vertex) ? 0 : FAILED(s->orders.v_order.equal, a, b->vertex))
 
 
 
@@ -56,7 +57,7 @@ push_severed (n, t, err)
 
 	  // Sever and push n into t, and disconnect its incoming edges.
 {
-  if (n ? 0 : IER(1581))
+  if (n ? 0 : IER(1735))
 	 return;
   _cru_pushed_node (_cru_half_severed (n), t, err);
   _cru_free_edges (n->edges_in, err);
@@ -86,9 +87,9 @@ packed (i, s, p, t, d, err)
   packet_list *c;
   edge_list e;
 
-  if (*err ? 1 : (! i) ? IER(1582) : (! *i) ? IER(1583) : (! s) ? IER(1584) : (! (s->orders.v_order.equal)) ? IER(1585) : 0)
+  if (*err ? 1 : (! i) ? IER(1736) : (! *i) ? IER(1737) : (! s) ? IER(1738) : (! (s->orders.v_order.equal)) ? IER(1739) : 0)
 	 goto a;
-  if ((! ((*i)->receiver)) ? IER(1586) : 0)
+  if ((! ((*i)->receiver)) ? IER(1740) : 0)
 	 goto a;
   if (! (c = _cru_collision ((*i)->hash_value, p, err)))
 	 {
@@ -150,23 +151,23 @@ _cru_prespreading_task (source, err)
   killed = 0;
   seen = NULL;
   memset (&buffer, 0, sizeof (buffer));
-  if ((! source) ? IER(1587) : (source->gruntled != PORT_MAGIC) ? IER(1588) : 0)
+  if ((! source) ? IER(1741) : (source->gruntled != PORT_MAGIC) ? IER(1742) : 0)
 	 return NULL;
-  if ((!(r = source->local)) ? IER(1589) : (r->valid != ROUTER_MAGIC) ? IER(1590) : 0)
+  if ((!(r = source->local)) ? IER(1743) : (r->valid != ROUTER_MAGIC) ? IER(1744) : 0)
 	 return NULL;
-  if ((r->tag == BUI) ? 0 : IER(1591))
+  if ((r->tag == BUI) ? 0 : IER(1745))
 	 goto d;
   s = &(r->builder.bu_sig);
-  if ((!(d = source->peers)) ? IER(1592) : 0)
+  if ((!(d = source->peers)) ? IER(1746) : 0)
 	 goto d;
   _cru_set_storage (r->ro_store, err);
   _cru_set_kill_switch (&(r->killed), err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
-		KILL_SITE(29);
+		KILL_SITE(30);
 		if (killed ? 0 : (killed = (*err ? 1 : KILLED)))
 		  _cru_kill_internally (&(r->killed), err);
-		if (((n = incoming->receiver)) ? RECORDED(n) : IER(1593))
+		if (((n = incoming->receiver)) ? RECORDED(n) : IER(1747))
 		  goto a;
 		if (incoming->payload)
 		  {
@@ -226,7 +227,7 @@ start (s, q, h, d, err)
 {
   node_list n;
 
-  if ((! s) ? IER(1594) : (! q) ? IER(1595) : ! (*q = _cru_queue_of (*s, err)))
+  if ((! s) ? IER(1748) : (! q) ? IER(1749) : ! (*q = _cru_queue_of (*s, err)))
 	 return;
   *s = NULL;
   for (n = (*q)->front; n; n = n->next_node)
@@ -254,9 +255,9 @@ cancel_spreading (s, err)
   node_list n;
   router r;
 
-  if ((! s) ? IER(1596) : (s->gruntled != PORT_MAGIC) ? IER(1597) : 0)
+  if ((! s) ? IER(1750) : (s->gruntled != PORT_MAGIC) ? IER(1751) : 0)
 	 return;
-  if ((!(r = s->local)) ? IER(1598) : (r->valid != ROUTER_MAGIC) ? IER(1599) : 0)
+  if ((!(r = s->local)) ? IER(1752) : (r->valid != ROUTER_MAGIC) ? IER(1753) : 0)
 	 return;
   _cru_forget_collisions (s->collided, err);
   s->collided = NULL;
@@ -311,17 +312,17 @@ break_out (i, b, d, err)
   void *l;                // incident edge label
   int ux;
 
-  if ((! i) ? IER(1600) : (! *i) ? IER(1601) : (! b) ? IER(1602) : (! (n = (*i)->receiver)) ? IER(1603) : ! ! (n->edges_out))
+  if ((! i) ? IER(1754) : (! *i) ? IER(1755) : (! b) ? IER(1756) : (! (n = (*i)->receiver)) ? IER(1757) : ! ! (n->edges_out))
 	 goto a;
-  if (((! (b->connector)) == ! (b->subconnector)) ? IER(1604) : *err)
+  if (((! (b->connector)) == ! (b->subconnector)) ? IER(1758) : *err)
 	 goto a;
-  if (b->subconnector ? (b->bu_sig.orders.e_order.hash ? 0 : IER(1605)) : 0)
+  if (b->subconnector ? (b->bu_sig.orders.e_order.hash ? 0 : IER(1759)) : 0)
 	 goto a;
-  if ((new_edges_out = _cru_get_edges ()) ? (! ! (*new_edges_out = NULL)) : IER(1606))
+  if ((new_edges_out = _cru_get_edges ()) ? (! ! (*new_edges_out = NULL)) : IER(1760))
 	 goto a;
   if (b->connector)
 	 APPLY(b->connector, n->vertex);
-  else if ((*i)->initial ? IER(1607) : (*i)->carrier ? 0 : IER(1608))
+  else if ((*i)->initial ? IER(1761) : (*i)->carrier ? 0 : IER(1762))
 	 goto a;
   else
 	 {
@@ -332,7 +333,7 @@ break_out (i, b, d, err)
   n->edges_out = *new_edges_out;
   if (b->subconnector)
 	 n->edges_out = _cru_deduplicated_edges (n->edges_out, &(b->bu_sig.orders.e_order), b->bu_sig.destructors.e_free, err);
-  _cru_scatter_out_or_consume (n, b->bu_sig.orders.v_order.hash, &(b->bu_sig.destructors), d, err);
+  _cru_scatter_out_or_consume (n, b->bu_sig.orders.v_order.hash, &(b->bu_sig.destructors), d, (*i)->depth + 1, err);
  a: _cru_nack (_cru_popped_packet (i, err), err);
   return ! *err;
 }
@@ -354,10 +355,8 @@ spreading_task (source, err)
 	  // edges.
 {
   edge_list new_edges_out;    // thread specific storage location for created edges
-  packet_list incoming;
+  packet_list incoming, p;
   int ux, ut, unequal;
-  uintptr_t limit;            // maximum number of vertices allowed to be created by this worker
-  uintptr_t count;            // number of vertices created by this worker
   unsigned sample;
   packet_list *c;
   cru_builder b;
@@ -366,43 +365,49 @@ spreading_task (source, err)
   node_list n;
   int started;
   int killed;                 // non-zero when the job is killed
+  int stopped;                // non-zero when a partial job is killed without an error
   context x;
   cru_sig s;
   router r;
 
   d = NULL;
   q = NULL;
-  count = 0;
   sample = 0;
   killed = 0;
   started = 0;
   x = BUILDING;
   new_edges_out = NULL;
-  if ((! source) ? IER(1609) : (source->gruntled != PORT_MAGIC) ? IER(1610) : 0)
+  if ((! source) ? IER(1763) : (source->gruntled != PORT_MAGIC) ? IER(1764) : 0)
 	 return NULL;
-  if ((!(r = source->local)) ? IER(1611) : (r->valid != ROUTER_MAGIC) ? IER(1612) : 0)
+  if ((!(r = source->local)) ? IER(1765) : (r->valid != ROUTER_MAGIC) ? IER(1766) : 0)
 	 return NULL;
   b = &(r->builder);
   s = &(b->bu_sig);
-  if ((!(d = source->peers)) ? IER(1613) : (r->tag != BUI) ? IER(1614) : 0)
+  if ((!(d = source->peers)) ? IER(1767) : (r->tag != BUI) ? IER(1768) : 0)
 	 goto a;
-  if ((s->orders.v_order.equal) ? 0 : IER(1615))
+  if ((s->orders.v_order.equal) ? 0 : IER(1769))
 	 goto a;
   if (_cru_set_context (&x, err) ? 1 : _cru_set_edges (&new_edges_out, err) ? 1 : _cru_set_storage (r->ro_store, err))
 	 goto a;
   if (_cru_set_kill_switch (&(r->killed), err) ? 1 : _cru_set_destructors (&(b->bu_sig.destructors), err))
 	 goto a;
-  limit = b->bu_sig.vertex_limit / r->lanes;
-  limit = (limit ? limit : b->bu_sig.vertex_limit ? 1 : 0);
-  for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
+  for (incoming = NULL; incoming ? incoming : (incoming = _cru_prioritized (source, d, b, err));)
 	 {
-		KILL_SITE(30);
+		KILL_SITE(31);
 		killed = (killed ? 1 : KILLED);
+		stopped = (killed ? STOPPED(r) : 0);
 		if (started ? 0 : ++started)
 		  start (&(source->deletions), &q, b->bu_sig.orders.v_order.hash, d, err);
 		if (incoming->receiver ? break_out (&incoming, b, d, err) : 0)
 		  continue;
-		if (*err ? 1 : killed ? 1 : ! (c = _cru_collision (incoming->hash_value, &(source->collided), err)))
+		if (*err ? 0 : killed ? 0 : HELD(incoming, r))
+		  {
+			 _cru_push_packet (_cru_popped_packet (&incoming, err), &(source->frontier), err);
+			 continue;
+		  }
+		if (*err ? 1 : killed ? (! stopped) : 0)
+		  goto b;
+		if (! (c = _cru_collision (incoming->hash_value, &(source->collided), err)))
 		  goto b;
 		if (*c)
 		  while (*err ? 0 : (unequal = UNEQUAL(incoming->payload, (*c)->receiver)) ? (*c)->next_packet : NULL)
@@ -410,9 +415,15 @@ spreading_task (source, err)
 		if (*err)
 		  goto b;
 		if (*c ? (! unequal) : 0)
-		  _cru_reach_extant_node (&incoming, *c, b, d, err);
-		else if (limit ? (count++ < limit) : 1)
-		  _cru_push_packet (_cru_reached_new_node (&incoming, b, &q, d, err), *c ? &((*c)->next_packet) : c, err);
+		  _cru_reach_extant_node (&incoming, *c, b, d, stopped, err);
+		else if (BUDGETED(s->vertex_limit, r))
+		  {
+			 _cru_push_packet (p = _cru_reached_new_node (&incoming, b, &q, d, NO_SLABS, stopped, err), *c ? &((*c)->next_packet) : c, err);
+			 if (p)
+				_cru_discovered (b, p->receiver, &x, &(r->killed), err);
+		  }
+		else if (b->partial)
+		  _cru_truncate (&incoming, b, err);
 		else
 		  RAISE(CRU_INTOVF);
 		continue;
@@ -457,9 +468,9 @@ _cru_spread (g, k, r, err)
   uintptr_t h;
 
   _cru_disable_killing (k, err);
-  if ((! r) ? IER(1616) : (r->valid != ROUTER_MAGIC) ? IER(1617) : (! (r->ro_sig.orders.v_order.hash)) ? IER(1618) : 0)
+  if ((! r) ? IER(1770) : (r->valid != ROUTER_MAGIC) ? IER(1771) : (! (r->ro_sig.orders.v_order.hash)) ? IER(1772) : 0)
 	 goto a;
-  if ((! g) ? 1 : (! (g->base_node)) ? IER(1619) : 0)
+  if ((! g) ? 1 : (! (g->base_node)) ? IER(1773) : 0)
 	 goto a;
   if (! _cru_status_launched (k, g->base_node, h = (r->ro_sig.orders.v_order.hash) (g->base_node->vertex), r, err))
 	 goto a;
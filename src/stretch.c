@@ -18,6 +18,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include "count.h"
 #include "cthread.h"
 #include "duplex.h"
 #include "edges.h"
@@ -67,20 +68,20 @@ scattered (n, x, s, d, err)
   int deletable, ux, ut;
   edge_map *new_edge_map;
 
-  if ((! n) ? IER(1620) : n->edges_in ? IER(1621) : 0)
+  if ((! n) ? IER(1774) : n->edges_in ? IER(1775) : 0)
 	 return 0;
   l = NULL;
-  if ((! s) ? IER(1622) : 0)
+  if ((! s) ? IER(1776) : 0)
 	 return 0;
   if (! _cru_scattered_by_hashes (n, s->orders.v_order.hash, d, BY_TERMINUS, err))
 	 return 0;
-  if ((! x) ? IER(1623) : (! (x->expander)) ? IER(1624) : 0)
+  if ((! x) ? IER(1777) : (! (x->expander)) ? IER(1778) : 0)
 	 return 0;
-  if ((new_edge_map = _cru_get_edge_maps ()) ? 0 : IER(1625))
+  if ((new_edge_map = _cru_get_edge_maps ()) ? 0 : IER(1779))
 	 return 0;
   for (e = &(n->edges_out); *err ? NULL : *e;)
 	 {
-		if (((m = (*e)->remote.node)) ? 0 : IER(1626))
+		if (((m = (*e)->remote.node)) ? 0 : IER(1780))
 		  return 0;
 		*new_edge_map = NULL;
 		deletable = (*err ? 1 : PASSED(x->expander, n->vertex_property, (*e)->label, m->vertex_property));
@@ -115,9 +116,9 @@ grown (i, limit, count, err)
 {
   packet_list c;
 
-  if (count ? (limit ? ((*count)++ >= limit) : 0) : ! IER(1627))
+  if (count ? (limit ? ((*count)++ >= limit) : 0) : ! IER(1781))
 	 RAISE(CRU_INTOVF);
-  if ((c = _cru_popped_packet (i, err)) ? 0 : IER(1628))
+  if ((c = _cru_popped_packet (i, err)) ? 0 : IER(1782))
 	 return NULL;
   c->receiver = _cru_half_severed (c->receiver);
   _cru_record_edge (_cru_scalar_hash (c->carrier), EQUAL_CARRIERS, (void *) c->carrier, &(c->seen_carriers), err);
@@ -145,9 +146,9 @@ graft (i, c, s, err)
 	  // successors. This is done when an incoming node with an
 	  // stretch class mark matches one previously stored.
 {
-  if ((! i) ? IER(1629) : (! (i->carrier)) ? IER(1630) : (! (i->receiver)) ? IER(1631) : 0)
+  if ((! i) ? IER(1783) : (! (i->carrier)) ? IER(1784) : (! (i->receiver)) ? IER(1785) : 0)
 	 return;
-  if ((! c) ? IER(1632) : (! (c->receiver)) ? IER(1633) : (i == c) ? IER(1634) : s ? 0 : IER(1635))
+  if ((! c) ? IER(1786) : (! (c->receiver)) ? IER(1787) : (i == c) ? IER(1788) : s ? 0 : IER(1789))
 	 return;
   c->receiver->edges_out = _cru_cat_edges (i->receiver->edges_out, c->receiver->edges_out);
   i->receiver->edges_out = NULL;
@@ -182,7 +183,7 @@ overwrite (i, c, s, d, err)
 	  // by an equivalant one recieved later with a non-stretch
 	  // class mark.
 {
-  if ((! i) ? IER(1636) : (! (i->receiver)) ? IER(1637) : (! c) ? IER(1638) : (! (c->receiver)) ? IER(1639) : s ? 0 : IER(1640))
+  if ((! i) ? IER(1790) : (! (i->receiver)) ? IER(1791) : (! c) ? IER(1792) : (! (c->receiver)) ? IER(1793) : s ? 0 : IER(1794))
 	 return;
   _cru_redirect (c->seen_carriers, i->receiver, err);
   i->receiver->edges_out = _cru_cat_edges (c->receiver->edges_out, i->receiver->edges_out);
@@ -216,9 +217,9 @@ _cru_cull (i, b, h, q, d, by_class, err)
 {
   node_list n;
 
-  if ((! i) ? IER(1641) : (! *i) ? IER(1642) : 0)
+  if ((! i) ? IER(1795) : (! *i) ? IER(1796) : 0)
 	 return;
-  if ((! b) ? IER(1643) : (! q) ? IER(1644) : (! d) ? IER(1645) : (! (n = (*i)->receiver)) ? IER(1646) : 0)
+  if ((! b) ? IER(1797) : (! q) ? IER(1798) : (! d) ? IER(1799) : (! (n = (*i)->receiver)) ? IER(1800) : 0)
 	 goto a;
   if (n->class_mark == RETIRED)
 	 goto b;
@@ -263,7 +264,7 @@ stretching_task (source, err)
 	  // non-null if there is a net increase in the number of vertices.
 {
 #define UNEQUAL(a,b) \
-((! b) ? (! IER(1647)) : (a == b->vertex) ? 0 : FAILED(r->ro_sig.orders.v_order.equal, a, b->vertex))
+((! b) ? (! IER(1801)) : (a == b->vertex) ? 0 : FAILED(r->ro_sig.orders.v_order.equal, a, b->vertex))
 
   struct packet_list_s buffer;  // needed if only if there's not enough memory to allocate a packet
   packet_table collisions;      // previous incoming packets
@@ -292,13 +293,13 @@ stretching_task (source, err)
   _cru_set_context (&x, err);
   memset (&buffer, 0, sizeof (buffer));
   _cru_set_edge_maps (&new_edge_map, err);
-  if ((! source) ? IER(1648) : (source->gruntled != PORT_MAGIC) ? IER(1649) : 0)
+  if ((! source) ? IER(1802) : (source->gruntled != PORT_MAGIC) ? IER(1803) : 0)
 	 goto a;
-  if ((!(r = source->local)) ? IER(1650) : (r->valid != ROUTER_MAGIC) ? IER(1651) : 0)
+  if ((!(r = source->local)) ? IER(1804) : (r->valid != ROUTER_MAGIC) ? IER(1805) : 0)
 	 goto b;
-  if ((!(d = source->peers)) ? IER(1652) : (r->tag != EXT) ? IER(1653) : 0)
+  if ((!(d = source->peers)) ? IER(1806) : (r->tag != EXT) ? IER(1807) : 0)
 	 goto b;
-  if ((r->ro_sig.orders.v_order.equal) ? 0 : IER(1654))
+  if ((r->ro_sig.orders.v_order.equal) ? 0 : IER(1808))
 	 goto b;
   if (_cru_set_context (&x, err) ? 1 : _cru_set_storage (r->ro_store, err) ? 1 : _cru_set_kill_switch (&(r->killed), err))
 	 goto b;
@@ -307,9 +308,9 @@ stretching_task (source, err)
   limit = (limit ? limit : r->ro_sig.vertex_limit ? 1 : 0);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
-		KILL_SITE(31);
+		KILL_SITE(32);
 		killed = (killed ? 1 : KILLED);
-		if ((! (n = incoming->receiver)) ? IER(1655) : 0)
+		if ((! (n = incoming->receiver)) ? IER(1809) : 0)
 		  goto c;
 		if (*err ? 1 : killed ? 1 : (c = _cru_collision (incoming->hash_value, &collisions, err)) ? *err : 1)
 		  goto d;
@@ -326,11 +327,11 @@ stretching_task (source, err)
 	 e: if (*c ? (! unequal) : 0)
 		  goto f;
 		_cru_push_packet (grown (&incoming, limit, &count, err), p = (*c ? &((*c)->next_packet) : c), err);
-		if ((! *p) ? IER(1656) : ((*p)->receiver->class_mark != STRETCHED) ? 1 : ++changed ? 1 : IER(1657))
+		if ((! *p) ? IER(1810) : ((*p)->receiver->class_mark != STRETCHED) ? 1 : ++changed ? 1 : IER(1811))
 		  continue;
 	 f: if (n->class_mark == STRETCHED)
 		  graft (incoming, *c, &(r->ro_sig), err);
-		else if (changed-- ? 1 : IER(1658))
+		else if (changed-- ? 1 : IER(1812))
 		  overwrite (incoming, *c, &(r->ro_sig), r->stretcher.st_prop.vertex.m_free, err);
 	 c: _cru_nack (_cru_popped_packet (&incoming, err), err);
 		continue;
@@ -362,7 +363,8 @@ _cru_pruning_task (source, err)
 	  int *err;
 
 	  // Return a queue of every received node, severing each from the
-	  // port's list of survivors. Cf. pruning_task in filters.c.
+	  // port's list of survivors, and tally them in the port's census.
+	  // Cf. pruning_task in filters.c.
 {
   router r;
   cru_sig s;
@@ -378,18 +380,19 @@ _cru_pruning_task (source, err)
   d = NULL;
   sample = 0;
   seen = NULL;
-  if ((! source) ? IER(1659) : (source->gruntled != PORT_MAGIC) ? IER(1660) : (killed = 0))
+  if ((! source) ? IER(1813) : (source->gruntled != PORT_MAGIC) ? IER(1814) : (killed = 0))
 	 return NULL;
-  if ((!(r = source->local)) ? IER(1661) : (r->valid != ROUTER_MAGIC) ? IER(1662) : 0)
+  if ((!(r = source->local)) ? IER(1815) : (r->valid != ROUTER_MAGIC) ? IER(1816) : 0)
 	 return NULL;
   s = &(r->ro_sig);
-  if (((d = source->peers)) ? 0 : IER(1663))
+  if (((d = source->peers)) ? 0 : IER(1817))
 	 return (node_queue) _cru_abort (source, d, err);
+  memset (&(source->tally), 0, sizeof (source->tally));
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
-		KILL_SITE(32);
+		KILL_SITE(33);
 		killed = (killed ? 1 : KILLED);
-		if (killed ? 1 : (! (n = incoming->receiver)) ? IER(1664) : _cru_test_and_set_membership (n, &seen, err) ? 1 : *err)
+		if (killed ? 1 : (! (n = incoming->receiver)) ? IER(1818) : _cru_test_and_set_membership (n, &seen, err) ? 1 : *err)
 		  goto a;
 		if (_cru_enqueued_node (_cru_severed (n, err), &q, err))
 		  _cru_scattered_by_hashes (n, s->orders.v_order.hash, d, (r->tag == CLU) ? BY_CLASS : BY_TERMINUS, err);
@@ -397,6 +400,8 @@ _cru_pruning_task (source, err)
 		  _cru_pushed_node (n, &(source->survivors), err);
 	 a: _cru_nack (_cru_popped_packet (&incoming, err), err);
 	 }
+  if (killed ? 0 : ! *err)
+	 _cru_tally (&(source->tally), q ? q->front : NULL);
   _cru_forget_members (seen);
   return q;
 }
@@ -429,11 +434,11 @@ _cru_stretched (g, k, r, err)
   uintptr_t count;   // non-zero when any worker detects a change
 
   _cru_disable_killing (k, err);
-  if (*err ? 1 : (! g) ? 1 : (! (b = g->base_node)) ? IER(1665) : 0)
+  if (*err ? 1 : (! g) ? 1 : (! (b = g->base_node)) ? IER(1819) : 0)
 	 goto a;
-  if ((! r) ? IER(1666) : (r->valid != ROUTER_MAGIC) ? IER(1667) : (r->tag != EXT) ? IER(1668) : 0)
+  if ((! r) ? IER(1820) : (r->valid != ROUTER_MAGIC) ? IER(1821) : (r->tag != EXT) ? IER(1822) : 0)
 	 goto a;
-  if ((! (r->ports)) ? IER(1669) : r->ro_sig.orders.v_order.hash ? 0 : IER(1670))
+  if ((! (r->ports)) ? IER(1823) : r->ro_sig.orders.v_order.hash ? 0 : IER(1824))
 	 goto a;
   if (_cru_half_duplex (g, err))
 	 goto b;
@@ -455,9 +460,10 @@ _cru_stretched (g, k, r, err)
 		if (*err)
 		  break;
 		iterating = (count ? r->stretcher.st_fix : 0);
-		if (_cru_queue_launched (k, b, q, _cru_reset (r, (task) _cru_pruning_task, err), &(g->nodes), err))
-		  if (g->nodes)
-			 g->nodes->previous = &(g->nodes);
+		if (_cru_queue_launched (k, b, q, _cru_reset (r, (task) _cru_pruning_task, err), &(g->nodes), err) ? (! *err) : 0)
+		  _cru_gathered_census (r, &(g->g_census));
+		if (g->nodes)
+		  g->nodes->previous = &(g->nodes);
 	 }
  a: if (*err)
 	 _cru_free_now (g, err);
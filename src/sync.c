@@ -26,6 +26,7 @@
 #include "repl.h"
 #include "route.h"
 #include "sync.h"
+#include "transport.h"
 #include "wrap.h"
 
 
@@ -49,13 +50,13 @@ error_consumed (r, status, err)
 {
   if (! status)
 	 return 1;
-  if ((! r) ? IER(1671) : (r->valid != ROUTER_MAGIC) ? IER(1672) : 0)
+  if ((! r) ? IER(1825) : (r->valid != ROUTER_MAGIC) ? IER(1826) : 0)
 	 return 0;
-  if ((pthread_mutex_lock (&(r->lock)) ? IER(1673) : 0) ? (r->valid = MUGGLE(57)) : 0)
+  if ((pthread_mutex_lock (&(r->lock)) ? IER(1827) : 0) ? (r->valid = MUGGLE(52)) : 0)
 	 return 0;
   if ((r->ro_status == status) ? 1 : r->ro_status ? 0 : (r->ro_status = status))
 	 status = 0;
-  if ((pthread_mutex_unlock (&(r->lock)) ? IER(1674) : 0) ? (r->valid = MUGGLE(58)) : 0)
+  if ((pthread_mutex_unlock (&(r->lock)) ? IER(1828) : 0) ? (r->valid = MUGGLE(53)) : 0)
 	 return 0;
   return ! status;
 }
@@ -94,7 +95,7 @@ _cru_catch (r, err)
 {
   int status;
 
-  if ((! r) ? IER(1675) : (r->valid != ROUTER_MAGIC) ? IER(1676) : 0)
+  if ((! r) ? IER(1829) : (r->valid != ROUTER_MAGIC) ? IER(1830) : 0)
 	 return *err;
   status = r->ro_status;
   r->ro_status = 0;
@@ -125,14 +126,14 @@ _cru_swell (r, err)
 {
   unsigned u;
 
-  if ((! r) ? IER(1677) : (r->valid != ROUTER_MAGIC) ? IER(1678) : 0)
+  if ((! r) ? IER(1831) : (r->valid != ROUTER_MAGIC) ? IER(1832) : 0)
 	 return;
-  if ((pthread_mutex_lock (&(r->lock)) ? IER(1679) : 0) ? (r->valid = MUGGLE(59)) : 0)
+  if ((pthread_mutex_lock (&(r->lock)) ? IER(1833) : 0) ? (r->valid = MUGGLE(54)) : 0)
 	 return;
-  if (! (((u = r->running + 1) ? 0 : IER(1680)) ? (r->valid = MUGGLE(60)) : 0))
+  if (! (((u = r->running + 1) ? 0 : IER(1834)) ? (r->valid = MUGGLE(55)) : 0))
 	 r->running = u;
-  if (pthread_mutex_unlock (&(r->lock)) ? IER(1681) : 0)
-	 r->valid = MUGGLE(61);
+  if (pthread_mutex_unlock (&(r->lock)) ? IER(1835) : 0)
+	 r->valid = MUGGLE(56);
 }
 
 
@@ -149,19 +150,19 @@ _cru_dwindled (r, err)
 	  // suspension, and if there are no workers left running then
 	  // signal a transition indicating quiescence.
 {
-  if ((! r) ? IER(1682) : (r->valid != ROUTER_MAGIC) ? IER(1683) : 0)
+  if ((! r) ? IER(1836) : (r->valid != ROUTER_MAGIC) ? IER(1837) : 0)
 	 return 0;
-  if ((pthread_mutex_lock (&(r->lock)) ? IER(1684) : 0) ? (r->valid = MUGGLE(62)) : 0)
+  if ((pthread_mutex_lock (&(r->lock)) ? IER(1838) : 0) ? (r->valid = MUGGLE(57)) : 0)
 	 return 0;
-  if ((! (r->running)) ? (pthread_mutex_unlock (&(r->lock)) ? (r->valid = MUGGLE(63)) : 1) : 0)
+  if ((! (r->running)) ? (pthread_mutex_unlock (&(r->lock)) ? (r->valid = MUGGLE(58)) : 1) : 0)
 	 return 0;
   if (--(r->running) ? 0 : (r->quiescent = 1))
-	 if ((pthread_cond_signal (&(r->transition)) ? IER(1685) : 0) ? (r->valid = MUGGLE(64)) : 0)
+	 if ((pthread_cond_signal (&(r->transition)) ? IER(1839) : 0) ? (r->valid = MUGGLE(59)) : 0)
 		{
 		  pthread_mutex_unlock (&(r->lock));
 		  return 0;
 		}
-  if ((pthread_mutex_unlock (&(r->lock)) ? IER(1686) : 0) ? (r->valid = MUGGLE(65)) : 0)
+  if ((pthread_mutex_unlock (&(r->lock)) ? IER(1840) : 0) ? (r->valid = MUGGLE(60)) : 0)
 	 return 0;
   return 1;
 }
@@ -181,29 +182,29 @@ _cru_undefer (r, err)
 	  int *err;
 
 	  // Resume workers where possible by recirculating their deferred
-	  // packets.
+	  // packets through the transport to any whose incoming packets
+	  // are exhausted. The transport wakes the workers if necessary.
 {
-#define NEW_ASSIGNMENT(x) (x->assigned ? 0 : ((x->assigned = x->deferred)) ? (!(x->deferred = NULL)) : 0)
-
+  packet_list s;
   port p;
   unsigned i;
 
-  if ((! r) ? IER(1687) : (r->valid != ROUTER_MAGIC) ? IER(1688) : r->ports ? 0 : IER(1689))
+  if ((! r) ? IER(1841) : (r->valid != ROUTER_MAGIC) ? IER(1842) : r->ports ? 0 : IER(1843))
+	 return;
+  if ((! (r->transport)) ? IER(1844) : 0)
 	 return;
   for (i = 0; i < r->lanes; i++)
 	 {
-		if ((!(p = r->ports[i])) ? IER(1690) : (p->gruntled != PORT_MAGIC) ? IER(1691) : 0)
+		if ((!(p = r->ports[i])) ? IER(1845) : (p->gruntled != PORT_MAGIC) ? IER(1846) : 0)
 		  continue;
-		if ((pthread_mutex_lock (&(p->suspension)) ? IER(1692) : 0) ? (p->gruntled = MUGGLE(66)) : 0)
+		if ((pthread_mutex_lock (&(p->suspension)) ? IER(1847) : 0) ? (p->gruntled = MUGGLE(61)) : 0)
 		  continue;
-		if (NEW_ASSIGNMENT(p) ? p->waiting : 0)
-		  {
-			 _cru_swell (r, err);
-			 if (pthread_cond_signal (&(p->resumable)) ? IER(1693) : 0)
-				p->gruntled = MUGGLE(67);
-		  }
-		if (pthread_mutex_unlock (&(p->suspension)) ? IER(1694) : 0)
-		  p->gruntled = MUGGLE(68);
+		if ((s = ((r->transport->pending) (p) ? NULL : p->deferred)))
+		  p->deferred = NULL;
+		if (pthread_mutex_unlock (&(p->suspension)) ? IER(1848) : 0)
+		  p->gruntled = MUGGLE(62);
+		else if (s)
+		  (r->transport->posted) (p, &s, NULL, err);
 	 }
 }
 
@@ -226,15 +227,15 @@ _cru_wait_for_quiescence (k, r, err)
 
 	  // Wait until all workers are suspended.
 {
-  if ((! r) ? IER(1695) : (r->valid != ROUTER_MAGIC) ? IER(1696) : 0)
+  if ((! r) ? IER(1849) : (r->valid != ROUTER_MAGIC) ? IER(1850) : 0)
 	 return;
-  if ((pthread_mutex_lock (&(r->lock)) ? IER(1697) : 0) ? (r->valid = MUGGLE(69)) : 0)
+  if ((pthread_mutex_lock (&(r->lock)) ? IER(1851) : 0) ? (r->valid = MUGGLE(63)) : 0)
 	 return;
   _cru_enable_killing (k, &(r->killed), err);
-  if (r->quiescent ? 0 : pthread_cond_wait (&(r->transition), &(r->lock)) ? IER(1698) : 0)
-	 r->valid = MUGGLE(70);
-  else if (pthread_mutex_unlock (&(r->lock)) ? IER(1699) : 0)
-	 r->valid = MUGGLE(71);
+  if (r->quiescent ? 0 : pthread_cond_wait (&(r->transition), &(r->lock)) ? IER(1852) : 0)
+	 r->valid = MUGGLE(64);
+  else if (pthread_mutex_unlock (&(r->lock)) ? IER(1853) : 0)
+	 r->valid = MUGGLE(65);
   _cru_disable_killing (k, err);
 }
 
@@ -254,24 +255,24 @@ _cru_dismiss (r, err)
 	  // Signal all workers in a router to exit. The router normally
 	  // should be quiescent at this point.
 {
+  packet_list incoming;
   unsigned i;
   port source;
 
-  if ((! r) ? IER(1700) : (r->valid != ROUTER_MAGIC) ? IER(1701) : 0)
+  if ((! r) ? IER(1854) : (r->valid != ROUTER_MAGIC) ? IER(1855) : 0)
 	 return;
-  if ((! (r->lanes)) ? IER(1702) : (! (r->ports)) ? IER(1703) : 0)
+  if ((! (r->lanes)) ? IER(1856) : (! (r->ports)) ? IER(1857) : (! (r->transport)) ? IER(1858) : 0)
 	 return;
   for (i = 0; i < r->lanes; i++)
-	 if (! ((! (source = r->ports[i])) ? IER(1704) : (source->gruntled == PORT_MAGIC) ? 0 : IER(1705)))
+	 if (! ((! (source = r->ports[i])) ? IER(1859) : (source->gruntled == PORT_MAGIC) ? 0 : IER(1860)))
 		{
-		  if ((pthread_mutex_lock (&(source->suspension)) ? IER(1706) : 0) ? (source->gruntled = MUGGLE(72)) : 0)
+		  if ((pthread_mutex_lock (&(source->suspension)) ? IER(1861) : 0) ? (source->gruntled = MUGGLE(66)) : 0)
 			 continue;
-		  if (source->assigned ? IER(1707) : 0)
-			 _cru_nack (source->assigned, err);
-		  source->assigned = NULL;
-		  if (source->waiting ? (pthread_cond_signal (&(source->resumable)) ? IER(1708) : 0) : ! (source->dismissed = 1))
-			 source->gruntled = MUGGLE(73);
-		  if (pthread_mutex_unlock (&(source->suspension)) ? IER(1709) : 0)
-			 source->gruntled = MUGGLE(74);
+		  if ((incoming = (r->transport->taken) (source, err)) ? IER(1862) : 0)
+			 _cru_nack (incoming, err);
+		  if (source->waiting ? (pthread_cond_signal (&(source->resumable)) ? IER(1863) : 0) : ! (source->dismissed = 1))
+			 source->gruntled = MUGGLE(67);
+		  if (pthread_mutex_unlock (&(source->suspension)) ? IER(1864) : 0)
+			 source->gruntled = MUGGLE(68);
 		}
 }
@@ -59,7 +59,7 @@ _cru_collision (index, seen, err)
 #ifdef JUDY
   POINTER_TO_JUDY_ARRAY_ENTRY p;
 
-  if (seen ? 0 : IER(1710))
+  if (seen ? 0 : IER(1865))
 	 return NULL;
   p = PJERR;
   if (MEMAVAIL)
@@ -172,7 +172,7 @@ unwind (e, b, p, index, t, err)
 {
   JUDY_ARRAY_SIZE freed_size;
 
-  if ((! e) ? IER(1711) : (! b) ? IER(1712) : ! *err)
+  if ((! e) ? IER(1866) : (! b) ? IER(1867) : ! *err)
 	 goto a;
   *e = _cru_cat_edges (_cru_unbundled (*b), *e);
   *b = NULL;
@@ -210,16 +210,16 @@ _cru_marshalled (e, by_class, d, err)
   JUDY_ARRAY_KEY index;
   POINTER_TO_JUDY_ARRAY_ENTRY p;
 
-  if (e ? 0 : IER(1713))
+  if (e ? 0 : IER(1868))
 	 return NULL;
   for (t = NULL; *err ? NULL : *e;)
 	 {
-		if (((o = (by_class ? CLASS_OF((*e)->remote.node) : (*e)->remote.node))) ? 0 : IER(1714))
+		if (((o = (by_class ? CLASS_OF((*e)->remote.node) : (*e)->remote.node))) ? 0 : IER(1869))
 		  break;
 		p = PJERR;
 		if (MEMAVAIL)
 		  JLI(p, t, (JUDY_ARRAY_KEY) o);
-		if ((p == PJERR) ? RAISE(ENOMEM) : p ? 0 : IER(1715))
+		if ((p == PJERR) ? RAISE(ENOMEM) : p ? 0 : IER(1870))
 		  break;
 		_cru_push_edge (_cru_popped_edge (e, err), (edge_list *) p, err);
 	 }
@@ -261,14 +261,14 @@ _cru_rallied (h, r, e, err)
   POINTER_TO_JUDY_ARRAY_ENTRY p;
 
   t = NULL;
-  if ((! e) ? IER(1716) : h ? 0 : IER(1717))
+  if ((! e) ? IER(1871) : h ? 0 : IER(1872))
 	 return NULL;
   while (*err ? NULL : *e)
 	 {
 		p = PJERR;
 		if (MEMAVAIL)
 		  JLI(p, t, (JUDY_ARRAY_KEY) h ((*e)->label));
-		if ((p == PJERR) ? RAISE(ENOMEM) : p ? 0 : IER(1718))
+		if ((p == PJERR) ? RAISE(ENOMEM) : p ? 0 : IER(1873))
 		  break;
 		_cru_push_edge (_cru_popped_edge (e, err), (edge_list *) p, err);
 	 }
@@ -292,6 +292,99 @@ _cru_rallied (h, r, e, err)
 
 
 
+static edge_list
+scanned (r, z, e, err)
+	  cru_bpred r;
+	  cru_destructor_pair z;
+	  edge_list e;
+	  int *err;
+
+	  // Consume a list of edges and return those with distinct
+	  // termini, freeing the rest, by comparing each edge to all of
+	  // those after it. Time is quadratic in the length of the list.
+{
+  edge_list p;            // next edge
+  edge_list c;            // a possibly coterminal edge
+  edge_list u;            // cumulative unique edges
+  int ux, ut;
+
+  for (u = NULL; (p = (e ? _cru_popped_edge (&e, err) : NULL));)
+	 {
+		for (c = e; c ? ((p->remote.vertex == c->remote.vertex) ? 0 : FAILED(r, p->remote.vertex, c->remote.vertex)) : 0; c = c->next_edge);
+		if (c ? 1 : *err)
+		  _cru_free_edges_and_termini (z, p, err);
+		else
+		  _cru_push_edge (p, &u, err);
+	 }
+  return u;
+}
+
+
+
+
+
+
+edge_list
+_cru_distinct_termini (h, r, z, e, err)
+	  cru_hash h;
+	  cru_bpred r;
+	  cru_destructor_pair z;
+	  edge_list e;
+	  int *err;
+
+	  // Consume a list of edges and return those with distinct termini
+	  // according to the hash h and equality relation r, freeing the
+	  // rest with the destructors z. Using Judy arrays, the edges are
+	  // binned by the hashes of their termini and compared only within
+	  // a bin, so the time is linear in the length of the list unless
+	  // there are hash collisions. If there's an error, all remaining
+	  // edges are returned.
+{
+#ifdef JUDY
+  COTERMINAL_TABLE t;
+  JUDY_ARRAY_KEY index;
+  JUDY_ARRAY_SIZE freed_size;
+  POINTER_TO_JUDY_ARRAY_ENTRY p;
+  edge_list c, u;
+  int ux, ut;
+
+  if ((r ? 0 : IER(1874)) ? 1 : (! e) ? 1 : ! (e->next_edge))
+	 return e;
+  if (! h)
+	 return scanned (r, z, e, err);
+  for (t = NULL; *err ? NULL : e;)
+	 {
+		p = PJERR;
+		if (MEMAVAIL)
+		  JLI(p, t, (JUDY_ARRAY_KEY) h (e->remote.vertex));
+		if ((p == PJERR) ? RAISE(ENOMEM) : p ? 0 : IER(1875))
+		  break;
+		for (c = *((edge_list *) p); c ? ((e->remote.vertex == c->remote.vertex) ? 0 : FAILED(r, e->remote.vertex, c->remote.vertex)) : 0; c = c->next_edge);
+		if (c ? 1 : *err)
+		  _cru_free_edges_and_termini (z, _cru_popped_edge (&e, err), err);
+		else
+		  _cru_push_edge (_cru_popped_edge (&e, err), (edge_list *) p, err);
+	 }
+  index = 0;
+  JLF(p, t, index);
+  for (u = e; p;)
+	 {
+		u = _cru_cat_edges (*((edge_list *) p), u);
+		JLN(p, t, index);
+	 }
+  JLFA(freed_size, t);
+  return u;
+#else
+  if (r ? 0 : IER(1876))
+	 return e;
+  return scanned (r, z, e, err);         // equivalent result in quadratic time
+#endif
+}
+
+
+
+
+
 // --------------- multiset tables -------------------------------------------------------------------------
 
 
@@ -310,7 +403,7 @@ _cru_record_edge (h, e, l, t, err)
 #ifdef JUDY
   POINTER_TO_JUDY_ARRAY_ENTRY p;
 
-  if (t ? 0 : IER(1719))
+  if (t ? 0 : IER(1877))
 	 return;
   p = PJERR;
   if (MEMAVAIL)
@@ -369,7 +462,7 @@ _cru_already_recorded (h, e, l, t, err)
   multiset_table_bin p;
   int ux, ut;
 
-  if ((! t) ? 1 : e ? 0 : IER(1720))
+  if ((! t) ? 1 : e ? 0 : IER(1878))
 	 return 0;
   for (p = lookup (h, t, err); (! p) ? 0 : FAILED(e, l, p->edge_label); p = p->other_edges);
   return (*err ? 0 : ! ! p);
@@ -394,7 +487,7 @@ _cru_merge (t, q, e, err)
   POINTER_TO_JUDY_ARRAY_ENTRY p;
 #endif
 
-  if ((! q) ? 1 : t ? 0 : IER(1721))
+  if ((! q) ? 1 : t ? 0 : IER(1879))
 	 return;
 #ifdef JUDY
   h = 0;
@@ -428,7 +521,7 @@ _cru_multiplicity (h, e, l, t, err)
   multiset_table_bin p;
   int ux, ut;
 
-  if (e ? 0 : IER(1722))
+  if (e ? 0 : IER(1880))
 	 return 0;
   for (p = lookup (h, t, err); (! p) ? 0: FAILED(e, l, p->edge_label); p = p->other_edges);
   return (p ? p->multiplicity : 0);
@@ -543,12 +636,12 @@ _cru_set_membership (node, seen, err)
 #ifdef JUDY
   int bit;
 
-  if (seen ? 0 : IER(1723))
+  if (seen ? 0 : IER(1881))
 	 return 0;
   bit = JERR;
   if (MEMAVAIL)
 	 J1S(bit, *seen, (JUDY_ARRAY_KEY) node);
-  return ! ((! bit) ? IER(1724) : (bit == JERR) ? RAISE(ENOMEM) : 0);
+  return ! ((! bit) ? IER(1882) : (bit == JERR) ? RAISE(ENOMEM) : 0);
 #else
   return _cru_set_membership_nj (node, (node_set_nj *) seen, err);
 #endif
@@ -593,7 +686,7 @@ _cru_test_and_set_membership (node, seen, err)
 #ifdef JUDY
   int bit;
 
-  if (seen ? 0 : IER(1725))
+  if (seen ? 0 : IER(1883))
 	 return 0;
   J1T(bit, *seen, (JUDY_ARRAY_KEY) node);
   if (bit)
@@ -601,7 +694,7 @@ _cru_test_and_set_membership (node, seen, err)
   bit = JERR;
   if (MEMAVAIL)
 	 J1S(bit, *seen, (JUDY_ARRAY_KEY) node);
-  if ((! bit) ? IER(1726) : (bit == JERR))
+  if ((! bit) ? IER(1884) : (bit == JERR))
 	 RAISE(ENOMEM);
   return 0;
 #else
@@ -712,12 +805,12 @@ _cru_associate (m, v, h, err)
 #ifdef JUDY
   POINTER_TO_JUDY_ARRAY_ENTRY p;
 
-  if ((! h) ? 1 : (h->classed != CLASS_MAGIC) ? IER(1727) : m ? 0 : IER(1728))
+  if ((! h) ? 1 : (h->classed != CLASS_MAGIC) ? IER(1885) : m ? 0 : IER(1886))
 	 goto a;
   p = PJERR;
   if (MEMAVAIL)
 	 JLI(p, *m, (JUDY_ARRAY_KEY) v);
-  if ((p == PJERR) ? RAISE(ENOMEM) : (! p) ? IER(1729) : *p ? RAISE(CRU_PARDPV) : 0)
+  if ((p == PJERR) ? RAISE(ENOMEM) : (! p) ? IER(1887) : *p ? RAISE(CRU_PARDPV) : 0)
 	 goto a;
   *p = (JUDY_ARRAY_ENTRY) h;
   return;
@@ -77,6 +77,10 @@ _cru_marshalled (edge_list *e, int by_class, cru_destructor d, int *err);
 extern brigade
 _cru_rallied (cru_hash h, cru_bpred r, edge_list *e, int *err);
 
+// consume a list of edges and return those with distinct termini, freeing the rest
+extern edge_list
+_cru_distinct_termini (cru_hash h, cru_bpred r, cru_destructor_pair z, edge_list e, int *err);
+
 // --------------- multiset tables -------------------------------------------------------------------------
 
 // include an edge in the table but don't bump the multiplicity if it's already present
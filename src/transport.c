@@ -0,0 +1,183 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// The local transport keeps the packets assigned to each port in a
+// list that any number of producers push onto without locking and
+// its consumer takes all at once. Only the sleeping and waking of the
+// consumer require the suspension mutex of the port.
+
+#include <pthread.h>
+#include "errs.h"
+#include "pack.h"
+#include "ports.h"
+#include "route.h"
+#include "sync.h"
+#include "transport.h"
+
+
+
+
+static packet_list
+local_taken (source, err)
+	  port source;
+	  int *err;
+
+	  // Retrieve the incoming packets assigned to a port and not yet
+	  // processed. This function runs in the context of the thread
+	  // that receives the assigned packets, and needn't lock anything
+	  // because the whole list is swapped out atomically.
+{
+  if ((! source) ? IER(1888) : (source->gruntled != PORT_MAGIC) ? IER(1889) : 0)
+	 return NULL;
+  return INBOX_TAKEN(source);
+}
+
+
+
+
+
+
+
+static int
+local_posted (destination, more_packets, last_packet, err)
+	  port destination;
+	  packet_list *more_packets;
+	  packet_list last_packet;   // the last of the packets if known, or NULL
+	  int *err;
+
+	  // Put more packets into the queue of packets assigned to a
+	  // destination port by pushing them all at once with a single
+	  // compare-and-swap on the destination's assigned list, finding
+	  // the last of them first only if the caller doesn't know it.
+	  // Only if the list was previously empty could the destination
+	  // port's worker be waiting or parked, so only then lock the port
+	  // and send a signal to resume it if it is. The worker that sends
+	  // the signal also clears the waiting flag so that no other
+	  // worker sends it again. If packets are assigned to a running
+	  // worker, return non-zero.
+{
+  packet_list previous;
+  int running;
+
+  if ((! more_packets) ? IER(1890) : ! *more_packets)
+	 return 0;
+  if ((! destination) ? IER(1891) : (destination->gruntled != PORT_MAGIC) ? IER(1892) : 0)
+	 goto a;
+  for (last_packet = (last_packet ? last_packet : *more_packets); last_packet->next_packet;)
+	 last_packet = last_packet->next_packet;
+  do
+	 last_packet->next_packet = previous = __atomic_load_n (&(destination->assigned), __ATOMIC_ACQUIRE);
+  while (! INBOX_SWAPPED(destination, previous, *more_packets));
+  *more_packets = NULL;
+  if (previous)
+	 return 1;
+  if ((pthread_mutex_lock (&(destination->suspension)) ? IER(1893) : 0) ? (destination->gruntled = MUGGLE(69)) : 0)
+	 return 0;
+  running = ! (destination->waiting);
+  if (running ? 0 : ! ! __atomic_load_n (&(destination->assigned), __ATOMIC_ACQUIRE))
+	 {
+		destination->waiting = 0;
+		_cru_swell (destination->local, err);
+		if (pthread_cond_signal (&(destination->resumable)) ? IER(1894) : 0)
+		  destination->gruntled = MUGGLE(70);
+	 }
+  else if (destination->idling)
+	 {
+		destination->idling = 0;
+		if (pthread_cond_signal (&(destination->resumable)) ? IER(1895) : 0)
+		  destination->gruntled = MUGGLE(71);
+	 }
+  if (pthread_mutex_unlock (&(destination->suspension)) ? IER(1896) : 0)
+	 destination->gruntled = MUGGLE(72);
+  return running;
+ a: _cru_free_packets (*more_packets, NO_VERTEX_DESTRUCTOR, err);
+  *more_packets = NULL;
+  return 0;
+}
+
+
+
+
+
+
+
+static packet_list
+local_awaited (source, err)
+	  port source;
+	  int *err;
+
+	  // Wait until at least one new packet arrives and is signaled
+	  // from some other thread unless the worker has been dismissed or
+	  // there are packets available without waiting. Then return the
+	  // new packets if any. The assigned list has to be checked while
+	  // the port is locked so that a producer finding it empty can't
+	  // miss the waiting flag.
+{
+  packet_list s;
+
+  if ((! source) ? IER(1897) : (source->gruntled != PORT_MAGIC) ? IER(1898) : 0)
+	 return NULL;
+  if ((pthread_mutex_lock (&(source->suspension)) ? IER(1899) : 0) ? (source->gruntled = MUGGLE(73)) : 0)
+	 return NULL;
+  if ((s = INBOX_TAKEN(source)) ? 1 : source->dismissed)
+	 {
+		if (pthread_mutex_unlock (&(source->suspension)) ? IER(1900) : 0)
+ 		  source->gruntled = MUGGLE(74);
+		return s;
+	 }
+  if (! _cru_dwindled (source->local, err))
+	 goto a;
+  source->waiting = 1;
+  if (pthread_cond_wait (&(source->resumable), &(source->suspension)) ? IER(1901) : 0)
+	 source->gruntled = MUGGLE(75);
+  s = INBOX_TAKEN(source);
+  source->waiting = 0;
+ a: if (pthread_mutex_unlock (&(source->suspension)) ? IER(1902) : 0)
+	 source->gruntled = MUGGLE(76);
+  return s;
+}
+
+
+
+
+
+
+
+static int
+local_pending (source)
+	  port source;
+
+	  // Return non-zero if any packets are assigned to a port. This
+	  // function is called with the port locked by a worker about to
+	  // park, so that a producer finding the list empty will see the
+	  // idling flag and signal the port directly.
+{
+  return ! ! __atomic_load_n (&(source->assigned), __ATOMIC_ACQUIRE);
+}
+
+
+
+
+
+
+
+struct transport_s _cru_local_transport = {
+  .posted = local_posted,
+  .taken = local_taken,
+  .awaited = local_awaited,
+  .pending = local_pending};
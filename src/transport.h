@@ -0,0 +1,53 @@
+/*
+  cru -- co-recursion utilities
+
+  copyright (c) 2022-2024 Dennis Furey
+
+  Cru is free software: you can redistribute it and/or modify it under
+  the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  Cru is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with cru. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CRU_TRANSPORT_H
+#define CRU_TRANSPORT_H 1
+
+// This file declares the operations by which packets travel between
+// the ports of a router. Ports decide where packets go and what to do
+// with them, and a transport decides how they get there. The only
+// transport so far is the local one, which passes packet lists
+// between threads through lock-free inboxes in shared memory. Another
+// transport would implement the same four operations, and would also
+// need to serialize the payloads of the packets it carries.
+
+#include "ptr.h"
+
+// the operations of a transport, each taking a port of the router using it
+
+struct transport_s
+{
+  int (*posted) (port destination, packet_list *more_packets, packet_list last, int *err);   // queues packets ending at last if known and returns non-zero if the destination is running
+  packet_list (*taken) (port source, int *err);                          // returns the packets queued for a port without waiting
+  packet_list (*awaited) (port source, int *err);                        // the same but waits for some unless the port is dismissed
+  int (*pending) (port source);                                          // non-zero if packets are queued for a port
+};
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// the transport for workers that are threads in the same process
+extern struct transport_s _cru_local_transport;
+
+#ifdef __cplusplus
+}
+#endif
+#endif
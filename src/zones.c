@@ -71,23 +71,23 @@ base_searching_task (source, err)
   seen = NULL;
   result = NULL;
   killed = found = dblx = 0;
-  if ((! source) ? IER(1760) : (source->gruntled != PORT_MAGIC) ? IER(1761) : 0)
+  if ((! source) ? IER(1933) : (source->gruntled != PORT_MAGIC) ? IER(1934) : 0)
 	 return NULL;
-  if ((!(r = source->local)) ? IER(1762) : (r->valid != ROUTER_MAGIC) ? IER(1763) : 0)
+  if ((!(r = source->local)) ? IER(1935) : (r->valid != ROUTER_MAGIC) ? IER(1936) : 0)
 	 return NULL;
   z = &(r->ro_plan.zone);
-  if ((! (d = source->peers)) ? IER(1764) : (e = r->ro_sig.orders.v_order.equal) ? *err : IER(1765))
+  if ((! (d = source->peers)) ? IER(1937) : (e = r->ro_sig.orders.v_order.equal) ? *err : IER(1938))
 	 {
 		_cru_abort (source, d, err);
 		return _cru_new_maybe (ABSENT, NULL, err);
 	 }
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, d, err));)
 	 {
-		KILL_SITE(33);
+		KILL_SITE(34);
 		killed = (killed ? 1 : KILLED);
 		if (killed ? 1 : found)
 		  goto a;
-		if ((n = (node_list) incoming->payload) ? (_cru_test_and_set_membership (n, &seen, err) ? 1 : *err) : IER(1766))
+		if ((n = (node_list) incoming->payload) ? (_cru_test_and_set_membership (n, &seen, err) ? 1 : *err) : IER(1939))
 		  goto a;
 		_cru_scattered (n->edges_out, d, err);
 		if (! (found = ((z->initial_vertex == n->vertex) ? 1 : PASSED(e, z->initial_vertex, n->vertex))))
@@ -160,17 +160,17 @@ reachability_analyzing_task (source, err)
 
   sample = 0;
   killed = 0;
-  if ((! source) ? IER(1767) : (source->gruntled != PORT_MAGIC) ? IER(1768) : 0)
+  if ((! source) ? IER(1940) : (source->gruntled != PORT_MAGIC) ? IER(1941) : 0)
 	 return NULL;
-  if ((! (r = source->local)) ? IER(1769) : (r->valid != ROUTER_MAGIC) ? IER(1770) : 0)
+  if ((! (r = source->local)) ? IER(1942) : (r->valid != ROUTER_MAGIC) ? IER(1943) : 0)
 	 return NULL;
-  if (! (destinations = source->peers) ? IER(1771) : *err)
+  if (! (destinations = source->peers) ? IER(1944) : *err)
 	 return _cru_abort_status (source, destinations, err);
   for (incoming = NULL; incoming ? incoming : (incoming = _cru_exchanged (source, destinations, err));)
 	 {
-		KILL_SITE(34);
+		KILL_SITE(35);
 		killed = (killed ? 1 : KILLED);
-		if (killed ? 1 : (n = (node_list) incoming->payload) ? 0 : IER(1772))
+		if (killed ? 1 : (n = (node_list) incoming->payload) ? 0 : IER(1945))
 		  goto a;
 		if (_cru_test_and_set_membership (n, &(source->reachable), err) ? 0 : ! *err)
 		  _cru_scattered (r->ro_plan.zone.backwards ? n->edges_in : n->edges_out, destinations, err);
@@ -210,7 +210,7 @@ _cru_initial_node (g, k, r, err)
   node_list result;
   cru_destructor_pair d;
 
-  if ((! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(1773) : 0)
+  if ((! r) ? 1 : (r->valid != ROUTER_MAGIC) ? IER(1946) : 0)
 	 return NULL;
   z = &((w = &(r->ro_plan))->zone);
   if (! _cru_half_duplex (g, err))
@@ -265,25 +265,25 @@ all_visited (e, r, s, unvisitable, err)
   node_list o;
   int visited;
 
-  if ((! r) ? IER(1774) : (r->valid != ROUTER_MAGIC) ? IER(1775) : 0)
+  if ((! r) ? IER(1947) : (r->valid != ROUTER_MAGIC) ? IER(1948) : 0)
 	 return 0;
-  if (((! r->ports) ? IER(1776) : (! (r->lanes)) ? IER(1777) : 0) ? (r->valid = MUGGLE(75)) : 0)
+  if (((! r->ports) ? IER(1949) : (! (r->lanes)) ? IER(1950) : 0) ? (r->valid = MUGGLE(77)) : 0)
 	 return 0;
-  if ((! unvisitable) ? IER(1778) : *unvisitable ? IER(1779) : 0)
+  if ((! unvisitable) ? IER(1951) : *unvisitable ? IER(1952) : 0)
 	 return 0;
   for (visited = 1; (! e) ? 0 : *unvisitable ? 0 : visited; e = e->next_edge)
 	 {
-		if (((p = r->ports[MOD(_cru_scalar_hash (o = e->remote.node), r->lanes)]) ? 0 : IER(1780)) ? (r->valid = MUGGLE(76)) : 0)
+		if (((p = r->ports[LANE(_cru_scalar_hash (o = e->remote.node), r->partitioner, r->lanes)]) ? 0 : IER(1953)) ? (r->valid = MUGGLE(78)) : 0)
 		  return 0;
-		if ((p->gruntled != PORT_MAGIC) ? IER(1781) : 0)
+		if ((p->gruntled != PORT_MAGIC) ? IER(1954) : 0)
 		  return 0;
 		if (p->reachable ? (! _cru_member (o, p->reachable)) : 0)
 		  continue;
-		if ((p == s) ? 0 : (pthread_rwlock_rdlock (&(p->p_lock)) ? IER(1782) : 0) ? (p->gruntled = MUGGLE(77)) : 0)
+		if ((p == s) ? 0 : (pthread_rwlock_rdlock (&(p->p_lock)) ? IER(1955) : 0) ? (p->gruntled = MUGGLE(79)) : 0)
 		  return 0;
 		if (! (*unvisitable = p->disabled))
 		  visited = _cru_member (o, p->visited);
-		if ((p == s) ? 0 : (pthread_rwlock_unlock (&(p->p_lock)) ? IER(1783) : 0) ? (p->gruntled = MUGGLE(78)) : 0)
+		if ((p == s) ? 0 : (pthread_rwlock_unlock (&(p->p_lock)) ? IER(1956) : 0) ? (p->gruntled = MUGGLE(80)) : 0)
 		  return 0;
 	 }
   return (*unvisitable ? 0 : visited);
@@ -306,16 +306,16 @@ visited (e, s, unvisitable, err)
 
 	  // Return non-zero if all remote nodes in the given edge list
 	  // have been visited. If so, enable the worker to resume at full
-	  // speed by resetting the backoff parameter.
+	  // speed by resetting its idle round count.
 {
-  if ((! s) ? IER(1784) : (s->gruntled != PORT_MAGIC) ? IER(1785) : ! all_visited (e, s->local, s, unvisitable, err))
+  if ((! s) ? IER(1957) : (s->gruntled != PORT_MAGIC) ? IER(1958) : ! all_visited (e, s->local, s, unvisitable, err))
 	 return 0;
-  if ((pthread_mutex_lock (&(s->suspension)) ? IER(1786) : 0) ? (s->gruntled = MUGGLE(79)) : 0)
+  if ((pthread_mutex_lock (&(s->suspension)) ? IER(1959) : 0) ? (s->gruntled = MUGGLE(81)) : 0)
 	 return 1;
-  if (s->backoff)
-	 s->backoff = 1;
-  if (pthread_mutex_unlock (&(s->suspension)) ? IER(1787) : 0)
-	 s->gruntled = MUGGLE(80);
+  if (s->idle)
+	 s->idle = 1;
+  if (pthread_mutex_unlock (&(s->suspension)) ? IER(1960) : 0)
+	 s->gruntled = MUGGLE(82);
   return 1;
 }
 
@@ -339,9 +339,9 @@ _cru_visitable (n, s, unvisitable, err)
   cru_plan w;
   router r;
 
-  if ((! s) ? IER(1788) : (s->gruntled != PORT_MAGIC) ? IER(1789) : 0)
+  if ((! s) ? IER(1961) : (s->gruntled != PORT_MAGIC) ? IER(1962) : 0)
 	 return 0;
-  if ((! n) ? IER(1790) : (! (r = s->local)) ? IER(1791) : (r->valid != ROUTER_MAGIC) ? IER(1792) : 0)
+  if ((! n) ? IER(1963) : (! (r = s->local)) ? IER(1964) : (r->valid != ROUTER_MAGIC) ? IER(1965) : 0)
 	 return 0;
   if (! ((w = &(r->ro_plan))->remote_first ? 1 : w->local_first))             // traversal order is unconstrained
 	 return 1;
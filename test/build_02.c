@@ -37,14 +37,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(1834))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2007))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(1835) : ++vertex_count ? 0 : FAIL(1836))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2008) : ++vertex_count ? 0 : FAIL(2009))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(1837) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2010) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -63,12 +63,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(1838) : (v->v_magic != VERTEX_MAGIC) ? FAIL(1839) : 0)
+  if ((! v) ? FAIL(2011) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2012) : 0)
 	 return;
-  v->v_magic = MUGGLE(82);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(1840) : vertex_count-- ? 0 : FAIL(1841))
+  v->v_magic = MUGGLE(84);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2013) : vertex_count-- ? 0 : FAIL(2014))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(1842) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2015) : 0)
 	 return;
   free (v);
 }
@@ -88,9 +88,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(1843) : (a->v_magic != VERTEX_MAGIC) ? FAIL(1844) : 0)
+  if ((! a) ? FAIL(2016) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2017) : 0)
 	 return 0;
-  if ((! b) ? FAIL(1845) : (b->v_magic != VERTEX_MAGIC) ? FAIL(1846) : 0)
+  if ((! b) ? FAIL(2018) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2019) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -111,7 +111,7 @@ vertex_hash (v, err)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? FAIL(1847) : (v->v_magic != VERTEX_MAGIC) ? FAIL(1848) : 0)
+  if ((! v) ? FAIL(2020) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2021) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -139,7 +139,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(1849) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1850) : 0)
+  if ((! given_vertex) ? FAIL(2022) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2023) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -165,11 +165,11 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! local_vertex) ? FAIL(1851) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1852) : 0)
+  if (*err ? 1 : (! local_vertex) ? FAIL(2024) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2025) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(1853) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1854) : 0)
+  if ((! remote_vertex) ? FAIL(2026) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2027) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge)) ? FAIL(1855) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge)) ? FAIL(2028) : 0);
 }
 
 
@@ -189,9 +189,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(1856) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1857) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2029) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2030) : 0)
 	 return 0;
-  return ! ((edges_in != DIMENSION) ? FAIL(1858) : (edges_out != DIMENSION) ? FAIL(1859) : 0);
+  return ! ((edges_in != DIMENSION) ? FAIL(2031) : (edges_out != DIMENSION) ? FAIL(2032) : 0);
 }
 
 
@@ -210,7 +210,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(1860) : (s < r) ? FAIL(1861) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2033) : (s < r) ? FAIL(2034) : 0) ? 0 : s);
 }
 
 
@@ -240,11 +240,11 @@ valid (g, err)
 
 uintptr_t n;
 
-  if (((n = cru_vertex_count (g, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(1862))
+  if (((n = cru_vertex_count (g, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2035))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(1863))
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2036))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(1864))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2037))
 	 return 0;
   return 1;
 }
@@ -265,14 +265,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(1865);
+	 FAIL(2038);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(1866);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(1867) : 0)
+	 FAIL(2039);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2040) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(1868) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(1869) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(1870) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2041) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2042) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2043) : *err);
 }
 
 
@@ -312,9 +312,9 @@ main (argc, argv)
   v = valid (g, &err);
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
-  err = (vertex_count ? THE_FAIL(1871) : err);
+  err = (vertex_count ? THE_FAIL(2044) : err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(1872);
+	 err = THE_FAIL(2045);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
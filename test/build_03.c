@@ -49,14 +49,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(1873))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2046))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(1874) : ++edge_count ? 0 : FAIL(1875))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2047) : ++edge_count ? 0 : FAIL(2048))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(1876) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2049) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -77,12 +77,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(1877) : (e->e_magic != EDGE_MAGIC) ? FAIL(1878) : 0)
+  if ((! e) ? FAIL(2050) : (e->e_magic != EDGE_MAGIC) ? FAIL(2051) : 0)
 	 return;
-  e->e_magic = MUGGLE(83);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(1879) : edge_count-- ? 0 : FAIL(1880))
+  e->e_magic = MUGGLE(85);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2052) : edge_count-- ? 0 : FAIL(2053))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(1881) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2054) : 0)
 	 return;
   free (e);
 }
@@ -102,9 +102,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(1882) : (a->e_magic != EDGE_MAGIC) ? FAIL(1883) : 0)
+  if ((! a) ? FAIL(2055) : (a->e_magic != EDGE_MAGIC) ? FAIL(2056) : 0)
 	 return 0;
-  if ((! b) ? FAIL(1884) : (b->e_magic != EDGE_MAGIC) ? FAIL(1885) : 0)
+  if ((! b) ? FAIL(2057) : (b->e_magic != EDGE_MAGIC) ? FAIL(2058) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -126,7 +126,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(1886) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(1887) : 0)
+  if ((! e) ? GLOBAL_FAIL(2059) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2060) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -150,14 +150,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(1888))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2061))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(1889) : ++vertex_count ? 0 : FAIL(1890))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2062) : ++vertex_count ? 0 : FAIL(2063))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(1891) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2064) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -179,12 +179,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(1892) : (v->v_magic != VERTEX_MAGIC) ? FAIL(1893) : 0)
+  if ((! v) ? FAIL(2065) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2066) : 0)
 	 return;
-  v->v_magic = MUGGLE(84);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(1894) : vertex_count-- ? 0 : FAIL(1895))
+  v->v_magic = MUGGLE(86);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2067) : vertex_count-- ? 0 : FAIL(2068))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(1896) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2069) : 0)
 	 return;
   free (v);
 }
@@ -205,9 +205,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(1897) : (a->v_magic != VERTEX_MAGIC) ? FAIL(1898) : 0)
+  if ((! a) ? FAIL(2070) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2071) : 0)
 	 return 0;
-  if ((! b) ? FAIL(1899) : (b->v_magic != VERTEX_MAGIC) ? FAIL(1900) : 0)
+  if ((! b) ? FAIL(2072) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2073) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -230,7 +230,7 @@ vertex_hash (v, err)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? FAIL(1901) : (v->v_magic != VERTEX_MAGIC) ? FAIL(1902) : 0)
+  if ((! v) ? FAIL(2074) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2075) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -259,7 +259,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(1903) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1904) : 0)
+  if ((! given_vertex) ? FAIL(2076) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2077) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -285,13 +285,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(1905) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(1906) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2078) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2079) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(1907) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1908) : 0)
+  if ((! local_vertex) ? FAIL(2080) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2081) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(1909) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1910) : 0)
+  if ((! remote_vertex) ? FAIL(2082) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2083) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(1911) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(2084) : 0);
 }
 
 
@@ -311,9 +311,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(1912) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1913) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2085) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2086) : 0)
 	 return 0;
-  return ! ((edges_in != DIMENSION) ? FAIL(1914) : (edges_out != DIMENSION) ? FAIL(1915) : 0);
+  return ! ((edges_in != DIMENSION) ? FAIL(2087) : (edges_out != DIMENSION) ? FAIL(2088) : 0);
 }
 
 
@@ -332,7 +332,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(1916) : (s < r) ? FAIL(1917) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2089) : (s < r) ? FAIL(2090) : 0) ? 0 : s);
 }
 
 
@@ -360,11 +360,11 @@ valid (g, err)
 		  .reduction = (cru_bop) sum,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(1918))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2091))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(1919))
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2092))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(1920))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2093))
 	 return 0;
   return 1;
 }
@@ -385,14 +385,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(1921);
+	 FAIL(2094);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(1922);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(1923) : 0)
+	 FAIL(2095);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2096) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(1924) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(1925) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(1926) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2097) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2098) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2099) : *err);
 }
 
 
@@ -438,11 +438,11 @@ main (argc, argv)
   v = valid (g, &err);
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
-  err = (edge_count ? THE_FAIL(1927) : vertex_count ? THE_FAIL(1928) : err);
+  err = (edge_count ? THE_FAIL(2100) : vertex_count ? THE_FAIL(2101) : err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(1929);
+	 err = THE_FAIL(2102);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(1930);
+	 err = THE_FAIL(2103);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
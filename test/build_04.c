@@ -50,14 +50,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(1931))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2104))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(1932) : ++edge_count ? 0 : FAIL(1933))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2105) : ++edge_count ? 0 : FAIL(2106))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(1934) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2107) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -79,12 +79,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(1935) : (e->e_magic != EDGE_MAGIC) ? FAIL(1936) : 0)
+  if ((! e) ? FAIL(2108) : (e->e_magic != EDGE_MAGIC) ? FAIL(2109) : 0)
 	 return;
-  e->e_magic = MUGGLE(85);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(1937) : edge_count-- ? 0 : FAIL(1938))
+  e->e_magic = MUGGLE(87);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2110) : edge_count-- ? 0 : FAIL(2111))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(1939) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2112) : 0)
 	 return;
   free (e);
 }
@@ -105,9 +105,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(1940) : (a->e_magic != EDGE_MAGIC) ? FAIL(1941) : 0)
+  if ((! a) ? FAIL(2113) : (a->e_magic != EDGE_MAGIC) ? FAIL(2114) : 0)
 	 return 0;
-  if ((! b) ? FAIL(1942) : (b->e_magic != EDGE_MAGIC) ? FAIL(1943) : 0)
+  if ((! b) ? FAIL(2115) : (b->e_magic != EDGE_MAGIC) ? FAIL(2116) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -129,7 +129,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(1944) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(1945) : 0)
+  if ((! e) ? GLOBAL_FAIL(2117) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2118) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -154,14 +154,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(1946))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2119))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(1947) : ++vertex_count ? 0 : FAIL(1948))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2120) : ++vertex_count ? 0 : FAIL(2121))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(1949) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2122) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -180,12 +180,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(1950) : (v->v_magic != VERTEX_MAGIC) ? FAIL(1951) : 0)
+  if ((! v) ? FAIL(2123) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2124) : 0)
 	 return;
-  v->v_magic = MUGGLE(86);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(1952) : vertex_count-- ? 0 : FAIL(1953))
+  v->v_magic = MUGGLE(88);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2125) : vertex_count-- ? 0 : FAIL(2126))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(1954) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2127) : 0)
 	 return;
   free (v);
 }
@@ -206,9 +206,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(1955) : (a->v_magic != VERTEX_MAGIC) ? FAIL(1956) : 0)
+  if ((! a) ? FAIL(2128) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2129) : 0)
 	 return 0;
-  if ((! b) ? FAIL(1957) : (b->v_magic != VERTEX_MAGIC) ? FAIL(1958) : 0)
+  if ((! b) ? FAIL(2130) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2131) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -230,7 +230,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(1959) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(1960) : 0)
+  if ((! v) ? GLOBAL_FAIL(2132) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2133) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -261,19 +261,19 @@ building_rule (initial, incident, given_vertex, err)
 {
   uintptr_t i, e;
 
-  if ((! given_vertex) ? FAIL(1961) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1962) : 0)
+  if ((! given_vertex) ? FAIL(2134) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2135) : 0)
 	 return;
   if (initial)
 	 {
-		if (given_vertex->v_value ? FAIL(1963) : 0)
+		if (given_vertex->v_value ? FAIL(2136) : 0)
 		  return;
-		if (incident ? FAIL(1964) : 0)
+		if (incident ? FAIL(2137) : 0)
 		  return;
 		e = 0;            // the incident edge is ignored
 	 }
   else
 	 {
-		if ((! incident) ? FAIL(1965) : (incident->e_magic != EDGE_MAGIC) ? FAIL(1966) : 0)
+		if ((! incident) ? FAIL(2138) : (incident->e_magic != EDGE_MAGIC) ? FAIL(2139) : 0)
 		  return;
 		e = incident->e_value;
 	 }
@@ -300,13 +300,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(1967) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(1968) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2140) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2141) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(1969) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1970) : 0)
+  if ((! local_vertex) ? FAIL(2142) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2143) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(1971) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1972) : 0)
+  if ((! remote_vertex) ? FAIL(2144) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2145) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(1973) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(2146) : 0);
 }
 
 
@@ -329,9 +329,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 {
 #define USUAL (DIMENSION >> (1 - (DIMENSION & 1)))
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(1974) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(1975) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2147) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2148) : 0)
 	 return 0;
-  return ! ((edges_in != USUAL) ? FAIL(1976) : (edges_out != USUAL) ? FAIL(1977) : 0);
+  return ! ((edges_in != USUAL) ? FAIL(2149) : (edges_out != USUAL) ? FAIL(2150) : 0);
 }
 
 
@@ -350,7 +350,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(1978) : (s < r) ? FAIL(1979) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2151) : (s < r) ? FAIL(2152) : 0) ? 0 : s);
 }
 
 
@@ -378,11 +378,11 @@ valid (g, err)
 		  .reduction = (cru_bop) sum,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(1980))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2153))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (NUMBER_OF_VERTICES * (((uintptr_t) DIMENSION) >> (1 - (DIMENSION & 1))))) ? 0 : FAIL(1981))
+  if ((cru_edge_count (g, LANES, err) == (NUMBER_OF_VERTICES * (((uintptr_t) DIMENSION) >> (1 - (DIMENSION & 1))))) ? 0 : FAIL(2154))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(1982))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2155))
 	 return 0;
   return 1;
 }
@@ -403,14 +403,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(1983);
+	 FAIL(2156);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(1984);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(1985) : 0)
+	 FAIL(2157);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2158) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(1986) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(1987) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(1988) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2159) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2160) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2161) : *err);
 }
 
 
@@ -457,11 +457,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(1989) : vertex_count ? THE_FAIL(1990) : global_err);
+	 err = (edge_count ? THE_FAIL(2162) : vertex_count ? THE_FAIL(2163) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(1991);
+	 err = THE_FAIL(2164);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(1992);
+	 err = THE_FAIL(2165);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
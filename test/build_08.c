@@ -0,0 +1,278 @@
+// Create a hypercubic graph with endogenous vertices and labels using
+// a partitioner that assigns neighboring vertices to the same worker
+// and check that it's all there, then check that an error reported by
+// the partitioner fails the build.
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <cru.h>
+#include "readme.h"
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero. This function cast to a
+	  // cru_connector is passed to the cru library as b.connector in
+	  // the builder b.
+{
+  uintptr_t outgoing_edge;
+  uintptr_t remote_vertex;
+
+  for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
+	 {
+		remote_vertex = (given_vertex ^ (uintptr_t) (1 << outgoing_edge));
+		cru_connect ((cru_edge) outgoing_edge, (cru_vertex) remote_vertex, err);
+	 }
+}
+
+
+
+
+
+
+uintptr_t
+vertex_hash (v)
+	  uintptr_t v;
+
+	  // Use the vertex itself as its hash so that the partitioner can
+	  // tell which vertices are close together. This function cast to
+	  // a cru_hash is passed to the cru library as
+	  // b.bu_sig.orders.v_order.hash in the builder b.
+{
+  return v;
+}
+
+
+
+
+
+
+int
+equal_vertices (a, b, err)
+	  uintptr_t a;
+	  uintptr_t b;
+	  int *err;
+
+	  // Compare two vertices for equality. This function cast to a
+	  // cru_bpred is passed to the cru library as
+	  // b.bu_sig.orders.v_order.equal in the builder b.
+{
+  return a == b;
+}
+
+
+
+
+
+
+unsigned
+partitioner (hash, lanes, err)
+	  uintptr_t hash;
+	  unsigned lanes;
+	  int *err;
+
+	  // Assign vertices differing only in their two least significant
+	  // bits to the same worker. The result may exceed the number of
+	  // lanes, in which case the cru library reduces it. This function
+	  // cast to a cru_partitioner is passed to the cru library as
+	  // b.partitioner in the builder b.
+{
+  return (unsigned) (hash >> 2);
+}
+
+
+
+
+
+
+
+
+
+
+unsigned
+refusing_partitioner (hash, lanes, err)
+	  uintptr_t hash;
+	  unsigned lanes;
+	  int *err;
+
+	  // Report an error for the last vertex and otherwise assign
+	  // vertices as above.
+{
+  if (hash == NUMBER_OF_VERTICES - 1)
+	 *err = EDOM;
+  return partitioner (hash, lanes, err);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  uintptr_t local_vertex;
+	  uintptr_t connecting_edge;
+	  uintptr_t remote_vertex;
+	  int *err;
+
+	  // Return 1 if an edge is labeled by the index of the bit in
+	  // which its endpoints differ, and 0 otherwise.
+{
+  return ! (*err ? 1 : ((local_vertex ^ remote_vertex) != (1 << connecting_edge)) ? FAIL(2196) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t 
+vertex_checker (edges_in, vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  uintptr_t vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Validate a vertex based on the incoming and outgoing
+	  // edges being valid.
+{
+  return ! (*err ? 1 : (edges_in != DIMENSION) ? FAIL(2197) : (edges_out != DIMENSION) ? FAIL(2198) : 0);
+}
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers, checking for overflow and
+	  // other errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2199) : (s < r) ? FAIL(2200) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check for correct vertex counts, edge counts, and edge labels.
+{
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.incident = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker},
+		.outgoing = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2201))
+	 return 0;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2202))
+	 return 0;
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2203))
+	 return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+int
+refused (b, err)
+	  cru_builder b;
+	  int *err;
+
+	  // Build a graph with a partitioner that reports an error, which
+	  // is expected to be reported by the build.
+{
+  cru_graph g;
+  int v;
+
+  if (*err)
+	 return 0;
+  b->partitioner = (cru_partitioner) refusing_partitioner;
+  v = ! (g = cru_built (b, 0, UNKILLABLE, LANES, err));
+  cru_free_now (g, LANES, err);
+  if (*err == EDOM)
+	 *err = 0;
+  else if (! *err)
+	 v = 0;
+  return v;
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  cru_graph g;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule,
+	 .bu_sig = {
+		.orders = {
+		  .v_order = {
+			 .hash = (cru_hash) vertex_hash,
+			 .equal = (cru_bpred) equal_vertices}}},
+	 .partitioner = (cru_partitioner) partitioner};
+
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  g = cru_built (&b, 0, UNKILLABLE, LANES, &err);
+  v = valid (g, &err);
+  cru_free_now (g, LANES, &err);
+  v = (v ? refused (&b, &err) : 0);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
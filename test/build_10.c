@@ -0,0 +1,167 @@
+// Create a hypercubic graph whose connector declares every edge
+// twice with the same label, and check that the duplicates are
+// removed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cru.h>
+#include "readme.h"
+
+// the label on every edge
+#define TAU 0
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare two identically labeled outgoing edges from the given
+	  // vertex along each dimensional axis to a vertex whose binary
+	  // encoding differs from that of the given vertex in exactly one
+	  // bit.
+{
+  uintptr_t outgoing_edge;
+  uintptr_t remote_vertex;
+
+  for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
+	 {
+		remote_vertex = (given_vertex ^ (uintptr_t) (1 << outgoing_edge));
+		cru_connect ((cru_edge) TAU, (cru_vertex) remote_vertex, err);
+		cru_connect ((cru_edge) TAU, (cru_vertex) remote_vertex, err);
+	 }
+}
+
+
+
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  uintptr_t local_vertex;
+	  uintptr_t connecting_edge;
+	  uintptr_t remote_vertex;
+	  int *err;
+
+	  // Return 1 if an edge is labeled TAU and its endpoints differ in
+	  // exactly one bit, and 0 otherwise.
+{
+  uintptr_t x;
+
+  if (*err ? 1 : (connecting_edge != TAU) ? FAIL(2212) : (x = local_vertex ^ remote_vertex) ? 0 : FAIL(2213))
+	 return 0;
+  return ! ((x & (x - 1)) ? FAIL(2214) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t 
+vertex_checker (edges_in, vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  uintptr_t vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Validate a vertex based on the incoming and outgoing
+	  // edges being valid.
+{
+  return ! (*err ? 1 : (edges_in != DIMENSION) ? FAIL(2215) : (edges_out != DIMENSION) ? FAIL(2216) : 0);
+}
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers, checking for overflow and
+	  // other errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2217) : (s < r) ? FAIL(2218) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check for correct vertex counts, edge counts, and edge labels.
+{
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.incident = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker},
+		.outgoing = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2219))
+	 return 0;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2220))
+	 return 0;
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2221))
+	 return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  cru_graph g;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule};
+
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  g = cru_built (&b, 0, UNKILLABLE, LANES, &err);
+  v = valid (g, &err);
+  cru_free_now (g, LANES, &err);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
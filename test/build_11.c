@@ -0,0 +1,231 @@
+// Create hypercubic graphs with endogenous vertices and labels from
+// multiple seeds, once from the heap and once in arena mode, by
+// connecting a base vertex outside the hypercube to every seventh
+// vertex twice over, and check that the duplicate seeds are ignored
+// and that everything else is there. Also check that a graph built
+// from no seeds has only the base vertex.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cru.h>
+#include "readme.h"
+
+// a vertex not in the hypercube
+#define BASE NUMBER_OF_VERTICES
+
+// the label on edges from the base vertex
+#define SEED_LABEL DIMENSION
+
+// every SPACING-th vertex in the hypercube is a seed
+#define SPACING 7
+
+// the number of distinct seeds
+#define SEEDS ((NUMBER_OF_VERTICES - 1) / SPACING + 1)
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero.
+{
+  uintptr_t axis;
+
+  if ((given_vertex == BASE) ? FAIL(2222) : 0)
+	 return;
+  for (axis = 0; axis < DIMENSION; axis++)
+	 cru_connect ((cru_edge) axis, (cru_vertex) (given_vertex ^ (uintptr_t) (1 << axis)), err);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  uintptr_t local_vertex;
+	  uintptr_t connecting_edge;
+	  uintptr_t remote_vertex;
+	  int *err;
+
+	  // Return 1 if an edge is labeled by the index of the bit in
+	  // which its endpoints differ or if it's a seed edge from the
+	  // base, and 0 otherwise.
+{
+  if (*err)
+	 return 0;
+  if ((local_vertex == BASE) ? 1 : (remote_vertex == BASE))
+	 return ! ((connecting_edge != SEED_LABEL) ? FAIL(2223) : ((local_vertex ^ remote_vertex ^ BASE) % SPACING) ? FAIL(2224) : 0);
+  return ! (((local_vertex ^ remote_vertex) != (1 << connecting_edge)) ? FAIL(2225) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+vertex_checker (edges_in, vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  uintptr_t vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Validate a vertex based on the incoming and outgoing
+	  // edges being valid.
+{
+  if (*err)
+	 return 0;
+  if (vertex == BASE)
+	 return ! (edges_in ? FAIL(2226) : (edges_out != SEEDS) ? FAIL(2227) : 0);
+  return ! ((edges_in != DIMENSION + ! (vertex % SPACING)) ? FAIL(2228) : (edges_out != DIMENSION) ? FAIL(2229) : 0);
+}
+
+
+
+
+
+
+uintptr_t
+null (err)
+	  int *err;
+
+	  // Unconditionally return zero. This function is used as the
+	  // vacuous case for the incident edges of the base vertex.
+{
+  return 0;
+}
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers, checking for overflow and
+	  // other errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2230) : (s < r) ? FAIL(2231) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check for correct vertex counts, edge counts, and edge labels.
+{
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.incident = {
+		  .vacuous_case = (cru_nop) null,
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker},
+		.outgoing = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES + 1) ? 0 : FAIL(2232))
+	 return 0;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES + SEEDS) ? 0 : FAIL(2233))
+	 return 0;
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES + 1) ? 0 : FAIL(2234))
+	 return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+cru_graph
+seeded (b, err)
+	  cru_builder b;
+	  int *err;
+
+	  // Build a graph from the base vertex with an edge to each seed,
+	  // and then another edge to each seed.
+{
+  cru_vertex termini[2 * SEEDS];
+  cru_edge labels[2 * SEEDS];
+  uintptr_t i;
+
+  for (i = 0; i < 2 * SEEDS; i++)
+	 {
+		labels[i] = (cru_edge) SEED_LABEL;
+		termini[i] = (cru_vertex) ((i % SEEDS) * SPACING);
+	 }
+  return cru_built_from (b, (cru_vertex) BASE, labels, termini, (size_t) (2 * SEEDS), UNKILLABLE, LANES, err);
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  cru_graph g;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule};
+
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  g = seeded (&b, &err);
+  v = valid (g, &err);
+  cru_free_now (g, LANES, &err);
+  b.bu_sig.arena = 1;
+  g = seeded (&b, &err);
+  v = (v ? valid (g, &err) : 0);
+  cru_free_now (g, LANES, &err);
+  g = cru_built_from (&b, (cru_vertex) BASE, NULL, NULL, (size_t) 0, UNKILLABLE, LANES, &err);
+  v = (v ? (cru_vertex_count (g, LANES, &err) == 1) : 0);
+  cru_free_now (g, LANES, &err);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
@@ -0,0 +1,146 @@
+// Create a hypercubic graph with a discoverer and check that it sees
+// every vertex exactly once before the build finishes, then build it
+// again with a stopper that's true of only one vertex and check that
+// the build is stopped.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cru.h>
+#include "readme.h"
+
+// the vertex whose discovery stops the second build
+#define VIOLATION (NUMBER_OF_VERTICES - 1)
+
+// the number of times each vertex has been discovered
+static uintptr_t discoveries[NUMBER_OF_VERTICES];
+
+// non-zero when the stopper has been true
+static int stopped = 0;
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero.
+{
+  uintptr_t axis;
+
+  for (axis = 0; axis < DIMENSION; axis++)
+	 cru_connect ((cru_edge) axis, (cru_vertex) (given_vertex ^ (uintptr_t) (1 << axis)), err);
+}
+
+
+
+
+
+
+
+
+void
+discoverer (vertex, err)
+	  uintptr_t vertex;
+	  int *err;
+
+	  // Count the discoveries of each vertex.
+{
+  if ((vertex < NUMBER_OF_VERTICES) ? 0 : FAIL(2235))
+	 return;
+  __atomic_fetch_add (&(discoveries[vertex]), 1, __ATOMIC_RELAXED);
+}
+
+
+
+
+
+
+
+
+int
+stopper (vertex, err)
+	  uintptr_t vertex;
+	  int *err;
+
+	  // Stop the build when the violating vertex is discovered.
+{
+  if (vertex != VIOLATION)
+	 return 0;
+  __atomic_store_n (&stopped, 1, __ATOMIC_RELAXED);
+  return 1;
+}
+
+
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check that the graph is complete and that every vertex in it
+	  // was discovered exactly once.
+{
+  uintptr_t i;
+
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2236))
+	 return 0;
+  for (i = 0; i < NUMBER_OF_VERTICES; i++)
+	 if ((discoveries[i] == 1) ? 0 : FAIL(2237))
+		return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  cru_graph g;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule,
+	 .discoverer = (cru_discoverer) discoverer};
+
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  g = cru_built (&b, 0, UNKILLABLE, LANES, &err);
+  v = valid (g, &err);
+  cru_free_now (g, LANES, &err);
+  b.stopper = (cru_upred) stopper;
+  g = (err ? NULL : cru_built (&b, 0, UNKILLABLE, LANES, &err));
+  if (err == CRU_INTKIL)
+	 err = 0;
+  else if (! err)
+	 v = 0;
+  v = (v ? (! g) ? stopped : 0 : 0);
+  cru_free_now (g, LANES, &err);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
@@ -0,0 +1,137 @@
+// Create a hypercubic graph with a depth limit, once from the heap and
+// once in arena mode, and check that it has exactly the vertices
+// within the limit of the initial vertex and that those at the limit
+// have no outgoing edges. Then spread it without a limit and check
+// that the whole hypercube is there.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cru.h>
+#include "readme.h"
+
+// the maximum distance of any vertex from the initial vertex
+#define DEPTH_LIMIT 3
+
+// the number of vertices within the limit, which is the sum of the
+// binomial coefficients (DIMENSION k) for k up to DEPTH_LIMIT
+#define LIMITED_VERTICES (1 + 6 + 15 + 20)
+
+// the number of vertices at the limit
+#define LEAVES 20
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero. Vertices at the limit should
+	  // never get this far.
+{
+  uintptr_t axis, depth;
+
+  for (depth = 0, axis = 0; axis < DIMENSION; axis++)
+	 depth += ! ! (given_vertex & (uintptr_t) (1 << axis));
+  if ((depth < DEPTH_LIMIT) ? 0 : FAIL(2238))
+	 return;
+  for (axis = 0; axis < DIMENSION; axis++)
+	 cru_connect ((cru_edge) axis, (cru_vertex) (given_vertex ^ (uintptr_t) (1 << axis)), err);
+}
+
+
+
+
+
+
+
+
+void
+spreading_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare the same edges as the building rule without checking
+	  // the depth.
+{
+  uintptr_t axis;
+
+  for (axis = 0; axis < DIMENSION; axis++)
+	 cru_connect ((cru_edge) axis, (cru_vertex) (given_vertex ^ (uintptr_t) (1 << axis)), err);
+}
+
+
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check the vertex, edge, and terminus counts of a depth limited
+	  // build and then spread it.
+{
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) spreading_rule};
+
+  if ((cru_vertex_count (g, LANES, err) == LIMITED_VERTICES) ? 0 : FAIL(2239))
+	 goto a;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * (LIMITED_VERTICES - LEAVES)) ? 0 : FAIL(2240))
+	 goto a;
+  if ((cru_terminus_count (g, LANES, err) == LEAVES) ? 0 : FAIL(2241))
+	 goto a;
+  if (! (g = cru_spread (g, &b, UNKILLABLE, LANES, err)))
+	 return 0;
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2242))
+	 goto a;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2243))
+	 goto a;
+  cru_free_now (g, LANES, err);
+  return 1;
+ a: cru_free_now (g, LANES, err);
+  return 0;
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule,
+	 .depth_limit = DEPTH_LIMIT};
+
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  v = valid (cru_built (&b, 0, UNKILLABLE, LANES, &err), &err);
+  b.bu_sig.arena = 1;
+  v = (v ? valid (cru_built (&b, 0, UNKILLABLE, LANES, &err), &err) : 0);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
@@ -0,0 +1,222 @@
+// Create hypercubic graphs with a partitioner that assigns every
+// vertex to the same worker and check that a vertex limit equal to the
+// number of vertices is still enough. Then check that a smaller limit
+// is reported as an overflow, and that a partial build with the
+// smaller limit stops at exactly that many vertices with no edges to
+// any vertices left out, once from the heap and once in arena mode.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cru.h>
+#include "readme.h"
+
+// the number of vertices in a partial build
+#define PARTIAL_VERTICES 40
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero.
+{
+  uintptr_t axis;
+
+  for (axis = 0; axis < DIMENSION; axis++)
+	 cru_connect ((cru_edge) axis, (cru_vertex) (given_vertex ^ (uintptr_t) (1 << axis)), err);
+}
+
+
+
+
+
+
+
+
+unsigned
+partitioner (hash, lanes, err)
+	  uintptr_t hash;
+	  unsigned lanes;
+	  int *err;
+
+	  // Assign every vertex to the first worker, which would have
+	  // overflowed a limit divided evenly among the workers.
+{
+  return 0;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  uintptr_t local_vertex;
+	  uintptr_t connecting_edge;
+	  uintptr_t remote_vertex;
+	  int *err;
+
+	  // Return 1 if an edge is labeled by the index of the bit in
+	  // which its endpoints differ, and 0 otherwise.
+{
+  if (*err)
+	 return 0;
+  return ! ((remote_vertex >= NUMBER_OF_VERTICES) ? FAIL(2244) : ((local_vertex ^ remote_vertex) != (1 << connecting_edge)) ? FAIL(2245) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+vertex_checker (edges_in, vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  uintptr_t vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Return the number of valid outgoing edges from a vertex.
+{
+  if (*err ? 1 : (vertex >= NUMBER_OF_VERTICES) ? FAIL(2246) : (edges_in > DIMENSION) ? FAIL(2247) : (edges_out > DIMENSION) ? FAIL(2248) : 0)
+	 return 0;
+  return edges_out;
+}
+
+
+
+
+
+
+uintptr_t
+null (err)
+	  int *err;
+
+	  // Unconditionally return zero. This function is used as the
+	  // vacuous case for vertices whose edges were all left out.
+{
+  return 0;
+}
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers, checking for overflow and
+	  // other errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2249) : (s < r) ? FAIL(2250) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+
+
+int
+valid (g, n, err)
+	  cru_graph g;
+	  uintptr_t n;
+	  int *err;
+
+	  // Check that a graph has n vertices, that all of its edges are
+	  // valid, and that its edge count agrees with a traversal.
+{
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.incident = {
+		  .vacuous_case = (cru_nop) null,
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker},
+		.outgoing = {
+		  .vacuous_case = (cru_nop) null,
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+  uintptr_t e;
+
+  if (! g)
+	 return 0;
+  if ((cru_vertex_count (g, LANES, err) == n) ? 0 : FAIL(2251))
+	 goto a;
+  e = cru_edge_count (g, LANES, err);
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == e) ? 0 : FAIL(2252))
+	 goto a;
+  cru_free_now (g, LANES, err);
+  return 1;
+ a: cru_free_now (g, LANES, err);
+  return 0;
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  cru_graph g;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule,
+	 .partitioner = (cru_partitioner) partitioner,
+	 .bu_sig = {
+		.vertex_limit = NUMBER_OF_VERTICES}};
+
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  v = valid (cru_built (&b, 0, UNKILLABLE, LANES, &err), NUMBER_OF_VERTICES, &err);
+  b.bu_sig.vertex_limit = PARTIAL_VERTICES;
+  g = (err ? NULL : cru_built (&b, 0, UNKILLABLE, LANES, &err));
+  if (err == CRU_INTOVF)
+	 err = 0;
+  else if (! err)
+	 v = 0;
+  v = (v ? ! g : 0);
+  cru_free_now (g, LANES, &err);
+  b.partial = 1;
+  v = (v ? valid (cru_built (&b, 0, UNKILLABLE, LANES, &err), PARTIAL_VERTICES, &err) : 0);
+  b.bu_sig.arena = 1;
+  v = (v ? valid (cru_built (&b, 0, UNKILLABLE, LANES, &err), PARTIAL_VERTICES, &err) : 0);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
@@ -0,0 +1,164 @@
+// Create a hypercubic graph with a priority function and check that
+// it's all there. Then build it best first with a partial vertex
+// limit by a single worker, ranking vertices by their binary
+// encodings, and check that the limit is filled by exactly the least
+// vertices. Every other vertex is adjacent to a lesser one, so a
+// best first build reaches them in order, whereas a breadth first
+// build wouldn't.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cru.h>
+#include "readme.h"
+
+// the number of vertices in a best first partial build
+#define LEAST_VERTICES 22
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero.
+{
+  uintptr_t axis;
+
+  for (axis = 0; axis < DIMENSION; axis++)
+	 cru_connect ((cru_edge) axis, (cru_vertex) (given_vertex ^ (uintptr_t) (1 << axis)), err);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+rank (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Rank a vertex by its binary encoding.
+{
+  return given_vertex;
+}
+
+
+
+
+
+
+
+
+unsigned
+partitioner (hash, lanes, err)
+	  uintptr_t hash;
+	  unsigned lanes;
+	  int *err;
+
+	  // Assign every vertex to the first worker so that the order of
+	  // building is determined only by the priorities.
+{
+  return 0;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+least_vertices (edges_in, vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  uintptr_t vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Return 1 for a vertex among the least ones and fail
+	  // otherwise.
+{
+  if (*err ? 1 : (vertex >= LEAST_VERTICES) ? FAIL(2253) : (edges_out > DIMENSION) ? FAIL(2254) : 0)
+	 return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers, checking for overflow and
+	  // other errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2255) : (s < r) ? FAIL(2256) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  cru_graph g;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule,
+	 .priority = (cru_uop) rank};
+
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) least_vertices}}};
+
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  g = cru_built (&b, 0, UNKILLABLE, LANES, &err);
+  v = (cru_vertex_count (g, LANES, &err) == NUMBER_OF_VERTICES);
+  v = (v ? (cru_edge_count (g, LANES, &err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) : 0);
+  cru_free_now (g, LANES, &err);
+  b.partitioner = (cru_partitioner) partitioner;
+  b.bu_sig.vertex_limit = LEAST_VERTICES;
+  b.partial = 1;
+  g = (err ? NULL : cru_built (&b, 0, UNKILLABLE, LANES, &err));
+  v = (v ? (cru_vertex_count (g, LANES, &err) == LEAST_VERTICES) : 0);
+  v = (v ? (((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, &err)) == LEAST_VERTICES) : 0);
+  cru_free_now (g, LANES, &err);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
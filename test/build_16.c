@@ -0,0 +1,371 @@
+// Create a hypercubic graph with exogenous vertices and a
+// canonicalizing function that identifies all vertices with the same
+// number of bits set, so that the graph collapses to a path of
+// DIMENSION + 1 vertices with DIMENSION edges out of each. Check that
+// it's all there and that every vertex replaced by its canonical
+// representative is reclaimed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <nthm/nthm.h>
+#include <cru.h>
+#include "readme.h"
+
+
+// a count of allocated vertices to detect memory leaks
+static uintptr_t vertex_count;
+
+// needed to lock the count
+static pthread_mutex_t vertex_lock;
+
+#define VERTEX_MAGIC 1370635490
+
+
+typedef struct vertex_s
+{
+  int v_magic;              // arbitrary constant used to detect double-free errors
+  uintptr_t v_value;
+} *vertex;
+
+
+
+
+vertex
+vertex_of (n, err)
+	  uintptr_t n;
+	  int *err;
+
+	  // Create a vertex.
+{
+  vertex v;
+
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2257))
+	 return NULL;
+  memset (v, 0, sizeof (*v));
+  v->v_magic = VERTEX_MAGIC;
+  v->v_value = n;
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2258) : ++vertex_count ? 0 : FAIL(2259))
+	 goto a;
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2260) : 0))
+	 return v;
+ a: free (v);
+  return NULL;
+}
+
+
+
+
+
+void
+free_vertex (v, err)
+	  vertex v;
+	  int *err;
+
+	  // Reclaim a vertex.
+{
+  if ((! v) ? FAIL(2261) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2262) : 0)
+	 return;
+  v->v_magic = MUGGLE(89);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2263) : vertex_count-- ? 0 : FAIL(2264))
+	 return;
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2265) : 0)
+	 return;
+  free (v);
+}
+
+
+
+
+
+
+int
+equal_vertices (a, b, err)
+	  vertex a;
+	  vertex b;
+	  int *err;
+
+	  // Compare two vertices and return non-zero if they are equal.
+{
+  if ((! a) ? FAIL(2266) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2267) : 0)
+	 return 0;
+  if ((! b) ? FAIL(2268) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2269) : 0)
+	 return 0;
+  return a->v_value == b->v_value;
+}
+
+
+
+
+
+uintptr_t
+vertex_hash (v, err)
+	  vertex v;
+	  int *err;
+
+	  // Mix up low-entropy numeric values.
+{
+  size_t i;
+  uintptr_t u;
+
+  if ((! v) ? FAIL(2270) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2271) : 0)
+	 return 0;
+  u = v->v_value;
+  for (i = 0; i < sizeof (u); i++)  // ignore overflow
+	 u += (u + 1) << 8;
+  return (u << HALF_POINTER_WIDTH) | (u >> HALF_POINTER_WIDTH);
+}
+
+
+
+
+
+
+uintptr_t
+weight (n)
+	  uintptr_t n;
+
+	  // Return the number of bits set in n.
+{
+  uintptr_t axis, w;
+
+  for (w = 0, axis = 0; axis < DIMENSION; axis++)
+	 w += ! ! (n & (uintptr_t) (1 << axis));
+  return w;
+}
+
+
+
+
+
+
+vertex
+canonical (given_vertex, err)
+	  vertex given_vertex;
+	  int *err;
+
+	  // Return the given vertex if its set bits are the lowest ones,
+	  // and otherwise a new vertex with the same number of bits set
+	  // in the lowest positions. This function cast to a cru_uop is
+	  // passed to the cru library as b.canonical in the builder b.
+{
+  uintptr_t c;
+
+  if ((! given_vertex) ? FAIL(2272) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2273) : 0)
+	 return NULL;
+  if ((c = ((uintptr_t) 1 << weight (given_vertex->v_value)) - 1) == given_vertex->v_value)
+	 return given_vertex;
+  return vertex_of (c, err);
+}
+
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  vertex given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero. Only canonical vertices should
+	  // get this far.
+{
+  uintptr_t outgoing_edge;
+  vertex remote_vertex;
+
+  if ((! given_vertex) ? FAIL(2274) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2275) : 0)
+	 return;
+  if ((given_vertex->v_value == ((uintptr_t) 1 << weight (given_vertex->v_value)) - 1) ? 0 : FAIL(2276))
+	 return;
+  for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
+	 {
+		remote_vertex = vertex_of (given_vertex->v_value ^ (uintptr_t) (1 << outgoing_edge), err);
+		cru_connect ((cru_edge) outgoing_edge, remote_vertex, err);
+	 }
+}
+
+
+
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  vertex local_vertex;
+	  uintptr_t connecting_edge;
+	  vertex remote_vertex;
+	  int *err;
+
+	  // Return 1 if the numbers of bits set in the endpoints of an
+	  // edge differ by one, and 0 otherwise.
+{
+  uintptr_t l, r;
+
+  if (*err ? 1 : (! local_vertex) ? FAIL(2277) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2278) : 0)
+	 return 0;
+  if ((! remote_vertex) ? FAIL(2279) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2280) : 0)
+	 return 0;
+  l = weight (local_vertex->v_value);
+  r = weight (remote_vertex->v_value);
+  return ! (((l + 1 == r) ? 0 : (r + 1 != l)) ? FAIL(2281) : (connecting_edge >= DIMENSION) ? FAIL(2282) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+vertex_checker (edges_in, given_vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  vertex given_vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Validate a vertex based on its outgoing edges being valid.
+{
+  if (*err ? 1 : (! given_vertex) ? FAIL(2283) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2284) : 0)
+	 return 0;
+  return ! ((! edges_in) ? FAIL(2285) : (edges_out != DIMENSION) ? FAIL(2286) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers checking for overflow and other
+	  // errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2287) : (s < r) ? FAIL(2288) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check for correct vertex counts, edge counts, and edge labels.
+{
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.incident = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker},
+		.outgoing = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+
+  if ((cru_vertex_count (g, LANES, err) == (uintptr_t) (DIMENSION + 1)) ? 0 : FAIL(2289))
+	 return 0;
+  if ((cru_edge_count (g, LANES, err) == (uintptr_t) (DIMENSION * (DIMENSION + 1))) ? 0 : FAIL(2290))
+	 return 0;
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == (uintptr_t) (DIMENSION + 1)) ? 0 : FAIL(2291))
+	 return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+int
+initialized (count, lock, lock_created, err)
+	  uintptr_t *count;
+	  pthread_mutex_t *lock;
+	  int *lock_created;
+	  int *err;
+{
+  pthread_mutexattr_t mutex_attribute;
+
+  if (count ? (*count = 0) : 1)
+	 FAIL(2292);
+  if (lock_created ? (*lock_created = 0) : 1)
+	 FAIL(2293);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2294) : 0)
+	 return 0;
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2295) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2296) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2297) : *err);
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  int vertex_lock_created;
+  uintptr_t limit;
+  cru_graph g;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule,
+	 .canonical = (cru_uop) canonical,
+	 .bu_sig = {
+		.orders = {
+		  .v_order = {
+			 .hash = (cru_hash) vertex_hash,
+			 .equal = (cru_bpred) equal_vertices}},
+		.destructors = {
+		  .v_free = (cru_destructor) free_vertex}}};
+
+  v = 0;
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  if (! initialized (&vertex_count, &vertex_lock, &vertex_lock_created, &err))
+	 goto a;
+  g = cru_built (&b, vertex_of (DIMENSION, &err), UNKILLABLE, LANES, &err);
+  v = valid (g, &err);
+  cru_free_now (g, LANES, &err);
+  nthm_sync (&err);
+  err = (vertex_count ? THE_FAIL(2298) : err);
+ a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
+	 err = THE_FAIL(2299);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
@@ -0,0 +1,226 @@
+// Create a hypercubic graph in partial mode with a stopper that's true
+// of only one vertex, once from the heap and once in arena mode, and
+// check that the build is stopped without an error, that every vertex
+// in the graph has either all of its outgoing edges or none, and that
+// spreading the graph without a stopper completes it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cru.h>
+#include "readme.h"
+
+// the vertex whose discovery stops the build
+#define VIOLATION 1
+
+// non-zero when the stopper has been true
+static int stopped = 0;
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero.
+{
+  uintptr_t axis;
+
+  for (axis = 0; axis < DIMENSION; axis++)
+	 cru_connect ((cru_edge) axis, (cru_vertex) (given_vertex ^ (uintptr_t) (1 << axis)), err);
+}
+
+
+
+
+
+
+
+
+int
+stopper (vertex, err)
+	  uintptr_t vertex;
+	  int *err;
+
+	  // Stop the build when the violating vertex is discovered.
+{
+  if (vertex != VIOLATION)
+	 return 0;
+  __atomic_store_n (&stopped, 1, __ATOMIC_RELAXED);
+  return 1;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  uintptr_t local_vertex;
+	  uintptr_t connecting_edge;
+	  uintptr_t remote_vertex;
+	  int *err;
+
+	  // Return 1 if an edge is labeled by the index of the bit in
+	  // which its endpoints differ, and 0 otherwise.
+{
+  if (*err)
+	 return 0;
+  return ! ((remote_vertex >= NUMBER_OF_VERTICES) ? FAIL(2300) : ((local_vertex ^ remote_vertex) != (1 << connecting_edge)) ? FAIL(2301) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+vertex_checker (edges_in, vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  uintptr_t vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Return the number of outgoing edges from a vertex, which is
+	  // required to be either all of them or none.
+{
+  if (*err ? 1 : (vertex >= NUMBER_OF_VERTICES) ? FAIL(2302) : (edges_out ? (edges_out != DIMENSION) : 0) ? FAIL(2303) : 0)
+	 return 0;
+  return edges_out;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+null (err)
+	  int *err;
+
+	  // Unconditionally return zero. This function is used as the
+	  // vacuous case for vertices with no outgoing edges.
+{
+  return 0;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers, checking for overflow and
+	  // other errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2304) : (s < r) ? FAIL(2305) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check that a stopped build has only vertices with all of their
+	  // outgoing edges or none, then spread it and check that the
+	  // whole hypercube is there.
+{
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule};
+
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.outgoing = {
+		  .vacuous_case = (cru_nop) null,
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+  uintptr_t e;
+
+  if (! g)
+	 return 0;
+  e = cru_edge_count (g, LANES, err);
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == e) ? 0 : FAIL(2306))
+	 goto a;
+  if ((e == ((uintptr_t) DIMENSION) * (cru_vertex_count (g, LANES, err) - cru_terminus_count (g, LANES, err))) ? 0 : FAIL(2307))
+	 goto a;
+  if (! (g = cru_spread (g, &b, UNKILLABLE, LANES, err)))
+	 return 0;
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2308))
+	 goto a;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2309))
+	 goto a;
+  cru_free_now (g, LANES, err);
+  return 1;
+ a: cru_free_now (g, LANES, err);
+  return 0;
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule,
+	 .stopper = (cru_upred) stopper,
+	 .partial = 1};
+
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  v = valid (cru_built (&b, 0, UNKILLABLE, LANES, &err), &err);
+  v = (v ? stopped : 0);
+  stopped = 0;
+  b.bu_sig.arena = 1;
+  v = (v ? valid (cru_built (&b, 0, UNKILLABLE, LANES, &err), &err) : 0);
+  v = (v ? stopped : 0);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
@@ -0,0 +1,222 @@
+// Create hypercubic graphs with endogenous vertices and labels from
+// a base vertex in the hypercube with an edge to each of its
+// neighbors, once from the heap and once in arena mode. The base
+// vertex is given in a non-canonical form that a canonicalizing
+// function reduces to zero. Check that the edges from the seeds back
+// to the base vertex reach the base vertex rather than a duplicate,
+// that the connector is never called on the base vertex, and that
+// everything else is there.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cru.h>
+#include "readme.h"
+
+// the base vertex in canonical form
+#define BASE 0
+
+// a non-canonical form of the base vertex
+#define ALIAS NUMBER_OF_VERTICES
+
+
+
+
+
+uintptr_t
+canonical (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Reduce a vertex modulo the number of vertices in the
+	  // hypercube.
+{
+  return given_vertex % NUMBER_OF_VERTICES;
+}
+
+
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero. The base vertex has its edges
+	  // already.
+{
+  uintptr_t axis;
+
+  if ((given_vertex == BASE) ? FAIL(2310) : (given_vertex >= NUMBER_OF_VERTICES) ? FAIL(2311) : 0)
+	 return;
+  for (axis = 0; axis < DIMENSION; axis++)
+	 cru_connect ((cru_edge) axis, (cru_vertex) (given_vertex ^ (uintptr_t) (1 << axis)), err);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  uintptr_t local_vertex;
+	  uintptr_t connecting_edge;
+	  uintptr_t remote_vertex;
+	  int *err;
+
+	  // Return 1 if an edge is labeled by the index of the bit in
+	  // which its endpoints differ, and 0 otherwise.
+{
+  if (*err)
+	 return 0;
+  return ! (((local_vertex ^ remote_vertex) != (1 << connecting_edge)) ? FAIL(2312) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+vertex_checker (edges_in, vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  uintptr_t vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Validate a vertex based on the incoming and outgoing
+	  // edges being valid.
+{
+  if (*err)
+	 return 0;
+  return ! ((edges_in != DIMENSION) ? FAIL(2313) : (edges_out != DIMENSION) ? FAIL(2314) : 0);
+}
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers, checking for overflow and
+	  // other errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2315) : (s < r) ? FAIL(2316) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check for correct vertex counts, edge counts, and edge labels.
+{
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.incident = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker},
+		.outgoing = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2317))
+	 return 0;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2318))
+	 return 0;
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2319))
+	 return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+cru_graph
+seeded (b, err)
+	  cru_builder b;
+	  int *err;
+
+	  // Build a graph from the base vertex with an edge to each of its
+	  // neighbors, each of which has an edge back to it.
+{
+  cru_vertex termini[DIMENSION];
+  cru_edge labels[DIMENSION];
+  uintptr_t axis;
+
+  for (axis = 0; axis < DIMENSION; axis++)
+	 {
+		labels[axis] = (cru_edge) axis;
+		termini[axis] = (cru_vertex) (BASE ^ (uintptr_t) (1 << axis));
+	 }
+  return cru_built_from (b, (cru_vertex) ALIAS, labels, termini, (size_t) DIMENSION, UNKILLABLE, LANES, err);
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  cru_graph g;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .canonical = (cru_uop) canonical,
+	 .connector = (cru_connector) building_rule};
+
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  g = seeded (&b, &err);
+  v = valid (g, &err);
+  cru_free_now (g, LANES, &err);
+  b.bu_sig.arena = 1;
+  g = seeded (&b, &err);
+  v = (v ? valid (g, &err) : 0);
+  cru_free_now (g, LANES, &err);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
@@ -71,14 +71,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2005))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2320))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2006) : ++redex_count ? 0 : FAIL(2007))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2321) : ++redex_count ? 0 : FAIL(2322))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2008) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2323) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -102,12 +102,12 @@ free_outgoing_redex (r, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as c.cl_prop.outgoing.r_free in the classifier c.
 {
-  if ((! r) ? FAIL(2009) : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(2010) : 0)
+  if ((! r) ? FAIL(2324) : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(2325) : 0)
 	 return;
-  r->r_magic = MUGGLE(87);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2011) : redex_count-- ? 0 : FAIL(2012))
+  r->r_magic = MUGGLE(90);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2326) : redex_count-- ? 0 : FAIL(2327))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2013) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2328) : 0)
 	 return;
   free (r);
 }
@@ -126,12 +126,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(2014) : (r->r_magic != REDEX_MAGIC) ? FAIL(2015) : 0)
+  if ((! r) ? FAIL(2329) : (r->r_magic != REDEX_MAGIC) ? FAIL(2330) : 0)
 	 return;
-  r->r_magic = MUGGLE(88);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2016) : redex_count-- ? 0 : FAIL(2017))
+  r->r_magic = MUGGLE(91);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2331) : redex_count-- ? 0 : FAIL(2332))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2018) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2333) : 0)
 	 return;
   free (r);
 }
@@ -153,12 +153,12 @@ free_property (r, err)
 	  // the cru library as c.cl_prop.vertex.m_free in the
 	  // classifier c.
 {
-  if ((! r) ? FAIL(2019) : (r->r_magic != PROPERTY_MAGIC) ? FAIL(2020) : 0)
+  if ((! r) ? FAIL(2334) : (r->r_magic != PROPERTY_MAGIC) ? FAIL(2335) : 0)
 	 return;
-  r->r_magic = MUGGLE(89);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2021) : redex_count-- ? 0 : FAIL(2022))
+  r->r_magic = MUGGLE(92);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2336) : redex_count-- ? 0 : FAIL(2337))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2023) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2338) : 0)
 	 return;
   free (r);
 }
@@ -179,9 +179,9 @@ equal_properties (a, b, err)
 	  // Compare two redexes and return non-zero if they are
 	  // equal.
 {
-  if ((! a) ? FAIL(2024) : (a->r_magic != PROPERTY_MAGIC) ? FAIL(2025) : 0)
+  if ((! a) ? FAIL(2339) : (a->r_magic != PROPERTY_MAGIC) ? FAIL(2340) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2026) : (b->r_magic != PROPERTY_MAGIC) ? FAIL(2027) : 0)
+  if ((! b) ? FAIL(2341) : (b->r_magic != PROPERTY_MAGIC) ? FAIL(2342) : 0)
 	 return 0;
   return a->r_value == b->r_value;
 }
@@ -202,7 +202,7 @@ property_hash (r)
   size_t i;
   uintptr_t u;
 
-  if ((! r) ? GLOBAL_FAIL(2028) : (r->r_magic != PROPERTY_MAGIC) ? GLOBAL_FAIL(2029) : 0)
+  if ((! r) ? GLOBAL_FAIL(2343) : (r->r_magic != PROPERTY_MAGIC) ? GLOBAL_FAIL(2344) : 0)
 	 return 0;
   u = r->r_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -226,14 +226,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2030))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2345))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2031) : ++edge_count ? 0 : FAIL(2032))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2346) : ++edge_count ? 0 : FAIL(2347))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2033) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2348) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -254,12 +254,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2034) : (e->e_magic != EDGE_MAGIC) ? FAIL(2035) : 0)
+  if ((! e) ? FAIL(2349) : (e->e_magic != EDGE_MAGIC) ? FAIL(2350) : 0)
 	 return;
-  e->e_magic = MUGGLE(90);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2036) : edge_count-- ? 0 : FAIL(2037))
+  e->e_magic = MUGGLE(93);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2351) : edge_count-- ? 0 : FAIL(2352))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2038) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2353) : 0)
 	 return;
   free (e);
 }
@@ -281,7 +281,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2039) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2040) : 0)
+  if ((! e) ? GLOBAL_FAIL(2354) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2355) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -306,9 +306,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for merging.
 {
-  if ((! a) ? FAIL(2041) : (a->e_magic != EDGE_MAGIC) ? FAIL(2042) : 0)
+  if ((! a) ? FAIL(2356) : (a->e_magic != EDGE_MAGIC) ? FAIL(2357) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2043) : (b->e_magic != EDGE_MAGIC) ? FAIL(2044) : 0)
+  if ((! b) ? FAIL(2358) : (b->e_magic != EDGE_MAGIC) ? FAIL(2359) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -329,14 +329,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2045))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2360))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2046) : ++vertex_count ? 0 : FAIL(2047))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2361) : ++vertex_count ? 0 : FAIL(2362))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2048) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2363) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -358,12 +358,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2049) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2050) : 0)
+  if ((! v) ? FAIL(2364) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2365) : 0)
 	 return;
-  v->v_magic = MUGGLE(91);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2051) : vertex_count-- ? 0 : FAIL(2052))
+  v->v_magic = MUGGLE(94);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2366) : vertex_count-- ? 0 : FAIL(2367))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2053) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2368) : 0)
 	 return;
   free (v);
 }
@@ -385,9 +385,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2054) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2055) : 0)
+  if ((! a) ? FAIL(2369) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2370) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2056) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2057) : 0)
+  if ((! b) ? FAIL(2371) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2372) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -411,7 +411,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(2058) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2059) : 0)
+  if ((! v) ? GLOBAL_FAIL(2373) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2374) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -442,7 +442,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(2060) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2061) : 0)
+  if ((! given_vertex) ? FAIL(2375) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2376) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -469,13 +469,13 @@ incident_edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return the class assigned to a remote vertex if its value
 	  // doesn't exceed that of the local vertex.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2062) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2063) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2377) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2378) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(2064) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2065) : 0)
+  if ((! local_vertex) ? FAIL(2379) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2380) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(2066) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2067) : 0)
+  if ((! remote_vertex) ? FAIL(2381) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2382) : 0)
 	 return NULL;
-  if ((((local_vertex->v_value ^ remote_vertex->v_value)) != (1 << connecting_edge->e_value)) ? FAIL(2068) : 0)
+  if ((((local_vertex->v_value ^ remote_vertex->v_value)) != (1 << connecting_edge->e_value)) ? FAIL(2383) : 0)
 	 return NULL;
   return ((remote_vertex->v_value < local_vertex->v_value) ? cru_class_of (h, remote_vertex, err) : NULL);
 }
@@ -497,13 +497,13 @@ outgoing_edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return the class assigned to a remote vertex if its value
 	  // exceeds that of the local vertex.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2069) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2070) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2384) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2385) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(2071) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2072) : 0)
+  if ((! local_vertex) ? FAIL(2386) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2387) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(2073) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2074) : 0)
+  if ((! remote_vertex) ? FAIL(2388) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2389) : 0)
 	 return NULL;
-  if ((((local_vertex->v_value ^ remote_vertex->v_value)) != (1 << connecting_edge->e_value)) ? FAIL(2075) : 0)
+  if ((((local_vertex->v_value ^ remote_vertex->v_value)) != (1 << connecting_edge->e_value)) ? FAIL(2390) : 0)
 	 return NULL;
   return ((remote_vertex->v_value > local_vertex->v_value) ? cru_class_of (h, remote_vertex, err) : NULL);
 }
@@ -530,7 +530,7 @@ common_class (l, r, err)
 	 return NULL;
   if (! (l ? r : NULL))
 	 return (l ? l : r);
-  return (((l == r) ? 0 : FAIL(2076)) ? NULL : l);
+  return (((l == r) ? 0 : FAIL(2391)) ? NULL : l);
 }
 
 
@@ -576,17 +576,17 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
   cru_class c;
   uintptr_t v, bits;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(2077) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2078) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2392) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2393) : 0)
 	 return NULL;
-  if ((edges_in == edges_out) ? FAIL(2079) : 0)
+  if ((edges_in == edges_out) ? FAIL(2394) : 0)
 	 return NULL;
-  if (((c = cru_class_of (h, given_vertex, err)) == edges_in) ? FAIL(2080) : (c == edges_out) ? FAIL(2081) : 0)
+  if (((c = cru_class_of (h, given_vertex, err)) == edges_in) ? FAIL(2395) : (c == edges_out) ? FAIL(2396) : 0)
 	 return NULL;
   v = given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
 	 bits += (v & 1);
   if (*err != ENOMEM)
-	 if ((cru_class_size (c, err) != choose (DIMENSION, bits)) ? FAIL(2082) : 0)
+	 if ((cru_class_size (c, err) != choose (DIMENSION, bits)) ? FAIL(2397) : 0)
 		return NULL;
   return redex_of (1, err);
 }
@@ -612,12 +612,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2083) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2398) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2084) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2399) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(2085) : (s < (r ? r->r_value : 0)) ? FAIL(2086) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(2400) : (s < (r ? r->r_value : 0)) ? FAIL(2401) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -643,12 +643,12 @@ outgoing_sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(2087) : 0)
+  if ((! l) ? 0 : (l->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(2402) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(2088) : 0)
+  if ((! r) ? 0 : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(2403) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(2089) : (s < (r ? r->r_value : 0)) ? FAIL(2090) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(2404) : (s < (r ? r->r_value : 0)) ? FAIL(2405) : 0)
 	 return NULL;
   if ((t = redex_of (s, err)))
 	 t->r_magic = OUTGOING_REDEX_MAGIC;
@@ -689,16 +689,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2091))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2406))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES)) ? 0 : FAIL(2092))
+  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES)) ? 0 : FAIL(2407))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2093))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2408))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2094))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2409))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES)))
-	 FAIL(2095);
+	 FAIL(2410);
   free_redex (r, err);
   return v;
 }
@@ -727,13 +727,13 @@ common_property (edges_in, given_vertex, edges_out, err)
   redex r;
   uintptr_t v, bits;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(2096) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2097) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2411) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2412) : 0)
 	 return NULL;
-  if (edges_in ? FAIL(2098) : 0)
+  if (edges_in ? FAIL(2413) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(2099) : (edges_out->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(2100) : 0)
+  if ((! edges_out) ? FAIL(2414) : (edges_out->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(2415) : 0)
 	 return NULL;
-  if ((edges_out->r_value != D) ? FAIL(2101) : 0)
+  if ((edges_out->r_value != D) ? FAIL(2416) : 0)
 	 return NULL;
   v = given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
@@ -764,11 +764,11 @@ outgoing_map (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2102) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2103) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2417) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2418) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(2104) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2105) : 0)
+  if ((! local_vertex) ? FAIL(2419) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2420) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(2106) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2107) : 0)
+  if ((! remote_vertex) ? FAIL(2421) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2422) : 0)
 	 return NULL;
   if ((r = redex_of (connecting_edge->e_value, err)))
 	 r->r_magic = OUTGOING_REDEX_MAGIC;
@@ -796,14 +796,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(2108);
+	 FAIL(2423);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(2109);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2110) : 0)
+	 FAIL(2424);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2425) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2111) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2112) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2113) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2426) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2427) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2428) : *err);
 }
 
 
@@ -874,11 +874,11 @@ main (argc, argv)
   cru_free_partition (h, NOW, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(2114) : vertex_count ? THE_FAIL(2115) : redex_count ? THE_FAIL(2116) : global_err);
+	 err = (edge_count ? THE_FAIL(2429) : vertex_count ? THE_FAIL(2430) : redex_count ? THE_FAIL(2431) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2117);
+	 err = THE_FAIL(2432);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2118);
+	 err = THE_FAIL(2433);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
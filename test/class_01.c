@@ -54,7 +54,7 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // by the index of the bit in which its endpoints differ, and
 	  // NULL otherwise.
 {
-  if (((local_vertex ^ remote_vertex) == (1 << connecting_edge)) ? 1 : ! FAIL(2119))
+  if (((local_vertex ^ remote_vertex) == (1 << connecting_edge)) ? 1 : ! FAIL(2434))
 	 return cru_class_of (h, (cru_vertex) remote_vertex, err);
   return NULL;
 }
@@ -76,7 +76,7 @@ vertex_checker (edges_in, vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  return ! (*err ? 1 : (! edges_in) ? FAIL(2120) : (! edges_out) ? FAIL(2121) : (edges_in != edges_out) ? FAIL(2122) : 0);
+  return ! (*err ? 1 : (! edges_in) ? FAIL(2435) : (! edges_out) ? FAIL(2436) : (edges_in != edges_out) ? FAIL(2437) : 0);
 }
 
 
@@ -95,7 +95,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2123) : (s < r) ? FAIL(2124) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2438) : (s < r) ? FAIL(2439) : 0) ? 0 : s);
 }
 
 
@@ -112,7 +112,7 @@ intersection (l, r, err)
 
 	  // Return one of two equal classes.
 {
-  if (*err ? 1 : (! l) ? FAIL(2125) : (! r) ? FAIL(2126) : (l != r) ? FAIL(2127) : 0)
+  if (*err ? 1 : (! l) ? FAIL(2440) : (! r) ? FAIL(2441) : (l != r) ? FAIL(2442) : 0)
 	 return NULL;
   return l;
 }
@@ -143,11 +143,11 @@ valid (g, err)
 		  .reduction = (cru_bop) intersection,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2128))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2443))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2129))
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2444))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2130))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2445))
 	 return 0;
   return 1;
 }
@@ -174,9 +174,9 @@ common_property (edges_in, given_vertex, edges_out, err)
 
   if (*err)
 	 return 0;
-  if (edges_in ? FAIL(2131) : 0)
+  if (edges_in ? FAIL(2446) : 0)
 	 return 0;
-  if ((edges_out != ((DIMENSION * (DIMENSION - 1)) >> 1)) ? FAIL(2132) : 0)
+  if ((edges_out != ((DIMENSION * (DIMENSION - 1)) >> 1)) ? FAIL(2447) : 0)
 	 return 0;
   for (bits = 0; given_vertex; given_vertex >>= 1)
 	 bits += (given_vertex & 1);
@@ -226,9 +226,9 @@ united (c, err)
 		xh = cru_class_of (c, x = (void *) (((uintptr_t) 1 << i) - 1), err);
 		yh = cru_class_of (c, y = (void *) (((uintptr_t) 1 << (i + 2)) - 1), err);
 		if (*err != ENOMEM)
-		  if (cru_united (c, xh, yh, err) ? 0 : FAIL(2133))
+		  if (cru_united (c, xh, yh, err) ? 0 : FAIL(2448))
 			 break;
-		if (((xh = cru_class_of (c, x, err)) == (yh = cru_class_of (c, y, err))) ? 0 : FAIL(2134))
+		if (((xh = cru_class_of (c, x, err)) == (yh = cru_class_of (c, y, err))) ? 0 : FAIL(2449))
 		  break;
 	 }
   return c;
@@ -68,14 +68,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2135))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2450))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2136) : ++redex_count ? 0 : FAIL(2137))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2451) : ++redex_count ? 0 : FAIL(2452))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2138) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2453) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -94,12 +94,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(2139) : (r->r_magic != REDEX_MAGIC) ? FAIL(2140) : 0)
+  if ((! r) ? FAIL(2454) : (r->r_magic != REDEX_MAGIC) ? FAIL(2455) : 0)
 	 return;
-  r->r_magic = MUGGLE(92);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2141) : redex_count-- ? 0 : FAIL(2142))
+  r->r_magic = MUGGLE(95);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2456) : redex_count-- ? 0 : FAIL(2457))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2143) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2458) : 0)
 	 return;
   free (r);
 }
@@ -118,14 +118,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2144))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2459))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2145) : ++edge_count ? 0 : FAIL(2146))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2460) : ++edge_count ? 0 : FAIL(2461))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2147) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2462) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -146,12 +146,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2148) : (e->e_magic != EDGE_MAGIC) ? FAIL(2149) : 0)
+  if ((! e) ? FAIL(2463) : (e->e_magic != EDGE_MAGIC) ? FAIL(2464) : 0)
 	 return;
-  e->e_magic = MUGGLE(93);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2150) : edge_count-- ? 0 : FAIL(2151))
+  e->e_magic = MUGGLE(96);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2465) : edge_count-- ? 0 : FAIL(2466))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2152) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2467) : 0)
 	 return;
   free (e);
 }
@@ -173,7 +173,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2153) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2154) : 0)
+  if ((! e) ? GLOBAL_FAIL(2468) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2469) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -198,9 +198,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for composing.
 {
-  if ((! a) ? FAIL(2155) : (a->e_magic != EDGE_MAGIC) ? FAIL(2156) : 0)
+  if ((! a) ? FAIL(2470) : (a->e_magic != EDGE_MAGIC) ? FAIL(2471) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2157) : (b->e_magic != EDGE_MAGIC) ? FAIL(2158) : 0)
+  if ((! b) ? FAIL(2472) : (b->e_magic != EDGE_MAGIC) ? FAIL(2473) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -220,14 +220,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2159))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2474))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2160) : ++vertex_count ? 0 : FAIL(2161))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2475) : ++vertex_count ? 0 : FAIL(2476))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2162) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2477) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -249,12 +249,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2163) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2164) : 0)
+  if ((! v) ? FAIL(2478) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2479) : 0)
 	 return;
-  v->v_magic = MUGGLE(94);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2165) : vertex_count-- ? 0 : FAIL(2166))
+  v->v_magic = MUGGLE(97);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2480) : vertex_count-- ? 0 : FAIL(2481))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2167) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2482) : 0)
 	 return;
   free (v);
 }
@@ -275,9 +275,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2168) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2169) : 0)
+  if ((! a) ? FAIL(2483) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2484) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2170) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2171) : 0)
+  if ((! b) ? FAIL(2485) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2486) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -301,7 +301,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(2172) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2173) : 0)
+  if ((! v) ? GLOBAL_FAIL(2487) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2488) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -332,7 +332,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(2174) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2175) : 0)
+  if ((! given_vertex) ? FAIL(2489) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2490) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -362,15 +362,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2176) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2177) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2491) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2492) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(2178) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2179) : 0)
+  if ((! local_vertex) ? FAIL(2493) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2494) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(2180) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2181) : 0)
+  if ((! remote_vertex) ? FAIL(2495) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2496) : 0)
 	 return NULL;
   if (connecting_edge->e_value == DIMENSION)
 	 return redex_of (1, err);
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(2182) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(2497) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -392,15 +392,15 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2183) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2184) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2498) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2499) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(2185) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(2186) : 0)
+  if ((! edges_in) ? FAIL(2500) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(2501) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(2187) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(2188) : 0)
+  if ((! edges_out) ? FAIL(2502) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(2503) : 0)
 	 return NULL;
-  if ((edges_in->r_value != (DIMENSION + 1)) ? FAIL(2189) : 0)
+  if ((edges_in->r_value != (DIMENSION + 1)) ? FAIL(2504) : 0)
 	 return NULL;
-  if ((edges_out->r_value != (DIMENSION + 1)) ? FAIL(2190) : 0)
+  if ((edges_out->r_value != (DIMENSION + 1)) ? FAIL(2505) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -425,12 +425,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2191) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2506) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2192) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2507) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(2193) : (s < (r ? r->r_value : 0)) ? FAIL(2194) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(2508) : (s < (r ? r->r_value : 0)) ? FAIL(2509) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -472,16 +472,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2195))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2510))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) + 1) * NUMBER_OF_VERTICES)) ? 0 : FAIL(2196))
+  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) + 1) * NUMBER_OF_VERTICES)) ? 0 : FAIL(2511))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2197))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2512))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2198))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2513))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES)))
-	 FAIL(2199);
+	 FAIL(2514);
   free_redex (r, err);
   return v;
 }
@@ -505,14 +505,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(2200);
+	 FAIL(2515);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(2201);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2202) : 0)
+	 FAIL(2516);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2517) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2203) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2204) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2205) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2518) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2519) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2520) : *err);
 }
 
 
@@ -547,9 +547,9 @@ qop (local_redex, local_label, adjacent_redex, adjacent_label, err)
 
 	  // Create a bypassing edge labeled by the dimension.
 {
-  if ((! local_label) ? FAIL(2206) : (local_label->e_magic != EDGE_MAGIC) ? FAIL(2207) : 0)
+  if ((! local_label) ? FAIL(2521) : (local_label->e_magic != EDGE_MAGIC) ? FAIL(2522) : 0)
 	 return NULL;
-  if ((! adjacent_label) ? FAIL(2208) : (adjacent_label->e_magic != EDGE_MAGIC) ? FAIL(2209) : 0)
+  if ((! adjacent_label) ? FAIL(2523) : (adjacent_label->e_magic != EDGE_MAGIC) ? FAIL(2524) : 0)
 	 return NULL;
   return edge_of (DIMENSION, err);
 }
@@ -606,11 +606,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(2210) : vertex_count ? THE_FAIL(2211) : redex_count ? THE_FAIL(2212) : global_err);
+	 err = (edge_count ? THE_FAIL(2525) : vertex_count ? THE_FAIL(2526) : redex_count ? THE_FAIL(2527) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2213);
+	 err = THE_FAIL(2528);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2214);
+	 err = THE_FAIL(2529);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
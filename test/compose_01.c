@@ -68,14 +68,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2215))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2530))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2216) : ++redex_count ? 0 : FAIL(2217))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2531) : ++redex_count ? 0 : FAIL(2532))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2218) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2533) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -94,12 +94,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(2219) : (r->r_magic != REDEX_MAGIC) ? FAIL(2220) : 0)
+  if ((! r) ? FAIL(2534) : (r->r_magic != REDEX_MAGIC) ? FAIL(2535) : 0)
 	 return;
-  r->r_magic = MUGGLE(95);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2221) : redex_count-- ? 0 : FAIL(2222))
+  r->r_magic = MUGGLE(98);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2536) : redex_count-- ? 0 : FAIL(2537))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2223) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2538) : 0)
 	 return;
   free (r);
 }
@@ -118,14 +118,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2224))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2539))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2225) : ++edge_count ? 0 : FAIL(2226))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2540) : ++edge_count ? 0 : FAIL(2541))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2227) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2542) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -146,12 +146,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2228) : (e->e_magic != EDGE_MAGIC) ? FAIL(2229) : 0)
+  if ((! e) ? FAIL(2543) : (e->e_magic != EDGE_MAGIC) ? FAIL(2544) : 0)
 	 return;
-  e->e_magic = MUGGLE(96);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2230) : edge_count-- ? 0 : FAIL(2231))
+  e->e_magic = MUGGLE(99);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2545) : edge_count-- ? 0 : FAIL(2546))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2232) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2547) : 0)
 	 return;
   free (e);
 }
@@ -173,7 +173,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2233) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2234) : 0)
+  if ((! e) ? GLOBAL_FAIL(2548) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2549) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -198,9 +198,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for composing.
 {
-  if ((! a) ? FAIL(2235) : (a->e_magic != EDGE_MAGIC) ? FAIL(2236) : 0)
+  if ((! a) ? FAIL(2550) : (a->e_magic != EDGE_MAGIC) ? FAIL(2551) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2237) : (b->e_magic != EDGE_MAGIC) ? FAIL(2238) : 0)
+  if ((! b) ? FAIL(2552) : (b->e_magic != EDGE_MAGIC) ? FAIL(2553) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -220,14 +220,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2239))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2554))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2240) : ++vertex_count ? 0 : FAIL(2241))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2555) : ++vertex_count ? 0 : FAIL(2556))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2242) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2557) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -249,12 +249,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2243) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2244) : 0)
+  if ((! v) ? FAIL(2558) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2559) : 0)
 	 return;
-  v->v_magic = MUGGLE(97);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2245) : vertex_count-- ? 0 : FAIL(2246))
+  v->v_magic = MUGGLE(100);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2560) : vertex_count-- ? 0 : FAIL(2561))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2247) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2562) : 0)
 	 return;
   free (v);
 }
@@ -275,9 +275,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2248) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2249) : 0)
+  if ((! a) ? FAIL(2563) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2564) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2250) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2251) : 0)
+  if ((! b) ? FAIL(2565) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2566) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -301,7 +301,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(2252) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2253) : 0)
+  if ((! v) ? GLOBAL_FAIL(2567) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2568) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -332,7 +332,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(2254) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2255) : 0)
+  if ((! given_vertex) ? FAIL(2569) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2570) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -362,15 +362,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2256) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2257) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2571) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2572) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(2258) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2259) : 0)
+  if ((! local_vertex) ? FAIL(2573) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2574) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(2260) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2261) : 0)
+  if ((! remote_vertex) ? FAIL(2575) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2576) : 0)
 	 return NULL;
   if (local_vertex->v_value == remote_vertex->v_value)
 	 return redex_of (1, err);
-  if ((((local_vertex->v_value ^ remote_vertex->v_value) >> connecting_edge->e_value) & 1) ? 0 : FAIL(2262))
+  if ((((local_vertex->v_value ^ remote_vertex->v_value) >> connecting_edge->e_value) & 1) ? 0 : FAIL(2577))
 	 return NULL;
   return redex_of (1, err);
 }
@@ -392,15 +392,15 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2263) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2264) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2578) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2579) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(2265) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(2266) : 0)
+  if ((! edges_in) ? FAIL(2580) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(2581) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(2267) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(2268) : 0)
+  if ((! edges_out) ? FAIL(2582) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(2583) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DEGREE) ? FAIL(2269) : 0)
+  if ((edges_in->r_value != DEGREE) ? FAIL(2584) : 0)
 	 return NULL;
-  if ((edges_out->r_value != DEGREE) ? FAIL(2270) : 0)
+  if ((edges_out->r_value != DEGREE) ? FAIL(2585) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -425,12 +425,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2271) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2586) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2272) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2587) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(2273) : (s < (r ? r->r_value : 0)) ? FAIL(2274) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(2588) : (s < (r ? r->r_value : 0)) ? FAIL(2589) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -472,16 +472,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2275))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2590))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (DEGREE * NUMBER_OF_VERTICES)) ? 0 : FAIL(2276))
+  if ((cru_edge_count (g, LANES, err) == (DEGREE * NUMBER_OF_VERTICES)) ? 0 : FAIL(2591))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2277))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2592))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2278))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2593))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES)))
-	 FAIL(2279);
+	 FAIL(2594);
   free_redex (r, err);
   return v;
 }
@@ -502,14 +502,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(2280);
+	 FAIL(2595);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(2281);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2282) : 0)
+	 FAIL(2596);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2597) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2283) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2284) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2285) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2598) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2599) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2600) : *err);
 }
 
 
@@ -544,9 +544,9 @@ qop (local_redex, local_label, adjacent_redex, adjacent_label, err)
 
 	  // Create a bypassing edge with the same label as the launching edge.
 {
-  if ((! local_label) ? FAIL(2286) : (local_label->e_magic != EDGE_MAGIC) ? FAIL(2287) : 0)
+  if ((! local_label) ? FAIL(2601) : (local_label->e_magic != EDGE_MAGIC) ? FAIL(2602) : 0)
 	 return NULL;
-  if ((! adjacent_label) ? FAIL(2288) : (adjacent_label->e_magic != EDGE_MAGIC) ? FAIL(2289) : 0)
+  if ((! adjacent_label) ? FAIL(2603) : (adjacent_label->e_magic != EDGE_MAGIC) ? FAIL(2604) : 0)
 	 return NULL;
   return edge_of (adjacent_label->e_value, err);
 }
@@ -602,11 +602,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(2290) : vertex_count ? THE_FAIL(2291) : redex_count ? THE_FAIL(2292) : global_err);
+	 err = (edge_count ? THE_FAIL(2605) : vertex_count ? THE_FAIL(2606) : redex_count ? THE_FAIL(2607) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2293);
+	 err = THE_FAIL(2608);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2294);
+	 err = THE_FAIL(2609);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
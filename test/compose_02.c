@@ -70,14 +70,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2295))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2610))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2296) : ++redex_count ? 0 : FAIL(2297))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2611) : ++redex_count ? 0 : FAIL(2612))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2298) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2613) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -96,12 +96,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(2299) : (r->r_magic != REDEX_MAGIC) ? FAIL(2300) : 0)
+  if ((! r) ? FAIL(2614) : (r->r_magic != REDEX_MAGIC) ? FAIL(2615) : 0)
 	 return;
-  r->r_magic = MUGGLE(98);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2301) : redex_count-- ? 0 : FAIL(2302))
+  r->r_magic = MUGGLE(101);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2616) : redex_count-- ? 0 : FAIL(2617))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2303) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2618) : 0)
 	 return;
   free (r);
 }
@@ -120,14 +120,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2304))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2619))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2305) : ++edge_count ? 0 : FAIL(2306))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2620) : ++edge_count ? 0 : FAIL(2621))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2307) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2622) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -148,12 +148,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2308) : (e->e_magic != EDGE_MAGIC) ? FAIL(2309) : 0)
+  if ((! e) ? FAIL(2623) : (e->e_magic != EDGE_MAGIC) ? FAIL(2624) : 0)
 	 return;
-  e->e_magic = MUGGLE(99);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2310) : edge_count-- ? 0 : FAIL(2311))
+  e->e_magic = MUGGLE(102);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2625) : edge_count-- ? 0 : FAIL(2626))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2312) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2627) : 0)
 	 return;
   free (e);
 }
@@ -175,7 +175,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2313) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2314) : 0)
+  if ((! e) ? GLOBAL_FAIL(2628) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2629) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -200,9 +200,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for composing.
 {
-  if ((! a) ? FAIL(2315) : (a->e_magic != EDGE_MAGIC) ? FAIL(2316) : 0)
+  if ((! a) ? FAIL(2630) : (a->e_magic != EDGE_MAGIC) ? FAIL(2631) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2317) : (b->e_magic != EDGE_MAGIC) ? FAIL(2318) : 0)
+  if ((! b) ? FAIL(2632) : (b->e_magic != EDGE_MAGIC) ? FAIL(2633) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -222,14 +222,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2319))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2634))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2320) : ++vertex_count ? 0 : FAIL(2321))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2635) : ++vertex_count ? 0 : FAIL(2636))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2322) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2637) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -251,12 +251,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2323) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2324) : 0)
+  if ((! v) ? FAIL(2638) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2639) : 0)
 	 return;
-  v->v_magic = MUGGLE(100);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2325) : vertex_count-- ? 0 : FAIL(2326))
+  v->v_magic = MUGGLE(103);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2640) : vertex_count-- ? 0 : FAIL(2641))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2327) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2642) : 0)
 	 return;
   free (v);
 }
@@ -277,9 +277,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2328) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2329) : 0)
+  if ((! a) ? FAIL(2643) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2644) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2330) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2331) : 0)
+  if ((! b) ? FAIL(2645) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2646) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -303,7 +303,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(2332) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2333) : 0)
+  if ((! v) ? GLOBAL_FAIL(2647) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2648) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -334,7 +334,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(2334) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2335) : 0)
+  if ((! given_vertex) ? FAIL(2649) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2650) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -364,15 +364,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2336) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2337) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2651) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2652) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(2338) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2339) : 0)
+  if ((! local_vertex) ? FAIL(2653) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2654) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(2340) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2341) : 0)
+  if ((! remote_vertex) ? FAIL(2655) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2656) : 0)
 	 return NULL;
   if (local_vertex->v_value == remote_vertex->v_value)
 	 return redex_of (1, err);
-  if ((((local_vertex->v_value ^ remote_vertex->v_value) >> connecting_edge->e_value) & 1) ? 0 : FAIL(2342))
+  if ((((local_vertex->v_value ^ remote_vertex->v_value) >> connecting_edge->e_value) & 1) ? 0 : FAIL(2657))
 	 return NULL;
   return redex_of (1, err);
 }
@@ -394,15 +394,15 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2343) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2344) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2658) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2659) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(2345) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(2346) : 0)
+  if ((! edges_in) ? FAIL(2660) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(2661) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(2347) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(2348) : 0)
+  if ((! edges_out) ? FAIL(2662) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(2663) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DEGREE) ? FAIL(2349) : 0)
+  if ((edges_in->r_value != DEGREE) ? FAIL(2664) : 0)
 	 return NULL;
-  if ((edges_out->r_value != DEGREE) ? FAIL(2350) : 0)
+  if ((edges_out->r_value != DEGREE) ? FAIL(2665) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -427,12 +427,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2351) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2666) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2352) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2667) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(2353) : (s < (r ? r->r_value : 0)) ? FAIL(2354) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(2668) : (s < (r ? r->r_value : 0)) ? FAIL(2669) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -474,16 +474,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(2355))
+  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(2670))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (DEGREE * (NUMBER_OF_VERTICES >> 1))) ? 0 : FAIL(2356))
+  if ((cru_edge_count (g, LANES, err) == (DEGREE * (NUMBER_OF_VERTICES >> 1))) ? 0 : FAIL(2671))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2357))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2672))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2358))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2673))
 	 return 0;
   if (!(v = (r->r_value == (NUMBER_OF_VERTICES >> 1))))
-	 FAIL(2359);
+	 FAIL(2674);
   free_redex (r, err);
   return v;
 }
@@ -504,14 +504,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(2360);
+	 FAIL(2675);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(2361);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2362) : 0)
+	 FAIL(2676);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2677) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2363) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2364) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2365) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2678) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2679) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2680) : *err);
 }
 
 
@@ -546,9 +546,9 @@ qop (local_redex, local_label, adjacent_redex, adjacent_label, err)
 
 	  // Create a bypassing edge with the same lable as the launching edge.
 {
-  if ((! local_label) ? FAIL(2366) : (local_label->e_magic != EDGE_MAGIC) ? FAIL(2367) : 0)
+  if ((! local_label) ? FAIL(2681) : (local_label->e_magic != EDGE_MAGIC) ? FAIL(2682) : 0)
 	 return NULL;
-  if ((! adjacent_label) ? FAIL(2368) : (adjacent_label->e_magic != EDGE_MAGIC) ? FAIL(2369) : 0)
+  if ((! adjacent_label) ? FAIL(2683) : (adjacent_label->e_magic != EDGE_MAGIC) ? FAIL(2684) : 0)
 	 return NULL;
   return edge_of (adjacent_label->e_value, err);
 }
@@ -605,11 +605,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(2370) : vertex_count ? THE_FAIL(2371) : redex_count ? THE_FAIL(2372) : global_err);
+	 err = (edge_count ? THE_FAIL(2685) : vertex_count ? THE_FAIL(2686) : redex_count ? THE_FAIL(2687) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2373);
+	 err = THE_FAIL(2688);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2374);
+	 err = THE_FAIL(2689);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -68,14 +68,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2375))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2690))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2376) : ++redex_count ? 0 : FAIL(2377))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2691) : ++redex_count ? 0 : FAIL(2692))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2378) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2693) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -94,12 +94,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(2379) : (r->r_magic != REDEX_MAGIC) ? FAIL(2380) : 0)
+  if ((! r) ? FAIL(2694) : (r->r_magic != REDEX_MAGIC) ? FAIL(2695) : 0)
 	 return;
-  r->r_magic = MUGGLE(101);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2381) : redex_count-- ? 0 : FAIL(2382))
+  r->r_magic = MUGGLE(104);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2696) : redex_count-- ? 0 : FAIL(2697))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2383) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2698) : 0)
 	 return;
   free (r);
 }
@@ -118,14 +118,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2384))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2699))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2385) : ++edge_count ? 0 : FAIL(2386))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2700) : ++edge_count ? 0 : FAIL(2701))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2387) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2702) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -146,12 +146,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2388) : (e->e_magic != EDGE_MAGIC) ? FAIL(2389) : 0)
+  if ((! e) ? FAIL(2703) : (e->e_magic != EDGE_MAGIC) ? FAIL(2704) : 0)
 	 return;
-  e->e_magic = MUGGLE(102);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2390) : edge_count-- ? 0 : FAIL(2391))
+  e->e_magic = MUGGLE(105);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2705) : edge_count-- ? 0 : FAIL(2706))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2392) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2707) : 0)
 	 return;
   free (e);
 }
@@ -173,7 +173,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2393) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2394) : 0)
+  if ((! e) ? GLOBAL_FAIL(2708) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2709) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -198,9 +198,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for composing.
 {
-  if ((! a) ? FAIL(2395) : (a->e_magic != EDGE_MAGIC) ? FAIL(2396) : 0)
+  if ((! a) ? FAIL(2710) : (a->e_magic != EDGE_MAGIC) ? FAIL(2711) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2397) : (b->e_magic != EDGE_MAGIC) ? FAIL(2398) : 0)
+  if ((! b) ? FAIL(2712) : (b->e_magic != EDGE_MAGIC) ? FAIL(2713) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -220,14 +220,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2399))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2714))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2400) : ++vertex_count ? 0 : FAIL(2401))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2715) : ++vertex_count ? 0 : FAIL(2716))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2402) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2717) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -249,12 +249,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2403) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2404) : 0)
+  if ((! v) ? FAIL(2718) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2719) : 0)
 	 return;
-  v->v_magic = MUGGLE(103);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2405) : vertex_count-- ? 0 : FAIL(2406))
+  v->v_magic = MUGGLE(106);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2720) : vertex_count-- ? 0 : FAIL(2721))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2407) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2722) : 0)
 	 return;
   free (v);
 }
@@ -275,9 +275,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2408) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2409) : 0)
+  if ((! a) ? FAIL(2723) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2724) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2410) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2411) : 0)
+  if ((! b) ? FAIL(2725) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2726) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -301,7 +301,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(2412) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2413) : 0)
+  if ((! v) ? GLOBAL_FAIL(2727) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2728) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -332,7 +332,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(2414) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2415) : 0)
+  if ((! given_vertex) ? FAIL(2729) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2730) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -362,15 +362,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2416) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2417) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2731) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2732) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(2418) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2419) : 0)
+  if ((! local_vertex) ? FAIL(2733) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2734) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(2420) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2421) : 0)
+  if ((! remote_vertex) ? FAIL(2735) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2736) : 0)
 	 return NULL;
   if ((connecting_edge->e_value == DIMENSION) ? ((local_vertex->v_value & 1) != (remote_vertex->v_value & 1)) : 0)
 	 return redex_of (1, err);
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(2422) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(2737) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -392,13 +392,13 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2423) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2424) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2738) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2739) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(2425) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(2426) : 0)
+  if ((! edges_in) ? FAIL(2740) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(2741) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(2427) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(2428) : 0)
+  if ((! edges_out) ? FAIL(2742) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(2743) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DEGREE) ? FAIL(2429) : (edges_out->r_value != DEGREE) ? FAIL(2430) : 0)
+  if ((edges_in->r_value != DEGREE) ? FAIL(2744) : (edges_out->r_value != DEGREE) ? FAIL(2745) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -423,12 +423,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2431) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2746) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2432) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2747) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(2433) : (s < (r ? r->r_value : 0)) ? FAIL(2434) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(2748) : (s < (r ? r->r_value : 0)) ? FAIL(2749) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -470,16 +470,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2435))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2750))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (DEGREE * NUMBER_OF_VERTICES)) ? 0 : FAIL(2436))
+  if ((cru_edge_count (g, LANES, err) == (DEGREE * NUMBER_OF_VERTICES)) ? 0 : FAIL(2751))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2437))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2752))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2438))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2753))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES)))
-	 FAIL(2439);
+	 FAIL(2754);
   free_redex (r, err);
   return v;
 }
@@ -503,14 +503,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(2440);
+	 FAIL(2755);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(2441);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2442) : 0)
+	 FAIL(2756);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2757) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2443) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2444) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2445) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2758) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2759) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2760) : *err);
 }
 
 
@@ -530,9 +530,9 @@ parity (edges_in, given_vertex, edges_out, err)
 	  // Let the local and adjacent conditions for a bypassing edge consist
 	  // only in the parity of the given vertex.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2446) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2447) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2761) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2762) : 0)
 	 return NULL;
-  if (edges_in ? FAIL(2448) : edges_out ? FAIL(2449) : 0)
+  if (edges_in ? FAIL(2763) : edges_out ? FAIL(2764) : 0)
 	 return NULL;
   return redex_of (given_vertex->v_value & 1, err);
 }
@@ -554,9 +554,9 @@ qual (local_redex, local_label, adjacent_redex, adjacent_label, err)
 	  // Enable a bypassing edge across adjecent vertices of
 	  // opposite parities.
 {
-  if ((! local_redex) ? FAIL(2450) : (local_redex->r_magic != REDEX_MAGIC) ? FAIL(2451) : 0)
+  if ((! local_redex) ? FAIL(2765) : (local_redex->r_magic != REDEX_MAGIC) ? FAIL(2766) : 0)
 	 return 0;
-  if ((! adjacent_redex) ? FAIL(2452) : (adjacent_redex->r_magic != REDEX_MAGIC) ? FAIL(2453) : 0)
+  if ((! adjacent_redex) ? FAIL(2767) : (adjacent_redex->r_magic != REDEX_MAGIC) ? FAIL(2768) : 0)
 	 return 0;
   return (local_redex->r_value != adjacent_redex->r_value);
 }
@@ -577,9 +577,9 @@ qop (local_redex, local_label, adjacent_redex, adjacent_label, err)
 
 	  // Create a bypassing edge labeled by the dimension.
 {
-  if ((! local_label) ? FAIL(2454) : (local_label->e_magic != EDGE_MAGIC) ? FAIL(2455) : 0)
+  if ((! local_label) ? FAIL(2769) : (local_label->e_magic != EDGE_MAGIC) ? FAIL(2770) : 0)
 	 return NULL;
-  if ((! adjacent_label) ? FAIL(2456) : (adjacent_label->e_magic != EDGE_MAGIC) ? FAIL(2457) : 0)
+  if ((! adjacent_label) ? FAIL(2771) : (adjacent_label->e_magic != EDGE_MAGIC) ? FAIL(2772) : 0)
 	 return NULL;
   return edge_of (DIMENSION, err);
 }
@@ -644,11 +644,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(2458) : vertex_count ? THE_FAIL(2459) : redex_count ? THE_FAIL(2460) : global_err);
+	 err = (edge_count ? THE_FAIL(2773) : vertex_count ? THE_FAIL(2774) : redex_count ? THE_FAIL(2775) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2461);
+	 err = THE_FAIL(2776);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2462);
+	 err = THE_FAIL(2777);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -69,14 +69,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2463))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(2778))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2464) : ++redex_count ? 0 : FAIL(2465))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2779) : ++redex_count ? 0 : FAIL(2780))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2466) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(2781) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -95,12 +95,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(2467) : (r->r_magic != REDEX_MAGIC) ? FAIL(2468) : 0)
+  if ((! r) ? FAIL(2782) : (r->r_magic != REDEX_MAGIC) ? FAIL(2783) : 0)
 	 return;
-  r->r_magic = MUGGLE(104);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(2469) : redex_count-- ? 0 : FAIL(2470))
+  r->r_magic = MUGGLE(107);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(2784) : redex_count-- ? 0 : FAIL(2785))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2471) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(2786) : 0)
 	 return;
   free (r);
 }
@@ -119,14 +119,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2472))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2787))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2473) : ++edge_count ? 0 : FAIL(2474))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2788) : ++edge_count ? 0 : FAIL(2789))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2475) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2790) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -147,12 +147,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2476) : (e->e_magic != EDGE_MAGIC) ? FAIL(2477) : 0)
+  if ((! e) ? FAIL(2791) : (e->e_magic != EDGE_MAGIC) ? FAIL(2792) : 0)
 	 return;
-  e->e_magic = MUGGLE(105);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2478) : edge_count-- ? 0 : FAIL(2479))
+  e->e_magic = MUGGLE(108);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2793) : edge_count-- ? 0 : FAIL(2794))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2480) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2795) : 0)
 	 return;
   free (e);
 }
@@ -174,7 +174,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2481) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2482) : 0)
+  if ((! e) ? GLOBAL_FAIL(2796) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2797) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -199,9 +199,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for composing.
 {
-  if ((! a) ? FAIL(2483) : (a->e_magic != EDGE_MAGIC) ? FAIL(2484) : 0)
+  if ((! a) ? FAIL(2798) : (a->e_magic != EDGE_MAGIC) ? FAIL(2799) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2485) : (b->e_magic != EDGE_MAGIC) ? FAIL(2486) : 0)
+  if ((! b) ? FAIL(2800) : (b->e_magic != EDGE_MAGIC) ? FAIL(2801) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -221,14 +221,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2487))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2802))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2488) : ++vertex_count ? 0 : FAIL(2489))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2803) : ++vertex_count ? 0 : FAIL(2804))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2490) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2805) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -250,12 +250,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2491) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2492) : 0)
+  if ((! v) ? FAIL(2806) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2807) : 0)
 	 return;
-  v->v_magic = MUGGLE(106);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2493) : vertex_count-- ? 0 : FAIL(2494))
+  v->v_magic = MUGGLE(109);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2808) : vertex_count-- ? 0 : FAIL(2809))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2495) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2810) : 0)
 	 return;
   free (v);
 }
@@ -276,9 +276,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2496) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2497) : 0)
+  if ((! a) ? FAIL(2811) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2812) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2498) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2499) : 0)
+  if ((! b) ? FAIL(2813) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2814) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -302,7 +302,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(2500) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2501) : 0)
+  if ((! v) ? GLOBAL_FAIL(2815) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2816) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -333,7 +333,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(2502) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2503) : 0)
+  if ((! given_vertex) ? FAIL(2817) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2818) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -363,15 +363,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2504) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2505) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2819) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2820) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(2506) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2507) : 0)
+  if ((! local_vertex) ? FAIL(2821) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2822) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(2508) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2509) : 0)
+  if ((! remote_vertex) ? FAIL(2823) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2824) : 0)
 	 return NULL;
   if (! (connecting_edge->e_value))
 	 goto a;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 + (1 << connecting_edge->e_value))) ? FAIL(2510) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 + (1 << connecting_edge->e_value))) ? FAIL(2825) : 0)
   	 return NULL;
  a: return redex_of (1, err);
 }
@@ -393,13 +393,13 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2511) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2512) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2826) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2827) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(2513) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(2514) : 0)
+  if ((! edges_in) ? FAIL(2828) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(2829) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(2515) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(2516) : 0)
+  if ((! edges_out) ? FAIL(2830) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(2831) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DEGREE) ? FAIL(2517) : (edges_out->r_value != DEGREE) ? FAIL(2518) : 0)
+  if ((edges_in->r_value != DEGREE) ? FAIL(2832) : (edges_out->r_value != DEGREE) ? FAIL(2833) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -424,12 +424,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2519) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(2834) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2520) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(2835) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(2521) : (s < (r ? r->r_value : 0)) ? FAIL(2522) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(2836) : (s < (r ? r->r_value : 0)) ? FAIL(2837) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -471,16 +471,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(2523))
+  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(2838))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (DEGREE * (NUMBER_OF_VERTICES >> 1))) ? 0 : FAIL(2524))
+  if ((cru_edge_count (g, LANES, err) == (DEGREE * (NUMBER_OF_VERTICES >> 1))) ? 0 : FAIL(2839))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2525))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(2840))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2526))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(2841))
 	 return 0;
   if (!(v = (r->r_value == (NUMBER_OF_VERTICES >> 1))))
-	 FAIL(2527);
+	 FAIL(2842);
   free_redex (r, err);
   return v;
 }
@@ -502,14 +502,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(2528);
+	 FAIL(2843);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(2529);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2530) : 0)
+	 FAIL(2844);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2845) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2531) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2532) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2533) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2846) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2847) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2848) : *err);
 }
 
 
@@ -529,9 +529,9 @@ parity (edges_in, given_vertex, edges_out, err)
 	  // Let the local and adjacent conditions for a bypassing edge consist
 	  // only in the parity of the given vertex.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2534) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2535) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2849) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2850) : 0)
 	 return NULL;
-  if (edges_in ? FAIL(2536) : edges_out ? FAIL(2537) : 0)
+  if (edges_in ? FAIL(2851) : edges_out ? FAIL(2852) : 0)
 	 return NULL;
   return redex_of (given_vertex->v_value & 1, err);
 }
@@ -553,9 +553,9 @@ anti_parity (edges_in, given_vertex, edges_out, err)
 	  // Let the local and adjacent conditions for a bypassing edge consist
 	  // only in the parity of the given vertex.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2538) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2539) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2853) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2854) : 0)
 	 return NULL;
-  if (edges_in ? FAIL(2540) : edges_out ? FAIL(2541) : 0)
+  if (edges_in ? FAIL(2855) : edges_out ? FAIL(2856) : 0)
 	 return NULL;
   return redex_of (! (given_vertex->v_value & 1), err);
 }
@@ -577,9 +577,9 @@ qual (local_redex, local_label, adjacent_redex, adjacent_label, err)
 	  // Enable a bypassing edge across adjacent vertices of
 	  // opposite parities.
 {
-  if ((! local_redex) ? FAIL(2542) : (local_redex->r_magic != REDEX_MAGIC) ? FAIL(2543) : 0)
+  if ((! local_redex) ? FAIL(2857) : (local_redex->r_magic != REDEX_MAGIC) ? FAIL(2858) : 0)
 	 return 0;
-  if ((! adjacent_redex) ? FAIL(2544) : (adjacent_redex->r_magic != REDEX_MAGIC) ? FAIL(2545) : 0)
+  if ((! adjacent_redex) ? FAIL(2859) : (adjacent_redex->r_magic != REDEX_MAGIC) ? FAIL(2860) : 0)
 	 return 0;
   return (local_redex->r_value == adjacent_redex->r_value);
 }
@@ -598,9 +598,9 @@ qop (local_redex, local_label, adjacent_redex, adjacent_label, err)
 
 	  // Create a bypassing edge with the same label as the launching edge.
 {
-  if ((! local_label) ? FAIL(2546) : (local_label->e_magic != EDGE_MAGIC) ? FAIL(2547) : 0)
+  if ((! local_label) ? FAIL(2861) : (local_label->e_magic != EDGE_MAGIC) ? FAIL(2862) : 0)
 	 return NULL;
-  if ((! adjacent_label) ? FAIL(2548) : (adjacent_label->e_magic != EDGE_MAGIC) ? FAIL(2549) : 0)
+  if ((! adjacent_label) ? FAIL(2863) : (adjacent_label->e_magic != EDGE_MAGIC) ? FAIL(2864) : 0)
 	 return NULL;
   return edge_of (local_label->e_value, err);
 }
@@ -667,11 +667,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(2550) : vertex_count ? THE_FAIL(2551) : redex_count ? THE_FAIL(2552) : global_err);
+	 err = (edge_count ? THE_FAIL(2865) : vertex_count ? THE_FAIL(2866) : redex_count ? THE_FAIL(2867) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2553);
+	 err = THE_FAIL(2868);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2554);
+	 err = THE_FAIL(2869);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -53,14 +53,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2617))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2932))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2618) : ++edge_count ? 0 : FAIL(2619))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2933) : ++edge_count ? 0 : FAIL(2934))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2620) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2935) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -80,12 +80,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2621) : (e->e_magic != EDGE_MAGIC) ? FAIL(2622) : 0)
+  if ((! e) ? FAIL(2936) : (e->e_magic != EDGE_MAGIC) ? FAIL(2937) : 0)
 	 return;
-  e->e_magic = MUGGLE(109);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2623) : edge_count-- ? 0 : FAIL(2624))
+  e->e_magic = MUGGLE(112);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2938) : edge_count-- ? 0 : FAIL(2939))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2625) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2940) : 0)
 	 return;
   free (e);
 }
@@ -106,14 +106,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2626))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2941))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2627) : ++vertex_count ? 0 : FAIL(2628))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2942) : ++vertex_count ? 0 : FAIL(2943))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2629) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2944) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -136,12 +136,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2630) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2631) : 0)
+  if ((! v) ? FAIL(2945) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2946) : 0)
 	 return;
-  v->v_magic = MUGGLE(110);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2632) : vertex_count-- ? 0 : FAIL(2633))
+  v->v_magic = MUGGLE(113);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2947) : vertex_count-- ? 0 : FAIL(2948))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2634) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2949) : 0)
 	 return;
   free (v);
 }
@@ -166,7 +166,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2635) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2636) : 0)
+  if ((! e) ? GLOBAL_FAIL(2950) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2951) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -190,9 +190,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2637) : (a->e_magic != EDGE_MAGIC) ? FAIL(2638) : 0)
+  if ((! a) ? FAIL(2952) : (a->e_magic != EDGE_MAGIC) ? FAIL(2953) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2639) : (b->e_magic != EDGE_MAGIC) ? FAIL(2640) : 0)
+  if ((! b) ? FAIL(2954) : (b->e_magic != EDGE_MAGIC) ? FAIL(2955) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -215,7 +215,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(2641) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2642) : 0)
+  if ((! v) ? GLOBAL_FAIL(2956) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2957) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -239,9 +239,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2643) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2644) : 0)
+  if ((! a) ? FAIL(2958) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2959) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2645) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2646) : 0)
+  if ((! b) ? FAIL(2960) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2961) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -272,19 +272,19 @@ building_rule (initial, incident, given_vertex, err)
 {
   uintptr_t i, e;
 
-  if ((! given_vertex) ? FAIL(2647) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2648) : 0)
+  if ((! given_vertex) ? FAIL(2962) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2963) : 0)
 	 return;
   if (initial)
 	 {
-		if (given_vertex->v_value ? FAIL(2649) : 0)
+		if (given_vertex->v_value ? FAIL(2964) : 0)
 		  return;
-		if (incident ? FAIL(2650) : 0)
+		if (incident ? FAIL(2965) : 0)
 		  return;
 		e = 0;            // the incident edge is ignored
 	 }
   else
 	 {
-		if ((! incident) ? FAIL(2651) : (incident->e_magic != EDGE_MAGIC) ? FAIL(2652) : 0)
+		if ((! incident) ? FAIL(2966) : (incident->e_magic != EDGE_MAGIC) ? FAIL(2967) : 0)
 		  return;
 		e = incident->e_value;
 	 }
@@ -310,13 +310,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2653) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2654) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(2968) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2969) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(2655) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2656) : 0)
+  if ((! local_vertex) ? FAIL(2970) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2971) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(2657) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2658) : 0)
+  if ((! remote_vertex) ? FAIL(2972) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2973) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(2659) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(2974) : 0);
 }
 
 
@@ -337,9 +337,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2660) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2661) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(2975) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2976) : 0)
 	 return 0;
-  return ! ((edges_in != EDGES_PER_VERTEX) ? FAIL(2662) : (edges_out != EDGES_PER_VERTEX) ? FAIL(2663) : 0);
+  return ! ((edges_in != EDGES_PER_VERTEX) ? FAIL(2977) : (edges_out != EDGES_PER_VERTEX) ? FAIL(2978) : 0);
 }
 
 
@@ -361,7 +361,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2664) : (s < r) ? FAIL(2665) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2979) : (s < r) ? FAIL(2980) : 0) ? 0 : s);
 }
 
 
@@ -389,11 +389,11 @@ valid (g, err)
 		  .reduction = (cru_bop) sum,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2666))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2981))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (EDGES_PER_VERTEX * NUMBER_OF_VERTICES)) ? 0 : FAIL(2667))
+  if ((cru_edge_count (g, LANES, err) == (EDGES_PER_VERTEX * NUMBER_OF_VERTICES)) ? 0 : FAIL(2982))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2668))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2983))
 	 return 0;
   return 1;
 }
@@ -414,14 +414,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(2669);
+	 FAIL(2984);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(2670);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2671) : 0)
+	 FAIL(2985);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2986) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2672) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2673) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2674) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2987) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2988) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2989) : *err);
 }
 
 
@@ -472,11 +472,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(2675) : vertex_count ? THE_FAIL(2676) : global_err);
+	 err = (edge_count ? THE_FAIL(2990) : vertex_count ? THE_FAIL(2991) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2677);
+	 err = THE_FAIL(2992);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2678);
+	 err = THE_FAIL(2993);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -51,14 +51,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2679))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2994))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2680) : ++edge_count ? 0 : FAIL(2681))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(2995) : ++edge_count ? 0 : FAIL(2996))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2682) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2997) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -79,12 +79,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2683) : (e->e_magic != EDGE_MAGIC) ? FAIL(2684) : 0)
+  if ((! e) ? FAIL(2998) : (e->e_magic != EDGE_MAGIC) ? FAIL(2999) : 0)
 	 return;
-  e->e_magic = MUGGLE(111);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2685) : edge_count-- ? 0 : FAIL(2686))
+  e->e_magic = MUGGLE(114);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3000) : edge_count-- ? 0 : FAIL(3001))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2687) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3002) : 0)
 	 return;
   free (e);
 }
@@ -104,9 +104,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2688) : (a->e_magic != EDGE_MAGIC) ? FAIL(2689) : 0)
+  if ((! a) ? FAIL(3003) : (a->e_magic != EDGE_MAGIC) ? FAIL(3004) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2690) : (b->e_magic != EDGE_MAGIC) ? FAIL(2691) : 0)
+  if ((! b) ? FAIL(3005) : (b->e_magic != EDGE_MAGIC) ? FAIL(3006) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -128,7 +128,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2692) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2693) : 0)
+  if ((! e) ? GLOBAL_FAIL(3007) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3008) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -152,14 +152,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2694))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3009))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2695) : ++vertex_count ? 0 : FAIL(2696))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3010) : ++vertex_count ? 0 : FAIL(3011))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2697) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3012) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -178,12 +178,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2698) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2699) : 0)
+  if ((! v) ? FAIL(3013) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3014) : 0)
 	 return;
-  v->v_magic = MUGGLE(112);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2700) : vertex_count-- ? 0 : FAIL(2701))
+  v->v_magic = MUGGLE(115);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3015) : vertex_count-- ? 0 : FAIL(3016))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2702) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3017) : 0)
 	 return;
   free (v);
 }
@@ -207,7 +207,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(2703) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2704) : 0)
+  if ((! v) ? GLOBAL_FAIL(3018) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3019) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -230,7 +230,7 @@ mutant_vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(2705) : (v->v_magic != MUTANT_VERTEX_MAGIC) ? GLOBAL_FAIL(2706) : 0)
+  if ((! v) ? GLOBAL_FAIL(3020) : (v->v_magic != MUTANT_VERTEX_MAGIC) ? GLOBAL_FAIL(3021) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -254,9 +254,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2707) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2708) : 0)
+  if ((! a) ? FAIL(3022) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3023) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2709) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2710) : 0)
+  if ((! b) ? FAIL(3024) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3025) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -282,7 +282,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(2711) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2712) : 0)
+  if ((! given_vertex) ? FAIL(3026) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3027) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -308,13 +308,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2713) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2714) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(3028) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3029) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(2715) : (local_vertex->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(2716) : 0)
+  if ((! local_vertex) ? FAIL(3030) : (local_vertex->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(3031) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(2717) : (remote_vertex->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(2718) : 0)
+  if ((! remote_vertex) ? FAIL(3032) : (remote_vertex->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(3033) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value) >> 1) ? FAIL(2719) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value) >> 1) ? FAIL(3034) : 0);
 }
 
 
@@ -334,9 +334,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2720) : (given_vertex->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(2721) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3035) : (given_vertex->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(3036) : 0)
 	 return 0;
-  return ! ((edges_in != DIMENSION) ? FAIL(2722) : (edges_out != DIMENSION) ? FAIL(2723) : 0);
+  return ! ((edges_in != DIMENSION) ? FAIL(3037) : (edges_out != DIMENSION) ? FAIL(3038) : 0);
 }
 
 
@@ -355,7 +355,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2724) : (s < r) ? FAIL(2725) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3039) : (s < r) ? FAIL(3040) : 0) ? 0 : s);
 }
 
 
@@ -383,11 +383,11 @@ valid (g, err)
 		  .reduction = (cru_bop) sum,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(2726))
+  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(3041))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(2727))
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(3042))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(2728))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(3043))
 	 return 0;
   return 1;
 }
@@ -408,14 +408,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(2729);
+	 FAIL(3044);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(2730);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2731) : 0)
+	 FAIL(3045);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3046) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2732) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2733) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2734) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3047) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3048) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3049) : *err);
 }
 
 
@@ -435,9 +435,9 @@ rounder (edges_in, given_vertex, edges_out, err)
 {
   vertex v;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(2735) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2736) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3050) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3051) : 0)
 	 return NULL;
-  if ((v = vertex_of (given_vertex->v_value >> 1, err)) ? 0 : FAIL(2737))
+  if ((v = vertex_of (given_vertex->v_value >> 1, err)) ? 0 : FAIL(3052))
 	 return NULL;
   v->v_magic = MUTANT_VERTEX_MAGIC;
   return v;
@@ -455,12 +455,12 @@ free_mutant_vertex (v, err)
 
 	  // Reclaim a vertex created by rounder.
 {
-  if ((! v) ? FAIL(2738) : (v->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(2739) : 0)
+  if ((! v) ? FAIL(3053) : (v->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(3054) : 0)
 	 return;
-  v->v_magic = MUGGLE(113);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2740) : vertex_count-- ? 0 : FAIL(2741))
+  v->v_magic = MUGGLE(116);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3055) : vertex_count-- ? 0 : FAIL(3056))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2742) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3057) : 0)
 	 return;
   free (v);
 }
@@ -481,9 +481,9 @@ equal_mutant_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2743) : (a->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(2744) : 0)
+  if ((! a) ? FAIL(3058) : (a->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(3059) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2745) : (b->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(2746) : 0)
+  if ((! b) ? FAIL(3060) : (b->v_magic != MUTANT_VERTEX_MAGIC) ? FAIL(3061) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -550,11 +550,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(2747) : vertex_count ? THE_FAIL(2748) : global_err);
+	 err = (edge_count ? THE_FAIL(3062) : vertex_count ? THE_FAIL(3063) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2749);
+	 err = THE_FAIL(3064);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2750);
+	 err = THE_FAIL(3065);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -0,0 +1,394 @@
+// Create a hypercubic graph and export it as CSV, then import it back
+// and check that it's all there. Export it as DOT concurrently and
+// sequentially with formatters padded enough to fill the buffers of
+// the workers before their turns, and check that both files are the
+// same and as long as reported. Export it as GraphML with a vertex
+// formatter that needs escaping and check that it's escaped once per
+// vertex. Then check that an unknown format is rejected.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <cru.h>
+#include "readme.h"
+
+// the first line of an exported CSV file
+#define CSV_HEADER "source,terminus,label\n"
+
+// the number of digits in a padded vertex or edge label
+#define PAD 400
+
+// the number of bytes compared at a time
+#define BLOCK 0x1000
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero.
+{
+  uintptr_t axis;
+
+  for (axis = 0; axis < DIMENSION; axis++)
+	 cru_connect ((cru_edge) axis, (cru_vertex) (given_vertex ^ (uintptr_t) (1 << axis)), err);
+}
+
+
+
+
+
+
+
+
+size_t
+padded (item, buffer, size, err)
+	  uintptr_t item;
+	  void *buffer;
+	  size_t size;
+	  int *err;
+
+	  // Write a number into a buffer with enough leading zeros to make
+	  // it longer than the scratch area of a worker, and return the
+	  // length whether or not it fits.
+{
+  char t[PAD + 1];
+  int n;
+
+  if ((n = snprintf (t, sizeof (t), "%0*lu", PAD, item)) < 0 ? FAIL(3066) : 0)
+	 return 0;
+  memcpy (buffer, t, ((size_t) n < size) ? (size_t) n : size);
+  return (size_t) n;
+}
+
+
+
+
+
+
+
+
+size_t
+marked_up (item, buffer, size, err)
+	  uintptr_t item;
+	  void *buffer;
+	  size_t size;
+	  int *err;
+
+	  // Write a number into a buffer between characters that GraphML
+	  // requires to be escaped.
+{
+  char t[32];
+  int n;
+
+  if ((n = snprintf (t, sizeof (t), "<%lu&>", item)) < 0 ? FAIL(3067) : 0)
+	 return 0;
+  memcpy (buffer, t, ((size_t) n < size) ? (size_t) n : size);
+  return (size_t) n;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  uintptr_t local_vertex;
+	  uintptr_t connecting_edge;
+	  uintptr_t remote_vertex;
+	  int *err;
+
+	  // Return 1 if an edge is labeled by the index of the bit in
+	  // which its endpoints differ, and 0 otherwise.
+{
+  if (*err)
+	 return 0;
+  return ! ((remote_vertex >= NUMBER_OF_VERTICES) ? FAIL(3068) : ((local_vertex ^ remote_vertex) != (1 << connecting_edge)) ? FAIL(3069) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+vertex_checker (edges_in, vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  uintptr_t vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Return 1 for a vertex with all of its edges and fail
+	  // otherwise.
+{
+  if (*err ? 1 : (vertex >= NUMBER_OF_VERTICES) ? FAIL(3070) : (edges_out != DIMENSION) ? FAIL(3071) : 0)
+	 return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers, checking for overflow and
+	  // other errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3072) : (s < r) ? FAIL(3073) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check the vertex and edge counts of an imported graph and
+	  // traverse it to check that every vertex and edge is there, then
+	  // free it.
+{
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.outgoing = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+
+  if (! g)
+	 return 0;
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(3074))
+	 goto a;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(3075))
+	 goto a;
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(3076))
+	 goto a;
+  cru_free_now (g, LANES, err);
+  return 1;
+ a: cru_free_now (g, LANES, err);
+  return 0;
+}
+
+
+
+
+
+
+
+
+int
+round_tripped (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Export a graph as CSV, skip the header, and import it back.
+{
+  struct cru_exporter_s x = {
+	 .format = CSV_FORMAT};
+
+  struct cru_importer_s i = {
+	 .labeled = 1};
+
+  FILE *f;
+  int v;
+
+  if (*err ? 1 : (f = tmpfile ()) ? 0 : FAIL(3077))
+	 return 0;
+  v = ! ! cru_exported (g, fileno (f), &x, LANES, err);
+  if ((! v) ? 1 : (lseek (fileno (f), (off_t) strlen (CSV_HEADER), SEEK_SET) < 0) ? FAIL(3078) : 0)
+	 goto a;
+  v = valid (cru_imported (fileno (f), &i, (cru_vertex) 0, LANES, err), err);
+ a: fclose (f);
+  return v;
+}
+
+
+
+
+
+
+
+
+int
+same (f, g, size, err)
+	  FILE *f;
+	  FILE *g;
+	  uintptr_t size;
+	  int *err;
+
+	  // Return non-zero if two files both have the given size and the
+	  // same contents.
+{
+  char a[BLOCK], b[BLOCK];
+  struct stat s, t;
+  ssize_t n;
+  off_t o;
+
+  if (*err ? 1 : fstat (fileno (f), &s) ? FAIL(3079) : fstat (fileno (g), &t) ? FAIL(3080) : 0)
+	 return 0;
+  if (((uintptr_t) s.st_size != size) ? FAIL(3081) : ((uintptr_t) t.st_size != size) ? FAIL(3082) : 0)
+	 return 0;
+  for (o = 0; o < s.st_size; o += n)
+	 if (((n = pread (fileno (f), a, sizeof (a), o)) <= 0) ? FAIL(3083) : (pread (fileno (g), b, (size_t) n, o) != n) ? FAIL(3084) : 0)
+		return 0;
+	 else if (memcmp (a, b, (size_t) n) ? FAIL(3085) : 0)
+		return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+int
+deterministic (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Export a graph as DOT with padded vertices and edge labels
+	  // concurrently and sequentially, and check that the results are
+	  // identical.
+{
+  struct cru_exporter_s x = {
+	 .format = DOT_FORMAT,
+	 .v_format = (cru_encoder) padded,
+	 .e_format = (cru_encoder) padded};
+
+  uintptr_t size;
+  FILE *f, *h;
+  int v;
+
+  v = 0;
+  if (*err ? 1 : (f = tmpfile ()) ? 0 : FAIL(3086))
+	 return 0;
+  if ((h = tmpfile ()) ? 0 : FAIL(3087))
+	 goto a;
+  size = cru_exported (g, fileno (f), &x, LANES, err);
+  v = ((cru_exported (g, fileno (h), &x, SEQUENTIALLY, err) == size) ? same (f, h, size, err) : 0);
+  fclose (h);
+ a: fclose (f);
+  return v;
+}
+
+
+
+
+
+
+
+
+int
+escaped (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Export a graph as GraphML with a vertex formatter whose output
+	  // needs escaping, and check that both ends of each vertex are
+	  // escaped.
+{
+  struct cru_exporter_s x = {
+	 .format = GRAPHML_FORMAT,
+	 .v_format = (cru_encoder) marked_up};
+
+  uintptr_t size, count;
+  const char *p;
+  char *t;
+  FILE *f;
+
+  count = 0;
+  if (*err ? 1 : (f = tmpfile ()) ? 0 : FAIL(3088))
+	 return 0;
+  if (! (size = cru_exported (g, fileno (f), &x, LANES, err)))
+	 goto a;
+  if ((t = (char *) malloc ((size_t) size + 1)) ? 0 : FAIL(3089))
+	 goto a;
+  if ((pread (fileno (f), t, (size_t) size, (off_t) 0) != (ssize_t) size) ? FAIL(3090) : 0)
+	 goto b;
+  t[size] = 0;
+  for (p = t; (p = strstr (p, "\">&lt;")); p++)
+	 count++;
+  for (p = t; (p = strstr (p, "&amp;&gt;</data>")); p++)
+	 count++;
+ b: free (t);
+ a: fclose (f);
+  return (*err ? 0 : (count == 2 * NUMBER_OF_VERTICES));
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  cru_graph g;
+  int err;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule};
+
+  struct cru_exporter_s x = {
+	 .format = CSV_FORMAT + 1};
+
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  g = cru_built (&b, 0, UNKILLABLE, LANES, &err);
+  v = round_tripped (g, &err);
+  v = (v ? deterministic (g, &err) : 0);
+  v = (v ? escaped (g, &err) : 0);
+  v = (v ? (! cru_exported (g, STDOUT_FILENO, &x, LANES, &err)) : 0);
+  if (err == CRU_BADFMT)
+	 err = 0;
+  else if (! err)
+	 v = 0;
+  cru_free_now (g, LANES, &err);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
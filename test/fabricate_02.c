@@ -50,14 +50,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2817))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3157))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2818) : ++edge_count ? 0 : FAIL(2819))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3158) : ++edge_count ? 0 : FAIL(3159))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2820) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3160) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -78,12 +78,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2821) : (e->e_magic != EDGE_MAGIC) ? FAIL(2822) : 0)
+  if ((! e) ? FAIL(3161) : (e->e_magic != EDGE_MAGIC) ? FAIL(3162) : 0)
 	 return;
-  e->e_magic = MUGGLE(116);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2823) : edge_count-- ? 0 : FAIL(2824))
+  e->e_magic = MUGGLE(119);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3163) : edge_count-- ? 0 : FAIL(3164))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2825) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3165) : 0)
 	 return;
   free (e);
 }
@@ -103,9 +103,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2826) : (a->e_magic != EDGE_MAGIC) ? FAIL(2827) : 0)
+  if ((! a) ? FAIL(3166) : (a->e_magic != EDGE_MAGIC) ? FAIL(3167) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2828) : (b->e_magic != EDGE_MAGIC) ? FAIL(2829) : 0)
+  if ((! b) ? FAIL(3168) : (b->e_magic != EDGE_MAGIC) ? FAIL(3169) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -127,7 +127,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2830) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2831) : 0)
+  if ((! e) ? GLOBAL_FAIL(3170) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3171) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -151,14 +151,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2832))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3172))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2833) : ++vertex_count ? 0 : FAIL(2834))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3173) : ++vertex_count ? 0 : FAIL(3174))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2835) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3175) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -180,12 +180,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2836) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2837) : 0)
+  if ((! v) ? FAIL(3176) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3177) : 0)
 	 return;
-  v->v_magic = MUGGLE(117);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2838) : vertex_count-- ? 0 : FAIL(2839))
+  v->v_magic = MUGGLE(120);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3178) : vertex_count-- ? 0 : FAIL(3179))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2840) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3180) : 0)
 	 return;
   free (v);
 }
@@ -205,12 +205,12 @@ free_flipped_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2841) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(2842) : 0)
+  if ((! v) ? FAIL(3181) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(3182) : 0)
 	 return;
-  v->v_magic = MUGGLE(118);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2843) : vertex_count-- ? 0 : FAIL(2844))
+  v->v_magic = MUGGLE(121);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3183) : vertex_count-- ? 0 : FAIL(3184))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2845) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3185) : 0)
 	 return;
   free (v);
 }
@@ -230,9 +230,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2846) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2847) : 0)
+  if ((! a) ? FAIL(3186) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3187) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2848) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2849) : 0)
+  if ((! b) ? FAIL(3188) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3189) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -255,7 +255,7 @@ vertex_hash (v, err)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? FAIL(2850) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2851) : 0)
+  if ((! v) ? FAIL(3190) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3191) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -284,7 +284,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(2852) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2853) : 0)
+  if ((! given_vertex) ? FAIL(3192) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3193) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -310,13 +310,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2854) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2855) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(3194) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3195) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(2856) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(2857) : 0)
+  if ((! local_vertex) ? FAIL(3196) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(3197) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(2858) : (remote_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(2859) : 0)
+  if ((! remote_vertex) ? FAIL(3198) : (remote_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(3199) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(2860) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3200) : 0);
 }
 
 
@@ -336,9 +336,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2861) : (given_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(2862) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3201) : (given_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(3202) : 0)
 	 return 0;
-  return ! ((edges_in != DIMENSION) ? FAIL(2863) : (edges_out != DIMENSION) ? FAIL(2864) : 0);
+  return ! ((edges_in != DIMENSION) ? FAIL(3203) : (edges_out != DIMENSION) ? FAIL(3204) : 0);
 }
 
 
@@ -357,7 +357,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2865) : (s < r) ? FAIL(2866) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3205) : (s < r) ? FAIL(3206) : 0) ? 0 : s);
 }
 
 
@@ -385,11 +385,11 @@ valid (g, err)
 		  .reduction = (cru_bop) sum,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2867))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(3207))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2868))
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(3208))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2869))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(3209))
 	 return 0;
   return 1;
 }
@@ -410,7 +410,7 @@ vflip (given_vertex, err)
 {
   vertex v;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(2870) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2871) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3210) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3211) : 0)
 	 return NULL;
   if ((v = vertex_of (given_vertex->v_value ^ (uintptr_t) (NUMBER_OF_VERTICES - 1), err)))
 	 v->v_magic = FLIPPED_VERTEX_MAGIC;
@@ -434,14 +434,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(2872);
+	 FAIL(3212);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(2873);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2874) : 0)
+	 FAIL(3213);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3214) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2875) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2876) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2877) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3215) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3216) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3217) : *err);
 }
 
 
@@ -495,11 +495,11 @@ main (argc, argv)
   cru_free_now (f, LANES, &err);
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
-  err = (edge_count ? THE_FAIL(2878) : vertex_count ? THE_FAIL(2879) : err);
+  err = (edge_count ? THE_FAIL(3218) : vertex_count ? THE_FAIL(3219) : err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2880);
+	 err = THE_FAIL(3220);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2881);
+	 err = THE_FAIL(3221);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
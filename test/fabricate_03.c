@@ -52,14 +52,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2882))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3222))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2883) : ++edge_count ? 0 : FAIL(2884))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3223) : ++edge_count ? 0 : FAIL(3224))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2885) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3225) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -80,12 +80,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2886) : (e->e_magic != EDGE_MAGIC) ? FAIL(2887) : 0)
+  if ((! e) ? FAIL(3226) : (e->e_magic != EDGE_MAGIC) ? FAIL(3227) : 0)
 	 return;
-  e->e_magic = MUGGLE(119);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2888) : edge_count-- ? 0 : FAIL(2889))
+  e->e_magic = MUGGLE(122);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3228) : edge_count-- ? 0 : FAIL(3229))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2890) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3230) : 0)
 	 return;
   free (e);
 }
@@ -105,9 +105,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2891) : (a->e_magic != EDGE_MAGIC) ? FAIL(2892) : 0)
+  if ((! a) ? FAIL(3231) : (a->e_magic != EDGE_MAGIC) ? FAIL(3232) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2893) : (b->e_magic != EDGE_MAGIC) ? FAIL(2894) : 0)
+  if ((! b) ? FAIL(3233) : (b->e_magic != EDGE_MAGIC) ? FAIL(3234) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -129,7 +129,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2895) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2896) : 0)
+  if ((! e) ? GLOBAL_FAIL(3235) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3236) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -151,12 +151,12 @@ free_flipped_edge (e, err)
 
 	  // Reclaim an edge as above assuming it has been flipped.
 {
-  if ((! e) ? FAIL(2897) : (e->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(2898) : 0)
+  if ((! e) ? FAIL(3237) : (e->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(3238) : 0)
 	 return;
-  e->e_magic = MUGGLE(120);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2899) : edge_count-- ? 0 : FAIL(2900))
+  e->e_magic = MUGGLE(123);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3239) : edge_count-- ? 0 : FAIL(3240))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2901) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3241) : 0)
 	 return;
   free (e);
 }
@@ -176,14 +176,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2902))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3242))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2903) : ++vertex_count ? 0 : FAIL(2904))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3243) : ++vertex_count ? 0 : FAIL(3244))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2905) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3245) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -205,12 +205,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2906) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2907) : 0)
+  if ((! v) ? FAIL(3246) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3247) : 0)
 	 return;
-  v->v_magic = MUGGLE(121);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2908) : vertex_count-- ? 0 : FAIL(2909))
+  v->v_magic = MUGGLE(124);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3248) : vertex_count-- ? 0 : FAIL(3249))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2910) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3250) : 0)
 	 return;
   free (v);
 }
@@ -230,12 +230,12 @@ free_flipped_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2911) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(2912) : 0)
+  if ((! v) ? FAIL(3251) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(3252) : 0)
 	 return;
-  v->v_magic = MUGGLE(122);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2913) : vertex_count-- ? 0 : FAIL(2914))
+  v->v_magic = MUGGLE(125);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3253) : vertex_count-- ? 0 : FAIL(3254))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2915) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3255) : 0)
 	 return;
   free (v);
 }
@@ -255,9 +255,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2916) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2917) : 0)
+  if ((! a) ? FAIL(3256) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3257) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2918) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2919) : 0)
+  if ((! b) ? FAIL(3258) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3259) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -280,7 +280,7 @@ vertex_hash (v, err)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? FAIL(2920) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2921) : 0)
+  if ((! v) ? FAIL(3260) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3261) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -309,7 +309,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(2922) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2923) : 0)
+  if ((! given_vertex) ? FAIL(3262) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3263) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -335,13 +335,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2924) : (connecting_edge->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(2925) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(3264) : (connecting_edge->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(3265) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(2926) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(2927) : 0)
+  if ((! local_vertex) ? FAIL(3266) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(3267) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(2928) : (remote_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(2929) : 0)
+  if ((! remote_vertex) ? FAIL(3268) : (remote_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(3269) : 0)
 	 return 0;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << (DIMENSION - connecting_edge->e_value))) ? FAIL(2930) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << (DIMENSION - connecting_edge->e_value))) ? FAIL(3270) : 0)
 	 return 0;
   return 1;
 }
@@ -363,9 +363,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(2931) : (given_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(2932) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3271) : (given_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(3272) : 0)
 	 return 0;
-  return ! ((edges_in != DIMENSION) ? FAIL(2933) : (edges_out != DIMENSION) ? FAIL(2934) : 0);
+  return ! ((edges_in != DIMENSION) ? FAIL(3273) : (edges_out != DIMENSION) ? FAIL(3274) : 0);
 }
 
 
@@ -386,7 +386,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2935) : (s < r) ? FAIL(2936) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3275) : (s < r) ? FAIL(3276) : 0) ? 0 : s);
 }
 
 
@@ -416,11 +416,11 @@ valid (g, err)
 		  .reduction = (cru_bop) sum,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(2937))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(3277))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(2938))
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(3278))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(2939))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(3279))
 	 return 0;
   return 1;
 }
@@ -443,7 +443,7 @@ vflip (given_vertex, err)
 {
   vertex v;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(2940) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2941) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3280) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3281) : 0)
 	 return NULL;
   if ((v = vertex_of (given_vertex->v_value ^ (uintptr_t) (NUMBER_OF_VERTICES - 1), err)))
 	 v->v_magic = FLIPPED_VERTEX_MAGIC;
@@ -467,7 +467,7 @@ eflip (label, err)
 {
   edge e;
 
-  if ((! label) ? FAIL(2942) : (label->e_magic != EDGE_MAGIC) ? FAIL(2943) : 0)
+  if ((! label) ? FAIL(3282) : (label->e_magic != EDGE_MAGIC) ? FAIL(3283) : 0)
 	 return NULL;
   if ((e = edge_of (DIMENSION - label->e_value, err)))
 	 e->e_magic = FLIPPED_EDGE_MAGIC;
@@ -491,14 +491,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(2944);
+	 FAIL(3284);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(2945);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(2946) : 0)
+	 FAIL(3285);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3286) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(2947) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(2948) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(2949) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3287) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3288) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3289) : *err);
 }
 
 
@@ -554,11 +554,11 @@ main (argc, argv)
   cru_free_now (f, LANES, &err);
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
-  err = (edge_count ? THE_FAIL(2950) : vertex_count ? THE_FAIL(2951) : err);
+  err = (edge_count ? THE_FAIL(3290) : vertex_count ? THE_FAIL(3291) : err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2952);
+	 err = THE_FAIL(3292);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(2953);
+	 err = THE_FAIL(3293);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -54,14 +54,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(2954))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3294))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2955) : ++edge_count ? 0 : FAIL(2956))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3295) : ++edge_count ? 0 : FAIL(3296))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(2957) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3297) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -82,12 +82,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(2958) : (e->e_magic != EDGE_MAGIC) ? FAIL(2959) : 0)
+  if ((! e) ? FAIL(3298) : (e->e_magic != EDGE_MAGIC) ? FAIL(3299) : 0)
 	 return;
-  e->e_magic = MUGGLE(123);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(2960) : edge_count-- ? 0 : FAIL(2961))
+  e->e_magic = MUGGLE(126);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3300) : edge_count-- ? 0 : FAIL(3301))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(2962) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3302) : 0)
 	 return;
   free (e);
 }
@@ -107,9 +107,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2963) : (a->e_magic != EDGE_MAGIC) ? FAIL(2964) : 0)
+  if ((! a) ? FAIL(3303) : (a->e_magic != EDGE_MAGIC) ? FAIL(3304) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2965) : (b->e_magic != EDGE_MAGIC) ? FAIL(2966) : 0)
+  if ((! b) ? FAIL(3305) : (b->e_magic != EDGE_MAGIC) ? FAIL(3306) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -131,7 +131,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(2967) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(2968) : 0)
+  if ((! e) ? GLOBAL_FAIL(3307) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3308) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -155,14 +155,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(2969))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3309))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2970) : ++vertex_count ? 0 : FAIL(2971))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3310) : ++vertex_count ? 0 : FAIL(3311))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(2972) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3312) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -184,12 +184,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(2973) : (v->v_magic != VERTEX_MAGIC) ? FAIL(2974) : 0)
+  if ((! v) ? FAIL(3313) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3314) : 0)
 	 return;
-  v->v_magic = MUGGLE(124);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(2975) : vertex_count-- ? 0 : FAIL(2976))
+  v->v_magic = MUGGLE(127);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3315) : vertex_count-- ? 0 : FAIL(3316))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(2977) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3317) : 0)
 	 return;
   free (v);
 }
@@ -210,9 +210,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(2978) : (a->v_magic != VERTEX_MAGIC) ? FAIL(2979) : 0)
+  if ((! a) ? FAIL(3318) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3319) : 0)
 	 return 0;
-  if ((! b) ? FAIL(2980) : (b->v_magic != VERTEX_MAGIC) ? FAIL(2981) : 0)
+  if ((! b) ? FAIL(3320) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3321) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -234,7 +234,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(2982) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(2983) : 0)
+  if ((! v) ? GLOBAL_FAIL(3322) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3323) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -264,7 +264,7 @@ building_rule (given_vertex, err)
   vertex remote_vertex;
   edge e;
 
-  if ((! given_vertex) ? FAIL(2984) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2985) : 0)
+  if ((! given_vertex) ? FAIL(3324) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3325) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -290,13 +290,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(2986) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(2987) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(3326) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3327) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(2988) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2989) : 0)
+  if ((! local_vertex) ? FAIL(3328) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3329) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(2990) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2991) : 0)
+  if ((! remote_vertex) ? FAIL(3330) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3331) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(2992) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3332) : 0);
 }
 
 
@@ -318,14 +318,14 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 {
   uintptr_t v, bits;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(2993) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(2994) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3333) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3334) : 0)
 	 return 0;
   v = given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
 	 bits += (v & 1);
   if (bits < ((DIMENSION >> 1) - 1))
-	 return ! ((edges_in != DIMENSION) ? FAIL(2995) : (edges_out != DIMENSION) ? FAIL(2996) : 0);
-  return ! ((edges_in != bits) ? FAIL(2997) : (edges_out != bits) ? FAIL(2998) : 0);
+	 return ! ((edges_in != DIMENSION) ? FAIL(3335) : (edges_out != DIMENSION) ? FAIL(3336) : 0);
+  return ! ((edges_in != bits) ? FAIL(3337) : (edges_out != bits) ? FAIL(3338) : 0);
 }
 
 
@@ -357,7 +357,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(2999) : (s < r) ? FAIL(3000) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3339) : (s < r) ? FAIL(3340) : 0) ? 0 : s);
 }
 
 
@@ -409,11 +409,11 @@ valid (g, err)
 		  .vacuous_case = (cru_nop) null,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3001))
+  if ((cru_vertex_count (g, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3341))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == REMAINING_EDGES) ? 0 : FAIL(3002))
+  if ((cru_edge_count (g, LANES, err) == REMAINING_EDGES) ? 0 : FAIL(3342))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == REMAINING_VERTICES) ? 0 : FAIL(3003))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == REMAINING_VERTICES) ? 0 : FAIL(3343))
 	 return 0;
   return 1;
 }
@@ -439,7 +439,7 @@ vertex_test (edges_in, given_vertex, edges_out, err)
   int bits;
   int b;
 
-  if ((! given_vertex) ? FAIL(3004) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3005) : 0)
+  if ((! given_vertex) ? FAIL(3344) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3345) : 0)
 	 return 0;
   b = (int) given_vertex->v_value;
   for (bits = 0; b; b >>= 1)
@@ -464,14 +464,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(3006);
+	 FAIL(3346);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(3007);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3008) : 0)
+	 FAIL(3347);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3348) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3009) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3010) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3011) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3349) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3350) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3351) : *err);
 }
 
 
@@ -525,11 +525,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(3012) : vertex_count ? THE_FAIL(3013) : global_err);
+	 err = (edge_count ? THE_FAIL(3352) : vertex_count ? THE_FAIL(3353) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3014);
+	 err = THE_FAIL(3354);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3015);
+	 err = THE_FAIL(3355);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -52,14 +52,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3016))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3356))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3017) : ++edge_count ? 0 : FAIL(3018))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3357) : ++edge_count ? 0 : FAIL(3358))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3019) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3359) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -80,12 +80,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(3020) : (e->e_magic != EDGE_MAGIC) ? FAIL(3021) : 0)
+  if ((! e) ? FAIL(3360) : (e->e_magic != EDGE_MAGIC) ? FAIL(3361) : 0)
 	 return;
-  e->e_magic = MUGGLE(125);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3022) : edge_count-- ? 0 : FAIL(3023))
+  e->e_magic = MUGGLE(128);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3362) : edge_count-- ? 0 : FAIL(3363))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3024) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3364) : 0)
 	 return;
   free (e);
 }
@@ -105,9 +105,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3025) : (a->e_magic != EDGE_MAGIC) ? FAIL(3026) : 0)
+  if ((! a) ? FAIL(3365) : (a->e_magic != EDGE_MAGIC) ? FAIL(3366) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3027) : (b->e_magic != EDGE_MAGIC) ? FAIL(3028) : 0)
+  if ((! b) ? FAIL(3367) : (b->e_magic != EDGE_MAGIC) ? FAIL(3368) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -129,7 +129,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(3029) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3030) : 0)
+  if ((! e) ? GLOBAL_FAIL(3369) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3370) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -153,14 +153,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3031))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3371))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3032) : ++vertex_count ? 0 : FAIL(3033))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3372) : ++vertex_count ? 0 : FAIL(3373))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3034) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3374) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -182,12 +182,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(3035) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3036) : 0)
+  if ((! v) ? FAIL(3375) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3376) : 0)
 	 return;
-  v->v_magic = MUGGLE(126);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3037) : vertex_count-- ? 0 : FAIL(3038))
+  v->v_magic = MUGGLE(129);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3377) : vertex_count-- ? 0 : FAIL(3378))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3039) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3379) : 0)
 	 return;
   free (v);
 }
@@ -208,9 +208,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3040) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3041) : 0)
+  if ((! a) ? FAIL(3380) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3381) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3042) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3043) : 0)
+  if ((! b) ? FAIL(3382) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3383) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -232,7 +232,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3044) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3045) : 0)
+  if ((! v) ? GLOBAL_FAIL(3384) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3385) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -262,7 +262,7 @@ building_rule (given_vertex, err)
   vertex remote_vertex;
   edge e;
 
-  if ((! given_vertex) ? FAIL(3046) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3047) : 0)
+  if ((! given_vertex) ? FAIL(3386) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3387) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -288,13 +288,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3048) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3049) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(3388) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3389) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(3050) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3051) : 0)
+  if ((! local_vertex) ? FAIL(3390) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3391) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(3052) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3053) : 0)
+  if ((! remote_vertex) ? FAIL(3392) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3393) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3054) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3394) : 0);
 }
 
 
@@ -316,14 +316,14 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 {
   int v, bits;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(3055) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3056) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3395) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3396) : 0)
 	 return 0;
   v = (int) given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
 	 bits += (v & 1);
   if (bits < ((DIMENSION >> 1) - 1))
-	 return ! ((edges_in != DIMENSION) ? FAIL(3057) : (edges_out != DIMENSION) ? FAIL(3058) : 0);
-  return ! ((edges_in != bits) ? FAIL(3059) : (edges_out != bits) ? FAIL(3060) : 0);
+	 return ! ((edges_in != DIMENSION) ? FAIL(3397) : (edges_out != DIMENSION) ? FAIL(3398) : 0);
+  return ! ((edges_in != bits) ? FAIL(3399) : (edges_out != bits) ? FAIL(3400) : 0);
 }
 
 
@@ -355,7 +355,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3061) : (s < r) ? FAIL(3062) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3401) : (s < r) ? FAIL(3402) : 0) ? 0 : s);
 }
 
 
@@ -407,11 +407,11 @@ valid (g, err)
 		  .vacuous_case = (cru_nop) null,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3063))
+  if ((cru_vertex_count (g, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3403))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == REMAINING_EDGES) ? 0 : FAIL(3064))
+  if ((cru_edge_count (g, LANES, err) == REMAINING_EDGES) ? 0 : FAIL(3404))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == REMAINING_VERTICES) ? 0 : FAIL(3065))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == REMAINING_VERTICES) ? 0 : FAIL(3405))
 	 return 0;
   return 1;
 }
@@ -437,11 +437,11 @@ edge_test (local_vertex, connecting_edge, adjacent_vertex, err)
   int bits;
   int b;
 
-  if ((! connecting_edge) ? FAIL(3066) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3067) : 0)
+  if ((! connecting_edge) ? FAIL(3406) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3407) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(3068) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3069) : 0)
+  if ((! local_vertex) ? FAIL(3408) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3409) : 0)
 	 return 0;
-  if ((! adjacent_vertex) ? FAIL(3070) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3071) : 0)
+  if ((! adjacent_vertex) ? FAIL(3410) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3411) : 0)
 	 return 0;
   b = (int) adjacent_vertex->v_value;
   for (bits = 0; b; b >>= 1)
@@ -466,14 +466,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(3072);
+	 FAIL(3412);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(3073);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3074) : 0)
+	 FAIL(3413);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3414) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3075) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3076) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3077) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3415) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3416) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3417) : *err);
 }
 
 
@@ -525,11 +525,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(3078) : vertex_count ? THE_FAIL(3079) : global_err);
+	 err = (edge_count ? THE_FAIL(3418) : vertex_count ? THE_FAIL(3419) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3080);
+	 err = THE_FAIL(3420);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3081);
+	 err = THE_FAIL(3421);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -52,14 +52,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3082))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3422))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3083) : ++edge_count ? 0 : FAIL(3084))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3423) : ++edge_count ? 0 : FAIL(3424))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3085) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3425) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -80,12 +80,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(3086) : (e->e_magic != EDGE_MAGIC) ? FAIL(3087) : 0)
+  if ((! e) ? FAIL(3426) : (e->e_magic != EDGE_MAGIC) ? FAIL(3427) : 0)
 	 return;
-  e->e_magic = MUGGLE(127);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3088) : edge_count-- ? 0 : FAIL(3089))
+  e->e_magic = MUGGLE(130);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3428) : edge_count-- ? 0 : FAIL(3429))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3090) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3430) : 0)
 	 return;
   free (e);
 }
@@ -105,9 +105,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3091) : (a->e_magic != EDGE_MAGIC) ? FAIL(3092) : 0)
+  if ((! a) ? FAIL(3431) : (a->e_magic != EDGE_MAGIC) ? FAIL(3432) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3093) : (b->e_magic != EDGE_MAGIC) ? FAIL(3094) : 0)
+  if ((! b) ? FAIL(3433) : (b->e_magic != EDGE_MAGIC) ? FAIL(3434) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -129,7 +129,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(3095) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3096) : 0)
+  if ((! e) ? GLOBAL_FAIL(3435) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3436) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -153,14 +153,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3097))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3437))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3098) : ++vertex_count ? 0 : FAIL(3099))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3438) : ++vertex_count ? 0 : FAIL(3439))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3100) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3440) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -182,12 +182,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(3101) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3102) : 0)
+  if ((! v) ? FAIL(3441) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3442) : 0)
 	 return;
-  v->v_magic = MUGGLE(128);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3103) : vertex_count-- ? 0 : FAIL(3104))
+  v->v_magic = MUGGLE(131);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3443) : vertex_count-- ? 0 : FAIL(3444))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3105) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3445) : 0)
 	 return;
   free (v);
 }
@@ -208,9 +208,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3106) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3107) : 0)
+  if ((! a) ? FAIL(3446) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3447) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3108) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3109) : 0)
+  if ((! b) ? FAIL(3448) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3449) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -232,7 +232,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3110) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3111) : 0)
+  if ((! v) ? GLOBAL_FAIL(3450) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3451) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -261,7 +261,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(3112) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3113) : 0)
+  if ((! given_vertex) ? FAIL(3452) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3453) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -287,13 +287,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3114) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3115) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(3454) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3455) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(3116) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3117) : 0)
+  if ((! local_vertex) ? FAIL(3456) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3457) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(3118) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3119) : 0)
+  if ((! remote_vertex) ? FAIL(3458) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3459) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3120) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3460) : 0);
 }
 
 
@@ -315,16 +315,16 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 {
   uintptr_t v, bits;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(3121) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3122) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3461) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3462) : 0)
 	 return 0;
   v = given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
 	 bits += (v & 1);
   if (bits < ((DIMENSION >> 1) - 1))
-	 return ! ((edges_in != DIMENSION) ? FAIL(3123) : (edges_out != DIMENSION) ? FAIL(3124) : 0);
+	 return ! ((edges_in != DIMENSION) ? FAIL(3463) : (edges_out != DIMENSION) ? FAIL(3464) : 0);
   if (bits == ((DIMENSION >> 1) - 1))
-	 return ! ((edges_in != bits) ? FAIL(3125) : (edges_out != DIMENSION) ? FAIL(3126) : 0);
-  return ! ((edges_in != bits) ? FAIL(3127) : edges_out ? FAIL(3128) : 0);
+	 return ! ((edges_in != bits) ? FAIL(3465) : (edges_out != DIMENSION) ? FAIL(3466) : 0);
+  return ! ((edges_in != bits) ? FAIL(3467) : edges_out ? FAIL(3468) : 0);
 }
 
 
@@ -358,7 +358,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3129) : (s < r) ? FAIL(3130) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3469) : (s < r) ? FAIL(3470) : 0) ? 0 : s);
 }
 
 
@@ -410,11 +410,11 @@ valid (g, err)
 		  .vacuous_case = (cru_nop) null,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3131))
+  if ((cru_vertex_count (g, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3471))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == REMAINING_EDGES) ? 0 : FAIL(3132))
+  if ((cru_edge_count (g, LANES, err) == REMAINING_EDGES) ? 0 : FAIL(3472))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == REMAINING_VERTICES) ? 0 : FAIL(3133))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == REMAINING_VERTICES) ? 0 : FAIL(3473))
 	 return 0;
   return 1;
 }
@@ -439,11 +439,11 @@ edge_test (local_vertex, connecting_edge, adjacent_vertex, err)
   int bits;
   int b;
 
-  if ((! connecting_edge) ? FAIL(3134) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3135) : 0)
+  if ((! connecting_edge) ? FAIL(3474) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3475) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(3136) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3137) : 0)
+  if ((! local_vertex) ? FAIL(3476) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3477) : 0)
 	 return 0;
-  if ((! adjacent_vertex) ? FAIL(3138) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3139) : 0)
+  if ((! adjacent_vertex) ? FAIL(3478) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3479) : 0)
 	 return 0;
   b = (int) local_vertex->v_value;
   for (bits = 0; b; b >>= 1)
@@ -468,14 +468,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(3140);
+	 FAIL(3480);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(3141);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3142) : 0)
+	 FAIL(3481);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3482) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3143) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3144) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3145) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3483) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3484) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3485) : *err);
 }
 
 
@@ -533,11 +533,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(3146) : vertex_count ? THE_FAIL(3147) : global_err);
+	 err = (edge_count ? THE_FAIL(3486) : vertex_count ? THE_FAIL(3487) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3148);
+	 err = THE_FAIL(3488);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3149);
+	 err = THE_FAIL(3489);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -68,14 +68,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3150))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3490))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3151) : ++edge_count ? 0 : FAIL(3152))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3491) : ++edge_count ? 0 : FAIL(3492))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3153) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3493) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -96,12 +96,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(3154) : (e->e_magic != EDGE_MAGIC) ? FAIL(3155) : 0)
+  if ((! e) ? FAIL(3494) : (e->e_magic != EDGE_MAGIC) ? FAIL(3495) : 0)
 	 return;
-  e->e_magic = MUGGLE(129);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3156) : edge_count-- ? 0 : FAIL(3157))
+  e->e_magic = MUGGLE(132);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3496) : edge_count-- ? 0 : FAIL(3497))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3158) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3498) : 0)
 	 return;
   free (e);
 }
@@ -121,9 +121,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3159) : (a->e_magic != EDGE_MAGIC) ? FAIL(3160) : 0)
+  if ((! a) ? FAIL(3499) : (a->e_magic != EDGE_MAGIC) ? FAIL(3500) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3161) : (b->e_magic != EDGE_MAGIC) ? FAIL(3162) : 0)
+  if ((! b) ? FAIL(3501) : (b->e_magic != EDGE_MAGIC) ? FAIL(3502) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -145,7 +145,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(3163) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3164) : 0)
+  if ((! e) ? GLOBAL_FAIL(3503) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3504) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -169,14 +169,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3165))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3505))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3166) : ++vertex_count ? 0 : FAIL(3167))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3506) : ++vertex_count ? 0 : FAIL(3507))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3168) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3508) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -198,12 +198,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(3169) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3170) : 0)
+  if ((! v) ? FAIL(3509) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3510) : 0)
 	 return;
-  v->v_magic = MUGGLE(130);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3171) : vertex_count-- ? 0 : FAIL(3172))
+  v->v_magic = MUGGLE(133);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3511) : vertex_count-- ? 0 : FAIL(3512))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3173) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3513) : 0)
 	 return;
   free (v);
 }
@@ -224,14 +224,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3174))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3514))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3175) : ++redex_count ? 0 : FAIL(3176))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3515) : ++redex_count ? 0 : FAIL(3516))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3177) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3517) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -250,12 +250,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(3178) : (r->r_magic != REDEX_MAGIC) ? FAIL(3179) : 0)
+  if ((! r) ? FAIL(3518) : (r->r_magic != REDEX_MAGIC) ? FAIL(3519) : 0)
 	 return;
-  r->r_magic = MUGGLE(131);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3180) : redex_count-- ? 0 : FAIL(3181))
+  r->r_magic = MUGGLE(134);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3520) : redex_count-- ? 0 : FAIL(3521))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3182) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3522) : 0)
 	 return;
   free (r);
 }
@@ -275,7 +275,7 @@ free_mapex (r, err)
 
 	  // Reclaim a mapex.
 {
-  if ((! r) ? FAIL(3183) : (r->r_magic != MAPEX_MAGIC) ? FAIL(3184) : 0)
+  if ((! r) ? FAIL(3523) : (r->r_magic != MAPEX_MAGIC) ? FAIL(3524) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -299,9 +299,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3185) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3186) : 0)
+  if ((! a) ? FAIL(3525) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3526) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3187) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3188) : 0)
+  if ((! b) ? FAIL(3527) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3528) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -323,7 +323,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3189) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3190) : 0)
+  if ((! v) ? GLOBAL_FAIL(3529) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3530) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -352,7 +352,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(3191) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3192) : 0)
+  if ((! given_vertex) ? FAIL(3531) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3532) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -378,13 +378,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3193) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3194) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(3533) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3534) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(3195) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3196) : 0)
+  if ((! local_vertex) ? FAIL(3535) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3536) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(3197) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3198) : 0)
+  if ((! remote_vertex) ? FAIL(3537) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3538) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3199) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3539) : 0);
 }
 
 
@@ -406,16 +406,16 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 {
   uintptr_t v, bits;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(3200) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3201) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3540) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3541) : 0)
 	 return 0;
   v = given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
 	 bits += (v & 1);
   if (bits < ((DIMENSION >> 1) - 1))
-	 return ! ((edges_in != DIMENSION) ? FAIL(3202) : (edges_out != DIMENSION) ? FAIL(3203) : 0);
+	 return ! ((edges_in != DIMENSION) ? FAIL(3542) : (edges_out != DIMENSION) ? FAIL(3543) : 0);
   if (bits == ((DIMENSION >> 1) - 1))
-	 return ! ((edges_in != bits) ? FAIL(3204) : (edges_out != DIMENSION) ? FAIL(3205) : 0);
-  return ! ((edges_in != bits) ? FAIL(3206) : edges_out ? FAIL(3207) : 0);
+	 return ! ((edges_in != bits) ? FAIL(3544) : (edges_out != DIMENSION) ? FAIL(3545) : 0);
+  return ! ((edges_in != bits) ? FAIL(3546) : edges_out ? FAIL(3547) : 0);
 }
 
 
@@ -450,7 +450,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3208) : (s < r) ? FAIL(3209) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3548) : (s < r) ? FAIL(3549) : 0) ? 0 : s);
 }
 
 
@@ -502,11 +502,11 @@ valid (g, err)
 		  .vacuous_case = (cru_nop) null,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3210))
+  if ((cru_vertex_count (g, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3550))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == REMAINING_EDGES) ? 0 : FAIL(3211))
+  if ((cru_edge_count (g, LANES, err) == REMAINING_EDGES) ? 0 : FAIL(3551))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == REMAINING_VERTICES) ? 0 : FAIL(3212))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == REMAINING_VERTICES) ? 0 : FAIL(3552))
 	 return 0;
   return 1;
 }
@@ -532,11 +532,11 @@ edge_map (local_vertex, connecting_edge, adjacent_vertex, err)
   uintptr_t v, bits;
   redex r;
 
-  if ((! connecting_edge) ? FAIL(3213) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3214) : 0)
+  if ((! connecting_edge) ? FAIL(3553) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3554) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(3215) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3216) : 0)
+  if ((! local_vertex) ? FAIL(3555) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3556) : 0)
 	 return 0;
-  if ((! adjacent_vertex) ? FAIL(3217) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3218) : 0)
+  if ((! adjacent_vertex) ? FAIL(3557) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3558) : 0)
 	 return 0;
   v = local_vertex->v_value;
   for (bits = 0; v; v >>= 1)
@@ -564,9 +564,9 @@ edge_reduction (a, b, err)
 	  // cru_bop is used in the f.fi_kernel.e_op.reduction field of the
 	  // filter f.
 {
-  if ((! a) ? FAIL(3219) : (a->r_magic != MAPEX_MAGIC) ? FAIL(3220) : 0)
+  if ((! a) ? FAIL(3559) : (a->r_magic != MAPEX_MAGIC) ? FAIL(3560) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(3221) : (b->r_magic != REDEX_MAGIC) ? FAIL(3222) : 0)
+  if ((! b) ? FAIL(3561) : (b->r_magic != REDEX_MAGIC) ? FAIL(3562) : 0)
 	 return NULL;
   if ((a->r_value == (DIMENSION >> 1)) ? 1 : (b->r_value == (DIMENSION >> 1)))
 	 return NULL;
@@ -605,14 +605,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(3223);
+	 FAIL(3563);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(3224);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3225) : 0)
+	 FAIL(3564);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3565) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3226) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3227) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3228) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3566) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3567) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3568) : *err);
 }
 
 
@@ -679,13 +679,13 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(3229) : vertex_count ? THE_FAIL(3230) : redex_count ? THE_FAIL(3231) : global_err);
+	 err = (edge_count ? THE_FAIL(3569) : vertex_count ? THE_FAIL(3570) : redex_count ? THE_FAIL(3571) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3232);
+	 err = THE_FAIL(3572);
   if ((! redex_lock_created) ? 0 : pthread_mutex_destroy (&(redex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3233);
+	 err = THE_FAIL(3573);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3234);
+	 err = THE_FAIL(3574);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -69,14 +69,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3235))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3575))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3236) : ++edge_count ? 0 : FAIL(3237))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3576) : ++edge_count ? 0 : FAIL(3577))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3238) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3578) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -97,12 +97,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(3239) : (e->e_magic != EDGE_MAGIC) ? FAIL(3240) : 0)
+  if ((! e) ? FAIL(3579) : (e->e_magic != EDGE_MAGIC) ? FAIL(3580) : 0)
 	 return;
-  e->e_magic = MUGGLE(132);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3241) : edge_count-- ? 0 : FAIL(3242))
+  e->e_magic = MUGGLE(135);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3581) : edge_count-- ? 0 : FAIL(3582))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3243) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3583) : 0)
 	 return;
   free (e);
 }
@@ -122,9 +122,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3244) : (a->e_magic != EDGE_MAGIC) ? FAIL(3245) : 0)
+  if ((! a) ? FAIL(3584) : (a->e_magic != EDGE_MAGIC) ? FAIL(3585) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3246) : (b->e_magic != EDGE_MAGIC) ? FAIL(3247) : 0)
+  if ((! b) ? FAIL(3586) : (b->e_magic != EDGE_MAGIC) ? FAIL(3587) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -146,7 +146,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(3248) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3249) : 0)
+  if ((! e) ? GLOBAL_FAIL(3588) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3589) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -170,14 +170,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3250))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3590))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3251) : ++vertex_count ? 0 : FAIL(3252))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3591) : ++vertex_count ? 0 : FAIL(3592))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3253) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3593) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -199,12 +199,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(3254) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3255) : 0)
+  if ((! v) ? FAIL(3594) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3595) : 0)
 	 return;
-  v->v_magic = MUGGLE(133);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3256) : vertex_count-- ? 0 : FAIL(3257))
+  v->v_magic = MUGGLE(136);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3596) : vertex_count-- ? 0 : FAIL(3597))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3258) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3598) : 0)
 	 return;
   free (v);
 }
@@ -225,14 +225,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3259))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3599))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3260) : ++redex_count ? 0 : FAIL(3261))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3600) : ++redex_count ? 0 : FAIL(3601))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3262) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3602) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -251,12 +251,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(3263) : (r->r_magic != REDEX_MAGIC) ? FAIL(3264) : 0)
+  if ((! r) ? FAIL(3603) : (r->r_magic != REDEX_MAGIC) ? FAIL(3604) : 0)
 	 return;
-  r->r_magic = MUGGLE(134);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3265) : redex_count-- ? 0 : FAIL(3266))
+  r->r_magic = MUGGLE(137);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3605) : redex_count-- ? 0 : FAIL(3606))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3267) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3607) : 0)
 	 return;
   free (r);
 }
@@ -274,7 +274,7 @@ free_mapex (r, err)
 
 	  // Reclaim a mapex.
 {
-  if ((! r) ? FAIL(3268) : (r->r_magic != MAPEX_MAGIC) ? FAIL(3269) : 0)
+  if ((! r) ? FAIL(3608) : (r->r_magic != MAPEX_MAGIC) ? FAIL(3609) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -299,9 +299,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3270) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3271) : 0)
+  if ((! a) ? FAIL(3610) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3611) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3272) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3273) : 0)
+  if ((! b) ? FAIL(3612) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3613) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -323,7 +323,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3274) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3275) : 0)
+  if ((! v) ? GLOBAL_FAIL(3614) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3615) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -352,7 +352,7 @@ building_rule (given_vertex, err)
 {
   uintptr_t outgoing_edge, v, remote_value, local_bits, remote_bits;
 
-  if ((! given_vertex) ? FAIL(3276) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3277) : 0)
+  if ((! given_vertex) ? FAIL(3616) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3617) : 0)
 	 return;
   v = given_vertex->v_value;
   for (local_bits = 0; v; v >>= 1)
@@ -385,13 +385,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3278) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3279) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(3618) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3619) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(3280) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3281) : 0)
+  if ((! local_vertex) ? FAIL(3620) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3621) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(3282) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3283) : 0)
+  if ((! remote_vertex) ? FAIL(3622) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3623) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3284) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3624) : 0);
 }
 
 
@@ -413,20 +413,20 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 {
   uintptr_t v, bits;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(3285) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3286) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3625) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3626) : 0)
 	 return 0;
   v = given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
 	 bits += (v & 1);
   if (! bits)
-	 return ! (edges_in ? FAIL(3287) : (edges_out != (DIMENSION - 1)) ? FAIL(3288) : 0);
+	 return ! (edges_in ? FAIL(3627) : (edges_out != (DIMENSION - 1)) ? FAIL(3628) : 0);
   if (bits == 2)
-	 return ! (((edges_in + (given_vertex->v_value >> (DIMENSION - 1))) != 2) ? FAIL(3289) : 0);
+	 return ! (((edges_in + (given_vertex->v_value >> (DIMENSION - 1))) != 2) ? FAIL(3629) : 0);
   if (bits == (DIMENSION >> 1))
-	 return ! ((edges_in != DIMENSION >> 1) ? FAIL(3290) : edges_out ? FAIL(3291) : 0);
-  if (((edges_out + bits) != DIMENSION) ? FAIL(3292) : 0)
+	 return ! ((edges_in != DIMENSION >> 1) ? FAIL(3630) : edges_out ? FAIL(3631) : 0);
+  if (((edges_out + bits) != DIMENSION) ? FAIL(3632) : 0)
 	 return 0;
-  return ! (((bits + edges_out) != DIMENSION) ? FAIL(3293) : 0);
+  return ! (((bits + edges_out) != DIMENSION) ? FAIL(3633) : 0);
 }
 
 
@@ -458,7 +458,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3294) : (s < r) ? FAIL(3295) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3634) : (s < r) ? FAIL(3635) : 0) ? 0 : s);
 }
 
 
@@ -511,11 +511,11 @@ valid (g, err)
 		  .vacuous_case = (cru_nop) null,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3296))
+  if ((cru_vertex_count (g, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3636))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == REMAINING_EDGES) ? 0 : FAIL(3297))
+  if ((cru_edge_count (g, LANES, err) == REMAINING_EDGES) ? 0 : FAIL(3637))
 	 return 0;
-  if (((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3298))
+  if (((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err) == REMAINING_VERTICES) ? 0 : FAIL(3638))
 	 return 0;
   return 1;
 }
@@ -537,7 +537,7 @@ vertex_test (edges_in, given_vertex, edges_out, err)
 	  // function cast to a cru_top is passed to the cru library as
 	  // f.fi_kernel.vertex.v_op.map in the filter f.
 {
-  if ((! given_vertex) ? FAIL(3299) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3300) : 0)
+  if ((! given_vertex) ? FAIL(3639) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3640) : 0)
 	 return NULL;
   if ((given_vertex->v_value != (NUMBER_OF_VERTICES >> 1)))
 	 return redex_of (VERTEX_PASS, err);
@@ -556,7 +556,7 @@ free_pass (r, err)
 	  redex r;
 	  int *err;
 {
-  if ((! r) ? FAIL(3301) : (r->r_magic != REDEX_MAGIC) ? FAIL(3302) : (r->r_value != VERTEX_PASS) ? FAIL(3303) : 0)
+  if ((! r) ? FAIL(3641) : (r->r_magic != REDEX_MAGIC) ? FAIL(3642) : (r->r_value != VERTEX_PASS) ? FAIL(3643) : 0)
 	 return;
   free_redex (r, err);
 }
@@ -583,11 +583,11 @@ edge_map (local_vertex, connecting_edge, adjacent_vertex, err)
   uintptr_t v, bits;
   redex r;
 
-  if ((! connecting_edge) ? FAIL(3304) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3305) : 0)
+  if ((! connecting_edge) ? FAIL(3644) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3645) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(3306) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3307) : 0)
+  if ((! local_vertex) ? FAIL(3646) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3647) : 0)
 	 return 0;
-  if ((! adjacent_vertex) ? FAIL(3308) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3309) : 0)
+  if ((! adjacent_vertex) ? FAIL(3648) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3649) : 0)
 	 return 0;
   v = local_vertex->v_value;
   for (bits = 0; v; v >>= 1)
@@ -615,9 +615,9 @@ edge_reduction (a, b, err)
 	  // cru_bop is used in the f.fi_kernel.e_op.reduction field of the
 	  // filter f.
 {
-  if ((! a) ? FAIL(3310) : (a->r_magic != MAPEX_MAGIC) ? FAIL(3311) : 0)
+  if ((! a) ? FAIL(3650) : (a->r_magic != MAPEX_MAGIC) ? FAIL(3651) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(3312) : (b->r_magic != REDEX_MAGIC) ? FAIL(3313) : 0)
+  if ((! b) ? FAIL(3652) : (b->r_magic != REDEX_MAGIC) ? FAIL(3653) : 0)
 	 return NULL;
   if ((a->r_value == (DIMENSION >> 1)) ? 1 : (b->r_value == (DIMENSION >> 1)))
 	 return NULL;
@@ -656,14 +656,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(3314);
+	 FAIL(3654);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(3315);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3316) : 0)
+	 FAIL(3655);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3656) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3317) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3318) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3319) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3657) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3658) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3659) : *err);
 }
 
 
@@ -734,13 +734,13 @@ main (argc, argv)
   free_vertex (f.fi_zone.initial_vertex, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(3320) : vertex_count ? THE_FAIL(3321) : redex_count ? THE_FAIL(3322) : global_err);
+	 err = (edge_count ? THE_FAIL(3660) : vertex_count ? THE_FAIL(3661) : redex_count ? THE_FAIL(3662) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3323);
+	 err = THE_FAIL(3663);
   if ((! redex_lock_created) ? 0 : pthread_mutex_destroy (&(redex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3324);
+	 err = THE_FAIL(3664);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3325);
+	 err = THE_FAIL(3665);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -52,14 +52,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3326))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3666))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3327) : ++edge_count ? 0 : FAIL(3328))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3667) : ++edge_count ? 0 : FAIL(3668))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3329) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3669) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -80,12 +80,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(3330) : (e->e_magic != EDGE_MAGIC) ? FAIL(3331) : 0)
+  if ((! e) ? FAIL(3670) : (e->e_magic != EDGE_MAGIC) ? FAIL(3671) : 0)
 	 return;
-  e->e_magic = MUGGLE(135);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3332) : edge_count-- ? 0 : FAIL(3333))
+  e->e_magic = MUGGLE(138);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3672) : edge_count-- ? 0 : FAIL(3673))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3334) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3674) : 0)
 	 return;
   free (e);
 }
@@ -105,9 +105,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3335) : (a->e_magic != EDGE_MAGIC) ? FAIL(3336) : 0)
+  if ((! a) ? FAIL(3675) : (a->e_magic != EDGE_MAGIC) ? FAIL(3676) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3337) : (b->e_magic != EDGE_MAGIC) ? FAIL(3338) : 0)
+  if ((! b) ? FAIL(3677) : (b->e_magic != EDGE_MAGIC) ? FAIL(3678) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -129,7 +129,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(3339) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3340) : 0)
+  if ((! e) ? GLOBAL_FAIL(3679) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3680) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -153,14 +153,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3341))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3681))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3342) : ++vertex_count ? 0 : FAIL(3343))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3682) : ++vertex_count ? 0 : FAIL(3683))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3344) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3684) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -182,12 +182,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(3345) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3346) : 0)
+  if ((! v) ? FAIL(3685) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3686) : 0)
 	 return;
-  v->v_magic = MUGGLE(136);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3347) : vertex_count-- ? 0 : FAIL(3348))
+  v->v_magic = MUGGLE(139);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3687) : vertex_count-- ? 0 : FAIL(3688))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3349) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3689) : 0)
 	 return;
   free (v);
 }
@@ -208,9 +208,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3350) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3351) : 0)
+  if ((! a) ? FAIL(3690) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3691) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3352) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3353) : 0)
+  if ((! b) ? FAIL(3692) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3693) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -232,7 +232,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3354) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3355) : 0)
+  if ((! v) ? GLOBAL_FAIL(3694) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3695) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -262,7 +262,7 @@ building_rule (given_vertex, err)
   vertex remote_vertex;
   edge e;
 
-  if ((! given_vertex) ? FAIL(3356) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3357) : 0)
+  if ((! given_vertex) ? FAIL(3696) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3697) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -303,7 +303,7 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 
 	  // Raise an error and return 1 because there should be no edges.
 {
-  FAIL(3358);
+  FAIL(3698);
   return 1;
 }
 
@@ -324,9 +324,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on there being no edges and the value
 	  // being 0.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(3359) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3360) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3699) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3700) : 0)
 	 return 0;
-  return ! (given_vertex->v_value ? FAIL(3361) : edges_in ? FAIL(3362) : edges_out ? FAIL(3363) : 0);
+  return ! (given_vertex->v_value ? FAIL(3701) : edges_in ? FAIL(3702) : edges_out ? FAIL(3703) : 0);
 }
 
 
@@ -343,7 +343,7 @@ fail (l, r, err)
 	  // Raise an error and return zero, because the set of vertices
 	  // shouldn't need reduction.
 {
-  FAIL(3364);
+  FAIL(3704);
   return 0;
 }
 
@@ -373,11 +373,11 @@ valid (g, err)
 		  .vacuous_case = (cru_nop) null,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == 1) ? 0 : FAIL(3365))
+  if ((cru_vertex_count (g, LANES, err) == 1) ? 0 : FAIL(3705))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == 0) ? 0 : FAIL(3366))
+  if ((cru_edge_count (g, LANES, err) == 0) ? 0 : FAIL(3706))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == 1) ? 0 : FAIL(3367))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == 1) ? 0 : FAIL(3707))
 	 return 0;
   return 1;
 }
@@ -395,11 +395,11 @@ edge_test (local_vertex, connecting_edge, adjacent_vertex, err)
 
 	  // Return 0 to filter out all edges.
 {
-  if ((! connecting_edge) ? FAIL(3368) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3369) : 0)
+  if ((! connecting_edge) ? FAIL(3708) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3709) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(3370) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3371) : 0)
+  if ((! local_vertex) ? FAIL(3710) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3711) : 0)
 	 return 0;
-  if ((! adjacent_vertex) ? FAIL(3372) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3373) : 0)
+  if ((! adjacent_vertex) ? FAIL(3712) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3713) : 0)
 	 return 0;
   return 0;
 }
@@ -419,14 +419,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(3374);
+	 FAIL(3714);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(3375);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3376) : 0)
+	 FAIL(3715);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3716) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3377) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3378) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3379) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3717) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3718) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3719) : *err);
 }
 
 
@@ -478,11 +478,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(3380) : vertex_count ? THE_FAIL(3381) : global_err);
+	 err = (edge_count ? THE_FAIL(3720) : vertex_count ? THE_FAIL(3721) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3382);
+	 err = THE_FAIL(3722);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3383);
+	 err = THE_FAIL(3723);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
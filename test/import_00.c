@@ -0,0 +1,290 @@
+// Write a hypercubic graph to a labeled text edge list padded with
+// comments so that it's parsed in several parcels, import it, and
+// check that it's all there. Do the same with a binary edge list.
+// Then check that an edge list with vertices unreachable from the
+// base is rejected by default, that they're dropped and reported if
+// requested, that deduplicating the graph and freeing it concurrently
+// afterwards find it unchanged, and that an edge list with a
+// malformed line is rejected.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <cru.h>
+#include "readme.h"
+
+// a vertex not in the hypercube
+#define STRAY ((uintptr_t) NUMBER_OF_VERTICES + 1)
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  uintptr_t local_vertex;
+	  uintptr_t connecting_edge;
+	  uintptr_t remote_vertex;
+	  int *err;
+
+	  // Return 1 if an edge is labeled by the index of the bit in
+	  // which its endpoints differ, and 0 otherwise.
+{
+  if (*err)
+	 return 0;
+  return ! ((remote_vertex >= NUMBER_OF_VERTICES) ? FAIL(3774) : ((local_vertex ^ remote_vertex) != (1 << connecting_edge)) ? FAIL(3775) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+vertex_checker (edges_in, vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  uintptr_t vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Return 1 for a vertex with all of its edges and fail
+	  // otherwise.
+{
+  if (*err ? 1 : (vertex >= NUMBER_OF_VERTICES) ? FAIL(3776) : (edges_out != DIMENSION) ? FAIL(3777) : 0)
+	 return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers, checking for overflow and
+	  // other errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(3778) : (s < r) ? FAIL(3779) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+
+
+FILE *
+edge_list (binary, stray, malformed, err)
+	  int binary;
+	  int stray;
+	  int malformed;
+	  int *err;
+
+	  // Return a file containing the edges of a hypercube with their
+	  // labels, optionally with an edge between two vertices outside
+	  // of it or a line with a missing label.
+{
+  uintptr_t vertex, axis;
+  uint64_t w[3];
+  FILE *f;
+
+  if ((f = tmpfile ()) ? 0 : FAIL(3780))
+	 return NULL;
+  if (binary ? 0 : (fprintf (f, "# a hypercube of dimension %d\n\n", DIMENSION) < 0) ? FAIL(3781) : 0)
+	 goto a;
+  for (vertex = 0; vertex < NUMBER_OF_VERTICES; vertex++)
+	 for (axis = 0; axis < DIMENSION; axis++)
+		if (binary)
+		  {
+			 w[0] = (uint64_t) vertex;
+			 w[1] = (uint64_t) (vertex ^ (uintptr_t) (1 << axis));
+			 w[2] = (uint64_t) axis;
+			 if ((fwrite (w, sizeof (w[0]), (size_t) 3, f) != 3) ? FAIL(3782) : 0)
+				goto a;
+		  }
+		else if ((fprintf (f, (vertex & 1) ? "0x%lx,\t0x%lx, %lu\r\n" : "%lu %lu %lu\n", vertex, vertex ^ (uintptr_t) (1 << axis), axis) < 0) ? FAIL(3783) : 0)
+		  goto a;
+		else if ((fprintf (f, "# the edge along axis %lu from vertex %lu\n", axis, vertex) < 0) ? FAIL(3784) : 0)
+		  goto a;
+  if (stray ? (fprintf (f, "%lu %lu 0\n", STRAY, STRAY + 1) < 0) : 0)
+	 goto a;
+  if (malformed ? (fprintf (f, "0 1\n") < 0) : 0)
+	 goto a;
+  if (fflush (f) ? FAIL(3785) : (lseek (fileno (f), (off_t) 0, SEEK_SET) < 0) ? FAIL(3786) : 0)
+	 goto a;
+  return f;
+ a: fclose (f);
+  return NULL;
+}
+
+
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check the vertex and edge counts of an imported graph and
+	  // traverse it to check that every vertex and edge is there, then
+	  // free it.
+{
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.outgoing = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+
+  if (! g)
+	 return 0;
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(3787))
+	 goto a;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(3788))
+	 goto a;
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(3789))
+	 goto a;
+  cru_free_now (g, LANES, err);
+  return 1;
+ a: cru_free_now (g, LANES, err);
+  return 0;
+}
+
+
+
+
+
+
+
+
+int
+rejected (f, i, e, err)
+	  FILE *f;
+	  cru_importer i;
+	  int e;
+	  int *err;
+
+	  // Import an edge list that's expected to be rejected with the
+	  // error code e and close the file.
+{
+  cru_graph g;
+  int v;
+
+  if (! f)
+	 return 0;
+  v = ! (g = cru_imported (fileno (f), i, (cru_vertex) 0, LANES, err));
+  cru_free_now (g, LANES, err);
+  fclose (f);
+  if (*err == e)
+	 *err = 0;
+  else
+	 v = 0;
+  return v;
+}
+
+
+
+
+
+
+
+
+int
+strays_dropped (f, i, err)
+	  FILE *f;
+	  cru_importer i;
+	  int *err;
+
+	  // Import an edge list with an edge between two vertices outside
+	  // of the hypercube, check that they're dropped and reported, and
+	  // that the counts are the same before and after deduplication,
+	  // and close the file.
+{
+  uintptr_t strays;
+  cru_graph g;
+  int v;
+
+  if (! f)
+	 return 0;
+  strays = 0;
+  i->strays = &strays;
+  v = ! ! (g = cru_imported (fileno (f), i, (cru_vertex) 0, LANES, err));
+  i->strays = NULL;
+  fclose (f);
+  if ((! v) ? 1 : (strays == 2) ? 0 : FAIL(3790))
+	 v = 0;
+  else if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(3791))
+	 v = 0;
+  else if ((cru_terminus_count (g, LANES, err) == 0) ? 0 : FAIL(3792))
+	 v = 0;
+  else
+	 return valid (cru_deduplicated (g, UNKILLABLE, LANES, err), err);
+  cru_free_now (g, LANES, err);
+  return v;
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit;
+  int err;
+  FILE *f;
+  int v;
+
+  struct cru_importer_s i = {
+	 .labeled = 1};
+
+  v = 0;
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  if ((f = edge_list (0, 0, 0, &err)))
+	 {
+		v = valid (cru_imported (fileno (f), &i, (cru_vertex) 0, LANES, &err), &err);
+		fclose (f);
+	 }
+  i.binary = 1;
+  if ((v ? (f = edge_list (1, 0, 0, &err)) : NULL))
+	 {
+		v = valid (cru_imported (fileno (f), &i, (cru_vertex) 0, LANES, &err), &err);
+		fclose (f);
+	 }
+  i.binary = 0;
+  v = (v ? rejected (edge_list (0, 1, 0, &err), &i, CRU_BADBAS, &err) : 0);
+  v = (v ? strays_dropped (edge_list (0, 1, 0, &err), &i, &err) : 0);
+  v = (v ? rejected (edge_list (0, 0, 1, &err), &i, CRU_BADFIL, &err) : 0);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
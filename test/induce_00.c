@@ -66,14 +66,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3434))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3793))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3435) : ++redex_count ? 0 : FAIL(3436))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3794) : ++redex_count ? 0 : FAIL(3795))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3437) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3796) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -94,12 +94,12 @@ free_redex (r, err)
 	  // passed to the cru library as i.in_fold.r_free in the inducer
 	  // i.
 {
-  if ((! r) ? FAIL(3438) : (r->r_magic != REDEX_MAGIC) ? FAIL(3439) : 0)
+  if ((! r) ? FAIL(3797) : (r->r_magic != REDEX_MAGIC) ? FAIL(3798) : 0)
 	 return;
-  r->r_magic = MUGGLE(139);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3440) : redex_count-- ? 0 : FAIL(3441))
+  r->r_magic = MUGGLE(142);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3799) : redex_count-- ? 0 : FAIL(3800))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3442) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3801) : 0)
 	 return;
   free (r);
 }
@@ -122,14 +122,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3443))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3802))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3444) : ++edge_count ? 0 : FAIL(3445))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3803) : ++edge_count ? 0 : FAIL(3804))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3446) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3805) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -150,12 +150,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(3447) : (e->e_magic != EDGE_MAGIC) ? FAIL(3448) : 0)
+  if ((! e) ? FAIL(3806) : (e->e_magic != EDGE_MAGIC) ? FAIL(3807) : 0)
 	 return;
-  e->e_magic = MUGGLE(140);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3449) : edge_count-- ? 0 : FAIL(3450))
+  e->e_magic = MUGGLE(143);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3808) : edge_count-- ? 0 : FAIL(3809))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3451) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3810) : 0)
 	 return;
   free (e);
 }
@@ -175,9 +175,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3452) : (a->e_magic != EDGE_MAGIC) ? FAIL(3453) : 0)
+  if ((! a) ? FAIL(3811) : (a->e_magic != EDGE_MAGIC) ? FAIL(3812) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3454) : (b->e_magic != EDGE_MAGIC) ? FAIL(3455) : 0)
+  if ((! b) ? FAIL(3813) : (b->e_magic != EDGE_MAGIC) ? FAIL(3814) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -199,7 +199,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(3456) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3457) : 0)
+  if ((! e) ? GLOBAL_FAIL(3815) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3816) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -223,14 +223,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3458))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3817))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3459) : ++vertex_count ? 0 : FAIL(3460))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3818) : ++vertex_count ? 0 : FAIL(3819))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3461) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3820) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -252,12 +252,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(3462) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3463) : 0)
+  if ((! v) ? FAIL(3821) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3822) : 0)
 	 return;
-  v->v_magic = MUGGLE(141);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3464) : vertex_count-- ? 0 : FAIL(3465))
+  v->v_magic = MUGGLE(144);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3823) : vertex_count-- ? 0 : FAIL(3824))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3466) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3825) : 0)
 	 return;
   free (v);
 }
@@ -278,9 +278,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3467) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3468) : 0)
+  if ((! a) ? FAIL(3826) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3827) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3469) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3470) : 0)
+  if ((! b) ? FAIL(3828) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3829) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -304,7 +304,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3471) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3472) : 0)
+  if ((! v) ? GLOBAL_FAIL(3830) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3831) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -335,7 +335,7 @@ building_rule (given_vertex, err)
   vertex r;
   edge e;
 
-  if ((! given_vertex) ? FAIL(3473) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3474) : 0)
+  if ((! given_vertex) ? FAIL(3832) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3833) : 0)
 	 return;
   v = given_vertex->v_value;
   for (local_bits = 0; v; v >>= 1)
@@ -373,13 +373,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3475) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3476) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(3834) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3835) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(3477) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3478) : 0)
+  if ((! local_vertex) ? FAIL(3836) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3837) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(3479) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3480) : 0)
+  if ((! remote_vertex) ? FAIL(3838) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3839) : 0)
 	 return NULL;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3481) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3840) : 0)
 	 return NULL;
   r = redex_of (1, err);
   return r;
@@ -405,16 +405,16 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
   uintptr_t v, bits;
   redex r;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(3482) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3483) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3841) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3842) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(3484) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(3485) : 0)
+  if ((! edges_in) ? FAIL(3843) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(3844) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(3486) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(3487) : 0)
+  if ((! edges_out) ? FAIL(3845) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(3846) : 0)
 	 return NULL;
   v = given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
 	 bits += (v & 1);
-  if ((edges_in->r_value != bits) ? FAIL(3488) : (edges_out->r_value != (DIMENSION - bits)) ? FAIL(3489) : 0)
+  if ((edges_in->r_value != bits) ? FAIL(3847) : (edges_out->r_value != (DIMENSION - bits)) ? FAIL(3848) : 0)
 	 return NULL;
   r = redex_of (1, err);
   return r;
@@ -438,12 +438,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(3490) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(3849) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(3491) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(3850) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(3492) : (s < (r ? r->r_value : 0)) ? FAIL(3493) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(3851) : (s < (r ? r->r_value : 0)) ? FAIL(3852) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -522,19 +522,19 @@ valid (g, path_count, err)
   int v;
 
   v = 0;
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(3494))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(3853))
 	 goto a;
-  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1) ? 0 : FAIL(3495))
+  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1) ? 0 : FAIL(3854))
 	 goto a;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(3496))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(3855))
 	 goto a;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(3497))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(3856))
 	 goto a;
-  if ((r->r_value == NUMBER_OF_VERTICES) ? 0 : FAIL(3498))
+  if ((r->r_value == NUMBER_OF_VERTICES) ? 0 : FAIL(3857))
 	 goto b;
-  if ((! path_count) ? FAIL(3499) : (path_count->r_magic == REDEX_MAGIC) ? 0 : FAIL(3500))
+  if ((! path_count) ? FAIL(3858) : (path_count->r_magic == REDEX_MAGIC) ? 0 : FAIL(3859))
 	 goto b;
-  v = ((path_count->r_value == (1 + variations (DIMENSION))) ? 1 : ! FAIL(3501));
+  v = ((path_count->r_value == (1 + variations (DIMENSION))) ? 1 : ! FAIL(3860));
  b: free_redex (r, err); 
  a: free_redex (path_count, err);
   return v;
@@ -577,11 +577,11 @@ path_counter (local_vertex, connecting_edge, remote_value, err)
 {
   redex r;
 
-  if (*err ? 1 : (! local_vertex) ? FAIL(3502) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3503) : 0)
+  if (*err ? 1 : (! local_vertex) ? FAIL(3861) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3862) : 0)
 	 return NULL;
-  if ((! connecting_edge) ? FAIL(3504) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3505) : 0)
+  if ((! connecting_edge) ? FAIL(3863) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3864) : 0)
 	 return NULL;
-  if ((! remote_value) ? FAIL(3506) : (remote_value->r_magic != REDEX_MAGIC) ? FAIL(3507) : 0)
+  if ((! remote_value) ? FAIL(3865) : (remote_value->r_magic != REDEX_MAGIC) ? FAIL(3866) : 0)
 	 return NULL;
   r = redex_of (remote_value->r_value, err);
   return r;
@@ -605,14 +605,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(3508);
+	 FAIL(3867);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(3509);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3510) : 0)
+	 FAIL(3868);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3869) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3511) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3512) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3513) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3870) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3871) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3872) : *err);
 }
 
 
@@ -677,13 +677,13 @@ main (argc, argv)
   pthread_mutex_lock (&edge_lock);
   pthread_mutex_lock (&vertex_lock);
   if (! err)
-	 err = (edge_count ? THE_FAIL(3514) : vertex_count ? THE_FAIL(3515) : redex_count ? THE_FAIL(3516) : global_err);
+	 err = (edge_count ? THE_FAIL(3873) : vertex_count ? THE_FAIL(3874) : redex_count ? THE_FAIL(3875) : global_err);
   pthread_mutex_unlock (&vertex_lock);
   pthread_mutex_unlock (&edge_lock);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3517);
+	 err = THE_FAIL(3876);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3518);
+	 err = THE_FAIL(3877);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
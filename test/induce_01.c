@@ -67,14 +67,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3519))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3878))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3520) : ++redex_count ? 0 : FAIL(3521))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3879) : ++redex_count ? 0 : FAIL(3880))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3522) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3881) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -95,12 +95,12 @@ free_redex (r, err)
 	  // passed to the cru library as i.in_fold.r_free in the inducer
 	  // i.
 {
-  if ((! r) ? FAIL(3523) : (r->r_magic != REDEX_MAGIC) ? FAIL(3524) : 0)
+  if ((! r) ? FAIL(3882) : (r->r_magic != REDEX_MAGIC) ? FAIL(3883) : 0)
 	 return;
-  r->r_magic = MUGGLE(142);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3525) : redex_count-- ? 0 : FAIL(3526))
+  r->r_magic = MUGGLE(145);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3884) : redex_count-- ? 0 : FAIL(3885))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3527) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3886) : 0)
 	 return;
   free (r);
 }
@@ -122,14 +122,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3528))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3887))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3529) : ++edge_count ? 0 : FAIL(3530))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3888) : ++edge_count ? 0 : FAIL(3889))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3531) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3890) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -150,12 +150,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(3532) : (e->e_magic != EDGE_MAGIC) ? FAIL(3533) : 0)
+  if ((! e) ? FAIL(3891) : (e->e_magic != EDGE_MAGIC) ? FAIL(3892) : 0)
 	 return;
-  e->e_magic = MUGGLE(143);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3534) : edge_count-- ? 0 : FAIL(3535))
+  e->e_magic = MUGGLE(146);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3893) : edge_count-- ? 0 : FAIL(3894))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3536) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3895) : 0)
 	 return;
   free (e);
 }
@@ -175,9 +175,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3537) : (a->e_magic != EDGE_MAGIC) ? FAIL(3538) : 0)
+  if ((! a) ? FAIL(3896) : (a->e_magic != EDGE_MAGIC) ? FAIL(3897) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3539) : (b->e_magic != EDGE_MAGIC) ? FAIL(3540) : 0)
+  if ((! b) ? FAIL(3898) : (b->e_magic != EDGE_MAGIC) ? FAIL(3899) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -199,7 +199,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(3541) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3542) : 0)
+  if ((! e) ? GLOBAL_FAIL(3900) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3901) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -223,14 +223,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3543))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3902))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3544) : ++vertex_count ? 0 : FAIL(3545))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3903) : ++vertex_count ? 0 : FAIL(3904))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3546) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3905) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -252,12 +252,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(3547) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3548) : 0)
+  if ((! v) ? FAIL(3906) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3907) : 0)
 	 return;
-  v->v_magic = MUGGLE(144);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3549) : vertex_count-- ? 0 : FAIL(3550))
+  v->v_magic = MUGGLE(147);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3908) : vertex_count-- ? 0 : FAIL(3909))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3551) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3910) : 0)
 	 return;
   free (v);
 }
@@ -278,9 +278,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3552) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3553) : 0)
+  if ((! a) ? FAIL(3911) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3912) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3554) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3555) : 0)
+  if ((! b) ? FAIL(3913) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3914) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -304,7 +304,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3556) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3557) : 0)
+  if ((! v) ? GLOBAL_FAIL(3915) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3916) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -335,7 +335,7 @@ building_rule (given_vertex, err)
   vertex r;
   edge e;
 
-  if ((! given_vertex) ? FAIL(3558) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3559) : 0)
+  if ((! given_vertex) ? FAIL(3917) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3918) : 0)
 	 return;
   v = given_vertex->v_value;
   for (local_bits = 0; v; v >>= 1)
@@ -371,13 +371,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3560) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3561) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(3919) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3920) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(3562) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3563) : 0)
+  if ((! local_vertex) ? FAIL(3921) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3922) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(3564) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3565) : 0)
+  if ((! remote_vertex) ? FAIL(3923) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3924) : 0)
 	 return NULL;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3566) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(3925) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -401,16 +401,16 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 {
   uintptr_t v, bits;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(3567) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3568) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(3926) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3927) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(3569) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(3570) : 0)
+  if ((! edges_in) ? FAIL(3928) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(3929) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(3571) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(3572) : 0)
+  if ((! edges_out) ? FAIL(3930) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(3931) : 0)
 	 return NULL;
   v = given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
 	 bits += (v & 1);
-  if ((edges_in->r_value != bits) ? FAIL(3573) : (edges_out->r_value != (DIMENSION - bits)) ? FAIL(3574) : 0)
+  if ((edges_in->r_value != bits) ? FAIL(3932) : (edges_out->r_value != (DIMENSION - bits)) ? FAIL(3933) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -435,12 +435,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(3575) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(3934) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(3576) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(3935) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(3577) : (s < (r ? r->r_value : 0)) ? FAIL(3578) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(3936) : (s < (r ? r->r_value : 0)) ? FAIL(3937) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -517,19 +517,19 @@ valid (g, path_count, err)
   int v;
 
   v = 0;
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(3579))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(3938))
 	 goto a;
-  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1) ? 0 : FAIL(3580))
+  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1) ? 0 : FAIL(3939))
 	 goto a;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(3581))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(3940))
 	 goto a;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(3582))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(3941))
 	 goto a;
-  if ((r->r_value == NUMBER_OF_VERTICES) ? 0 : FAIL(3583))
+  if ((r->r_value == NUMBER_OF_VERTICES) ? 0 : FAIL(3942))
 	 goto b;
-  if ((! path_count) ? FAIL(3584) : (path_count->r_magic == REDEX_MAGIC) ? 0 : FAIL(3585))
+  if ((! path_count) ? FAIL(3943) : (path_count->r_magic == REDEX_MAGIC) ? 0 : FAIL(3944))
 	 goto b;
-  v = ((path_count->r_value == (1 + variations (DIMENSION - 1))) ? 1 : ! FAIL(3586));
+  v = ((path_count->r_value == (1 + variations (DIMENSION - 1))) ? 1 : ! FAIL(3945));
  b: free_redex (r, err); 
  a: free_redex (path_count, err);
   return v;
@@ -570,11 +570,11 @@ path_counter (local_vertex, connecting_edge, remote_value, err)
 	  // returning the partial sum associated with the terminus of the edge
 	  // in the course of an induction.
 {
-  if (*err ? 1 : (! local_vertex) ? FAIL(3587) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3588) : 0)
+  if (*err ? 1 : (! local_vertex) ? FAIL(3946) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3947) : 0)
 	 return NULL;
-  if ((! connecting_edge) ? FAIL(3589) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3590) : 0)
+  if ((! connecting_edge) ? FAIL(3948) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3949) : 0)
 	 return NULL;
-  if ((! remote_value) ? FAIL(3591) : (remote_value->r_magic != REDEX_MAGIC) ? FAIL(3592) : 0)
+  if ((! remote_value) ? FAIL(3950) : (remote_value->r_magic != REDEX_MAGIC) ? FAIL(3951) : 0)
 	 return NULL;
   return redex_of (remote_value->r_value, err);
 }
@@ -597,14 +597,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(3593);
+	 FAIL(3952);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(3594);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3595) : 0)
+	 FAIL(3953);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3954) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3596) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3597) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3598) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3955) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3956) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3957) : *err);
 }
 
 
@@ -671,13 +671,13 @@ main (argc, argv)
   pthread_mutex_lock (&edge_lock);
   pthread_mutex_lock (&vertex_lock);
   if (! err)
-	 err = (edge_count ? THE_FAIL(3599) : vertex_count ? THE_FAIL(3600) : redex_count ? THE_FAIL(3601) : global_err);
+	 err = (edge_count ? THE_FAIL(3958) : vertex_count ? THE_FAIL(3959) : redex_count ? THE_FAIL(3960) : global_err);
   pthread_mutex_unlock (&vertex_lock);
   pthread_mutex_unlock (&edge_lock);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3602);
+	 err = THE_FAIL(3961);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3603);
+	 err = THE_FAIL(3962);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
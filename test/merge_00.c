@@ -68,14 +68,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3613))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3972))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3614) : ++redex_count ? 0 : FAIL(3615))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3973) : ++redex_count ? 0 : FAIL(3974))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3616) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3975) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -94,12 +94,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(3617) : (r->r_magic != REDEX_MAGIC) ? FAIL(3618) : 0)
+  if ((! r) ? FAIL(3976) : (r->r_magic != REDEX_MAGIC) ? FAIL(3977) : 0)
 	 return;
-  r->r_magic = MUGGLE(145);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3619) : redex_count-- ? 0 : FAIL(3620))
+  r->r_magic = MUGGLE(148);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3978) : redex_count-- ? 0 : FAIL(3979))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3621) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3980) : 0)
 	 return;
   free (r);
 }
@@ -123,12 +123,12 @@ free_property (r, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as c.me_classifier.cl_prop.vertex.m_free in the merger c.
 {
-  if ((! r) ? FAIL(3622) : (r->r_magic != PROPERTY_MAGIC) ? FAIL(3623) : 0)
+  if ((! r) ? FAIL(3981) : (r->r_magic != PROPERTY_MAGIC) ? FAIL(3982) : 0)
 	 return;
-  r->r_magic = MUGGLE(146);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3624) : redex_count-- ? 0 : FAIL(3625))
+  r->r_magic = MUGGLE(149);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(3983) : redex_count-- ? 0 : FAIL(3984))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3626) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3985) : 0)
 	 return;
   free (r);
 }
@@ -149,9 +149,9 @@ equal_properties (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed as
 	  // c.me_classifier.cl_order.equal in the merger c.
 {
-  if ((! a) ? FAIL(3627) : (a->r_magic != PROPERTY_MAGIC) ? FAIL(3628) : 0)
+  if ((! a) ? FAIL(3986) : (a->r_magic != PROPERTY_MAGIC) ? FAIL(3987) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3629) : (b->r_magic != PROPERTY_MAGIC) ? FAIL(3630) : 0)
+  if ((! b) ? FAIL(3988) : (b->r_magic != PROPERTY_MAGIC) ? FAIL(3989) : 0)
 	 return 0;
   return a->r_value == b->r_value;
 }
@@ -175,7 +175,7 @@ property_hash (r)
   size_t i;
   uintptr_t u;
 
-  if ((! r) ? GLOBAL_FAIL(3631) : (r->r_magic != PROPERTY_MAGIC) ? GLOBAL_FAIL(3632) : 0)
+  if ((! r) ? GLOBAL_FAIL(3990) : (r->r_magic != PROPERTY_MAGIC) ? GLOBAL_FAIL(3991) : 0)
 	 return 0;
   u = r->r_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -199,14 +199,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3633))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3992))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3634) : ++edge_count ? 0 : FAIL(3635))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3993) : ++edge_count ? 0 : FAIL(3994))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3636) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3995) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -227,12 +227,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(3637) : (e->e_magic != EDGE_MAGIC) ? FAIL(3638) : 0)
+  if ((! e) ? FAIL(3996) : (e->e_magic != EDGE_MAGIC) ? FAIL(3997) : 0)
 	 return;
-  e->e_magic = MUGGLE(147);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3639) : edge_count-- ? 0 : FAIL(3640))
+  e->e_magic = MUGGLE(150);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(3998) : edge_count-- ? 0 : FAIL(3999))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3641) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4000) : 0)
 	 return;
   free (e);
 }
@@ -254,7 +254,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(3642) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3643) : 0)
+  if ((! e) ? GLOBAL_FAIL(4001) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4002) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -279,9 +279,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for merging.
 {
-  if ((! a) ? FAIL(3644) : (a->e_magic != EDGE_MAGIC) ? FAIL(3645) : 0)
+  if ((! a) ? FAIL(4003) : (a->e_magic != EDGE_MAGIC) ? FAIL(4004) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3646) : (b->e_magic != EDGE_MAGIC) ? FAIL(3647) : 0)
+  if ((! b) ? FAIL(4005) : (b->e_magic != EDGE_MAGIC) ? FAIL(4006) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -302,14 +302,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3648))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4007))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3649) : ++vertex_count ? 0 : FAIL(3650))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4008) : ++vertex_count ? 0 : FAIL(4009))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3651) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4010) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -331,12 +331,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(3652) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3653) : 0)
+  if ((! v) ? FAIL(4011) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4012) : 0)
 	 return;
-  v->v_magic = MUGGLE(148);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3654) : vertex_count-- ? 0 : FAIL(3655))
+  v->v_magic = MUGGLE(151);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4013) : vertex_count-- ? 0 : FAIL(4014))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3656) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4015) : 0)
 	 return;
   free (v);
 }
@@ -355,12 +355,12 @@ free_fused_vertex (v, err)
 
 	  // Reclaim a vertex resulting from a fusion operation.
 {
-  if ((! v) ? FAIL(3657) : (v->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3658) : 0)
+  if ((! v) ? FAIL(4016) : (v->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4017) : 0)
 	 return;
-  v->v_magic = MUGGLE(149);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3659) : vertex_count-- ? 0 : FAIL(3660))
+  v->v_magic = MUGGLE(152);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4018) : vertex_count-- ? 0 : FAIL(4019))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3661) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4020) : 0)
 	 return;
   free (v);
 }
@@ -381,9 +381,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3662) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3663) : 0)
+  if ((! a) ? FAIL(4021) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4022) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3664) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3665) : 0)
+  if ((! b) ? FAIL(4023) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4024) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -403,9 +403,9 @@ fused_equal_vertices (a, b, err)
 	  // Compare two fused vertices and return non-zero if they are
 	  // equal.
 {
-  if ((! a) ? FAIL(3666) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3667) : 0)
+  if ((! a) ? FAIL(4025) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4026) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3668) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3669) : 0)
+  if ((! b) ? FAIL(4027) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4028) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -429,7 +429,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3670) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3671) : 0)
+  if ((! v) ? GLOBAL_FAIL(4029) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4030) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -454,7 +454,7 @@ fused_vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3672) : (v->v_magic != FUSED_VERTEX_MAGIC) ? GLOBAL_FAIL(3673) : 0)
+  if ((! v) ? GLOBAL_FAIL(4031) : (v->v_magic != FUSED_VERTEX_MAGIC) ? GLOBAL_FAIL(4032) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -485,7 +485,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(3674) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3675) : 0)
+  if ((! given_vertex) ? FAIL(4033) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4034) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -513,15 +513,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3676) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3677) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4035) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4036) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(3678) : (local_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3679) : 0)
+  if ((! local_vertex) ? FAIL(4037) : (local_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4038) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(3680) : (remote_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3681) : 0)
+  if ((! remote_vertex) ? FAIL(4039) : (remote_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4040) : 0)
 	 return NULL;
   if ((local_vertex->v_value == remote_vertex->v_value) ? (! (connecting_edge->e_value)) : 0)
 	 goto a;
-  if ((((local_vertex->v_value ^ remote_vertex->v_value) << 1) != ( 1 << connecting_edge->e_value)) ? FAIL(3682) : 0)
+  if ((((local_vertex->v_value ^ remote_vertex->v_value) << 1) != ( 1 << connecting_edge->e_value)) ? FAIL(4041) : 0)
 	 return NULL;
  a: return redex_of (1, err);
 }
@@ -543,13 +543,13 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(3683) : (given_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3684) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4042) : (given_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4043) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(3685) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(3686) : 0)
+  if ((! edges_in) ? FAIL(4044) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(4045) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(3687) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(3688) : 0)
+  if ((! edges_out) ? FAIL(4046) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(4047) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DIMENSION) ? FAIL(3689) : (edges_out->r_value != DIMENSION) ? FAIL(3690) : 0)
+  if ((edges_in->r_value != DIMENSION) ? FAIL(4048) : (edges_out->r_value != DIMENSION) ? FAIL(4049) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -574,12 +574,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(3691) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(4050) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(3692) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(4051) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(3693) : (s < (r ? r->r_value : 0)) ? FAIL(3694) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4052) : (s < (r ? r->r_value : 0)) ? FAIL(4053) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -642,16 +642,16 @@ valid (g, err)
 
   if (*err)
 	 return 0;
-  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(3695))
+  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(4054))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(3696))
+  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(4055))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(3697))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(4056))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(3698))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(4057))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES >> 1)))
-	 FAIL(3699);
+	 FAIL(4058);
   free_redex (r, err);
   return v;
 }
@@ -676,9 +676,9 @@ common_property (edges_in, given_vertex, edges_out, err)
 {
   redex r;
 
-  if ((! given_vertex) ? FAIL(3700) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3701) : 0)
+  if ((! given_vertex) ? FAIL(4059) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4060) : 0)
 	 return NULL;
-  if (edges_in ? FAIL(3702) : edges_out ? FAIL(3703) : 0)
+  if (edges_in ? FAIL(4061) : edges_out ? FAIL(4062) : 0)
 	 return NULL;
   if ((r = redex_of (given_vertex->v_value >> 1, err)))
 	 r->r_magic = PROPERTY_MAGIC;
@@ -705,9 +705,9 @@ vertex_map (edges_in, given_vertex, edges_out, err)
 {
   vertex v;
 
-  if (edges_in ? FAIL(3704) : edges_out ? FAIL(3705) : 0)
+  if (edges_in ? FAIL(4063) : edges_out ? FAIL(4064) : 0)
 	 return NULL;
-  if ((! given_vertex) ? FAIL(3706) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3707) : 0)
+  if ((! given_vertex) ? FAIL(4065) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4066) : 0)
 	 return NULL;
   if ((v = vertex_of (given_vertex->v_value >> 1, err)))
 	 v->v_magic = FUSED_VERTEX_MAGIC;
@@ -734,11 +734,11 @@ vertex_fusion (a, b, err)
 {
   vertex v;
 
-  if ((! a) ? FAIL(3708) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3709) : 0)
+  if ((! a) ? FAIL(4067) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4068) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(3710) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3711) : 0)
+  if ((! b) ? FAIL(4069) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4070) : 0)
 	 return NULL;
-  if ((a->v_value != b->v_value) ? FAIL(3712) : 0)
+  if ((a->v_value != b->v_value) ? FAIL(4071) : 0)
 	 return NULL;
   if ((v = vertex_of (a->v_value, err)))
 	 v->v_magic = FUSED_VERTEX_MAGIC;
@@ -763,14 +763,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(3713);
+	 FAIL(4072);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(3714);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3715) : 0)
+	 FAIL(4073);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4074) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3716) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3717) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3718) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4075) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4076) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4077) : *err);
 }
 
 
@@ -845,11 +845,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(3719) : vertex_count ? THE_FAIL(3720) : redex_count ? THE_FAIL(3721) : global_err);
+	 err = (edge_count ? THE_FAIL(4078) : vertex_count ? THE_FAIL(4079) : redex_count ? THE_FAIL(4080) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3722);
+	 err = THE_FAIL(4081);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3723);
+	 err = THE_FAIL(4082);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -74,14 +74,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3724))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(4083))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3725) : ++redex_count ? 0 : FAIL(3726))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4084) : ++redex_count ? 0 : FAIL(4085))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3727) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(4086) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -100,12 +100,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(3728) : (r->r_magic != REDEX_MAGIC) ? FAIL(3729) : 0)
+  if ((! r) ? FAIL(4087) : (r->r_magic != REDEX_MAGIC) ? FAIL(4088) : 0)
 	 return;
-  r->r_magic = MUGGLE(150);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3730) : redex_count-- ? 0 : FAIL(3731))
+  r->r_magic = MUGGLE(153);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4089) : redex_count-- ? 0 : FAIL(4090))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3732) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4091) : 0)
 	 return;
   free (r);
 }
@@ -123,7 +123,7 @@ free_mapex (r, err)
 
 	  // Reclaim a mapex.
 {
-  if ((! r) ? FAIL(3733) : (r->r_magic != MAPEX_MAGIC) ? FAIL(3734) : 0)
+  if ((! r) ? FAIL(4092) : (r->r_magic != MAPEX_MAGIC) ? FAIL(4093) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -145,12 +145,12 @@ free_property (r, err)
 	  // the cru library as c.me_classifier.cl_prop.vertex.m_free in the
 	  // merger c.
 {
-  if ((! r) ? FAIL(3735) : (r->r_magic != PROPERTY_MAGIC) ? FAIL(3736) : 0)
+  if ((! r) ? FAIL(4094) : (r->r_magic != PROPERTY_MAGIC) ? FAIL(4095) : 0)
 	 return;
-  r->r_magic = MUGGLE(151);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3737) : redex_count-- ? 0 : FAIL(3738))
+  r->r_magic = MUGGLE(154);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4096) : redex_count-- ? 0 : FAIL(4097))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3739) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4098) : 0)
 	 return;
   free (r);
 }
@@ -171,12 +171,12 @@ free_incident_redex (r, err)
 	  // to a cru_destructor is passed to the cru library as
 	  // c.me_classifier.cl_prop.incident.r_free in the merger c.
 {
-  if ((! r) ? FAIL(3740) : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(3741) : 0)
+  if ((! r) ? FAIL(4099) : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4100) : 0)
 	 return;
-  r->r_magic = MUGGLE(152);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3742) : redex_count-- ? 0 : FAIL(3743))
+  r->r_magic = MUGGLE(155);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4101) : redex_count-- ? 0 : FAIL(4102))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3744) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4103) : 0)
 	 return;
   free (r);
 }
@@ -196,7 +196,7 @@ free_incident_mapex (r, err)
 	  // Reclaim a mapex created as from an incident
 	  // edges on a vertex during a merge operation.
 {
-  if ((! r) ? FAIL(3745) : (r->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(3746) : 0)
+  if ((! r) ? FAIL(4104) : (r->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(4105) : 0)
 	 return;
   r->r_magic = INCIDENT_REDEX_MAGIC;
   free_incident_redex (r, err);
@@ -220,12 +220,12 @@ free_outgoing_redex (r, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as c.me_classifier.cl_prop.outgoing.r_free in the merger c.
 {
-  if ((! r) ? FAIL(3747) : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(3748) : 0)
+  if ((! r) ? FAIL(4106) : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4107) : 0)
 	 return;
-  r->r_magic = MUGGLE(153);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3749) : redex_count-- ? 0 : FAIL(3750))
+  r->r_magic = MUGGLE(156);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4108) : redex_count-- ? 0 : FAIL(4109))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3751) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4110) : 0)
 	 return;
   free (r);
 }
@@ -249,9 +249,9 @@ equal_properties (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed as
 	  // c.me_classifier.cl_order.equal in the merger c.
 {
-  if ((! a) ? FAIL(3752) : (a->r_magic != PROPERTY_MAGIC) ? FAIL(3753) : 0)
+  if ((! a) ? FAIL(4111) : (a->r_magic != PROPERTY_MAGIC) ? FAIL(4112) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3754) : (b->r_magic != PROPERTY_MAGIC) ? FAIL(3755) : 0)
+  if ((! b) ? FAIL(4113) : (b->r_magic != PROPERTY_MAGIC) ? FAIL(4114) : 0)
 	 return 0;
   return a->r_value == b->r_value;
 }
@@ -275,7 +275,7 @@ property_hash (r)
   size_t i;
   uintptr_t u;
 
-  if ((! r) ? GLOBAL_FAIL(3756) : (r->r_magic != PROPERTY_MAGIC) ? GLOBAL_FAIL(3757) : 0)
+  if ((! r) ? GLOBAL_FAIL(4115) : (r->r_magic != PROPERTY_MAGIC) ? GLOBAL_FAIL(4116) : 0)
 	 return 0;
   u = r->r_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -299,14 +299,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3758))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4117))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3759) : ++edge_count ? 0 : FAIL(3760))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4118) : ++edge_count ? 0 : FAIL(4119))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3761) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4120) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -327,12 +327,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(3762) : (e->e_magic != EDGE_MAGIC) ? FAIL(3763) : 0)
+  if ((! e) ? FAIL(4121) : (e->e_magic != EDGE_MAGIC) ? FAIL(4122) : 0)
 	 return;
-  e->e_magic = MUGGLE(154);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3764) : edge_count-- ? 0 : FAIL(3765))
+  e->e_magic = MUGGLE(157);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4123) : edge_count-- ? 0 : FAIL(4124))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3766) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4125) : 0)
 	 return;
   free (e);
 }
@@ -354,7 +354,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(3767) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3768) : 0)
+  if ((! e) ? GLOBAL_FAIL(4126) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4127) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -379,9 +379,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for merging.
 {
-  if ((! a) ? FAIL(3769) : (a->e_magic != EDGE_MAGIC) ? FAIL(3770) : 0)
+  if ((! a) ? FAIL(4128) : (a->e_magic != EDGE_MAGIC) ? FAIL(4129) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3771) : (b->e_magic != EDGE_MAGIC) ? FAIL(3772) : 0)
+  if ((! b) ? FAIL(4130) : (b->e_magic != EDGE_MAGIC) ? FAIL(4131) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -402,14 +402,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3773))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4132))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3774) : ++vertex_count ? 0 : FAIL(3775))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4133) : ++vertex_count ? 0 : FAIL(4134))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3776) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4135) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -431,12 +431,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(3777) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3778) : 0)
+  if ((! v) ? FAIL(4136) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4137) : 0)
 	 return;
-  v->v_magic = MUGGLE(155);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3779) : vertex_count-- ? 0 : FAIL(3780))
+  v->v_magic = MUGGLE(158);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4138) : vertex_count-- ? 0 : FAIL(4139))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3781) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4140) : 0)
 	 return;
   free (v);
 }
@@ -455,12 +455,12 @@ free_fused_vertex (v, err)
 
 	  // Reclaim a vertex resulting from a fusion operation.
 {
-  if ((! v) ? FAIL(3782) : (v->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3783) : 0)
+  if ((! v) ? FAIL(4141) : (v->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4142) : 0)
 	 return;
-  v->v_magic = MUGGLE(156);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3784) : vertex_count-- ? 0 : FAIL(3785))
+  v->v_magic = MUGGLE(159);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4143) : vertex_count-- ? 0 : FAIL(4144))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3786) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4145) : 0)
 	 return;
   free (v);
 }
@@ -481,9 +481,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3787) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3788) : 0)
+  if ((! a) ? FAIL(4146) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4147) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3789) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3790) : 0)
+  if ((! b) ? FAIL(4148) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4149) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -503,9 +503,9 @@ fused_equal_vertices (a, b, err)
 	  // Compare two fused vertices and return non-zero if they are
 	  // equal.
 {
-  if ((! a) ? FAIL(3791) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3792) : 0)
+  if ((! a) ? FAIL(4150) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4151) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3793) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3794) : 0)
+  if ((! b) ? FAIL(4152) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4153) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -529,7 +529,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3795) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3796) : 0)
+  if ((! v) ? GLOBAL_FAIL(4154) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4155) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -554,7 +554,7 @@ fused_vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3797) : (v->v_magic != FUSED_VERTEX_MAGIC) ? GLOBAL_FAIL(3798) : 0)
+  if ((! v) ? GLOBAL_FAIL(4156) : (v->v_magic != FUSED_VERTEX_MAGIC) ? GLOBAL_FAIL(4157) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -585,7 +585,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(3799) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3800) : 0)
+  if ((! given_vertex) ? FAIL(4158) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4159) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -613,15 +613,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3801) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3802) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4160) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4161) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(3803) : (local_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3804) : 0)
+  if ((! local_vertex) ? FAIL(4162) : (local_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4163) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(3805) : (remote_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3806) : 0)
+  if ((! remote_vertex) ? FAIL(4164) : (remote_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4165) : 0)
 	 return NULL;
   if ((local_vertex->v_value == remote_vertex->v_value) ? (! (connecting_edge->e_value)) : 0)
 	 goto a;
-  if ((((local_vertex->v_value ^ remote_vertex->v_value) << 1) != ( 1 << connecting_edge->e_value)) ? FAIL(3807) : 0)
+  if ((((local_vertex->v_value ^ remote_vertex->v_value) << 1) != ( 1 << connecting_edge->e_value)) ? FAIL(4166) : 0)
 	 return NULL;
  a: return redex_of (1, err);
 }
@@ -643,13 +643,13 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(3808) : (given_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3809) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4167) : (given_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4168) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(3810) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(3811) : 0)
+  if ((! edges_in) ? FAIL(4169) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(4170) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(3812) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(3813) : 0)
+  if ((! edges_out) ? FAIL(4171) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(4172) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DIMENSION) ? FAIL(3814) : (edges_out->r_value != DIMENSION) ? FAIL(3815) : 0)
+  if ((edges_in->r_value != DIMENSION) ? FAIL(4173) : (edges_out->r_value != DIMENSION) ? FAIL(4174) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -673,12 +673,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(3816) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(4175) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(3817) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(4176) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(3818) : (s < (r ? r->r_value : 0)) ? FAIL(3819) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4177) : (s < (r ? r->r_value : 0)) ? FAIL(4178) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -706,12 +706,12 @@ incident_sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(3820) : 0)
+  if ((! l) ? 0 : (l->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(4179) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(3821) : 0)
+  if ((! r) ? 0 : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4180) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(3822) : (s < (r ? r->r_value : 0)) ? FAIL(3823) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4181) : (s < (r ? r->r_value : 0)) ? FAIL(4182) : 0)
 	 return NULL;
   if ((t = redex_of (s, err)))
 	 t->r_magic = INCIDENT_REDEX_MAGIC;
@@ -740,12 +740,12 @@ outgoing_sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(3824) : 0)
+  if ((! l) ? 0 : (l->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4183) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(3825) : 0)
+  if ((! r) ? 0 : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4184) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(3826) : (s < (r ? r->r_value : 0)) ? FAIL(3827) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4185) : (s < (r ? r->r_value : 0)) ? FAIL(4186) : 0)
 	 return NULL;
   if ((t = redex_of (s, err)))
 	 t->r_magic = OUTGOING_REDEX_MAGIC;
@@ -829,16 +829,16 @@ valid (g, err)
 
   if (*err)
 	 return 0;
-  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(3828))
+  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(4187))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(3829))
+  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(4188))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(3830))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(4189))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(3831))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(4190))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES >> 1)))
-	 FAIL(3832);
+	 FAIL(4191);
   free_redex (r, err);
   return v;
 }
@@ -865,13 +865,13 @@ common_property (edges_in, given_vertex, edges_out, err)
 
   redex r;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(3833) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3834) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4192) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4193) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(3835) : (edges_in->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(3836) : 0)
+  if ((! edges_in) ? FAIL(4194) : (edges_in->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4195) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(3837) : (edges_out->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(3838) : 0)
+  if ((! edges_out) ? FAIL(4196) : (edges_out->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4197) : 0)
 	 return NULL;
-  if ((edges_in->r_value != D) ? FAIL(3839) : (edges_out->r_value != D) ? FAIL(3840) : 0)
+  if ((edges_in->r_value != D) ? FAIL(4198) : (edges_out->r_value != D) ? FAIL(4199) : 0)
 	 return NULL;
   if ((r = redex_of (given_vertex->v_value >> 1, err)))
 	 r->r_magic = PROPERTY_MAGIC;
@@ -899,11 +899,11 @@ incident_map (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3841) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3842) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4200) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4201) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(3843) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3844) : 0)
+  if ((! local_vertex) ? FAIL(4202) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4203) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(3845) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3846) : 0)
+  if ((! remote_vertex) ? FAIL(4204) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4205) : 0)
 	 return NULL;
   if ((r = redex_of (connecting_edge->e_value, err)))
 	 r->r_magic = INCIDENT_MAPEX_MAGIC;
@@ -931,11 +931,11 @@ outgoing_map (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3847) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3848) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4206) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4207) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(3849) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3850) : 0)
+  if ((! local_vertex) ? FAIL(4208) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4209) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(3851) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3852) : 0)
+  if ((! remote_vertex) ? FAIL(4210) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4211) : 0)
 	 return NULL;
   if ((r = redex_of (connecting_edge->e_value, err)))
 	 r->r_magic = OUTGOING_REDEX_MAGIC;
@@ -964,9 +964,9 @@ vertex_map (edges_in, given_vertex, edges_out, err)
 {
   vertex v;
 
-  if (edges_in ? FAIL(3853) : edges_out ? FAIL(3854) : 0)
+  if (edges_in ? FAIL(4212) : edges_out ? FAIL(4213) : 0)
 	 return NULL;
-  if ((! given_vertex) ? FAIL(3855) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3856) : 0)
+  if ((! given_vertex) ? FAIL(4214) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4215) : 0)
 	 return NULL;
   if ((v = vertex_of (given_vertex->v_value >> 1, err)))
 	 v->v_magic = FUSED_VERTEX_MAGIC;
@@ -995,11 +995,11 @@ vertex_fusion (a, b, err)
 {
   vertex v;
 
-  if ((! a) ? FAIL(3857) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3858) : 0)
+  if ((! a) ? FAIL(4216) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4217) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(3859) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3860) : 0)
+  if ((! b) ? FAIL(4218) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4219) : 0)
 	 return NULL;
-  if ((a->v_value != b->v_value) ? FAIL(3861) : 0)
+  if ((a->v_value != b->v_value) ? FAIL(4220) : 0)
 	 return NULL;
   if ((v = vertex_of (a->v_value, err)))
 	 v->v_magic = FUSED_VERTEX_MAGIC;
@@ -1024,14 +1024,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(3862);
+	 FAIL(4221);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(3863);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(3864) : 0)
+	 FAIL(4222);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4223) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(3865) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(3866) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(3867) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4224) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4225) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4226) : *err);
 }
 
 
@@ -1117,11 +1117,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(3868) : vertex_count ? THE_FAIL(3869) : redex_count ? THE_FAIL(3870) : global_err);
+	 err = (edge_count ? THE_FAIL(4227) : vertex_count ? THE_FAIL(4228) : redex_count ? THE_FAIL(4229) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3871);
+	 err = THE_FAIL(4230);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(3872);
+	 err = THE_FAIL(4231);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -75,14 +75,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(3873))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(4232))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3874) : ++redex_count ? 0 : FAIL(3875))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4233) : ++redex_count ? 0 : FAIL(4234))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(3876) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(4235) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -101,12 +101,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(3877) : (r->r_magic != REDEX_MAGIC) ? FAIL(3878) : 0)
+  if ((! r) ? FAIL(4236) : (r->r_magic != REDEX_MAGIC) ? FAIL(4237) : 0)
 	 return;
-  r->r_magic = MUGGLE(157);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3879) : redex_count-- ? 0 : FAIL(3880))
+  r->r_magic = MUGGLE(160);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4238) : redex_count-- ? 0 : FAIL(4239))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3881) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4240) : 0)
 	 return;
   free (r);
 }
@@ -121,7 +121,7 @@ free_mapex (r, err)
 
 	  // Reclaim a mapex.
 {
-  if ((! r) ? FAIL(3882) : (r->r_magic != MAPEX_MAGIC) ? FAIL(3883) : 0)
+  if ((! r) ? FAIL(4241) : (r->r_magic != MAPEX_MAGIC) ? FAIL(4242) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -142,12 +142,12 @@ free_property (r, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as c.me_classifier.cl_prop.vertex.m_free in the merger c.
 {
-  if ((! r) ? FAIL(3884) : (r->r_magic != PROPERTY_MAGIC) ? FAIL(3885) : 0)
+  if ((! r) ? FAIL(4243) : (r->r_magic != PROPERTY_MAGIC) ? FAIL(4244) : 0)
 	 return;
-  r->r_magic = MUGGLE(158);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3886) : redex_count-- ? 0 : FAIL(3887))
+  r->r_magic = MUGGLE(161);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4245) : redex_count-- ? 0 : FAIL(4246))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3888) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4247) : 0)
 	 return;
   free (r);
 }
@@ -168,12 +168,12 @@ free_incident_redex (r, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as c.me_classifier.cl_prop.incident.r_free in the merger c.
 {
-  if ((! r) ? FAIL(3889) : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(3890) : 0)
+  if ((! r) ? FAIL(4248) : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4249) : 0)
 	 return;
-  r->r_magic = MUGGLE(159);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3891) : redex_count-- ? 0 : FAIL(3892))
+  r->r_magic = MUGGLE(162);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4250) : redex_count-- ? 0 : FAIL(4251))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3893) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4252) : 0)
 	 return;
   free (r);
 }
@@ -191,7 +191,7 @@ free_incident_mapex (r, err)
 	  // Reclaim a mapex created as from an incident
 	  // edges on a vertex during a merge operation.
 {
-  if ((! r) ? FAIL(3894) : (r->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(3895) : 0)
+  if ((! r) ? FAIL(4253) : (r->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(4254) : 0)
 	 return;
   r->r_magic = INCIDENT_REDEX_MAGIC;
   free_incident_redex (r, err);
@@ -213,12 +213,12 @@ free_outgoing_redex (r, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as c.me_classifier.cl_prop.outgoing.r_free in the merger c.
 {
-  if ((! r) ? FAIL(3896) : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(3897) : 0)
+  if ((! r) ? FAIL(4255) : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4256) : 0)
 	 return;
-  r->r_magic = MUGGLE(160);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(3898) : redex_count-- ? 0 : FAIL(3899))
+  r->r_magic = MUGGLE(163);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4257) : redex_count-- ? 0 : FAIL(4258))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(3900) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4259) : 0)
 	 return;
   free (r);
 }
@@ -242,9 +242,9 @@ equal_properties (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed as
 	  // c.me_classifier.cl_order.equal in the merger c.
 {
-  if ((! a) ? FAIL(3901) : (a->r_magic != PROPERTY_MAGIC) ? FAIL(3902) : 0)
+  if ((! a) ? FAIL(4260) : (a->r_magic != PROPERTY_MAGIC) ? FAIL(4261) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3903) : (b->r_magic != PROPERTY_MAGIC) ? FAIL(3904) : 0)
+  if ((! b) ? FAIL(4262) : (b->r_magic != PROPERTY_MAGIC) ? FAIL(4263) : 0)
 	 return 0;
   return a->r_value == b->r_value;
 }
@@ -268,7 +268,7 @@ property_hash (r)
   size_t i;
   uintptr_t u;
 
-  if ((! r) ? GLOBAL_FAIL(3905) : (r->r_magic != PROPERTY_MAGIC) ? GLOBAL_FAIL(3906) : 0)
+  if ((! r) ? GLOBAL_FAIL(4264) : (r->r_magic != PROPERTY_MAGIC) ? GLOBAL_FAIL(4265) : 0)
 	 return 0;
   u = r->r_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -292,14 +292,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(3907))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4266))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3908) : ++edge_count ? 0 : FAIL(3909))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4267) : ++edge_count ? 0 : FAIL(4268))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(3910) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4269) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -320,12 +320,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(3911) : (e->e_magic != EDGE_MAGIC) ? FAIL(3912) : 0)
+  if ((! e) ? FAIL(4270) : (e->e_magic != EDGE_MAGIC) ? FAIL(4271) : 0)
 	 return;
-  e->e_magic = MUGGLE(161);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(3913) : edge_count-- ? 0 : FAIL(3914))
+  e->e_magic = MUGGLE(164);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4272) : edge_count-- ? 0 : FAIL(4273))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(3915) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4274) : 0)
 	 return;
   free (e);
 }
@@ -347,7 +347,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(3916) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(3917) : 0)
+  if ((! e) ? GLOBAL_FAIL(4275) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4276) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -372,9 +372,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for merging.
 {
-  if ((! a) ? FAIL(3918) : (a->e_magic != EDGE_MAGIC) ? FAIL(3919) : 0)
+  if ((! a) ? FAIL(4277) : (a->e_magic != EDGE_MAGIC) ? FAIL(4278) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3920) : (b->e_magic != EDGE_MAGIC) ? FAIL(3921) : 0)
+  if ((! b) ? FAIL(4279) : (b->e_magic != EDGE_MAGIC) ? FAIL(4280) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -395,14 +395,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(3922))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4281))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3923) : ++vertex_count ? 0 : FAIL(3924))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4282) : ++vertex_count ? 0 : FAIL(4283))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(3925) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4284) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -424,12 +424,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(3926) : (v->v_magic != VERTEX_MAGIC) ? FAIL(3927) : 0)
+  if ((! v) ? FAIL(4285) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4286) : 0)
 	 return;
-  v->v_magic = MUGGLE(162);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3928) : vertex_count-- ? 0 : FAIL(3929))
+  v->v_magic = MUGGLE(165);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4287) : vertex_count-- ? 0 : FAIL(4288))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3930) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4289) : 0)
 	 return;
   free (v);
 }
@@ -448,12 +448,12 @@ free_fused_vertex (v, err)
 
 	  // Reclaim a vertex resulting from a fusion operation.
 {
-  if ((! v) ? FAIL(3931) : (v->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3932) : 0)
+  if ((! v) ? FAIL(4290) : (v->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4291) : 0)
 	 return;
-  v->v_magic = MUGGLE(163);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(3933) : vertex_count-- ? 0 : FAIL(3934))
+  v->v_magic = MUGGLE(166);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4292) : vertex_count-- ? 0 : FAIL(4293))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(3935) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4294) : 0)
 	 return;
   free (v);
 }
@@ -474,9 +474,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(3936) : (a->v_magic != VERTEX_MAGIC) ? FAIL(3937) : 0)
+  if ((! a) ? FAIL(4295) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4296) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3938) : (b->v_magic != VERTEX_MAGIC) ? FAIL(3939) : 0)
+  if ((! b) ? FAIL(4297) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4298) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -495,9 +495,9 @@ fused_equal_vertices (a, b, err)
 	  // Compare two fused vertices and return non-zero if they are
 	  // equal.
 {
-  if ((! a) ? FAIL(3940) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3941) : 0)
+  if ((! a) ? FAIL(4299) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4300) : 0)
 	 return 0;
-  if ((! b) ? FAIL(3942) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3943) : 0)
+  if ((! b) ? FAIL(4301) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4302) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -519,7 +519,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3944) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(3945) : 0)
+  if ((! v) ? GLOBAL_FAIL(4303) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4304) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -544,7 +544,7 @@ fused_vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(3946) : (v->v_magic != FUSED_VERTEX_MAGIC) ? GLOBAL_FAIL(3947) : 0)
+  if ((! v) ? GLOBAL_FAIL(4305) : (v->v_magic != FUSED_VERTEX_MAGIC) ? GLOBAL_FAIL(4306) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -573,7 +573,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(3948) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3949) : 0)
+  if ((! given_vertex) ? FAIL(4307) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4308) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -601,13 +601,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3950) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3951) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4309) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4310) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(3952) : (local_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3953) : 0)
+  if ((! local_vertex) ? FAIL(4311) : (local_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4312) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(3954) : (remote_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3955) : 0)
+  if ((! remote_vertex) ? FAIL(4313) : (remote_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4314) : 0)
 	 return NULL;
-  if ((((local_vertex->v_value ^ remote_vertex->v_value) << 1) != ( 1 << connecting_edge->e_value)) ? FAIL(3956) : 0)
+  if ((((local_vertex->v_value ^ remote_vertex->v_value) << 1) != ( 1 << connecting_edge->e_value)) ? FAIL(4315) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -629,13 +629,13 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(3957) : (given_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(3958) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4316) : (given_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4317) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(3959) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(3960) : 0)
+  if ((! edges_in) ? FAIL(4318) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(4319) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(3961) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(3962) : 0)
+  if ((! edges_out) ? FAIL(4320) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(4321) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DIMENSION - 1) ? FAIL(3963) : (edges_out->r_value != DIMENSION - 1) ? FAIL(3964) : 0)
+  if ((edges_in->r_value != DIMENSION - 1) ? FAIL(4322) : (edges_out->r_value != DIMENSION - 1) ? FAIL(4323) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -659,12 +659,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(3965) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(4324) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(3966) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(4325) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(3967) : (s < (r ? r->r_value : 0)) ? FAIL(3968) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4326) : (s < (r ? r->r_value : 0)) ? FAIL(4327) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -691,12 +691,12 @@ incident_sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(3969) : 0)
+  if ((! l) ? 0 : (l->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(4328) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(3970) : 0)
+  if ((! r) ? 0 : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4329) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(3971) : (s < (r ? r->r_value : 0)) ? FAIL(3972) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4330) : (s < (r ? r->r_value : 0)) ? FAIL(4331) : 0)
 	 return NULL;
   if ((t = redex_of (s, err)))
 	 t->r_magic = INCIDENT_REDEX_MAGIC;
@@ -725,12 +725,12 @@ outgoing_sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(3973) : 0)
+  if ((! l) ? 0 : (l->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4332) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(3974) : 0)
+  if ((! r) ? 0 : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4333) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(3975) : (s < (r ? r->r_value : 0)) ? FAIL(3976) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4334) : (s < (r ? r->r_value : 0)) ? FAIL(4335) : 0)
 	 return NULL;
   if ((t = redex_of (s, err)))
 	 t->r_magic = OUTGOING_REDEX_MAGIC;
@@ -813,16 +813,16 @@ valid (g, err)
 
   if (*err)
 	 return 0;
-  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(3977))
+  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(4336))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (((((uintptr_t) DIMENSION) - 1) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(3978))
+  if ((cru_edge_count (g, LANES, err) == (((((uintptr_t) DIMENSION) - 1) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(4337))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(3979))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(4338))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(3980))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(4339))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES >> 1)))
-	 FAIL(3981);
+	 FAIL(4340);
   free_redex (r, err);
   return v;
 }
@@ -849,13 +849,13 @@ common_property (edges_in, given_vertex, edges_out, err)
 
   redex r;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(3982) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3983) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4341) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4342) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(3984) : (edges_in->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(3985) : 0)
+  if ((! edges_in) ? FAIL(4343) : (edges_in->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4344) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(3986) : (edges_out->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(3987) : 0)
+  if ((! edges_out) ? FAIL(4345) : (edges_out->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4346) : 0)
 	 return NULL;
-  if ((edges_in->r_value != D) ? FAIL(3988) : (edges_out->r_value != D) ? FAIL(3989) : 0)
+  if ((edges_in->r_value != D) ? FAIL(4347) : (edges_out->r_value != D) ? FAIL(4348) : 0)
 	 return NULL;
   if ((r = redex_of (given_vertex->v_value >> 1, err)))
 	 r->r_magic = PROPERTY_MAGIC;
@@ -883,11 +883,11 @@ incident_map (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3990) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3991) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4349) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4350) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(3992) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3993) : 0)
+  if ((! local_vertex) ? FAIL(4351) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4352) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(3994) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3995) : 0)
+  if ((! remote_vertex) ? FAIL(4353) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4354) : 0)
 	 return NULL;
   if ((r = redex_of (connecting_edge->e_value, err)))
 	 r->r_magic = INCIDENT_MAPEX_MAGIC;
@@ -915,11 +915,11 @@ outgoing_map (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(3996) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(3997) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4355) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4356) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(3998) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(3999) : 0)
+  if ((! local_vertex) ? FAIL(4357) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4358) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4000) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4001) : 0)
+  if ((! remote_vertex) ? FAIL(4359) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4360) : 0)
 	 return NULL;
   if ((r = redex_of (connecting_edge->e_value, err)))
 	 r->r_magic = OUTGOING_REDEX_MAGIC;
@@ -948,9 +948,9 @@ vertex_map (edges_in, given_vertex, edges_out, err)
 {
   vertex v;
 
-  if (edges_in ? FAIL(4002) : edges_out ? FAIL(4003) : 0)
+  if (edges_in ? FAIL(4361) : edges_out ? FAIL(4362) : 0)
 	 return NULL;
-  if ((! given_vertex) ? FAIL(4004) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4005) : 0)
+  if ((! given_vertex) ? FAIL(4363) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4364) : 0)
 	 return NULL;
   if ((v = vertex_of (given_vertex->v_value >> 1, err)))
 	 v->v_magic = FUSED_VERTEX_MAGIC;
@@ -979,11 +979,11 @@ vertex_fusion (a, b, err)
 {
   vertex v;
 
-  if ((! a) ? FAIL(4006) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4007) : 0)
+  if ((! a) ? FAIL(4365) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4366) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(4008) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4009) : 0)
+  if ((! b) ? FAIL(4367) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4368) : 0)
 	 return NULL;
-  if ((a->v_value != b->v_value) ? FAIL(4010) : 0)
+  if ((a->v_value != b->v_value) ? FAIL(4369) : 0)
 	 return NULL;
   if ((v = vertex_of (a->v_value, err)))
 	 v->v_magic = FUSED_VERTEX_MAGIC;
@@ -1008,14 +1008,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(4011);
+	 FAIL(4370);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(4012);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4013) : 0)
+	 FAIL(4371);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4372) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4014) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4015) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4016) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4373) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4374) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4375) : *err);
 }
 
 
@@ -1034,7 +1034,7 @@ predicate (everywhere, outgoing_edge, err)
 
 	  // Request removal of edges labeled by zero.
 {
-  if ((! outgoing_edge) ? FAIL(4017) : (outgoing_edge->e_magic != EDGE_MAGIC) ? FAIL(4018) : (! everywhere) ? FAIL(4019) : 0)
+  if ((! outgoing_edge) ? FAIL(4376) : (outgoing_edge->e_magic != EDGE_MAGIC) ? FAIL(4377) : (! everywhere) ? FAIL(4378) : 0)
 	 return 0;
   return ! ! (outgoing_edge->e_value);
 }
@@ -1121,11 +1121,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(4020) : vertex_count ? THE_FAIL(4021) : redex_count ? THE_FAIL(4022) : global_err);
+	 err = (edge_count ? THE_FAIL(4379) : vertex_count ? THE_FAIL(4380) : redex_count ? THE_FAIL(4381) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4023);
+	 err = THE_FAIL(4382);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4024);
+	 err = THE_FAIL(4383);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
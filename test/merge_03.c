@@ -78,14 +78,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(4025))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(4384))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4026) : ++redex_count ? 0 : FAIL(4027))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4385) : ++redex_count ? 0 : FAIL(4386))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(4028) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(4387) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -104,12 +104,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(4029) : (r->r_magic != REDEX_MAGIC) ? FAIL(4030) : 0)
+  if ((! r) ? FAIL(4388) : (r->r_magic != REDEX_MAGIC) ? FAIL(4389) : 0)
 	 return;
-  r->r_magic = MUGGLE(164);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4031) : redex_count-- ? 0 : FAIL(4032))
+  r->r_magic = MUGGLE(167);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4390) : redex_count-- ? 0 : FAIL(4391))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4033) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4392) : 0)
 	 return;
   free (r);
 }
@@ -126,7 +126,7 @@ free_mapex (r, err)
 
 	  // Reclaim a mapex.
 {
-  if ((! r) ? FAIL(4034) : (r->r_magic != MAPEX_MAGIC) ? FAIL(4035) : 0)
+  if ((! r) ? FAIL(4393) : (r->r_magic != MAPEX_MAGIC) ? FAIL(4394) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -149,12 +149,12 @@ free_property (r, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as c.me_classifier.cl_prop.vertex.m_free in the merger c.
 {
-  if ((! r) ? FAIL(4036) : (r->r_magic != PROPERTY_MAGIC) ? FAIL(4037) : 0)
+  if ((! r) ? FAIL(4395) : (r->r_magic != PROPERTY_MAGIC) ? FAIL(4396) : 0)
 	 return;
-  r->r_magic = MUGGLE(165);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4038) : redex_count-- ? 0 : FAIL(4039))
+  r->r_magic = MUGGLE(168);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4397) : redex_count-- ? 0 : FAIL(4398))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4040) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4399) : 0)
 	 return;
   free (r);
 }
@@ -175,12 +175,12 @@ free_incident_redex (r, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as c.me_classifier.cl_prop.incident.r_free in the merger c.
 {
-  if ((! r) ? FAIL(4041) : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4042) : 0)
+  if ((! r) ? FAIL(4400) : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4401) : 0)
 	 return;
-  r->r_magic = MUGGLE(166);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4043) : redex_count-- ? 0 : FAIL(4044))
+  r->r_magic = MUGGLE(169);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4402) : redex_count-- ? 0 : FAIL(4403))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4045) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4404) : 0)
 	 return;
   free (r);
 }
@@ -199,7 +199,7 @@ free_incident_mapex (r, err)
 	  // Reclaim a mapex created as from an incident
 	  // edges on a vertex during a merge operation.
 {
-  if ((! r) ? FAIL(4046) : (r->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(4047) : 0)
+  if ((! r) ? FAIL(4405) : (r->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(4406) : 0)
 	 return;
   r->r_magic = INCIDENT_REDEX_MAGIC;
   free_incident_redex (r, err);
@@ -221,12 +221,12 @@ free_outgoing_redex (r, err)
 	  // to a cru_destructor is passed to the cru library as
 	  // c.me_classifier.cl_prop.outgoing.r_free in the merger c.
 {
-  if ((! r) ? FAIL(4048) : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4049) : 0)
+  if ((! r) ? FAIL(4407) : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4408) : 0)
 	 return;
-  r->r_magic = MUGGLE(167);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4050) : redex_count-- ? 0 : FAIL(4051))
+  r->r_magic = MUGGLE(170);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4409) : redex_count-- ? 0 : FAIL(4410))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4052) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4411) : 0)
 	 return;
   free (r);
 }
@@ -250,9 +250,9 @@ equal_properties (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed as
 	  // c.me_classifier.cl_order.equal in the merger c.
 {
-  if ((! a) ? FAIL(4053) : (a->r_magic != PROPERTY_MAGIC) ? FAIL(4054) : 0)
+  if ((! a) ? FAIL(4412) : (a->r_magic != PROPERTY_MAGIC) ? FAIL(4413) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4055) : (b->r_magic != PROPERTY_MAGIC) ? FAIL(4056) : 0)
+  if ((! b) ? FAIL(4414) : (b->r_magic != PROPERTY_MAGIC) ? FAIL(4415) : 0)
 	 return 0;
   return a->r_value == b->r_value;
 }
@@ -276,7 +276,7 @@ property_hash (r)
   size_t i;
   uintptr_t u;
 
-  if ((! r) ? GLOBAL_FAIL(4057) : (r->r_magic != PROPERTY_MAGIC) ? GLOBAL_FAIL(4058) : 0)
+  if ((! r) ? GLOBAL_FAIL(4416) : (r->r_magic != PROPERTY_MAGIC) ? GLOBAL_FAIL(4417) : 0)
 	 return 0;
   u = r->r_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -300,14 +300,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4059))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4418))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4060) : ++edge_count ? 0 : FAIL(4061))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4419) : ++edge_count ? 0 : FAIL(4420))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4062) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4421) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -328,12 +328,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(4063) : (e->e_magic != EDGE_MAGIC) ? FAIL(4064) : 0)
+  if ((! e) ? FAIL(4422) : (e->e_magic != EDGE_MAGIC) ? FAIL(4423) : 0)
 	 return;
-  e->e_magic = MUGGLE(168);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4065) : edge_count-- ? 0 : FAIL(4066))
+  e->e_magic = MUGGLE(171);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4424) : edge_count-- ? 0 : FAIL(4425))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4067) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4426) : 0)
 	 return;
   free (e);
 }
@@ -352,12 +352,12 @@ free_fused_edge (e, err)
 
 	  // Reclaim an edge resulting from a fusion operation.
 {
-  if ((! e) ? FAIL(4068) : (e->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4069) : 0)
+  if ((! e) ? FAIL(4427) : (e->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4428) : 0)
 	 return;
-  e->e_magic = MUGGLE(169);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4070) : edge_count-- ? 0 : FAIL(4071))
+  e->e_magic = MUGGLE(172);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4429) : edge_count-- ? 0 : FAIL(4430))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4072) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4431) : 0)
 	 return;
   free (e);
 }
@@ -379,7 +379,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(4073) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4074) : 0)
+  if ((! e) ? GLOBAL_FAIL(4432) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4433) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -402,7 +402,7 @@ fused_edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(4075) : (e->e_magic != FUSED_EDGE_MAGIC) ? GLOBAL_FAIL(4076) : 0)
+  if ((! e) ? GLOBAL_FAIL(4434) : (e->e_magic != FUSED_EDGE_MAGIC) ? GLOBAL_FAIL(4435) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -427,9 +427,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for merging.
 {
-  if ((! a) ? FAIL(4077) : (a->e_magic != EDGE_MAGIC) ? FAIL(4078) : 0)
+  if ((! a) ? FAIL(4436) : (a->e_magic != EDGE_MAGIC) ? FAIL(4437) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4079) : (b->e_magic != EDGE_MAGIC) ? FAIL(4080) : 0)
+  if ((! b) ? FAIL(4438) : (b->e_magic != EDGE_MAGIC) ? FAIL(4439) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -449,9 +449,9 @@ fused_equal_edges (a, b, err)
 	  // Compare two fused edges and return non-zero if they are
 	  // equal.
 {
-  if ((! a) ? FAIL(4081) : (a->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4082) : 0)
+  if ((! a) ? FAIL(4440) : (a->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4441) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4083) : (b->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4084) : 0)
+  if ((! b) ? FAIL(4442) : (b->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4443) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -472,14 +472,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4085))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4444))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4086) : ++vertex_count ? 0 : FAIL(4087))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4445) : ++vertex_count ? 0 : FAIL(4446))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4088) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4447) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -501,12 +501,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(4089) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4090) : 0)
+  if ((! v) ? FAIL(4448) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4449) : 0)
 	 return;
-  v->v_magic = MUGGLE(170);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4091) : vertex_count-- ? 0 : FAIL(4092))
+  v->v_magic = MUGGLE(173);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4450) : vertex_count-- ? 0 : FAIL(4451))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4093) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4452) : 0)
 	 return;
   free (v);
 }
@@ -525,12 +525,12 @@ free_fused_vertex (v, err)
 
 	  // Reclaim a vertex resulting froma fusion operation.
 {
-  if ((! v) ? FAIL(4094) : (v->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4095) : 0)
+  if ((! v) ? FAIL(4453) : (v->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4454) : 0)
 	 return;
-  v->v_magic = MUGGLE(171);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4096) : vertex_count-- ? 0 : FAIL(4097))
+  v->v_magic = MUGGLE(174);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4455) : vertex_count-- ? 0 : FAIL(4456))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4098) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4457) : 0)
 	 return;
   free (v);
 }
@@ -551,9 +551,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4099) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4100) : 0)
+  if ((! a) ? FAIL(4458) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4459) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4101) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4102) : 0)
+  if ((! b) ? FAIL(4460) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4461) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -572,9 +572,9 @@ fused_equal_vertices (a, b, err)
 	  // Compare two fused vertices and return non-zero if they are
 	  // equal.
 {
-  if ((! a) ? FAIL(4103) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4104) : 0)
+  if ((! a) ? FAIL(4462) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4463) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4105) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4106) : 0)
+  if ((! b) ? FAIL(4464) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4465) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -596,7 +596,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4107) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4108) : 0)
+  if ((! v) ? GLOBAL_FAIL(4466) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4467) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -620,7 +620,7 @@ fused_vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4109) : (v->v_magic != FUSED_VERTEX_MAGIC) ? GLOBAL_FAIL(4110) : 0)
+  if ((! v) ? GLOBAL_FAIL(4468) : (v->v_magic != FUSED_VERTEX_MAGIC) ? GLOBAL_FAIL(4469) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -649,7 +649,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(4111) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4112) : 0)
+  if ((! given_vertex) ? FAIL(4470) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4471) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -679,15 +679,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(4113) : (connecting_edge->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4114) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4472) : (connecting_edge->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4473) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(4115) : (local_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4116) : 0)
+  if ((! local_vertex) ? FAIL(4474) : (local_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4475) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4117) : (remote_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4118) : 0)
+  if ((! remote_vertex) ? FAIL(4476) : (remote_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4477) : 0)
 	 return NULL;
-  if (((e = connecting_edge->e_value) & 1) ? FAIL(4119) : 0)
+  if (((e = connecting_edge->e_value) & 1) ? FAIL(4478) : 0)
 	 return NULL;
-  if ((((local_vertex->v_value ^ remote_vertex->v_value) << 1) != (1 << (e >> 1))) ? FAIL(4120) : 0)
+  if ((((local_vertex->v_value ^ remote_vertex->v_value) << 1) != (1 << (e >> 1))) ? FAIL(4479) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -709,13 +709,13 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(4121) : (given_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4122) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4480) : (given_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4481) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(4123) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(4124) : 0)
+  if ((! edges_in) ? FAIL(4482) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(4483) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(4125) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(4126) : 0)
+  if ((! edges_out) ? FAIL(4484) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(4485) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DIMENSION - 1) ? FAIL(4127) : (edges_out->r_value != DIMENSION - 1) ? FAIL(4128) : 0)
+  if ((edges_in->r_value != DIMENSION - 1) ? FAIL(4486) : (edges_out->r_value != DIMENSION - 1) ? FAIL(4487) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -740,12 +740,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(4129) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(4488) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(4130) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(4489) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(4131) : (s < (r ? r->r_value : 0)) ? FAIL(4132) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4490) : (s < (r ? r->r_value : 0)) ? FAIL(4491) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -772,12 +772,12 @@ incident_sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(4133) : 0)
+  if ((! l) ? 0 : (l->r_magic != INCIDENT_MAPEX_MAGIC) ? FAIL(4492) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4134) : 0)
+  if ((! r) ? 0 : (r->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4493) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(4135) : (s < (r ? r->r_value : 0)) ? FAIL(4136) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4494) : (s < (r ? r->r_value : 0)) ? FAIL(4495) : 0)
 	 return NULL;
   if ((t = redex_of (s, err)))
 	 t->r_magic = INCIDENT_REDEX_MAGIC;
@@ -805,12 +805,12 @@ outgoing_sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4137) : 0)
+  if ((! l) ? 0 : (l->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4496) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4138) : 0)
+  if ((! r) ? 0 : (r->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4497) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(4139) : (s < (r ? r->r_value : 0)) ? FAIL(4140) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4498) : (s < (r ? r->r_value : 0)) ? FAIL(4499) : 0)
 	 return NULL;
   if ((t = redex_of (s, err)))
 	 t->r_magic = OUTGOING_REDEX_MAGIC;
@@ -893,16 +893,16 @@ valid (g, err)
 
   if (*err)
 	 return 0;
-  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(4141))
+  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES >> 1)) ? 0 : FAIL(4500))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) (DIMENSION - 1)) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(4142))
+  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) (DIMENSION - 1)) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(4501))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(4143))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(4502))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(4144))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(4503))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES >> 1)))
-	 FAIL(4145);
+	 FAIL(4504);
   free_redex (r, err);
   return v;
 }
@@ -931,13 +931,13 @@ common_property (edges_in, given_vertex, edges_out, err)
 
   redex r;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(4146) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4147) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4505) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4506) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(4148) : (edges_in->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4149) : 0)
+  if ((! edges_in) ? FAIL(4507) : (edges_in->r_magic != INCIDENT_REDEX_MAGIC) ? FAIL(4508) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(4150) : (edges_out->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4151) : 0)
+  if ((! edges_out) ? FAIL(4509) : (edges_out->r_magic != OUTGOING_REDEX_MAGIC) ? FAIL(4510) : 0)
 	 return NULL;
-  if ((edges_in->r_value != D) ? FAIL(4152) : (edges_out->r_value != D) ? FAIL(4153) : 0)
+  if ((edges_in->r_value != D) ? FAIL(4511) : (edges_out->r_value != D) ? FAIL(4512) : 0)
 	 return NULL;
   if ((r = redex_of (given_vertex->v_value >> 1, err)))
 	 r->r_magic = PROPERTY_MAGIC;
@@ -965,11 +965,11 @@ incident_map (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(4154) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4155) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4513) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4514) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(4156) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4157) : 0)
+  if ((! local_vertex) ? FAIL(4515) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4516) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4158) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4159) : 0)
+  if ((! remote_vertex) ? FAIL(4517) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4518) : 0)
 	 return NULL;
   if ((r = redex_of (connecting_edge->e_value, err)))
 	 r->r_magic = INCIDENT_MAPEX_MAGIC;
@@ -997,11 +997,11 @@ outgoing_map (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(4160) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4161) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4519) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4520) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(4162) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4163) : 0)
+  if ((! local_vertex) ? FAIL(4521) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4522) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4164) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4165) : 0)
+  if ((! remote_vertex) ? FAIL(4523) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4524) : 0)
 	 return NULL;
   if ((r = redex_of (connecting_edge->e_value, err)))
 	 r->r_magic = OUTGOING_REDEX_MAGIC;
@@ -1030,9 +1030,9 @@ vertex_map (edges_in, given_vertex, edges_out, err)
 {
   vertex v;
 
-  if (edges_in ? FAIL(4166) : edges_out ? FAIL(4167) : 0)
+  if (edges_in ? FAIL(4525) : edges_out ? FAIL(4526) : 0)
 	 return NULL;
-  if ((! given_vertex) ? FAIL(4168) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4169) : 0)
+  if ((! given_vertex) ? FAIL(4527) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4528) : 0)
 	 return NULL;
   if ((v = vertex_of (given_vertex->v_value >> 1, err)))
 	 v->v_magic = FUSED_VERTEX_MAGIC;
@@ -1059,11 +1059,11 @@ edge_map (local_vertex, connecting_edge, remote_vertex, err)
 {
   edge e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(4170) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4171) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4529) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4530) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(4172) : (local_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4173) : 0)
+  if ((! local_vertex) ? FAIL(4531) : (local_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4532) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4174) : (remote_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4175) : 0)
+  if ((! remote_vertex) ? FAIL(4533) : (remote_vertex->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4534) : 0)
 	 return NULL;
   if ((e = edge_of (connecting_edge->e_value, err)))
 	 e->e_magic = FUSED_EDGE_MAGIC;
@@ -1092,11 +1092,11 @@ vertex_fusion (a, b, err)
 {
   vertex v;
 
-  if ((! a) ? FAIL(4176) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4177) : 0)
+  if ((! a) ? FAIL(4535) : (a->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4536) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(4178) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4179) : 0)
+  if ((! b) ? FAIL(4537) : (b->v_magic != FUSED_VERTEX_MAGIC) ? FAIL(4538) : 0)
 	 return NULL;
-  if ((a->v_value != b->v_value) ? FAIL(4180) : 0)
+  if ((a->v_value != b->v_value) ? FAIL(4539) : 0)
 	 return NULL;
   if ((v = vertex_of (a->v_value, err)))
 	 v->v_magic = FUSED_VERTEX_MAGIC;
@@ -1123,9 +1123,9 @@ edge_fusion (a, b, err)
 {
   edge e;
 
-  if ((! a) ? FAIL(4181) : (a->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4182) : 0)
+  if ((! a) ? FAIL(4540) : (a->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4541) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(4183) : (b->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4184) : 0)
+  if ((! b) ? FAIL(4542) : (b->e_magic != FUSED_EDGE_MAGIC) ? FAIL(4543) : 0)
 	 return NULL;
   if ((e = edge_of (a->e_value + b->e_value, err)))
 	 e->e_magic = FUSED_EDGE_MAGIC;
@@ -1150,14 +1150,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(4185);
+	 FAIL(4544);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(4186);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4187) : 0)
+	 FAIL(4545);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4546) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4188) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4189) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4190) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4547) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4548) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4549) : *err);
 }
 
 
@@ -1176,7 +1176,7 @@ predicate (everywhere, outgoing_edge, err)
 
 	  // Request removal of edges labeled by zero.
 {
-  if ((! outgoing_edge) ? FAIL(4191) : (outgoing_edge->e_magic != EDGE_MAGIC) ? FAIL(4192) : (! everywhere) ? FAIL(4193) : 0)
+  if ((! outgoing_edge) ? FAIL(4550) : (outgoing_edge->e_magic != EDGE_MAGIC) ? FAIL(4551) : (! everywhere) ? FAIL(4552) : 0)
 	 return 0;
   return ! ! (outgoing_edge->e_value);
 }
@@ -1271,11 +1271,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(4194) : vertex_count ? THE_FAIL(4195) : redex_count ? THE_FAIL(4196) : global_err);
+	 err = (edge_count ? THE_FAIL(4553) : vertex_count ? THE_FAIL(4554) : redex_count ? THE_FAIL(4555) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4197);
+	 err = THE_FAIL(4556);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4198);
+	 err = THE_FAIL(4557);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
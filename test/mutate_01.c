@@ -50,14 +50,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4207))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4566))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4208) : ++edge_count ? 0 : FAIL(4209))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4567) : ++edge_count ? 0 : FAIL(4568))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4210) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4569) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -78,12 +78,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(4211) : (e->e_magic != EDGE_MAGIC) ? FAIL(4212) : 0)
+  if ((! e) ? FAIL(4570) : (e->e_magic != EDGE_MAGIC) ? FAIL(4571) : 0)
 	 return;
-  e->e_magic = MUGGLE(172);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4213) : edge_count-- ? 0 : FAIL(4214))
+  e->e_magic = MUGGLE(175);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4572) : edge_count-- ? 0 : FAIL(4573))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4215) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4574) : 0)
 	 return;
   free (e);
 }
@@ -103,9 +103,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4216) : (a->e_magic != EDGE_MAGIC) ? FAIL(4217) : 0)
+  if ((! a) ? FAIL(4575) : (a->e_magic != EDGE_MAGIC) ? FAIL(4576) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4218) : (b->e_magic != EDGE_MAGIC) ? FAIL(4219) : 0)
+  if ((! b) ? FAIL(4577) : (b->e_magic != EDGE_MAGIC) ? FAIL(4578) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -127,7 +127,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(4220) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4221) : 0)
+  if ((! e) ? GLOBAL_FAIL(4579) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4580) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -151,14 +151,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4222))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4581))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4223) : ++vertex_count ? 0 : FAIL(4224))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4582) : ++vertex_count ? 0 : FAIL(4583))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4225) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4584) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -180,12 +180,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(4226) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4227) : 0)
+  if ((! v) ? FAIL(4585) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4586) : 0)
 	 return;
-  v->v_magic = MUGGLE(173);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4228) : vertex_count-- ? 0 : FAIL(4229))
+  v->v_magic = MUGGLE(176);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4587) : vertex_count-- ? 0 : FAIL(4588))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4230) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4589) : 0)
 	 return;
   free (v);
 }
@@ -206,12 +206,12 @@ free_flipped_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(4231) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4232) : 0)
+  if ((! v) ? FAIL(4590) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4591) : 0)
 	 return;
-  v->v_magic = MUGGLE(174);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4233) : vertex_count-- ? 0 : FAIL(4234))
+  v->v_magic = MUGGLE(177);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4592) : vertex_count-- ? 0 : FAIL(4593))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4235) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4594) : 0)
 	 return;
   free (v);
 }
@@ -232,9 +232,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4236) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4237) : 0)
+  if ((! a) ? FAIL(4595) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4596) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4238) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4239) : 0)
+  if ((! b) ? FAIL(4597) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4598) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -254,9 +254,9 @@ flipped_equal_vertices (a, b, err)
 	  // Compare two flipped vertices and return non-zero if they are
 	  // equal.
 {
-  if ((! a) ? FAIL(4240) : (a->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4241) : 0)
+  if ((! a) ? FAIL(4599) : (a->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4600) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4242) : (b->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4243) : 0)
+  if ((! b) ? FAIL(4601) : (b->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4602) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -280,7 +280,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4244) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4245) : 0)
+  if ((! v) ? GLOBAL_FAIL(4603) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4604) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -305,7 +305,7 @@ flipped_vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4246) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? GLOBAL_FAIL(4247) : 0)
+  if ((! v) ? GLOBAL_FAIL(4605) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? GLOBAL_FAIL(4606) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -335,7 +335,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(4248) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4249) : 0)
+  if ((! given_vertex) ? FAIL(4607) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4608) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -361,13 +361,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(4250) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4251) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4609) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4610) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(4252) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4253) : 0)
+  if ((! local_vertex) ? FAIL(4611) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4612) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(4254) : (remote_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4255) : 0)
+  if ((! remote_vertex) ? FAIL(4613) : (remote_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4614) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(4256) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(4615) : 0);
 }
 
 
@@ -387,9 +387,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(4257) : (given_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4258) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4616) : (given_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4617) : 0)
 	 return 0;
-  return ! ((edges_in != DIMENSION) ? FAIL(4259) : (edges_out != DIMENSION) ? FAIL(4260) : 0);
+  return ! ((edges_in != DIMENSION) ? FAIL(4618) : (edges_out != DIMENSION) ? FAIL(4619) : 0);
 }
 
 
@@ -408,7 +408,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(4261) : (s < r) ? FAIL(4262) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(4620) : (s < r) ? FAIL(4621) : 0) ? 0 : s);
 }
 
 
@@ -436,11 +436,11 @@ valid (g, err)
 		  .reduction = (cru_bop) sum,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(4263))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(4622))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(4264))
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(4623))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(4265))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(4624))
 	 return 0;
   return 1;
 }
@@ -462,9 +462,9 @@ vflip (edges_in, given_vertex, edges_out, err)
 {
   vertex v;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(4266) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4267) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4625) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4626) : 0)
 	 return NULL;
-  if (edges_in ? FAIL(4268) : edges_out ? FAIL(4269) : 0)
+  if (edges_in ? FAIL(4627) : edges_out ? FAIL(4628) : 0)
 	 return NULL;
   if ((v = vertex_of (given_vertex->v_value ^ (uintptr_t) (NUMBER_OF_VERTICES - 1), err)))
 	 v->v_magic = FLIPPED_VERTEX_MAGIC;
@@ -487,14 +487,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(4270);
+	 FAIL(4629);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(4271);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4272) : 0)
+	 FAIL(4630);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4631) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4273) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4274) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4275) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4632) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4633) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4634) : *err);
 }
 
 
@@ -553,11 +553,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(4276) : vertex_count ? THE_FAIL(4277) : global_err);
+	 err = (edge_count ? THE_FAIL(4635) : vertex_count ? THE_FAIL(4636) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4278);
+	 err = THE_FAIL(4637);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4279);
+	 err = THE_FAIL(4638);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -50,14 +50,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4280))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4639))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4281) : ++edge_count ? 0 : FAIL(4282))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4640) : ++edge_count ? 0 : FAIL(4641))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4283) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4642) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -78,12 +78,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(4284) : (e->e_magic != EDGE_MAGIC) ? FAIL(4285) : 0)
+  if ((! e) ? FAIL(4643) : (e->e_magic != EDGE_MAGIC) ? FAIL(4644) : 0)
 	 return;
-  e->e_magic = MUGGLE(175);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4286) : edge_count-- ? 0 : FAIL(4287))
+  e->e_magic = MUGGLE(178);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4645) : edge_count-- ? 0 : FAIL(4646))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4288) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4647) : 0)
 	 return;
   free (e);
 }
@@ -103,9 +103,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4289) : (a->e_magic != EDGE_MAGIC) ? FAIL(4290) : 0)
+  if ((! a) ? FAIL(4648) : (a->e_magic != EDGE_MAGIC) ? FAIL(4649) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4291) : (b->e_magic != EDGE_MAGIC) ? FAIL(4292) : 0)
+  if ((! b) ? FAIL(4650) : (b->e_magic != EDGE_MAGIC) ? FAIL(4651) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -127,7 +127,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(4293) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4294) : 0)
+  if ((! e) ? GLOBAL_FAIL(4652) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4653) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -150,12 +150,12 @@ free_flipped_edge (e, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as m.mu_kernel.e_op.m_free in the mutator m.
 {
-  if ((! e) ? FAIL(4295) : (e->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4296) : 0)
+  if ((! e) ? FAIL(4654) : (e->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4655) : 0)
 	 return;
-  e->e_magic = MUGGLE(176);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4297) : edge_count-- ? 0 : FAIL(4298))
+  e->e_magic = MUGGLE(179);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4656) : edge_count-- ? 0 : FAIL(4657))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4299) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4658) : 0)
 	 return;
   free (e);
 }
@@ -176,14 +176,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4300))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4659))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4301) : ++vertex_count ? 0 : FAIL(4302))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4660) : ++vertex_count ? 0 : FAIL(4661))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4303) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4662) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -205,12 +205,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in
 	  // the builder b.
 {
-  if ((! v) ? FAIL(4304) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4305) : 0)
+  if ((! v) ? FAIL(4663) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4664) : 0)
 	 return;
-  v->v_magic = MUGGLE(177);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4306) : vertex_count-- ? 0 : FAIL(4307))
+  v->v_magic = MUGGLE(180);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4665) : vertex_count-- ? 0 : FAIL(4666))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4308) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4667) : 0)
 	 return;
   free (v);
 }
@@ -231,9 +231,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4309) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4310) : 0)
+  if ((! a) ? FAIL(4668) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4669) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4311) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4312) : 0)
+  if ((! b) ? FAIL(4670) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4671) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -257,7 +257,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4313) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4314) : 0)
+  if ((! v) ? GLOBAL_FAIL(4672) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4673) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -286,7 +286,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(4315) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4316) : 0)
+  if ((! given_vertex) ? FAIL(4674) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4675) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -312,13 +312,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(4317) : (connecting_edge->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4318) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4676) : (connecting_edge->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4677) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(4319) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4320) : 0)
+  if ((! local_vertex) ? FAIL(4678) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4679) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(4321) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4322) : 0)
+  if ((! remote_vertex) ? FAIL(4680) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4681) : 0)
 	 return 0;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << (DIMENSION - connecting_edge->e_value))) ? FAIL(4323) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << (DIMENSION - connecting_edge->e_value))) ? FAIL(4682) : 0)
 	 return 0;
   return 1;
 }
@@ -340,9 +340,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(4324) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4325) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4683) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4684) : 0)
 	 return 0;
-  return ! ((edges_in != DIMENSION) ? FAIL(4326) : (edges_out != DIMENSION) ? FAIL(4327) : 0);
+  return ! ((edges_in != DIMENSION) ? FAIL(4685) : (edges_out != DIMENSION) ? FAIL(4686) : 0);
 }
 
 
@@ -361,7 +361,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(4328) : (s < r) ? FAIL(4329) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(4687) : (s < r) ? FAIL(4688) : 0) ? 0 : s);
 }
 
 
@@ -389,11 +389,11 @@ valid (g, err)
 		  .reduction = (cru_bop) sum,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(4330))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(4689))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(4331))
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(4690))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(4332))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(4691))
 	 return 0;
   return 1;
 }
@@ -417,11 +417,11 @@ eflip (local_vertex, label, remote_vertex, err)
 {
   edge e;
 
-  if (*err ? 1 : (! local_vertex) ? FAIL(4333) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4334) : 0)
+  if (*err ? 1 : (! local_vertex) ? FAIL(4692) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4693) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4335) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4336) : 0)
+  if ((! remote_vertex) ? FAIL(4694) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4695) : 0)
 	 return NULL;
-  if ((! label) ? FAIL(4337) : (label->e_magic != EDGE_MAGIC) ? FAIL(4338) : 0)
+  if ((! label) ? FAIL(4696) : (label->e_magic != EDGE_MAGIC) ? FAIL(4697) : 0)
 	 return NULL;
   if ((e = edge_of (DIMENSION - label->e_value, err)))
 	 e->e_magic = FLIPPED_EDGE_MAGIC;
@@ -444,14 +444,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(4339);
+	 FAIL(4698);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(4340);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4341) : 0)
+	 FAIL(4699);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4700) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4342) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4343) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4344) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4701) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4702) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4703) : *err);
 }
 
 
@@ -505,11 +505,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(4345) : vertex_count ? THE_FAIL(4346) : global_err);
+	 err = (edge_count ? THE_FAIL(4704) : vertex_count ? THE_FAIL(4705) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4347);
+	 err = THE_FAIL(4706);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4348);
+	 err = THE_FAIL(4707);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -69,14 +69,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(4462))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(4821))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4463) : ++redex_count ? 0 : FAIL(4464))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4822) : ++redex_count ? 0 : FAIL(4823))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(4465) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(4824) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -97,12 +97,12 @@ free_redex (r, err)
 	  // passed to the cru library as m.ma_prop.vertex.r_free in the
 	  // mapreducer m.
 {
-  if ((! r) ? FAIL(4466) : (r->r_magic != REDEX_MAGIC) ? FAIL(4467) : 0)
+  if ((! r) ? FAIL(4825) : (r->r_magic != REDEX_MAGIC) ? FAIL(4826) : 0)
 	 return;
-  r->r_magic = MUGGLE(183);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4468) : redex_count-- ? 0 : FAIL(4469))
+  r->r_magic = MUGGLE(186);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(4827) : redex_count-- ? 0 : FAIL(4828))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4470) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4829) : 0)
 	 return;
   free (r);
 }
@@ -124,14 +124,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4471))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4830))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4472) : ++edge_count ? 0 : FAIL(4473))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4831) : ++edge_count ? 0 : FAIL(4832))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4474) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4833) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -152,12 +152,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(4475) : (e->e_magic != EDGE_MAGIC) ? FAIL(4476) : 0)
+  if ((! e) ? FAIL(4834) : (e->e_magic != EDGE_MAGIC) ? FAIL(4835) : 0)
 	 return;
-  e->e_magic = MUGGLE(184);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4477) : edge_count-- ? 0 : FAIL(4478))
+  e->e_magic = MUGGLE(187);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4836) : edge_count-- ? 0 : FAIL(4837))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4479) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4838) : 0)
 	 return;
   free (e);
 }
@@ -177,9 +177,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4480) : (a->e_magic != EDGE_MAGIC) ? FAIL(4481) : 0)
+  if ((! a) ? FAIL(4839) : (a->e_magic != EDGE_MAGIC) ? FAIL(4840) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4482) : (b->e_magic != EDGE_MAGIC) ? FAIL(4483) : 0)
+  if ((! b) ? FAIL(4841) : (b->e_magic != EDGE_MAGIC) ? FAIL(4842) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -201,7 +201,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(4484) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4485) : 0)
+  if ((! e) ? GLOBAL_FAIL(4843) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4844) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -224,12 +224,12 @@ free_flipped_edge (e, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as m.mu_kernel.e_op.m_free in the mutator m.
 {
-  if ((! e) ? FAIL(4486) : (e->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4487) : 0)
+  if ((! e) ? FAIL(4845) : (e->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4846) : 0)
 	 return;
-  e->e_magic = MUGGLE(185);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4488) : edge_count-- ? 0 : FAIL(4489))
+  e->e_magic = MUGGLE(188);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(4847) : edge_count-- ? 0 : FAIL(4848))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4490) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4849) : 0)
 	 return;
   free (e);
 }
@@ -250,14 +250,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4491))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4850))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4492) : ++vertex_count ? 0 : FAIL(4493))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4851) : ++vertex_count ? 0 : FAIL(4852))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4494) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4853) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -279,12 +279,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(4495) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4496) : 0)
+  if ((! v) ? FAIL(4854) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4855) : 0)
 	 return;
-  v->v_magic = MUGGLE(186);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4497) : vertex_count-- ? 0 : FAIL(4498))
+  v->v_magic = MUGGLE(189);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4856) : vertex_count-- ? 0 : FAIL(4857))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4499) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4858) : 0)
 	 return;
   free (v);
 }
@@ -305,12 +305,12 @@ free_flipped_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(4500) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4501) : 0)
+  if ((! v) ? FAIL(4859) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4860) : 0)
 	 return;
-  v->v_magic = MUGGLE(187);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4502) : vertex_count-- ? 0 : FAIL(4503))
+  v->v_magic = MUGGLE(190);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4861) : vertex_count-- ? 0 : FAIL(4862))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4504) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4863) : 0)
 	 return;
   free (v);
 }
@@ -331,9 +331,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4505) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4506) : 0)
+  if ((! a) ? FAIL(4864) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4865) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4507) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4508) : 0)
+  if ((! b) ? FAIL(4866) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4867) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -355,9 +355,9 @@ flipped_equal_vertices (a, b, err)
 	  // Compare two flipped vertices and return non-zero if they are
 	  // equal.
 {
-  if ((! a) ? FAIL(4509) : (a->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4510) : 0)
+  if ((! a) ? FAIL(4868) : (a->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4869) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4511) : (b->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4512) : 0)
+  if ((! b) ? FAIL(4870) : (b->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4871) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -378,7 +378,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4513) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4514) : 0)
+  if ((! v) ? GLOBAL_FAIL(4872) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4873) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -401,7 +401,7 @@ flipped_vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4515) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? GLOBAL_FAIL(4516) : 0)
+  if ((! v) ? GLOBAL_FAIL(4874) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? GLOBAL_FAIL(4875) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -430,7 +430,7 @@ building_rule (given_vertex, err)
 {
   uintptr_t outgoing_edge, v, local_bits, remote_bits, remote_value;
 
-  if ((! given_vertex) ? FAIL(4517) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4518) : 0)
+  if ((! given_vertex) ? FAIL(4876) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4877) : 0)
 	 return;
   v = given_vertex->v_value;
   for (local_bits = 0; v; v >>= 1)
@@ -463,13 +463,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(4519) : (connecting_edge->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4520) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(4878) : (connecting_edge->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4879) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(4521) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4522) : 0)
+  if ((! local_vertex) ? FAIL(4880) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4881) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4523) : (remote_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4524) : 0)
+  if ((! remote_vertex) ? FAIL(4882) : (remote_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4883) : 0)
 	 return NULL;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << (DIMENSION - connecting_edge->e_value))) ? FAIL(4525) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << (DIMENSION - connecting_edge->e_value))) ? FAIL(4884) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -493,16 +493,16 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 {
   uintptr_t v, bits;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(4526) : (given_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4527) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4885) : (given_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4886) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(4528) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(4529) : 0)
+  if ((! edges_in) ? FAIL(4887) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(4888) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(4530) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(4531) : 0)
+  if ((! edges_out) ? FAIL(4889) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(4890) : 0)
 	 return NULL;
   v = given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
 	 bits += (v & 1);
-  if ((edges_in->r_value != (DIMENSION - bits)) ? FAIL(4532) : (edges_out->r_value != bits) ? FAIL(4533) : 0)
+  if ((edges_in->r_value != (DIMENSION - bits)) ? FAIL(4891) : (edges_out->r_value != bits) ? FAIL(4892) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -525,12 +525,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(4534) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(4893) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(4535) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(4894) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(4536) : (s < (r ? r->r_value : 0)) ? FAIL(4537) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(4895) : (s < (r ? r->r_value : 0)) ? FAIL(4896) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -588,13 +588,13 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(4538))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(4897))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(4539))
+  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(4898))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(4540))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(4899))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(4541))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(4900))
 	 return 0;
   v = (r->r_value == NUMBER_OF_VERTICES);
   free_redex (r, err);
@@ -620,11 +620,11 @@ eflip (local_vertex, label, adjacent_vertex, err)
 {
   edge e;
 
-  if (*err ? 1 : (! local_vertex) ? FAIL(4542) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4543) : 0)
+  if (*err ? 1 : (! local_vertex) ? FAIL(4901) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4902) : 0)
 	 return NULL;
-  if ((! adjacent_vertex) ? FAIL(4544) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4545) : 0)
+  if ((! adjacent_vertex) ? FAIL(4903) : (adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4904) : 0)
 	 return NULL;
-  if ((! label) ? FAIL(4546) : (label->e_magic != EDGE_MAGIC) ? FAIL(4547) : 0)
+  if ((! label) ? FAIL(4905) : (label->e_magic != EDGE_MAGIC) ? FAIL(4906) : 0)
 	 return NULL;
   if ((e = edge_of (DIMENSION - label->e_value, err)))
 	 e->e_magic = FLIPPED_EDGE_MAGIC;
@@ -648,9 +648,9 @@ vflip (edges_in, given_vertex, edges_out, err)
 {
   vertex v;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(4548) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4549) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(4907) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4908) : 0)
 	 return NULL;
-  if ((edges_in != (void *) 1) ? FAIL(4550) : (edges_out != (void *) 1) ? FAIL(4551) : 0)
+  if ((edges_in != (void *) 1) ? FAIL(4909) : (edges_out != (void *) 1) ? FAIL(4910) : 0)
 	 return NULL;
   if ((v = vertex_of (given_vertex->v_value ^ (uintptr_t) (NUMBER_OF_VERTICES - 1), err)))
 	 v->v_magic = FLIPPED_VERTEX_MAGIC;
@@ -701,13 +701,13 @@ mutation_check_in (local_vertex, edge_label, adjacent_vertex, err)
 	  // Check that the incoming edge origins and termini have the
 	  // right types during a forward remote first mutation.
 {
-  if (*err ? 1 : (! local_vertex) ? FAIL(4552) : (! edge_label) ? FAIL(4553) : (! adjacent_vertex) ? FAIL(4554) : 0)
+  if (*err ? 1 : (! local_vertex) ? FAIL(4911) : (! edge_label) ? FAIL(4912) : (! adjacent_vertex) ? FAIL(4913) : 0)
 	 return 0;
-  if ((local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4555) : 0)
+  if ((local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4914) : 0)
 	 return 0;
-  if ((edge_label->e_magic != EDGE_MAGIC) ? FAIL(4556) : 0)
+  if ((edge_label->e_magic != EDGE_MAGIC) ? FAIL(4915) : 0)
 	 return 0;
-  if ((adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4557) : 0)
+  if ((adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4916) : 0)
 	 return 0;
   return 1;
 }
@@ -727,13 +727,13 @@ mutation_check_out (local_vertex, edge_label, adjacent_vertex, err)
 	  // Check that the outgoing edge origins and termini have the
 	  // right types during a forward remote first mutation.
 {
-  if (*err ? 1 : (! local_vertex) ? FAIL(4558) : (! edge_label) ? FAIL(4559) : (! adjacent_vertex) ? FAIL(4560) : 0)
+  if (*err ? 1 : (! local_vertex) ? FAIL(4917) : (! edge_label) ? FAIL(4918) : (! adjacent_vertex) ? FAIL(4919) : 0)
 	 return 0;
-  if ((local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4561) : 0)
+  if ((local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4920) : 0)
 	 return 0;
-  if ((edge_label->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4562) : 0)
+  if ((edge_label->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4921) : 0)
 	 return 0;
-  if ((adjacent_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4563) : 0)
+  if ((adjacent_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4922) : 0)
 	 return 0;
   return 1;
 }
@@ -754,14 +754,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(4564);
+	 FAIL(4923);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(4565);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4566) : 0)
+	 FAIL(4924);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4925) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4567) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4568) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4569) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4926) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4927) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4928) : *err);
 }
 
 
@@ -836,11 +836,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(4570) : vertex_count ? THE_FAIL(4571) : redex_count ? THE_FAIL(4572) : global_err);
+	 err = (edge_count ? THE_FAIL(4929) : vertex_count ? THE_FAIL(4930) : redex_count ? THE_FAIL(4931) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4573);
+	 err = THE_FAIL(4932);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4574);
+	 err = THE_FAIL(4933);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
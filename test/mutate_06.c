@@ -69,14 +69,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(4688))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5047))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4689) : ++redex_count ? 0 : FAIL(4690))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5048) : ++redex_count ? 0 : FAIL(5049))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(4691) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5050) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -97,12 +97,12 @@ free_redex (r, err)
 	  // passed to the cru library as m.ma_prop.vertex.r_free in the
 	  // mapreducer m.
 {
-  if ((! r) ? FAIL(4692) : (r->r_magic != REDEX_MAGIC) ? FAIL(4693) : 0)
+  if ((! r) ? FAIL(5051) : (r->r_magic != REDEX_MAGIC) ? FAIL(5052) : 0)
 	 return;
-  r->r_magic = MUGGLE(193);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4694) : redex_count-- ? 0 : FAIL(4695))
+  r->r_magic = MUGGLE(196);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5053) : redex_count-- ? 0 : FAIL(5054))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4696) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5055) : 0)
 	 return;
   free (r);
 }
@@ -127,14 +127,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4697))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5056))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4698) : ++edge_count ? 0 : FAIL(4699))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5057) : ++edge_count ? 0 : FAIL(5058))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4700) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5059) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -155,12 +155,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(4701) : (e->e_magic != EDGE_MAGIC) ? FAIL(4702) : 0)
+  if ((! e) ? FAIL(5060) : (e->e_magic != EDGE_MAGIC) ? FAIL(5061) : 0)
 	 return;
-  e->e_magic = MUGGLE(194);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4703) : edge_count-- ? 0 : FAIL(4704))
+  e->e_magic = MUGGLE(197);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5062) : edge_count-- ? 0 : FAIL(5063))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4705) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5064) : 0)
 	 return;
   free (e);
 }
@@ -180,9 +180,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4706) : (a->e_magic != EDGE_MAGIC) ? FAIL(4707) : 0)
+  if ((! a) ? FAIL(5065) : (a->e_magic != EDGE_MAGIC) ? FAIL(5066) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4708) : (b->e_magic != EDGE_MAGIC) ? FAIL(4709) : 0)
+  if ((! b) ? FAIL(5067) : (b->e_magic != EDGE_MAGIC) ? FAIL(5068) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -204,7 +204,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(4710) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4711) : 0)
+  if ((! e) ? GLOBAL_FAIL(5069) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5070) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -227,12 +227,12 @@ free_flipped_edge (e, err)
 	  // function cast to a cru_destructor is passed to the cru library
 	  // as m.mu_kernel.e_op.m_free in the mutator m.
 {
-  if ((! e) ? FAIL(4712) : (e->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4713) : 0)
+  if ((! e) ? FAIL(5071) : (e->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(5072) : 0)
 	 return;
-  e->e_magic = MUGGLE(195);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4714) : edge_count-- ? 0 : FAIL(4715))
+  e->e_magic = MUGGLE(198);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5073) : edge_count-- ? 0 : FAIL(5074))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4716) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5075) : 0)
 	 return;
   free (e);
 }
@@ -253,14 +253,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4717))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5076))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4718) : ++vertex_count ? 0 : FAIL(4719))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5077) : ++vertex_count ? 0 : FAIL(5078))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4720) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5079) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -282,12 +282,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(4721) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4722) : 0)
+  if ((! v) ? FAIL(5080) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5081) : 0)
 	 return;
-  v->v_magic = MUGGLE(196);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4723) : vertex_count-- ? 0 : FAIL(4724))
+  v->v_magic = MUGGLE(199);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5082) : vertex_count-- ? 0 : FAIL(5083))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4725) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5084) : 0)
 	 return;
   free (v);
 }
@@ -308,12 +308,12 @@ free_flipped_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(4726) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4727) : 0)
+  if ((! v) ? FAIL(5085) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(5086) : 0)
 	 return;
-  v->v_magic = MUGGLE(197);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4728) : vertex_count-- ? 0 : FAIL(4729))
+  v->v_magic = MUGGLE(200);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5087) : vertex_count-- ? 0 : FAIL(5088))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4730) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5089) : 0)
 	 return;
   free (v);
 }
@@ -334,9 +334,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4731) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4732) : 0)
+  if ((! a) ? FAIL(5090) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5091) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4733) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4734) : 0)
+  if ((! b) ? FAIL(5092) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5093) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -356,9 +356,9 @@ flipped_equal_vertices (a, b, err)
 	  // Compare two flipped vertices and return non-zero if they are
 	  // equal.
 {
-  if ((! a) ? FAIL(4735) : (a->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4736) : 0)
+  if ((! a) ? FAIL(5094) : (a->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(5095) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4737) : (b->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4738) : 0)
+  if ((! b) ? FAIL(5096) : (b->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(5097) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -380,7 +380,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4739) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4740) : 0)
+  if ((! v) ? GLOBAL_FAIL(5098) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5099) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -403,7 +403,7 @@ flipped_vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4741) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? GLOBAL_FAIL(4742) : 0)
+  if ((! v) ? GLOBAL_FAIL(5100) : (v->v_magic != FLIPPED_VERTEX_MAGIC) ? GLOBAL_FAIL(5101) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -432,7 +432,7 @@ building_rule (given_vertex, err)
 {
   uintptr_t outgoing_edge, v, local_bits, remote_bits, remote_value;
 
-  if ((! given_vertex) ? FAIL(4743) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4744) : 0)
+  if ((! given_vertex) ? FAIL(5102) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5103) : 0)
 	 return;
   v = given_vertex->v_value;
   for (local_bits = 0; v; v >>= 1)
@@ -465,13 +465,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(4745) : (connecting_edge->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4746) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(5104) : (connecting_edge->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(5105) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(4747) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4748) : 0)
+  if ((! local_vertex) ? FAIL(5106) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(5107) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4749) : (remote_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4750) : 0)
+  if ((! remote_vertex) ? FAIL(5108) : (remote_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(5109) : 0)
 	 return NULL;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << (DIMENSION - connecting_edge->e_value))) ? FAIL(4751) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << (DIMENSION - connecting_edge->e_value))) ? FAIL(5110) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -495,16 +495,16 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 {
   uintptr_t v, bits;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(4752) : (given_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4753) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(5111) : (given_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(5112) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(4754) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(4755) : 0)
+  if ((! edges_in) ? FAIL(5113) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5114) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(4756) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(4757) : 0)
+  if ((! edges_out) ? FAIL(5115) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5116) : 0)
 	 return NULL;
   v = given_vertex->v_value;
   for (bits = 0; v; v >>= 1)
 	 bits += (v & 1);
-  if ((edges_in->r_value != (DIMENSION - bits)) ? FAIL(4758) : (edges_out->r_value != bits) ? FAIL(4759) : 0)
+  if ((edges_in->r_value != (DIMENSION - bits)) ? FAIL(5117) : (edges_out->r_value != bits) ? FAIL(5118) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -528,12 +528,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(4760) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5119) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(4761) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5120) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(4762) : (s < (r ? r->r_value : 0)) ? FAIL(4763) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(5121) : (s < (r ? r->r_value : 0)) ? FAIL(5122) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -591,13 +591,13 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(4764))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(5123))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(4765))
+  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(5124))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(4766))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5125))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(4767))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5126))
 	 return 0;
   v = (r->r_value == NUMBER_OF_VERTICES);
   free_redex (r, err);
@@ -623,11 +623,11 @@ eflip (local_vertex, label, remote_vertex, err)
 {
   edge e;
 
-  if (*err ? 1 : (! local_vertex) ? FAIL(4768) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4769) : 0)
+  if (*err ? 1 : (! local_vertex) ? FAIL(5127) : (local_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(5128) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4770) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4771) : 0)
+  if ((! remote_vertex) ? FAIL(5129) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5130) : 0)
 	 return NULL;
-  if ((! label) ? FAIL(4772) : (label->e_magic != EDGE_MAGIC) ? FAIL(4773) : 0)
+  if ((! label) ? FAIL(5131) : (label->e_magic != EDGE_MAGIC) ? FAIL(5132) : 0)
 	 return NULL;
   if ((e = edge_of (DIMENSION - label->e_value, err)))
 	 e->e_magic = FLIPPED_EDGE_MAGIC;
@@ -651,9 +651,9 @@ vflip (edges_in, given_vertex, edges_out, err)
 {
   vertex v;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(4774) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4775) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(5133) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5134) : 0)
 	 return NULL;
-  if ((edges_in != (void *) 1) ? FAIL(4776) : (edges_out != (void *) 1) ? FAIL(4777) : 0)
+  if ((edges_in != (void *) 1) ? FAIL(5135) : (edges_out != (void *) 1) ? FAIL(5136) : 0)
 	 return NULL;
   if ((v = vertex_of (given_vertex->v_value ^ (uintptr_t) (NUMBER_OF_VERTICES - 1), err)))
 	 v->v_magic = FLIPPED_VERTEX_MAGIC;
@@ -706,13 +706,13 @@ mutation_check_in (local_vertex, edge_label, adjacent_vertex, err)
 	  // Check that the incoming edge origins and termini have the
 	  // right types during a backwards remote first mutation.
 {
-  if (*err ? 1 : (! local_vertex) ? FAIL(4778) : (! edge_label) ? FAIL(4779) : (! adjacent_vertex) ? FAIL(4780) : 0)
+  if (*err ? 1 : (! local_vertex) ? FAIL(5137) : (! edge_label) ? FAIL(5138) : (! adjacent_vertex) ? FAIL(5139) : 0)
 	 return 0;
-  if ((local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4781) : 0)
+  if ((local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5140) : 0)
 	 return 0;
-  if ((edge_label->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(4782) : 0)
+  if ((edge_label->e_magic != FLIPPED_EDGE_MAGIC) ? FAIL(5141) : 0)
 	 return 0;
-  if ((adjacent_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(4783) : 0)
+  if ((adjacent_vertex->v_magic != FLIPPED_VERTEX_MAGIC) ? FAIL(5142) : 0)
 	 return 0;
   return 1;
 }
@@ -734,13 +734,13 @@ mutation_check_out (local_vertex, edge_label, adjacent_vertex, err)
 {
   if (! adjacent_vertex)
 	 return 1;
-  if (*err ? 1 : (! local_vertex) ? FAIL(4784) : (! edge_label) ? FAIL(4785) : (! adjacent_vertex) ? FAIL(4786) : 0)
+  if (*err ? 1 : (! local_vertex) ? FAIL(5143) : (! edge_label) ? FAIL(5144) : (! adjacent_vertex) ? FAIL(5145) : 0)
 	 return 0;
-  if ((local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4787) : 0)
+  if ((local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5146) : 0)
 	 return 0;
-  if ((edge_label->e_magic != EDGE_MAGIC) ? FAIL(4788) : 0)
+  if ((edge_label->e_magic != EDGE_MAGIC) ? FAIL(5147) : 0)
 	 return 0;
-  if ((adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4789) : 0)
+  if ((adjacent_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5148) : 0)
 	 return 0;
   return 1;
 }
@@ -761,14 +761,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(4790);
+	 FAIL(5149);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(4791);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4792) : 0)
+	 FAIL(5150);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5151) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4793) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4794) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4795) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5152) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5153) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5154) : *err);
 }
 
 
@@ -847,11 +847,11 @@ main (argc, argv)
   free_vertex (m.mu_plan.zone.initial_vertex, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(4796) : vertex_count ? THE_FAIL(4797) : redex_count ? THE_FAIL(4798) : global_err);
+	 err = (edge_count ? THE_FAIL(5155) : vertex_count ? THE_FAIL(5156) : redex_count ? THE_FAIL(5157) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4799);
+	 err = THE_FAIL(5158);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4800);
+	 err = THE_FAIL(5159);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
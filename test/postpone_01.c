@@ -69,14 +69,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(4808))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5280))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4809) : ++redex_count ? 0 : FAIL(4810))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5281) : ++redex_count ? 0 : FAIL(5282))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(4811) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5283) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -95,12 +95,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(4812) : (r->r_magic != REDEX_MAGIC) ? FAIL(4813) : 0)
+  if ((! r) ? FAIL(5284) : (r->r_magic != REDEX_MAGIC) ? FAIL(5285) : 0)
 	 return;
-  r->r_magic = MUGGLE(198);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4814) : redex_count-- ? 0 : FAIL(4815))
+  r->r_magic = MUGGLE(206);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5286) : redex_count-- ? 0 : FAIL(5287))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4816) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5288) : 0)
 	 return;
   free (r);
 }
@@ -119,14 +119,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4817))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5289))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4818) : ++edge_count ? 0 : FAIL(4819))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5290) : ++edge_count ? 0 : FAIL(5291))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4820) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5292) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -147,12 +147,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(4821) : (e->e_magic != EDGE_MAGIC) ? FAIL(4822) : 0)
+  if ((! e) ? FAIL(5293) : (e->e_magic != EDGE_MAGIC) ? FAIL(5294) : 0)
 	 return;
-  e->e_magic = MUGGLE(199);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4823) : edge_count-- ? 0 : FAIL(4824))
+  e->e_magic = MUGGLE(207);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5295) : edge_count-- ? 0 : FAIL(5296))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4825) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5297) : 0)
 	 return;
   free (e);
 }
@@ -174,7 +174,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(4826) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4827) : 0)
+  if ((! e) ? GLOBAL_FAIL(5298) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5299) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -199,9 +199,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for composing.
 {
-  if ((! a) ? FAIL(4828) : (a->e_magic != EDGE_MAGIC) ? FAIL(4829) : 0)
+  if ((! a) ? FAIL(5300) : (a->e_magic != EDGE_MAGIC) ? FAIL(5301) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4830) : (b->e_magic != EDGE_MAGIC) ? FAIL(4831) : 0)
+  if ((! b) ? FAIL(5302) : (b->e_magic != EDGE_MAGIC) ? FAIL(5303) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -221,14 +221,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4832))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5304))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4833) : ++vertex_count ? 0 : FAIL(4834))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5305) : ++vertex_count ? 0 : FAIL(5306))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4835) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5307) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -250,12 +250,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(4836) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4837) : 0)
+  if ((! v) ? FAIL(5308) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5309) : 0)
 	 return;
-  v->v_magic = MUGGLE(200);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4838) : vertex_count-- ? 0 : FAIL(4839))
+  v->v_magic = MUGGLE(208);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5310) : vertex_count-- ? 0 : FAIL(5311))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4840) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5312) : 0)
 	 return;
   free (v);
 }
@@ -276,9 +276,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4841) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4842) : 0)
+  if ((! a) ? FAIL(5313) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5314) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4843) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4844) : 0)
+  if ((! b) ? FAIL(5315) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5316) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -302,7 +302,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4845) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4846) : 0)
+  if ((! v) ? GLOBAL_FAIL(5317) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5318) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -333,7 +333,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(4847) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4848) : 0)
+  if ((! given_vertex) ? FAIL(5319) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5320) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -364,11 +364,11 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(4849) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4850) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(5321) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5322) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(4851) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4852) : 0)
+  if ((! local_vertex) ? FAIL(5323) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5324) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4853) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4854) : 0)
+  if ((! remote_vertex) ? FAIL(5325) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5326) : 0)
 	 return NULL;
   if (connecting_edge->e_value & 1)
 	 if ((local_vertex->v_value ^ remote_vertex->v_value) == (1 << connecting_edge->e_value))
@@ -396,15 +396,15 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(4855) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4856) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(5327) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5328) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(4857) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(4858) : 0)
+  if ((! edges_in) ? FAIL(5329) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5330) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(4859) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(4860) : 0)
+  if ((! edges_out) ? FAIL(5331) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5332) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DEGREE) ? FAIL(4861) : 0)
+  if ((edges_in->r_value != DEGREE) ? FAIL(5333) : 0)
 	 return NULL;
-  if ((edges_out->r_value != DEGREE) ? FAIL(4862) : 0)
+  if ((edges_out->r_value != DEGREE) ? FAIL(5334) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -429,12 +429,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(4863) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5335) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(4864) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5336) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(4865) : (s < (r ? r->r_value : 0)) ? FAIL(4866) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(5337) : (s < (r ? r->r_value : 0)) ? FAIL(5338) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -476,16 +476,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(4867))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(5339))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (DEGREE * NUMBER_OF_VERTICES)) ? 0 : FAIL(4868))
+  if ((cru_edge_count (g, LANES, err) == (DEGREE * NUMBER_OF_VERTICES)) ? 0 : FAIL(5340))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(4869))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5341))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(4870))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5342))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES)))
-	 FAIL(4871);
+	 FAIL(5343);
   free_redex (r, err);
   return v;
 }
@@ -509,14 +509,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(4872);
+	 FAIL(5344);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(4873);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4874) : 0)
+	 FAIL(5345);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5346) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4875) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4876) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4877) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5347) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5348) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5349) : *err);
 }
 
 
@@ -533,7 +533,7 @@ copied_mark (l, r, err)
 
 	  // Return a copy of the left edge.
 {
-  if ((! l) ? FAIL(4878) : (l->e_magic != EDGE_MAGIC) ? FAIL(4879) : 0)
+  if ((! l) ? FAIL(5350) : (l->e_magic != EDGE_MAGIC) ? FAIL(5351) : 0)
 	 return 0;
   return edge_of (l->e_value, err);
 }
@@ -553,11 +553,11 @@ even_label (o, l, t, err)
 
 	  // Treat all edges with an even numbered label as postponable.
 {
-  if ((! o) ? FAIL(4880) : (o->v_magic != VERTEX_MAGIC) ? FAIL(4881) : 0)
+  if ((! o) ? FAIL(5352) : (o->v_magic != VERTEX_MAGIC) ? FAIL(5353) : 0)
 	 return 0;
-  if ((! t) ? FAIL(4882) : (t->v_magic != VERTEX_MAGIC) ? FAIL(4883) : 0)
+  if ((! t) ? FAIL(5354) : (t->v_magic != VERTEX_MAGIC) ? FAIL(5355) : 0)
 	 return 0;
-  if ((! l) ? FAIL(4884) : (l->e_magic != EDGE_MAGIC) ? FAIL(4885) : 0)
+  if ((! l) ? FAIL(5356) : (l->e_magic != EDGE_MAGIC) ? FAIL(5357) : 0)
 	 return 0;
   return ! (l->e_value & 1);
 }
@@ -617,11 +617,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(4886) : vertex_count ? THE_FAIL(4887) : redex_count ? THE_FAIL(4888) : global_err);
+	 err = (edge_count ? THE_FAIL(5358) : vertex_count ? THE_FAIL(5359) : redex_count ? THE_FAIL(5360) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4889);
+	 err = THE_FAIL(5361);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4890);
+	 err = THE_FAIL(5362);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -70,14 +70,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(4891))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5363))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4892) : ++redex_count ? 0 : FAIL(4893))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5364) : ++redex_count ? 0 : FAIL(5365))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(4894) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5366) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -96,12 +96,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(4895) : (r->r_magic != REDEX_MAGIC) ? FAIL(4896) : 0)
+  if ((! r) ? FAIL(5367) : (r->r_magic != REDEX_MAGIC) ? FAIL(5368) : 0)
 	 return;
-  r->r_magic = MUGGLE(201);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4897) : redex_count-- ? 0 : FAIL(4898))
+  r->r_magic = MUGGLE(209);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5369) : redex_count-- ? 0 : FAIL(5370))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4899) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5371) : 0)
 	 return;
   free (r);
 }
@@ -120,14 +120,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4900))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5372))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4901) : ++edge_count ? 0 : FAIL(4902))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5373) : ++edge_count ? 0 : FAIL(5374))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4903) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5375) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -148,12 +148,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(4904) : (e->e_magic != EDGE_MAGIC) ? FAIL(4905) : 0)
+  if ((! e) ? FAIL(5376) : (e->e_magic != EDGE_MAGIC) ? FAIL(5377) : 0)
 	 return;
-  e->e_magic = MUGGLE(202);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4906) : edge_count-- ? 0 : FAIL(4907))
+  e->e_magic = MUGGLE(210);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5378) : edge_count-- ? 0 : FAIL(5379))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4908) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5380) : 0)
 	 return;
   free (e);
 }
@@ -175,7 +175,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(4909) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4910) : 0)
+  if ((! e) ? GLOBAL_FAIL(5381) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5382) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -200,9 +200,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for composing.
 {
-  if ((! a) ? FAIL(4911) : (a->e_magic != EDGE_MAGIC) ? FAIL(4912) : 0)
+  if ((! a) ? FAIL(5383) : (a->e_magic != EDGE_MAGIC) ? FAIL(5384) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4913) : (b->e_magic != EDGE_MAGIC) ? FAIL(4914) : 0)
+  if ((! b) ? FAIL(5385) : (b->e_magic != EDGE_MAGIC) ? FAIL(5386) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -222,14 +222,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(4915))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5387))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4916) : ++vertex_count ? 0 : FAIL(4917))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5388) : ++vertex_count ? 0 : FAIL(5389))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(4918) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5390) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -251,12 +251,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(4919) : (v->v_magic != VERTEX_MAGIC) ? FAIL(4920) : 0)
+  if ((! v) ? FAIL(5391) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5392) : 0)
 	 return;
-  v->v_magic = MUGGLE(203);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(4921) : vertex_count-- ? 0 : FAIL(4922))
+  v->v_magic = MUGGLE(211);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5393) : vertex_count-- ? 0 : FAIL(5394))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(4923) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5395) : 0)
 	 return;
   free (v);
 }
@@ -277,9 +277,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(4924) : (a->v_magic != VERTEX_MAGIC) ? FAIL(4925) : 0)
+  if ((! a) ? FAIL(5396) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5397) : 0)
 	 return 0;
-  if ((! b) ? FAIL(4926) : (b->v_magic != VERTEX_MAGIC) ? FAIL(4927) : 0)
+  if ((! b) ? FAIL(5398) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5399) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -303,7 +303,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(4928) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(4929) : 0)
+  if ((! v) ? GLOBAL_FAIL(5400) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5401) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -334,7 +334,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(4930) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4931) : 0)
+  if ((! given_vertex) ? FAIL(5402) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5403) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -365,11 +365,11 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(4932) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(4933) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(5404) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5405) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(4934) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4935) : 0)
+  if ((! local_vertex) ? FAIL(5406) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5407) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(4936) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4937) : 0)
+  if ((! remote_vertex) ? FAIL(5408) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5409) : 0)
 	 return NULL;
   if (connecting_edge->e_value & 1)
 	 if ((local_vertex->v_value ^ remote_vertex->v_value) == (1 << connecting_edge->e_value))
@@ -399,15 +399,15 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(4938) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(4939) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(5410) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5411) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(4940) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(4941) : 0)
+  if ((! edges_in) ? FAIL(5412) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5413) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(4942) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(4943) : 0)
+  if ((! edges_out) ? FAIL(5414) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5415) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DEGREE) ? FAIL(4944) : 0)
+  if ((edges_in->r_value != DEGREE) ? FAIL(5416) : 0)
 	 return NULL;
-  if ((edges_out->r_value != DEGREE) ? FAIL(4945) : 0)
+  if ((edges_out->r_value != DEGREE) ? FAIL(5417) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -432,12 +432,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(4946) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5418) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(4947) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5419) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(4948) : (s < (r ? r->r_value : 0)) ? FAIL(4949) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(5420) : (s < (r ? r->r_value : 0)) ? FAIL(5421) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -479,16 +479,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(4950))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(5422))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (DEGREE * NUMBER_OF_VERTICES)) ? 0 : FAIL(4951))
+  if ((cru_edge_count (g, LANES, err) == (DEGREE * NUMBER_OF_VERTICES)) ? 0 : FAIL(5423))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(4952))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5424))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(4953))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5425))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES)))
-	 FAIL(4954);
+	 FAIL(5426);
   free_redex (r, err);
   return v;
 }
@@ -512,14 +512,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(4955);
+	 FAIL(5427);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(4956);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(4957) : 0)
+	 FAIL(5428);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5429) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(4958) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(4959) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(4960) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5430) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5431) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5432) : *err);
 }
 
 
@@ -536,7 +536,7 @@ copied_mark (l, r, err)
 
 	  // Return a copy of the left edge.
 {
-  if ((! l) ? FAIL(4961) : (l->e_magic != EDGE_MAGIC) ? FAIL(4962) : 0)
+  if ((! l) ? FAIL(5433) : (l->e_magic != EDGE_MAGIC) ? FAIL(5434) : 0)
 	 return 0;
   return edge_of (l->e_value, err);
 }
@@ -555,9 +555,9 @@ lesser_labels (l, r, err)
 	  // function used as the cond in a cru_postponer permits edges to be
 	  // postponed only to the termini of greater numbered edges.
 {
-  if ((! l) ? FAIL(4963) : (l->e_magic != EDGE_MAGIC) ? FAIL(4964) : 0)
+  if ((! l) ? FAIL(5435) : (l->e_magic != EDGE_MAGIC) ? FAIL(5436) : 0)
 	 return 0;
-  if ((! r) ? FAIL(4965) : (r->e_magic != EDGE_MAGIC) ? FAIL(4966) : 0)
+  if ((! r) ? FAIL(5437) : (r->e_magic != EDGE_MAGIC) ? FAIL(5438) : 0)
 	 return 0;
   return (l->e_value < r->e_value);
 }
@@ -576,11 +576,11 @@ even_label (o, l, t, err)
 
 	  // Treat all edges with an even numbered label as postponable.
 {
-  if ((! o) ? FAIL(4967) : (o->v_magic != VERTEX_MAGIC) ? FAIL(4968) : 0)
+  if ((! o) ? FAIL(5439) : (o->v_magic != VERTEX_MAGIC) ? FAIL(5440) : 0)
 	 return 0;
-  if ((! t) ? FAIL(4969) : (t->v_magic != VERTEX_MAGIC) ? FAIL(4970) : 0)
+  if ((! t) ? FAIL(5441) : (t->v_magic != VERTEX_MAGIC) ? FAIL(5442) : 0)
 	 return 0;
-  if ((! l) ? FAIL(4971) : (l->e_magic != EDGE_MAGIC) ? FAIL(4972) : 0)
+  if ((! l) ? FAIL(5443) : (l->e_magic != EDGE_MAGIC) ? FAIL(5444) : 0)
 	 return 0;
   return ! (l->e_value & 1);
 }
@@ -641,11 +641,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(4973) : vertex_count ? THE_FAIL(4974) : redex_count ? THE_FAIL(4975) : global_err);
+	 err = (edge_count ? THE_FAIL(5445) : vertex_count ? THE_FAIL(5446) : redex_count ? THE_FAIL(5447) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4976);
+	 err = THE_FAIL(5448);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(4977);
+	 err = THE_FAIL(5449);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
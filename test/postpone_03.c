@@ -70,14 +70,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(4978))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5450))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4979) : ++redex_count ? 0 : FAIL(4980))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5451) : ++redex_count ? 0 : FAIL(5452))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(4981) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5453) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -96,12 +96,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(4982) : (r->r_magic != REDEX_MAGIC) ? FAIL(4983) : 0)
+  if ((! r) ? FAIL(5454) : (r->r_magic != REDEX_MAGIC) ? FAIL(5455) : 0)
 	 return;
-  r->r_magic = MUGGLE(204);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(4984) : redex_count-- ? 0 : FAIL(4985))
+  r->r_magic = MUGGLE(212);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5456) : redex_count-- ? 0 : FAIL(5457))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(4986) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5458) : 0)
 	 return;
   free (r);
 }
@@ -116,7 +116,7 @@ free_mapex (r, err)
 
 	  // Reclaim a mapex.
 {
-  if ((! r) ? FAIL(4987) : (r->r_magic != MAPEX_MAGIC) ? FAIL(4988) : 0)
+  if ((! r) ? FAIL(5459) : (r->r_magic != MAPEX_MAGIC) ? FAIL(5460) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -137,14 +137,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(4989))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5461))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4990) : ++edge_count ? 0 : FAIL(4991))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5462) : ++edge_count ? 0 : FAIL(5463))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(4992) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5464) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -165,12 +165,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(4993) : (e->e_magic != EDGE_MAGIC) ? FAIL(4994) : 0)
+  if ((! e) ? FAIL(5465) : (e->e_magic != EDGE_MAGIC) ? FAIL(5466) : 0)
 	 return;
-  e->e_magic = MUGGLE(205);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(4995) : edge_count-- ? 0 : FAIL(4996))
+  e->e_magic = MUGGLE(213);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5467) : edge_count-- ? 0 : FAIL(5468))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(4997) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5469) : 0)
 	 return;
   free (e);
 }
@@ -192,7 +192,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(4998) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(4999) : 0)
+  if ((! e) ? GLOBAL_FAIL(5470) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5471) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -217,9 +217,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for composing.
 {
-  if ((! a) ? FAIL(5000) : (a->e_magic != EDGE_MAGIC) ? FAIL(5001) : 0)
+  if ((! a) ? FAIL(5472) : (a->e_magic != EDGE_MAGIC) ? FAIL(5473) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5002) : (b->e_magic != EDGE_MAGIC) ? FAIL(5003) : 0)
+  if ((! b) ? FAIL(5474) : (b->e_magic != EDGE_MAGIC) ? FAIL(5475) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -239,14 +239,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5004))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5476))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5005) : ++vertex_count ? 0 : FAIL(5006))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5477) : ++vertex_count ? 0 : FAIL(5478))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5007) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5479) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -268,12 +268,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(5008) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5009) : 0)
+  if ((! v) ? FAIL(5480) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5481) : 0)
 	 return;
-  v->v_magic = MUGGLE(206);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5010) : vertex_count-- ? 0 : FAIL(5011))
+  v->v_magic = MUGGLE(214);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5482) : vertex_count-- ? 0 : FAIL(5483))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5012) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5484) : 0)
 	 return;
   free (v);
 }
@@ -294,9 +294,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(5013) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5014) : 0)
+  if ((! a) ? FAIL(5485) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5486) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5015) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5016) : 0)
+  if ((! b) ? FAIL(5487) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5488) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -320,7 +320,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(5017) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5018) : 0)
+  if ((! v) ? GLOBAL_FAIL(5489) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5490) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -351,7 +351,7 @@ building_rule (given_vertex, err)
   vertex r;
   edge e;
 
-  if ((! given_vertex) ? FAIL(5019) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5020) : 0)
+  if ((! given_vertex) ? FAIL(5491) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5492) : 0)
 	 return;
   v = given_vertex->v_value;
   for (local_bits = 0; v; v >>= 1)
@@ -389,11 +389,11 @@ edge_offsetter (local_vertex, connecting_edge, remote_vertex, err)
   uintptr_t e;
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(5021) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5022) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(5493) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5494) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(5023) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5024) : 0)
+  if ((! local_vertex) ? FAIL(5495) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5496) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(5025) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5026) : 0)
+  if ((! remote_vertex) ? FAIL(5497) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5498) : 0)
 	 return NULL;
   if ((r = redex_of (connecting_edge->e_value + 2, err)))
 	 r->r_magic = MAPEX_MAGIC;
@@ -417,13 +417,13 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(5027) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5028) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(5499) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5500) : 0)
 	 return NULL;
-  if (edges_in ? FAIL(5029) : 0)
+  if (edges_in ? FAIL(5501) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(5030) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5031) : 0)
+  if ((! edges_out) ? FAIL(5502) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5503) : 0)
 	 return NULL;
-  if ((edges_out->r_value != 1) ? FAIL(5032) : 0)
+  if ((edges_out->r_value != 1) ? FAIL(5504) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -447,12 +447,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5033) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5505) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5034) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5506) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(5035) : (s < (r ? r->r_value : 0)) ? FAIL(5036) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(5507) : (s < (r ? r->r_value : 0)) ? FAIL(5508) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -474,9 +474,9 @@ matching_parity (l, r, err)
 {
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != MAPEX_MAGIC) ? FAIL(5037) : 0)
+  if ((! l) ? 0 : (l->r_magic != MAPEX_MAGIC) ? FAIL(5509) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5038) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5510) : 0)
 	 return NULL;
   return redex_of ((! l) ? 0 : (! r) ? 0 : (! (r->r_value)) ? 1 : ((l->r_value & 1) == (r->r_value & 1)), err);
 }
@@ -525,16 +525,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(5039))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(5511))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(5040))
+  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) >> 1)) ? 0 : FAIL(5512))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5041))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5513))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5042))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5514))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES)))
-	 FAIL(5043);
+	 FAIL(5515);
   free_redex (r, err);
   return v;
 }
@@ -558,14 +558,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(5044);
+	 FAIL(5516);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(5045);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5046) : 0)
+	 FAIL(5517);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5518) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5047) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5048) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5049) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5519) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5520) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5521) : *err);
 }
 
 
@@ -584,7 +584,7 @@ copied_mark (l, r, err)
 
 	  // Return a copy of the left edge.
 {
-  if ((! l) ? FAIL(5050) : (l->e_magic != EDGE_MAGIC) ? FAIL(5051) : 0)
+  if ((! l) ? FAIL(5522) : (l->e_magic != EDGE_MAGIC) ? FAIL(5523) : 0)
 	 return 0;
   return edge_of (l->e_value, err);
 }
@@ -604,11 +604,11 @@ even_label (o, l, t, err)
 
 	  // Treat all edges with an even numbered label as postponable.
 {
-  if ((! o) ? FAIL(5052) : (o->v_magic != VERTEX_MAGIC) ? FAIL(5053) : 0)
+  if ((! o) ? FAIL(5524) : (o->v_magic != VERTEX_MAGIC) ? FAIL(5525) : 0)
 	 return 0;
-  if ((! t) ? FAIL(5054) : (t->v_magic != VERTEX_MAGIC) ? FAIL(5055) : 0)
+  if ((! t) ? FAIL(5526) : (t->v_magic != VERTEX_MAGIC) ? FAIL(5527) : 0)
 	 return 0;
-  if ((! l) ? FAIL(5056) : (l->e_magic != EDGE_MAGIC) ? FAIL(5057) : 0)
+  if ((! l) ? FAIL(5528) : (l->e_magic != EDGE_MAGIC) ? FAIL(5529) : 0)
 	 return 0;
   return ! (l->e_value & 1);
 }
@@ -669,11 +669,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(5058) : vertex_count ? THE_FAIL(5059) : redex_count ? THE_FAIL(5060) : global_err);
+	 err = (edge_count ? THE_FAIL(5530) : vertex_count ? THE_FAIL(5531) : redex_count ? THE_FAIL(5532) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5061);
+	 err = THE_FAIL(5533);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5062);
+	 err = THE_FAIL(5534);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -74,14 +74,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5169))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5641))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(5170) : ++redex_count ? 0 : FAIL(5171))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5642) : ++redex_count ? 0 : FAIL(5643))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5172) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5644) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -100,12 +100,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(5173) : (r->r_magic != REDEX_MAGIC) ? FAIL(5174) : 0)
+  if ((! r) ? FAIL(5645) : (r->r_magic != REDEX_MAGIC) ? FAIL(5646) : 0)
 	 return;
-  r->r_magic = MUGGLE(210);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(5175) : redex_count-- ? 0 : FAIL(5176))
+  r->r_magic = MUGGLE(218);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5647) : redex_count-- ? 0 : FAIL(5648))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5177) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5649) : 0)
 	 return;
   free (r);
 }
@@ -124,14 +124,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5178))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5650))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5179) : ++edge_count ? 0 : FAIL(5180))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5651) : ++edge_count ? 0 : FAIL(5652))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5181) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5653) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -153,12 +153,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(5182) : (e->e_magic != EDGE_MAGIC) ? FAIL(5183) : 0)
+  if ((! e) ? FAIL(5654) : (e->e_magic != EDGE_MAGIC) ? FAIL(5655) : 0)
 	 return;
-  e->e_magic = MUGGLE(211);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5184) : edge_count-- ? 0 : FAIL(5185))
+  e->e_magic = MUGGLE(219);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5656) : edge_count-- ? 0 : FAIL(5657))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5186) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5658) : 0)
 	 return;
   free (e);
 }
@@ -178,9 +178,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(5187) : (a->e_magic != EDGE_MAGIC) ? FAIL(5188) : 0)
+  if ((! a) ? FAIL(5659) : (a->e_magic != EDGE_MAGIC) ? FAIL(5660) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5189) : (b->e_magic != EDGE_MAGIC) ? FAIL(5190) : 0)
+  if ((! b) ? FAIL(5661) : (b->e_magic != EDGE_MAGIC) ? FAIL(5662) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -202,7 +202,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(5191) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5192) : 0)
+  if ((! e) ? GLOBAL_FAIL(5663) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5664) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -223,7 +223,7 @@ free_cross_edge (e, err)
 
 	  // as above for cross edges
 {
-  if ((! e) ? FAIL(5193) : (e->e_magic != CROSS_EDGE_MAGIC) ? FAIL(5194) : 0)
+  if ((! e) ? FAIL(5665) : (e->e_magic != CROSS_EDGE_MAGIC) ? FAIL(5666) : 0)
 	 return;
   e->e_magic = EDGE_MAGIC;
   free_edge (e, err);
@@ -245,14 +245,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5195))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5667))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5196) : ++vertex_count ? 0 : FAIL(5197))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5668) : ++vertex_count ? 0 : FAIL(5669))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5198) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5670) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -274,12 +274,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(5199) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5200) : 0)
+  if ((! v) ? FAIL(5671) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5672) : 0)
 	 return;
-  v->v_magic = MUGGLE(212);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5201) : vertex_count-- ? 0 : FAIL(5202))
+  v->v_magic = MUGGLE(220);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5673) : vertex_count-- ? 0 : FAIL(5674))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5203) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5675) : 0)
 	 return;
   free (v);
 }
@@ -298,7 +298,7 @@ free_cross_vertex (v, err)
 
 	  // as above for cross vertices
 {
-  if ((! v) ? FAIL(5204) : (v->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5205) : 0)
+  if ((! v) ? FAIL(5676) : (v->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5677) : 0)
 	 return;
   v->v_magic = VERTEX_MAGIC;
   free_vertex (v, err);
@@ -320,9 +320,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(5206) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5207) : 0)
+  if ((! a) ? FAIL(5678) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5679) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5208) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5209) : 0)
+  if ((! b) ? FAIL(5680) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5681) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -341,9 +341,9 @@ equal_cross_vertices (a, b, err)
 
 	  // as above for cross vertices
 {
-  if ((! a) ? FAIL(5210) : (a->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5211) : 0)
+  if ((! a) ? FAIL(5682) : (a->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5683) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5212) : (b->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5213) : 0)
+  if ((! b) ? FAIL(5684) : (b->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5685) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -367,7 +367,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(5214) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5215) : 0)
+  if ((! v) ? GLOBAL_FAIL(5686) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5687) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -392,7 +392,7 @@ cross_vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(5216) : (v->v_magic != CROSS_VERTEX_MAGIC) ? GLOBAL_FAIL(5217) : 0)
+  if ((! v) ? GLOBAL_FAIL(5688) : (v->v_magic != CROSS_VERTEX_MAGIC) ? GLOBAL_FAIL(5689) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -423,7 +423,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(5218) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5219) : 0)
+  if ((! given_vertex) ? FAIL(5690) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5691) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < HALF_DIMENSION; outgoing_edge++)
 	 {
@@ -454,15 +454,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 #define HI(x) (x >> HALF_DIMENSION)
 #define LO(x) (x & ((1 << HALF_DIMENSION) - 1))
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(5220) : (connecting_edge->e_magic != CROSS_EDGE_MAGIC) ? FAIL(5221) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(5692) : (connecting_edge->e_magic != CROSS_EDGE_MAGIC) ? FAIL(5693) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(5222) : (local_vertex->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5223) : 0)
+  if ((! local_vertex) ? FAIL(5694) : (local_vertex->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5695) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(5224) : (remote_vertex->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5225) : 0)
+  if ((! remote_vertex) ? FAIL(5696) : (remote_vertex->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5697) : 0)
 	 return NULL;
-  if (((HI(local_vertex->v_value) ^ HI(remote_vertex->v_value)) != (1 << HI(connecting_edge->e_value))) ? FAIL(5226) : 0)
+  if (((HI(local_vertex->v_value) ^ HI(remote_vertex->v_value)) != (1 << HI(connecting_edge->e_value))) ? FAIL(5698) : 0)
 	 return NULL;
-  if (((LO(local_vertex->v_value) ^ LO(remote_vertex->v_value)) != (1 << LO(connecting_edge->e_value))) ? FAIL(5227) : 0)
+  if (((LO(local_vertex->v_value) ^ LO(remote_vertex->v_value)) != (1 << LO(connecting_edge->e_value))) ? FAIL(5699) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -484,15 +484,15 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(5228) : (given_vertex->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5229) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(5700) : (given_vertex->v_magic != CROSS_VERTEX_MAGIC) ? FAIL(5701) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(5230) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5231) : 0)
+  if ((! edges_in) ? FAIL(5702) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5703) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(5232) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5233) : 0)
+  if ((! edges_out) ? FAIL(5704) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5705) : 0)
 	 return NULL;
-  if ((edges_in->r_value != (HALF_DIMENSION * HALF_DIMENSION)) ? FAIL(5234) : 0)
+  if ((edges_in->r_value != (HALF_DIMENSION * HALF_DIMENSION)) ? FAIL(5706) : 0)
 	 return NULL;
-  if ((edges_out->r_value != (HALF_DIMENSION * HALF_DIMENSION)) ? FAIL(5235) : 0)
+  if ((edges_out->r_value != (HALF_DIMENSION * HALF_DIMENSION)) ? FAIL(5707) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -517,12 +517,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5236) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5708) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5237) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5709) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(5238) : (s < (r ? r->r_value : 0)) ? FAIL(5239) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(5710) : (s < (r ? r->r_value : 0)) ? FAIL(5711) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -567,16 +567,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == V) ? 0 : FAIL(5240))
+  if ((cru_vertex_count (g, LANES, err) == V) ? 0 : FAIL(5712))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == E) ? 0 : FAIL(5241))
+  if ((cru_edge_count (g, LANES, err) == E) ? 0 : FAIL(5713))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5242))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5714))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5243))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5715))
 	 return 0;
   if (! (v = (r->r_value == V)))
-	 FAIL(5244);
+	 FAIL(5716);
   free_redex (r, err);
   return v;
 }
@@ -596,9 +596,9 @@ vertex_product (left_vertex, right_vertex, err)
 {
   vertex v;
 
-  if ((! left_vertex) ? FAIL(5245) : (left_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5246) : 0)
+  if ((! left_vertex) ? FAIL(5717) : (left_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5718) : 0)
 	 return NULL;
-  if ((! right_vertex) ? FAIL(5247) : (right_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5248) : 0)
+  if ((! right_vertex) ? FAIL(5719) : (right_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5720) : 0)
 	 return NULL;
   if ((v = vertex_of ((left_vertex->v_value << HALF_DIMENSION) + right_vertex->v_value, err)))
 	 v->v_magic = CROSS_VERTEX_MAGIC;
@@ -622,9 +622,9 @@ edge_product (left_edge, right_edge, err)
 {
   edge e;
 
-  if ((! left_edge) ? FAIL(5249) : (left_edge->e_magic != EDGE_MAGIC) ? FAIL(5250) : 0)
+  if ((! left_edge) ? FAIL(5721) : (left_edge->e_magic != EDGE_MAGIC) ? FAIL(5722) : 0)
 	 return NULL;
-  if ((! right_edge) ? FAIL(5251) : (right_edge->e_magic != EDGE_MAGIC) ? FAIL(5252) : 0)
+  if ((! right_edge) ? FAIL(5723) : (right_edge->e_magic != EDGE_MAGIC) ? FAIL(5724) : 0)
 	 return NULL;
   if ((e = edge_of ((left_edge->e_value << HALF_DIMENSION) + right_edge->e_value, err)))
 	 e->e_magic = CROSS_EDGE_MAGIC;
@@ -648,14 +648,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(5253);
+	 FAIL(5725);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(5254);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5255) : 0)
+	 FAIL(5726);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5727) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5256) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5257) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5258) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5728) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5729) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5730) : *err);
 }
 
 
@@ -719,11 +719,11 @@ main (argc, argv)
   cru_free_now (h, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(5259) : vertex_count ? THE_FAIL(5260) : redex_count ? THE_FAIL(5261) : global_err);
+	 err = (edge_count ? THE_FAIL(5731) : vertex_count ? THE_FAIL(5732) : redex_count ? THE_FAIL(5733) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5262);
+	 err = THE_FAIL(5734);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5263);
+	 err = THE_FAIL(5735);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
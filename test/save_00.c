@@ -0,0 +1,197 @@
+// Create a hypercubic graph and save it twice to the same file with an
+// empty graph in between. Load all three back, the first copy with
+// several workers and the second with one, and check that both
+// copies match the original, that the empty graph is loaded as NULL,
+// and that loading past the end of the file fails. Then corrupt the
+// version number in the file and check that it's rejected.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <cru.h>
+#include "readme.h"
+
+// the offset of the version number in a saved graph
+#define VERSION_OFFSET ((off_t) 8)
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  uintptr_t given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero.
+{
+  uintptr_t axis;
+
+  for (axis = 0; axis < DIMENSION; axis++)
+	 cru_connect ((cru_edge) axis, (cru_vertex) (given_vertex ^ (uintptr_t) (1 << axis)), err);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  uintptr_t local_vertex;
+	  uintptr_t connecting_edge;
+	  uintptr_t remote_vertex;
+	  int *err;
+
+	  // Return 1 if an edge is labeled by the index of the bit in
+	  // which its endpoints differ, and 0 otherwise.
+{
+  if (*err)
+	 return 0;
+  return ! ((remote_vertex >= NUMBER_OF_VERTICES) ? FAIL(5736) : ((local_vertex ^ remote_vertex) != (1 << connecting_edge)) ? FAIL(5737) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+vertex_checker (edges_in, vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  uintptr_t vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Return 1 for a vertex with all of its edges and fail
+	  // otherwise.
+{
+  if (*err ? 1 : (vertex >= NUMBER_OF_VERTICES) ? FAIL(5738) : (edges_out != DIMENSION) ? FAIL(5739) : 0)
+	 return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers, checking for overflow and
+	  // other errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(5740) : (s < r) ? FAIL(5741) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check the vertex and edge counts of a loaded graph and traverse
+	  // it to check that every vertex and edge is there, then free it.
+{
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.outgoing = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+
+  if (! g)
+	 return 0;
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(5742))
+	 goto a;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(5743))
+	 goto a;
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(5744))
+	 goto a;
+  cru_free_now (g, LANES, err);
+  return 1;
+ a: cru_free_now (g, LANES, err);
+  return 0;
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  uintptr_t limit, size;
+  cru_graph g;
+  int err;
+  FILE *f;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule};
+
+  v = 0;
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  if ((f = tmpfile ()) ? 0 : (err = errno))
+	 goto a;
+  g = cru_built (&b, 0, UNKILLABLE, LANES, &err);
+  size = cru_saved (g, fileno (f), NULL, LANES, &err);
+  cru_saved (NULL, fileno (f), NULL, LANES, &err);
+  v = ((cru_saved (g, fileno (f), NULL, LANES, &err) == size) ? ! ! size : 0);
+  cru_free_now (g, LANES, &err);
+  if (err ? 1 : (lseek (fileno (f), (off_t) 0, SEEK_SET) < 0) ? (err = errno) : 0)
+	 goto b;
+  v = (v ? valid (cru_loaded (fileno (f), NULL, NULL, LANES, &err), &err) : 0);
+  v = (v ? (! cru_loaded (fileno (f), NULL, NULL, LANES, &err)) : 0);
+  v = (v ? valid (cru_loaded (fileno (f), NULL, NULL, 1, &err), &err) : 0);
+  v = (v ? (! cru_loaded (fileno (f), NULL, NULL, LANES, &err)) : 0);
+  if (err == CRU_BADFIL)
+	 err = 0;
+  else if (! err)
+	 v = 0;
+  if ((! v) ? 1 : (pwrite (fileno (f), &size, sizeof (size), VERSION_OFFSET) < 0) ? (err = errno) : (lseek (fileno (f), (off_t) 0, SEEK_SET) < 0) ? (err = errno) : 0)
+	 goto b;
+  v = (! cru_loaded (fileno (f), NULL, NULL, LANES, &err));
+  if (err == CRU_BADFIL)
+	 err = 0;
+  else if (! err)
+	 v = 0;
+ b: fclose (f);
+ a: if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
@@ -0,0 +1,427 @@
+// Create a hypercubic graph with vertices allocated on the heap and
+// save it with codecs for the vertices and the edge labels, padding
+// some vertex encodings to more than the size of the output buffer.
+// Load it back with matching decoders, check that it's the same as the
+// original, and check that every vertex is reclaimed when it's freed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <nthm/nthm.h>
+#include <cru.h>
+#include "readme.h"
+
+// the length of the padding in the encoding of a vertex numbered n
+#define PADDING(n) ((size_t) (((n) & 3) * 0x2000))
+
+// a count of allocated vertices to detect memory leaks
+static uintptr_t vertex_count;
+
+// needed to lock the count
+static pthread_mutex_t vertex_lock;
+
+#define VERTEX_MAGIC 1370635490
+
+
+typedef struct vertex_s
+{
+  int v_magic;              // arbitrary constant used to detect double-free errors
+  uintptr_t v_value;
+} *vertex;
+
+
+
+
+vertex
+vertex_of (n, err)
+	  uintptr_t n;
+	  int *err;
+
+	  // Create a vertex.
+{
+  vertex v;
+
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5745))
+	 return NULL;
+  memset (v, 0, sizeof (*v));
+  v->v_magic = VERTEX_MAGIC;
+  v->v_value = n;
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5746) : ++vertex_count ? 0 : FAIL(5747))
+	 goto a;
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5748) : 0))
+	 return v;
+ a: free (v);
+  return NULL;
+}
+
+
+
+
+
+void
+free_vertex (v, err)
+	  vertex v;
+	  int *err;
+
+	  // Reclaim a vertex.
+{
+  if ((! v) ? FAIL(5749) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5750) : 0)
+	 return;
+  v->v_magic = MUGGLE(221);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5751) : vertex_count-- ? 0 : FAIL(5752))
+	 return;
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5753) : 0)
+	 return;
+  free (v);
+}
+
+
+
+
+
+
+int
+equal_vertices (a, b, err)
+	  vertex a;
+	  vertex b;
+	  int *err;
+
+	  // Compare two vertices and return non-zero if they are equal.
+{
+  if ((! a) ? FAIL(5754) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5755) : 0)
+	 return 0;
+  if ((! b) ? FAIL(5756) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5757) : 0)
+	 return 0;
+  return a->v_value == b->v_value;
+}
+
+
+
+
+
+uintptr_t
+vertex_hash (v, err)
+	  vertex v;
+	  int *err;
+
+	  // Mix up low-entropy numeric values.
+{
+  size_t i;
+  uintptr_t u;
+
+  if ((! v) ? FAIL(5758) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5759) : 0)
+	 return 0;
+  u = v->v_value;
+  for (i = 0; i < sizeof (u); i++)  // ignore overflow
+	 u += (u + 1) << 8;
+  return (u << HALF_POINTER_WIDTH) | (u >> HALF_POINTER_WIDTH);
+}
+
+
+
+
+
+
+int
+initialized (count, lock, lock_created, err)
+	  uintptr_t *count;
+	  pthread_mutex_t *lock;
+	  int *lock_created;
+	  int *err;
+{
+  pthread_mutexattr_t mutex_attribute;
+
+  if (count ? (*count = 0) : 1)
+	 FAIL(5760);
+  if (lock_created ? (*lock_created = 0) : 1)
+	 FAIL(5761);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5762) : 0)
+	 return 0;
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5763) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5764) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5765) : *err);
+}
+
+
+
+
+
+
+
+
+size_t
+vertex_encoder (given_vertex, buffer, size, err)
+	  vertex given_vertex;
+	  unsigned char *buffer;
+	  size_t size;
+	  int *err;
+
+	  // Write the number of a vertex followed by padding bytes derived
+	  // from it if they fit in the buffer, and return their length
+	  // either way.
+{
+  size_t n;
+
+  if ((! given_vertex) ? FAIL(5766) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5767) : 0)
+	 return 0;
+  if ((n = sizeof (given_vertex->v_value) + PADDING(given_vertex->v_value)) > size)
+	 return n;
+  memcpy (buffer, &(given_vertex->v_value), sizeof (given_vertex->v_value));
+  memset (buffer + sizeof (given_vertex->v_value), (int) (given_vertex->v_value & 0xff), PADDING(given_vertex->v_value));
+  return n;
+}
+
+
+
+
+
+
+vertex
+vertex_decoder (buffer, size, err)
+	  const unsigned char *buffer;
+	  size_t size;
+	  int *err;
+
+	  // Create a vertex from its encoding after checking the padding.
+{
+  uintptr_t n;
+  size_t i;
+
+  if ((size < sizeof (n)) ? FAIL(5768) : 0)
+	 return NULL;
+  memcpy (&n, buffer, sizeof (n));
+  if ((size != sizeof (n) + PADDING(n)) ? FAIL(5769) : 0)
+	 return NULL;
+  for (i = sizeof (n); i < size; i++)
+	 if ((buffer[i] != (n & 0xff)) ? FAIL(5770) : 0)
+		return NULL;
+  return vertex_of (n, err);
+}
+
+
+
+
+
+
+size_t
+label_encoder (label, buffer, size, err)
+	  uintptr_t label;
+	  unsigned char *buffer;
+	  size_t size;
+	  int *err;
+
+	  // Write an edge label as a single byte.
+{
+  if (size)
+	 *buffer = (unsigned char) label;
+  return 1;
+}
+
+
+
+
+
+
+uintptr_t
+label_decoder (buffer, size, err)
+	  const unsigned char *buffer;
+	  size_t size;
+	  int *err;
+
+	  // Read an edge label written as a single byte.
+{
+  return ((size != 1) ? FAIL(5771) : 0) ? 0 : (uintptr_t) *buffer;
+}
+
+
+
+
+
+
+void
+building_rule (given_vertex, err)
+	  vertex given_vertex;
+	  int *err;
+
+	  // Declare one outgoing edge from the given vertex along each
+	  // dimensional axis to a vertex whose binary encoding differs
+	  // from that of the given vertex in exactly one bit. Number the
+	  // edges consecutively from zero.
+{
+  uintptr_t outgoing_edge;
+
+  if ((! given_vertex) ? FAIL(5772) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5773) : 0)
+	 return;
+  for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
+	 cru_connect ((cru_edge) outgoing_edge, vertex_of (given_vertex->v_value ^ (uintptr_t) (1 << outgoing_edge), err), err);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+edge_checker (local_vertex, connecting_edge, remote_vertex, err)
+	  vertex local_vertex;
+	  uintptr_t connecting_edge;
+	  vertex remote_vertex;
+	  int *err;
+
+	  // Return 1 if an edge is labeled by the index of the bit in
+	  // which its endpoints differ, and 0 otherwise.
+{
+  if (*err ? 1 : (! local_vertex) ? FAIL(5774) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5775) : 0)
+	 return 0;
+  if ((! remote_vertex) ? FAIL(5776) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5777) : 0)
+	 return 0;
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (uintptr_t) (1 << connecting_edge)) ? FAIL(5778) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+vertex_checker (edges_in, given_vertex, edges_out, err)
+	  uintptr_t edges_in;
+	  vertex given_vertex;
+	  uintptr_t edges_out;
+	  int *err;
+
+	  // Return 1 for a vertex with all of its edges and fail
+	  // otherwise.
+{
+  if (*err ? 1 : (! given_vertex) ? FAIL(5779) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5780) : 0)
+	 return 0;
+  return ! ((given_vertex->v_value >= NUMBER_OF_VERTICES) ? FAIL(5781) : (edges_out != DIMENSION) ? FAIL(5782) : 0);
+}
+
+
+
+
+
+
+
+
+uintptr_t
+sum (l, r, err)
+	  uintptr_t l;
+	  uintptr_t r;
+	  int *err;
+
+	  // Compute the sum of two numbers checking for overflow and other
+	  // errors.
+{
+  uintptr_t s;
+
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(5783) : (s < r) ? FAIL(5784) : 0) ? 0 : s);
+}
+
+
+
+
+
+
+
+
+int
+valid (g, err)
+	  cru_graph g;
+	  int *err;
+
+	  // Check for correct vertex counts, edge counts, and edge labels.
+{
+  struct cru_mapreducer_s m = {
+	 .ma_prop = {
+		.vertex = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) vertex_checker},
+		.outgoing = {
+		  .reduction = (cru_bop) sum,
+		  .map = (cru_top) edge_checker}}};
+
+  if ((! g) ? FAIL(5785) : 0)
+	 return 0;
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(5786))
+	 return 0;
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(5787))
+	 return 0;
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(5788))
+	 return 0;
+  return 1;
+}
+
+
+
+
+
+
+
+
+int
+main (argc, argv)
+	  int argc;
+	  char **argv;
+{
+  int vertex_lock_created;
+  uintptr_t limit;
+  cru_graph g;
+  int err;
+  FILE *f;
+  int v;
+
+  struct cru_builder_s b = {
+	 .connector = (cru_connector) building_rule,
+	 .bu_sig = {
+		.orders = {
+		  .v_order = {
+			 .hash = (cru_hash) vertex_hash,
+			 .equal = (cru_bpred) equal_vertices}},
+		.destructors = {
+		  .v_free = (cru_destructor) free_vertex}}};
+
+  struct cru_codec_pair_s c = {
+	 .v_codec = {
+		.encoder = (cru_encoder) vertex_encoder,
+		.decoder = (cru_decoder) vertex_decoder},
+	 .e_codec = {
+		.encoder = (cru_encoder) label_encoder,
+		.decoder = (cru_decoder) label_decoder}};
+
+  v = 0;
+  err = 0;
+  if ((argc > 1) ? (limit = strtoull (argv[1], NULL, 0)) : 0)
+	 crudev_limit_allocations (limit, &err);
+  if (! initialized (&vertex_count, &vertex_lock, &vertex_lock_created, &err))
+	 goto a;
+  if ((f = tmpfile ()) ? 0 : (err = errno))
+	 goto a;
+  g = cru_built (&b, vertex_of (0, &err), UNKILLABLE, LANES, &err);
+  v = ! ! cru_saved (g, fileno (f), &c, LANES, &err);
+  cru_free_now (g, LANES, &err);
+  if (err ? 1 : (lseek (fileno (f), (off_t) 0, SEEK_SET) < 0) ? (err = errno) : 0)
+	 goto b;
+  g = cru_loaded (fileno (f), &(b.bu_sig), &c, LANES, &err);
+  v = (v ? valid (g, &err) : 0);
+  cru_free_now (g, LANES, &err);
+ b: fclose (f);
+  nthm_sync (&err);
+  err = (vertex_count ? THE_FAIL(5789) : err);
+ a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
+	 err = THE_FAIL(5790);
+  if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
+	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
+  else if ((argc > 1) ? (! limit) : 0)
+	 printf ("%lu", crudev_allocations_performed (&err));
+  else
+	 printf ("%s detected no errors\n", argv[0]);
+  EXIT;
+}
@@ -51,7 +51,7 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  return ! (*err ? 1 : ((local_vertex ^ remote_vertex) != (1 << connecting_edge)) ? FAIL(5264) : 0);
+  return ! (*err ? 1 : ((local_vertex ^ remote_vertex) != (1 << connecting_edge)) ? FAIL(5791) : 0);
 }
 
 
@@ -71,7 +71,7 @@ vertex_checker (edges_in, vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  return ! (*err ? 1 : (edges_in != (DIMENSION << 1)) ? FAIL(5265) : (edges_out != (DIMENSION << 1)) ? FAIL(5266) : 0);
+  return ! (*err ? 1 : (edges_in != (DIMENSION << 1)) ? FAIL(5792) : (edges_out != (DIMENSION << 1)) ? FAIL(5793) : 0);
 }
 
 
@@ -90,7 +90,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(5267) : (s < r) ? FAIL(5268) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(5794) : (s < r) ? FAIL(5795) : 0) ? 0 : s);
 }
 
 
@@ -117,11 +117,11 @@ valid (g, err)
 		  .reduction = (cru_bop) sum,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES << 1)) ? 0 : FAIL(5269))
+  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES << 1)) ? 0 : FAIL(5796))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) (DIMENSION << 1)) * (NUMBER_OF_VERTICES << 1))) ? 0 : FAIL(5270))
+  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) (DIMENSION << 1)) * (NUMBER_OF_VERTICES << 1))) ? 0 : FAIL(5797))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == (NUMBER_OF_VERTICES << 1)) ? 0 : FAIL(5271))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == (NUMBER_OF_VERTICES << 1)) ? 0 : FAIL(5798))
 	 return 0;
   return 1;
 }
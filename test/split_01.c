@@ -67,14 +67,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5272))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5799))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(5273) : ++redex_count ? 0 : FAIL(5274))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5800) : ++redex_count ? 0 : FAIL(5801))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5275) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5802) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -93,12 +93,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(5276) : (r->r_magic != REDEX_MAGIC) ? FAIL(5277) : 0)
+  if ((! r) ? FAIL(5803) : (r->r_magic != REDEX_MAGIC) ? FAIL(5804) : 0)
 	 return;
-  r->r_magic = MUGGLE(213);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(5278) : redex_count-- ? 0 : FAIL(5279))
+  r->r_magic = MUGGLE(222);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5805) : redex_count-- ? 0 : FAIL(5806))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5280) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5807) : 0)
 	 return;
   free (r);
 }
@@ -117,7 +117,7 @@ free_mapex (r, err)
 
 	  // Reclaim a mapex.
 {
-  if ((! r) ? FAIL(5281) : (r->r_magic != MAPEX_MAGIC) ? FAIL(5282) : 0)
+  if ((! r) ? FAIL(5808) : (r->r_magic != MAPEX_MAGIC) ? FAIL(5809) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -140,14 +140,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5283))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5810))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5284) : ++edge_count ? 0 : FAIL(5285))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5811) : ++edge_count ? 0 : FAIL(5812))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5286) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5813) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -168,12 +168,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(5287) : (e->e_magic != EDGE_MAGIC) ? FAIL(5288) : 0)
+  if ((! e) ? FAIL(5814) : (e->e_magic != EDGE_MAGIC) ? FAIL(5815) : 0)
 	 return;
-  e->e_magic = MUGGLE(214);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5289) : edge_count-- ? 0 : FAIL(5290))
+  e->e_magic = MUGGLE(223);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5816) : edge_count-- ? 0 : FAIL(5817))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5291) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5818) : 0)
 	 return;
   free (e);
 }
@@ -195,7 +195,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(5292) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5293) : 0)
+  if ((! e) ? GLOBAL_FAIL(5819) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5820) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -220,9 +220,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for merging.
 {
-  if ((! a) ? FAIL(5294) : (a->e_magic != EDGE_MAGIC) ? FAIL(5295) : 0)
+  if ((! a) ? FAIL(5821) : (a->e_magic != EDGE_MAGIC) ? FAIL(5822) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5296) : (b->e_magic != EDGE_MAGIC) ? FAIL(5297) : 0)
+  if ((! b) ? FAIL(5823) : (b->e_magic != EDGE_MAGIC) ? FAIL(5824) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -243,14 +243,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5298))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5825))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5299) : ++vertex_count ? 0 : FAIL(5300))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5826) : ++vertex_count ? 0 : FAIL(5827))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5301) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5828) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -272,12 +272,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(5302) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5303) : 0)
+  if ((! v) ? FAIL(5829) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5830) : 0)
 	 return;
-  v->v_magic = MUGGLE(215);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5304) : vertex_count-- ? 0 : FAIL(5305))
+  v->v_magic = MUGGLE(224);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5831) : vertex_count-- ? 0 : FAIL(5832))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5306) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5833) : 0)
 	 return;
   free (v);
 }
@@ -296,12 +296,12 @@ free_fused_vertex (v, err)
 
 	  // Reclaim a vertex resulting from a fusion operation.
 {
-  if ((! v) ? FAIL(5307) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5308) : 0)
+  if ((! v) ? FAIL(5834) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5835) : 0)
 	 return;
-  v->v_magic = MUGGLE(216);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5309) : vertex_count-- ? 0 : FAIL(5310))
+  v->v_magic = MUGGLE(225);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5836) : vertex_count-- ? 0 : FAIL(5837))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5311) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5838) : 0)
 	 return;
   free (v);
 }
@@ -322,9 +322,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(5312) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5313) : 0)
+  if ((! a) ? FAIL(5839) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5840) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5314) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5315) : 0)
+  if ((! b) ? FAIL(5841) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5842) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -348,7 +348,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(5316) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5317) : 0)
+  if ((! v) ? GLOBAL_FAIL(5843) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5844) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -379,7 +379,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(5318) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5319) : 0)
+  if ((! given_vertex) ? FAIL(5845) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5846) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -407,13 +407,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(5320) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5321) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(5847) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5848) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(5322) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5323) : 0)
+  if ((! local_vertex) ? FAIL(5849) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5850) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(5324) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5325) : 0)
+  if ((! remote_vertex) ? FAIL(5851) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5852) : 0)
 	 return NULL;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5326) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5853) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -438,13 +438,13 @@ serial_edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(5327) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5328) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(5854) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5855) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(5329) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5330) : 0)
+  if ((! local_vertex) ? FAIL(5856) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5857) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(5331) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5332) : 0)
+  if ((! remote_vertex) ? FAIL(5858) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5859) : 0)
 	 return NULL;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5333) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5860) : 0)
 	 return NULL;
   if ((r = redex_of (1, err)))
 	 r->r_magic = MAPEX_MAGIC;
@@ -468,15 +468,15 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(5334) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5335) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(5861) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5862) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(5336) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5337) : 0)
+  if ((! edges_in) ? FAIL(5863) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5864) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(5338) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5339) : 0)
+  if ((! edges_out) ? FAIL(5865) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5866) : 0)
 	 return NULL;
-  if ((edges_in->r_value != (uintptr_t) (DIMENSION << 1)) ? FAIL(5340) : 0)
+  if ((edges_in->r_value != (uintptr_t) (DIMENSION << 1)) ? FAIL(5867) : 0)
 	 return NULL;
-  if ((edges_out->r_value != (uintptr_t) (DIMENSION << 1)) ? FAIL(5341) : 0)
+  if ((edges_out->r_value != (uintptr_t) (DIMENSION << 1)) ? FAIL(5868) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -501,12 +501,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5342) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5869) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5343) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5870) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(5344) : (s < (r ? r->r_value : 0)) ? FAIL(5345) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(5871) : (s < (r ? r->r_value : 0)) ? FAIL(5872) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -531,12 +531,12 @@ serial_sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != MAPEX_MAGIC) ? FAIL(5346) : 0)
+  if ((! l) ? 0 : (l->r_magic != MAPEX_MAGIC) ? FAIL(5873) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5347) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5874) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(5348) : (s < (r ? r->r_value : 0)) ? FAIL(5349) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(5875) : (s < (r ? r->r_value : 0)) ? FAIL(5876) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -594,16 +594,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if (*err ? 1 : (cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES << 1)) ? 0 : FAIL(5350))
+  if (*err ? 1 : (cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES << 1)) ? 0 : FAIL(5877))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) (DIMENSION << 1)) * (NUMBER_OF_VERTICES << 1))) ? 0 : FAIL(5351))
+  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) (DIMENSION << 1)) * (NUMBER_OF_VERTICES << 1))) ? 0 : FAIL(5878))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5352))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5879))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5353))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5880))
 	 return 0;
   if (!(v = (r->r_value == (NUMBER_OF_VERTICES << 1))))
-	 FAIL(5354);
+	 FAIL(5881);
   free_redex (r, err);
   return v;
 }
@@ -624,15 +624,15 @@ r_copy (edges_in, v, edges_out, err)
 	  // splitter s creates a vertex property consisting of a single redex
 	  // numbered the same as the given vertex.
 {
-  if ((! edges_in) ? FAIL(5355) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5356) : 0)
+  if ((! edges_in) ? FAIL(5882) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5883) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(5357) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5358) : 0)
+  if ((! edges_out) ? FAIL(5884) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5885) : 0)
 	 return NULL;
-  if ((! (edges_in->r_value)) ? 0 : (edges_in->r_value != DIMENSION) ? FAIL(5359) : 0)
+  if ((! (edges_in->r_value)) ? 0 : (edges_in->r_value != DIMENSION) ? FAIL(5886) : 0)
 	 return NULL;
-  if ((edges_out->r_value != DIMENSION) ? FAIL(5360) : 0)
+  if ((edges_out->r_value != DIMENSION) ? FAIL(5887) : 0)
 	 return NULL;
-  if ((! v) ? FAIL(5361) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5362) : 0)
+  if ((! v) ? FAIL(5888) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5889) : 0)
 	 return NULL;
   return redex_of (v->v_value, err);
 }
@@ -651,9 +651,9 @@ u_copy (v, r, err)
 	  // This function is used as the ana function in a splitter to
 	  // create a vertex numbered the same as the given redex.
 {
-  if ((! v) ? FAIL(5363) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5364) : 0)
+  if ((! v) ? FAIL(5890) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5891) : 0)
 	 return NULL;
-  if ((! r) ? FAIL(5365) : (r->r_magic != REDEX_MAGIC) ? FAIL(5366) : 0)
+  if ((! r) ? FAIL(5892) : (r->r_magic != REDEX_MAGIC) ? FAIL(5893) : 0)
 	 return NULL;
   return vertex_of (r->r_value, err);
 }
@@ -674,9 +674,9 @@ v_copy (v, r, err)
 	  // This function is used as the cata function in a splitter to
 	  // create a vertex numbered the same as the given redex.
 {
-  if ((! v) ? FAIL(5367) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5368) : 0)
+  if ((! v) ? FAIL(5894) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5895) : 0)
 	 return NULL;
-  if ((! r) ? FAIL(5369) : (r->r_magic != REDEX_MAGIC) ? FAIL(5370) : 0)
+  if ((! r) ? FAIL(5896) : (r->r_magic != REDEX_MAGIC) ? FAIL(5897) : 0)
 	 return NULL;
   return vertex_of (r->r_value, err);
 }
@@ -701,11 +701,11 @@ e_copy (source, label, target, err)
 	  // source and target redexes. It's used as the mark function on
 	  // both ctops of both ctopses in a splitter.
 {
-  if ((! source) ? FAIL(5371) : (source->r_magic != REDEX_MAGIC) ? FAIL(5372) : 0)
+  if ((! source) ? FAIL(5898) : (source->r_magic != REDEX_MAGIC) ? FAIL(5899) : 0)
 	 return NULL;
-  if ((! target) ? FAIL(5373) : (target->r_magic != REDEX_MAGIC) ? FAIL(5374) : 0)
+  if ((! target) ? FAIL(5900) : (target->r_magic != REDEX_MAGIC) ? FAIL(5901) : 0)
 	 return NULL;
-  if ((! label) ? FAIL(5375) : (label->e_magic != EDGE_MAGIC) ? FAIL(5376) : 0)
+  if ((! label) ? FAIL(5902) : (label->e_magic != EDGE_MAGIC) ? FAIL(5903) : 0)
 	 return NULL;
   return edge_of (label->e_value, err);
 }
@@ -726,14 +726,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(5377);
+	 FAIL(5904);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(5378);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5379) : 0)
+	 FAIL(5905);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5906) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5380) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5381) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5382) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5907) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5908) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5909) : *err);
 }
 
 
@@ -815,11 +815,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(5383) : vertex_count ? THE_FAIL(5384) : redex_count ? THE_FAIL(5385) : global_err);
+	 err = (edge_count ? THE_FAIL(5910) : vertex_count ? THE_FAIL(5911) : redex_count ? THE_FAIL(5912) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5386);
+	 err = THE_FAIL(5913);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5387);
+	 err = THE_FAIL(5914);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
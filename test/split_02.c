@@ -69,14 +69,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5388))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5915))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(5389) : ++redex_count ? 0 : FAIL(5390))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5916) : ++redex_count ? 0 : FAIL(5917))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5391) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5918) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -95,12 +95,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(5392) : (r->r_magic != REDEX_MAGIC) ? FAIL(5393) : 0)
+  if ((! r) ? FAIL(5919) : (r->r_magic != REDEX_MAGIC) ? FAIL(5920) : 0)
 	 return;
-  r->r_magic = MUGGLE(217);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(5394) : redex_count-- ? 0 : FAIL(5395))
+  r->r_magic = MUGGLE(226);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(5921) : redex_count-- ? 0 : FAIL(5922))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5396) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5923) : 0)
 	 return;
   free (r);
 }
@@ -120,7 +120,7 @@ free_mapex (r, err)
 
 	  // Reclaim a mapex.
 {
-  if ((! r) ? FAIL(5397) : (r->r_magic != MAPEX_MAGIC) ? FAIL(5398) : 0)
+  if ((! r) ? FAIL(5924) : (r->r_magic != MAPEX_MAGIC) ? FAIL(5925) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -144,14 +144,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5399))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5926))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5400) : ++edge_count ? 0 : FAIL(5401))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5927) : ++edge_count ? 0 : FAIL(5928))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5402) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5929) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -172,12 +172,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(5403) : (e->e_magic != EDGE_MAGIC) ? FAIL(5404) : 0)
+  if ((! e) ? FAIL(5930) : (e->e_magic != EDGE_MAGIC) ? FAIL(5931) : 0)
 	 return;
-  e->e_magic = MUGGLE(218);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5405) : edge_count-- ? 0 : FAIL(5406))
+  e->e_magic = MUGGLE(227);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(5932) : edge_count-- ? 0 : FAIL(5933))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5407) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5934) : 0)
 	 return;
   free (e);
 }
@@ -199,7 +199,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(5408) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5409) : 0)
+  if ((! e) ? GLOBAL_FAIL(5935) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5936) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -224,9 +224,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for merging.
 {
-  if ((! a) ? FAIL(5410) : (a->e_magic != EDGE_MAGIC) ? FAIL(5411) : 0)
+  if ((! a) ? FAIL(5937) : (a->e_magic != EDGE_MAGIC) ? FAIL(5938) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5412) : (b->e_magic != EDGE_MAGIC) ? FAIL(5413) : 0)
+  if ((! b) ? FAIL(5939) : (b->e_magic != EDGE_MAGIC) ? FAIL(5940) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -247,14 +247,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5414))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5941))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5415) : ++vertex_count ? 0 : FAIL(5416))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5942) : ++vertex_count ? 0 : FAIL(5943))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5417) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5944) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -276,12 +276,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(5418) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5419) : 0)
+  if ((! v) ? FAIL(5945) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5946) : 0)
 	 return;
-  v->v_magic = MUGGLE(219);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5420) : vertex_count-- ? 0 : FAIL(5421))
+  v->v_magic = MUGGLE(228);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5947) : vertex_count-- ? 0 : FAIL(5948))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5422) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5949) : 0)
 	 return;
   free (v);
 }
@@ -300,12 +300,12 @@ free_fused_vertex (v, err)
 
 	  // Reclaim a vertex resulting from a fusion operation.
 {
-  if ((! v) ? FAIL(5423) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5424) : 0)
+  if ((! v) ? FAIL(5950) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5951) : 0)
 	 return;
-  v->v_magic = MUGGLE(220);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5425) : vertex_count-- ? 0 : FAIL(5426))
+  v->v_magic = MUGGLE(229);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5952) : vertex_count-- ? 0 : FAIL(5953))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5427) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5954) : 0)
 	 return;
   free (v);
 }
@@ -326,9 +326,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(5428) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5429) : 0)
+  if ((! a) ? FAIL(5955) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5956) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5430) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5431) : 0)
+  if ((! b) ? FAIL(5957) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5958) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -352,7 +352,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(5432) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5433) : 0)
+  if ((! v) ? GLOBAL_FAIL(5959) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5960) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -383,7 +383,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(5434) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5435) : 0)
+  if ((! given_vertex) ? FAIL(5961) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5962) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -411,13 +411,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(5436) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5437) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(5963) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5964) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(5438) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5439) : 0)
+  if ((! local_vertex) ? FAIL(5965) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5966) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(5440) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5441) : 0)
+  if ((! remote_vertex) ? FAIL(5967) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5968) : 0)
 	 return NULL;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5442) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5969) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -442,13 +442,13 @@ serial_edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(5443) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5444) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(5970) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5971) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(5445) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5446) : 0)
+  if ((! local_vertex) ? FAIL(5972) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5973) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(5447) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5448) : 0)
+  if ((! remote_vertex) ? FAIL(5974) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5975) : 0)
 	 return NULL;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5449) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5976) : 0)
 	 return NULL;
   if ((r = redex_of (1, err)))
 	 r->r_magic = MAPEX_MAGIC;
@@ -472,24 +472,24 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(5450) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5451) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(5977) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5978) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(5452) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5453) : 0)
+  if ((! edges_in) ? FAIL(5979) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5980) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(5454) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5455) : 0)
+  if ((! edges_out) ? FAIL(5981) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5982) : 0)
 	 return NULL;
   if ((given_vertex->v_value & 1))
 	 {
-		if ((edges_out->r_value != ((DIMENSION << 1) - 1)) ? FAIL(5456) : 0)
+		if ((edges_out->r_value != ((DIMENSION << 1) - 1)) ? FAIL(5983) : 0)
 		  return NULL;
-		if ((edges_in->r_value != ((DIMENSION << 1) - 1)) ? FAIL(5457) : 0)
+		if ((edges_in->r_value != ((DIMENSION << 1) - 1)) ? FAIL(5984) : 0)
 		  return NULL;
 	 }
   else
 	 {
-		if ((edges_out->r_value != (DIMENSION + 1)) ? FAIL(5458) : 0)
+		if ((edges_out->r_value != (DIMENSION + 1)) ? FAIL(5985) : 0)
 		  return NULL;
-		if ((edges_in->r_value != (DIMENSION + 1)) ? FAIL(5459) : 0)
+		if ((edges_in->r_value != (DIMENSION + 1)) ? FAIL(5986) : 0)
 		  return NULL;
 	 }
   return redex_of (1, err);
@@ -515,12 +515,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5460) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5987) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5461) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5988) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(5462) : (s < (r ? r->r_value : 0)) ? FAIL(5463) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(5989) : (s < (r ? r->r_value : 0)) ? FAIL(5990) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -543,12 +543,12 @@ serial_sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != MAPEX_MAGIC) ? FAIL(5464) : 0)
+  if ((! l) ? 0 : (l->r_magic != MAPEX_MAGIC) ? FAIL(5991) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5465) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5992) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(5466) : (s < (r ? r->r_value : 0)) ? FAIL(5467) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(5993) : (s < (r ? r->r_value : 0)) ? FAIL(5994) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -611,16 +611,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if (*err ? 1 : (cru_vertex_count (g, LANES, err) == V) ? 0 : FAIL(5468))
+  if (*err ? 1 : (cru_vertex_count (g, LANES, err) == V) ? 0 : FAIL(5995))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == E) ? 0 : FAIL(5469))
+  if ((cru_edge_count (g, LANES, err) == E) ? 0 : FAIL(5996))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5470))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5997))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5471))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5998))
 	 return 0;
   if (!(v = (r->r_value == V)))
-	 FAIL(5472);
+	 FAIL(5999);
   free_redex (r, err);
   return v;
 }
@@ -641,15 +641,15 @@ r_copy (edges_in, v, edges_out, err)
 	  // splitter s creates a vertex property consisting of a single redex
 	  // numbered the same as the given vertex.
 {
-  if ((! edges_in) ? FAIL(5473) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5474) : 0)
+  if ((! edges_in) ? FAIL(6000) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(6001) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(5475) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5476) : 0)
+  if ((! edges_out) ? FAIL(6002) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(6003) : 0)
 	 return NULL;
-  if ((! (edges_in->r_value)) ? 0 : (edges_in->r_value != DIMENSION) ? FAIL(5477) : 0)
+  if ((! (edges_in->r_value)) ? 0 : (edges_in->r_value != DIMENSION) ? FAIL(6004) : 0)
 	 return NULL;
-  if ((edges_out->r_value != DIMENSION) ? FAIL(5478) : 0)
+  if ((edges_out->r_value != DIMENSION) ? FAIL(6005) : 0)
 	 return NULL;
-  if ((! v) ? FAIL(5479) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5480) : 0)
+  if ((! v) ? FAIL(6006) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6007) : 0)
 	 return NULL;
   return redex_of (v->v_value, err);
 }
@@ -670,9 +670,9 @@ v_copy (v, r, err)
 	  // splitter to create a vertex numbered the same as the given
 	  // redex.
 {
-  if ((! v) ? FAIL(5481) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5482) : 0)
+  if ((! v) ? FAIL(6008) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6009) : 0)
 	 return NULL;
-  if ((! r) ? FAIL(5483) : (r->r_magic != REDEX_MAGIC) ? FAIL(5484) : 0)
+  if ((! r) ? FAIL(6010) : (r->r_magic != REDEX_MAGIC) ? FAIL(6011) : 0)
 	 return NULL;
   return vertex_of (r->r_value, err);
 }
@@ -698,11 +698,11 @@ e_copy (source, label, target, err)
 	  // source and target redexes. It's used as the mark function on
 	  // both ctops of both ctopses in a splitter.
 {
-  if ((! source) ? FAIL(5485) : (source->r_magic != REDEX_MAGIC) ? FAIL(5486) : 0)
+  if ((! source) ? FAIL(6012) : (source->r_magic != REDEX_MAGIC) ? FAIL(6013) : 0)
 	 return NULL;
-  if ((! target) ? FAIL(5487) : (target->r_magic != REDEX_MAGIC) ? FAIL(5488) : 0)
+  if ((! target) ? FAIL(6014) : (target->r_magic != REDEX_MAGIC) ? FAIL(6015) : 0)
 	 return NULL;
-  if ((! label) ? FAIL(5489) : (label->e_magic != EDGE_MAGIC) ? FAIL(5490) : 0)
+  if ((! label) ? FAIL(6016) : (label->e_magic != EDGE_MAGIC) ? FAIL(6017) : 0)
 	 return NULL;
   return edge_of (label->e_value, err);
 }
@@ -724,9 +724,9 @@ splittable (v, r, err)
 	  // a splitter calls for only the odd propertied vertices to be
 	  // split.
 {
-  if ((! v) ? FAIL(5491) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5492) : 0)
+  if ((! v) ? FAIL(6018) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6019) : 0)
 	 return 0;
-  if ((! r) ? FAIL(5493) : (r->r_magic != REDEX_MAGIC) ? FAIL(5494) : 0)
+  if ((! r) ? FAIL(6020) : (r->r_magic != REDEX_MAGIC) ? FAIL(6021) : 0)
 	 return 0;
   return (r->r_value & 1);
 }
@@ -747,14 +747,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(5495);
+	 FAIL(6022);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(5496);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5497) : 0)
+	 FAIL(6023);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(6024) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5498) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5499) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5500) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(6025) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(6026) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(6027) : *err);
 }
 
 
@@ -837,11 +837,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(5501) : vertex_count ? THE_FAIL(5502) : redex_count ? THE_FAIL(5503) : global_err);
+	 err = (edge_count ? THE_FAIL(6028) : vertex_count ? THE_FAIL(6029) : redex_count ? THE_FAIL(6030) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5504);
+	 err = THE_FAIL(6031);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5505);
+	 err = THE_FAIL(6032);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
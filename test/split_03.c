@@ -68,14 +68,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5506))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(6033))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(5507) : ++redex_count ? 0 : FAIL(5508))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(6034) : ++redex_count ? 0 : FAIL(6035))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5509) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(6036) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -94,12 +94,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(5510) : (r->r_magic != REDEX_MAGIC) ? FAIL(5511) : 0)
+  if ((! r) ? FAIL(6037) : (r->r_magic != REDEX_MAGIC) ? FAIL(6038) : 0)
 	 return;
-  r->r_magic = MUGGLE(221);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(5512) : redex_count-- ? 0 : FAIL(5513))
+  r->r_magic = MUGGLE(230);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(6039) : redex_count-- ? 0 : FAIL(6040))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5514) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(6041) : 0)
 	 return;
   free (r);
 }
@@ -120,7 +120,7 @@ free_mapex (r, err)
 
 	  // Reclaim a mapex.
 {
-  if ((! r) ? FAIL(5515) : (r->r_magic != MAPEX_MAGIC) ? FAIL(5516) : 0)
+  if ((! r) ? FAIL(6042) : (r->r_magic != MAPEX_MAGIC) ? FAIL(6043) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -144,14 +144,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5517))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(6044))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5518) : ++edge_count ? 0 : FAIL(5519))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(6045) : ++edge_count ? 0 : FAIL(6046))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5520) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(6047) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -172,12 +172,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(5521) : (e->e_magic != EDGE_MAGIC) ? FAIL(5522) : 0)
+  if ((! e) ? FAIL(6048) : (e->e_magic != EDGE_MAGIC) ? FAIL(6049) : 0)
 	 return;
-  e->e_magic = MUGGLE(222);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5523) : edge_count-- ? 0 : FAIL(5524))
+  e->e_magic = MUGGLE(231);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(6050) : edge_count-- ? 0 : FAIL(6051))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5525) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(6052) : 0)
 	 return;
   free (e);
 }
@@ -199,7 +199,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(5526) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5527) : 0)
+  if ((! e) ? GLOBAL_FAIL(6053) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(6054) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -224,9 +224,9 @@ equal_edges (a, b, err)
 	  // cru library as b.bu_sig.orders.e_order.equal in the builder b,
 	  // but is needed only for merging.
 {
-  if ((! a) ? FAIL(5528) : (a->e_magic != EDGE_MAGIC) ? FAIL(5529) : 0)
+  if ((! a) ? FAIL(6055) : (a->e_magic != EDGE_MAGIC) ? FAIL(6056) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5530) : (b->e_magic != EDGE_MAGIC) ? FAIL(5531) : 0)
+  if ((! b) ? FAIL(6057) : (b->e_magic != EDGE_MAGIC) ? FAIL(6058) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -247,14 +247,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5532))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(6059))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5533) : ++vertex_count ? 0 : FAIL(5534))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6060) : ++vertex_count ? 0 : FAIL(6061))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5535) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(6062) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -276,12 +276,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(5536) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5537) : 0)
+  if ((! v) ? FAIL(6063) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6064) : 0)
 	 return;
-  v->v_magic = MUGGLE(223);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5538) : vertex_count-- ? 0 : FAIL(5539))
+  v->v_magic = MUGGLE(232);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6065) : vertex_count-- ? 0 : FAIL(6066))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5540) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(6067) : 0)
 	 return;
   free (v);
 }
@@ -300,12 +300,12 @@ free_fused_vertex (v, err)
 
 	  // Reclaim a vertex resulting from a fusion operation.
 {
-  if ((! v) ? FAIL(5541) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5542) : 0)
+  if ((! v) ? FAIL(6068) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6069) : 0)
 	 return;
-  v->v_magic = MUGGLE(224);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5543) : vertex_count-- ? 0 : FAIL(5544))
+  v->v_magic = MUGGLE(233);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6070) : vertex_count-- ? 0 : FAIL(6071))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5545) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(6072) : 0)
 	 return;
   free (v);
 }
@@ -326,9 +326,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(5546) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5547) : 0)
+  if ((! a) ? FAIL(6073) : (a->v_magic != VERTEX_MAGIC) ? FAIL(6074) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5548) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5549) : 0)
+  if ((! b) ? FAIL(6075) : (b->v_magic != VERTEX_MAGIC) ? FAIL(6076) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -352,7 +352,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(5550) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(5551) : 0)
+  if ((! v) ? GLOBAL_FAIL(6077) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(6078) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -383,7 +383,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(5552) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5553) : 0)
+  if ((! given_vertex) ? FAIL(6079) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6080) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -411,13 +411,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(5554) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5555) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(6081) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(6082) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(5556) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5557) : 0)
+  if ((! local_vertex) ? FAIL(6083) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6084) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(5558) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5559) : 0)
+  if ((! remote_vertex) ? FAIL(6085) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6086) : 0)
 	 return NULL;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5560) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(6087) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -439,13 +439,13 @@ serial_edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   redex r;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(5561) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5562) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(6088) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(6089) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(5563) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5564) : 0)
+  if ((! local_vertex) ? FAIL(6090) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6091) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(5565) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5566) : 0)
+  if ((! remote_vertex) ? FAIL(6092) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6093) : 0)
 	 return NULL;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5567) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(6094) : 0)
 	 return NULL;
   if ((r = redex_of (1, err)))
 	 r->r_magic = MAPEX_MAGIC;
@@ -471,17 +471,17 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! given_vertex) ? FAIL(5568) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5569) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(6095) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6096) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(5570) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5571) : 0)
+  if ((! edges_in) ? FAIL(6097) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(6098) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(5572) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5573) : 0)
+  if ((! edges_out) ? FAIL(6099) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(6100) : 0)
 	 return NULL;
   e = edges_out->r_value;
-  if ((e == DIMENSION) ? 0 : (e == (DIMENSION >> 1)) ? 0 : (e == ((DIMENSION >> 1) + 1)) ? 0 : FAIL(5574))
+  if ((e == DIMENSION) ? 0 : (e == (DIMENSION >> 1)) ? 0 : (e == ((DIMENSION >> 1) + 1)) ? 0 : FAIL(6101))
 	 return NULL;
   e = edges_in->r_value;
-  if ((e == DIMENSION) ? 0 : (e == (DIMENSION >> 1)) ? 0 : (e == ((DIMENSION >> 1) + 1)) ? 0 : FAIL(5575))
+  if ((e == DIMENSION) ? 0 : (e == (DIMENSION >> 1)) ? 0 : (e == ((DIMENSION >> 1) + 1)) ? 0 : FAIL(6102))
 	 return NULL;
   return redex_of (1, err);
 }
@@ -506,12 +506,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(5576) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(6103) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5577) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(6104) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(5578) : (s < (r ? r->r_value : 0)) ? FAIL(5579) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(6105) : (s < (r ? r->r_value : 0)) ? FAIL(6106) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -537,12 +537,12 @@ serial_sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != MAPEX_MAGIC) ? FAIL(5580) : 0)
+  if ((! l) ? 0 : (l->r_magic != MAPEX_MAGIC) ? FAIL(6107) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(5581) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(6108) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(5582) : (s < (r ? r->r_value : 0)) ? FAIL(5583) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(6109) : (s < (r ? r->r_value : 0)) ? FAIL(6110) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -606,16 +606,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if (*err ? 1 : (cru_vertex_count (g, LANES, err) == V) ? 0 : FAIL(5584))
+  if (*err ? 1 : (cru_vertex_count (g, LANES, err) == V) ? 0 : FAIL(6111))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == E) ? 0 : FAIL(5585))
+  if ((cru_edge_count (g, LANES, err) == E) ? 0 : FAIL(6112))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(5586))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(6113))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(5587))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(6114))
 	 return 0;
   if (!(v = (r->r_value == V)))
-	 FAIL(5588);
+	 FAIL(6115);
   free_redex (r, err);
   return v;
 }
@@ -636,15 +636,15 @@ r_copy (edges_in, v, edges_out, err)
 	  // splitter s creates a vertex property consisting of a single redex
 	  // numbered the same as the given vertex.
 {
-  if ((! edges_in) ? FAIL(5589) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(5590) : 0)
+  if ((! edges_in) ? FAIL(6116) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(6117) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(5591) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(5592) : 0)
+  if ((! edges_out) ? FAIL(6118) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(6119) : 0)
 	 return NULL;
-  if ((! (edges_in->r_value)) ? 0 : (edges_in->r_value != DIMENSION) ? FAIL(5593) : 0)
+  if ((! (edges_in->r_value)) ? 0 : (edges_in->r_value != DIMENSION) ? FAIL(6120) : 0)
 	 return NULL;
-  if ((edges_out->r_value != DIMENSION) ? FAIL(5594) : 0)
+  if ((edges_out->r_value != DIMENSION) ? FAIL(6121) : 0)
 	 return NULL;
-  if ((! v) ? FAIL(5595) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5596) : 0)
+  if ((! v) ? FAIL(6122) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6123) : 0)
 	 return NULL;
   return redex_of (v->v_value, err);
 }
@@ -664,9 +664,9 @@ v_copy (v, r, err)
 	  // splitter to create a vertex numbered the same as the given
 	  // redex.
 {
-  if ((! v) ? FAIL(5597) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5598) : 0)
+  if ((! v) ? FAIL(6124) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6125) : 0)
 	 return NULL;
-  if ((! r) ? FAIL(5599) : (r->r_magic != REDEX_MAGIC) ? FAIL(5600) : 0)
+  if ((! r) ? FAIL(6126) : (r->r_magic != REDEX_MAGIC) ? FAIL(6127) : 0)
 	 return NULL;
   return vertex_of (r->r_value, err);
 }
@@ -692,11 +692,11 @@ e_copy (source, label, target, err)
 	  // source and target redexes. It's used as the mark function on
 	  // both ctops of both ctopses in a splitter.
 {
-  if ((! source) ? FAIL(5601) : (source->r_magic != REDEX_MAGIC) ? FAIL(5602) : 0)
+  if ((! source) ? FAIL(6128) : (source->r_magic != REDEX_MAGIC) ? FAIL(6129) : 0)
 	 return NULL;
-  if ((! target) ? FAIL(5603) : (target->r_magic != REDEX_MAGIC) ? FAIL(5604) : 0)
+  if ((! target) ? FAIL(6130) : (target->r_magic != REDEX_MAGIC) ? FAIL(6131) : 0)
 	 return NULL;
-  if ((! label) ? FAIL(5605) : (label->e_magic != EDGE_MAGIC) ? FAIL(5606) : 0)
+  if ((! label) ? FAIL(6132) : (label->e_magic != EDGE_MAGIC) ? FAIL(6133) : 0)
 	 return NULL;
   return edge_of (label->e_value, err);
 }
@@ -718,9 +718,9 @@ splittable (v, r, err)
 	  // a splitter calls for only the odd propertied vertices to be
 	  // split.
 {
-  if ((! v) ? FAIL(5607) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5608) : 0)
+  if ((! v) ? FAIL(6134) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6135) : 0)
 	 return 0;
-  if ((! r) ? FAIL(5609) : (r->r_magic != REDEX_MAGIC) ? FAIL(5610) : 0)
+  if ((! r) ? FAIL(6136) : (r->r_magic != REDEX_MAGIC) ? FAIL(6137) : 0)
 	 return 0;
   return (r->r_value & 1);
 }
@@ -742,11 +742,11 @@ odd_connectable (source, label, target, err)
 	  // the ctop of a ctops of a splitter allows only odd numbered
 	  // edges to be connected.
 {
-  if ((! source) ? FAIL(5611) : (source->r_magic != REDEX_MAGIC) ? FAIL(5612) : 0)
+  if ((! source) ? FAIL(6138) : (source->r_magic != REDEX_MAGIC) ? FAIL(6139) : 0)
 	 return 0;
-  if ((! target) ? FAIL(5613) : (target->r_magic != REDEX_MAGIC) ? FAIL(5614) : 0)
+  if ((! target) ? FAIL(6140) : (target->r_magic != REDEX_MAGIC) ? FAIL(6141) : 0)
 	 return 0;
-  if ((! label) ? FAIL(5615) : (label->e_magic != EDGE_MAGIC) ? FAIL(5616) : 0)
+  if ((! label) ? FAIL(6142) : (label->e_magic != EDGE_MAGIC) ? FAIL(6143) : 0)
 	 return 0;
   return ((label->e_value) & 1);
 }
@@ -766,11 +766,11 @@ even_connectable (source, label, target, err)
 	  // the ctop of a ctops of a splitter allows only even numbered
 	  // edges to be connected.
 {
-  if ((! source) ? FAIL(5617) : (source->r_magic != REDEX_MAGIC) ? FAIL(5618) : 0)
+  if ((! source) ? FAIL(6144) : (source->r_magic != REDEX_MAGIC) ? FAIL(6145) : 0)
 	 return 0;
-  if ((! target) ? FAIL(5619) : (target->r_magic != REDEX_MAGIC) ? FAIL(5620) : 0)
+  if ((! target) ? FAIL(6146) : (target->r_magic != REDEX_MAGIC) ? FAIL(6147) : 0)
 	 return 0;
-  if ((! label) ? FAIL(5621) : (label->e_magic != EDGE_MAGIC) ? FAIL(5622) : 0)
+  if ((! label) ? FAIL(6148) : (label->e_magic != EDGE_MAGIC) ? FAIL(6149) : 0)
 	 return 0;
   return ! ((label->e_value) & 1);
 }
@@ -791,14 +791,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(5623);
+	 FAIL(6150);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(5624);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5625) : 0)
+	 FAIL(6151);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(6152) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5626) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5627) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5628) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(6153) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(6154) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(6155) : *err);
 }
 
 
@@ -885,11 +885,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(5629) : vertex_count ? THE_FAIL(5630) : redex_count ? THE_FAIL(5631) : global_err);
+	 err = (edge_count ? THE_FAIL(6156) : vertex_count ? THE_FAIL(6157) : redex_count ? THE_FAIL(6158) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5632);
+	 err = THE_FAIL(6159);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5633);
+	 err = THE_FAIL(6160);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -53,14 +53,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5762))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(6289))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5763) : ++edge_count ? 0 : FAIL(5764))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(6290) : ++edge_count ? 0 : FAIL(6291))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5765) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(6292) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -81,12 +81,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(5766) : (e->e_magic != EDGE_MAGIC) ? FAIL(5767) : 0)
+  if ((! e) ? FAIL(6293) : (e->e_magic != EDGE_MAGIC) ? FAIL(6294) : 0)
 	 return;
-  e->e_magic = MUGGLE(229);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5768) : edge_count-- ? 0 : FAIL(5769))
+  e->e_magic = MUGGLE(238);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(6295) : edge_count-- ? 0 : FAIL(6296))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5770) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(6297) : 0)
 	 return;
   free (e);
 }
@@ -107,9 +107,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(5771) : (a->e_magic != EDGE_MAGIC) ? FAIL(5772) : 0)
+  if ((! a) ? FAIL(6298) : (a->e_magic != EDGE_MAGIC) ? FAIL(6299) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5773) : (b->e_magic != EDGE_MAGIC) ? FAIL(5774) : 0)
+  if ((! b) ? FAIL(6300) : (b->e_magic != EDGE_MAGIC) ? FAIL(6301) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -131,7 +131,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(5775) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5776) : 0)
+  if ((! e) ? GLOBAL_FAIL(6302) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(6303) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -155,14 +155,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5777))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(6304))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5778) : ++vertex_count ? 0 : FAIL(5779))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6305) : ++vertex_count ? 0 : FAIL(6306))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5780) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(6307) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -184,12 +184,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(5781) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5782) : 0)
+  if ((! v) ? FAIL(6308) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6309) : 0)
 	 return;
-  v->v_magic = MUGGLE(230);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5783) : vertex_count-- ? 0 : FAIL(5784))
+  v->v_magic = MUGGLE(239);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6310) : vertex_count-- ? 0 : FAIL(6311))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5785) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(6312) : 0)
 	 return;
   free (v);
 }
@@ -210,9 +210,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(5786) : (a->v_magic != VERTEX_MAGIC) ? FAIL(5787) : 0)
+  if ((! a) ? FAIL(6313) : (a->v_magic != VERTEX_MAGIC) ? FAIL(6314) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5788) : (b->v_magic != VERTEX_MAGIC) ? FAIL(5789) : 0)
+  if ((! b) ? FAIL(6315) : (b->v_magic != VERTEX_MAGIC) ? FAIL(6316) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -235,7 +235,7 @@ vertex_hash (v, err)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? FAIL(5790) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5791) : 0)
+  if ((! v) ? FAIL(6317) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6318) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -265,12 +265,12 @@ building_rule (given_vertex, err)
   vertex remote_vertex;
   int buildable;
 
-  if ((! given_vertex) ? FAIL(5792) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5793) : 0)
+  if ((! given_vertex) ? FAIL(6319) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6320) : 0)
 	 return;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5794) : 0)
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6321) : 0)
 	 return;
   buildable = (half_built ? 1 : (vertex_count < (1 << (DIMENSION - 1))));
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(5795) : ! buildable)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(6322) : ! buildable)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -296,13 +296,13 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 	  // Return 1 if an edge is labeled by the index of the bit in
 	  // which its endpoints differ, and 0 otherwise.
 {
-  if (*err ? 1 : (! connecting_edge) ? FAIL(5796) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(5797) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(6323) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(6324) : 0)
 	 return 0;
-  if ((! local_vertex) ? FAIL(5798) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5799) : 0)
+  if ((! local_vertex) ? FAIL(6325) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6326) : 0)
 	 return 0;
-  if ((! remote_vertex) ? FAIL(5800) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5801) : 0)
+  if ((! remote_vertex) ? FAIL(6327) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6328) : 0)
 	 return 0;
-  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(5802) : 0);
+  return ! (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(6329) : 0);
 }
 
 
@@ -322,9 +322,9 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(5803) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(5804) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(6330) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6331) : 0)
 	 return 0;
-  return ! ((edges_in != DIMENSION) ? FAIL(5805) : (edges_out != DIMENSION) ? FAIL(5806) : 0);
+  return ! ((edges_in != DIMENSION) ? FAIL(6332) : (edges_out != DIMENSION) ? FAIL(6333) : 0);
 }
 
 
@@ -343,7 +343,7 @@ sum (l, r, err)
 {
   uintptr_t s;
 
-  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(5807) : (s < r) ? FAIL(5808) : 0) ? 0 : s);
+  return ((*err ? 1 : ((s = l + r) < l) ? FAIL(6334) : (s < r) ? FAIL(6335) : 0) ? 0 : s);
 }
 
 
@@ -371,11 +371,11 @@ valid (g, err)
 		  .reduction = (cru_bop) sum,
 		  .map = (cru_top) edge_checker}}};
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(5809))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(6336))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(5810))
+  if ((cru_edge_count (g, LANES, err) == ((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES) ? 0 : FAIL(6337))
 	 return 0;
-  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(5811))
+  if ((((uintptr_t) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) == NUMBER_OF_VERTICES) ? 0 : FAIL(6338))
 	 return 0;
   return 1;
 }
@@ -396,14 +396,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(5812);
+	 FAIL(6339);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(5813);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(5814) : 0)
+	 FAIL(6340);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(6341) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(5815) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(5816) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(5817) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(6342) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(6343) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(6344) : *err);
 }
 
 
@@ -451,11 +451,11 @@ main (argc, argv)
   v = valid (g, &err);
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
-  err = (err ? err : edge_count ? THE_FAIL(5818) : vertex_count ? THE_FAIL(5819) : 0);
+  err = (err ? err : edge_count ? THE_FAIL(6345) : vertex_count ? THE_FAIL(6346) : 0);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5820);
+	 err = THE_FAIL(6347);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(5821);
+	 err = THE_FAIL(6348);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -71,14 +71,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(5962))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(6489))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(5963) : ++redex_count ? 0 : FAIL(5964))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(6490) : ++redex_count ? 0 : FAIL(6491))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(5965) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(6492) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -95,12 +95,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(5966) : (r->r_magic != REDEX_MAGIC) ? FAIL(5967) : 0)
+  if ((! r) ? FAIL(6493) : (r->r_magic != REDEX_MAGIC) ? FAIL(6494) : 0)
 	 return;
-  r->r_magic = MUGGLE(236);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(5968) : redex_count-- ? 0 : FAIL(5969))
+  r->r_magic = MUGGLE(245);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(6495) : redex_count-- ? 0 : FAIL(6496))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(5970) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(6497) : 0)
 	 return;
   free (r);
 }
@@ -115,7 +115,7 @@ free_vredex (r, err)
 
 	  // Reclaim a redex as above but expect a different magic number.
 {
-  if ((! r) ? FAIL(5971) : (r->r_magic != VREDEX_MAGIC) ? FAIL(5972) : 0)
+  if ((! r) ? FAIL(6498) : (r->r_magic != VREDEX_MAGIC) ? FAIL(6499) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -131,7 +131,7 @@ free_iredex (r, err)
 
 	  // Reclaim a redex as above but expect a different magic number.
 {
-  if ((! r) ? FAIL(5973) : (r->r_magic != IREDEX_MAGIC) ? FAIL(5974) : 0)
+  if ((! r) ? FAIL(6500) : (r->r_magic != IREDEX_MAGIC) ? FAIL(6501) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -147,7 +147,7 @@ free_imapex (r, err)
 
 	  // Reclaim a redex as above but expect a different magic number.
 {
-  if ((! r) ? FAIL(5975) : (r->r_magic != IMAPEX_MAGIC) ? FAIL(5976) : 0)
+  if ((! r) ? FAIL(6502) : (r->r_magic != IMAPEX_MAGIC) ? FAIL(6503) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -164,7 +164,7 @@ free_oredex (r, err)
 
 	  // Reclaim a redex as above but expect a different magic number.
 {
-  if ((! r) ? FAIL(5977) : (r->r_magic != OREDEX_MAGIC) ? FAIL(5978) : 0)
+  if ((! r) ? FAIL(6504) : (r->r_magic != OREDEX_MAGIC) ? FAIL(6505) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -185,14 +185,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(5979))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(6506))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5980) : ++edge_count ? 0 : FAIL(5981))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(6507) : ++edge_count ? 0 : FAIL(6508))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(5982) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(6509) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -213,12 +213,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(5983) : (e->e_magic != EDGE_MAGIC) ? FAIL(5984) : 0)
+  if ((! e) ? FAIL(6510) : (e->e_magic != EDGE_MAGIC) ? FAIL(6511) : 0)
 	 return;
-  e->e_magic = MUGGLE(237);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(5985) : edge_count-- ? 0 : FAIL(5986))
+  e->e_magic = MUGGLE(246);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(6512) : edge_count-- ? 0 : FAIL(6513))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(5987) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(6514) : 0)
 	 return;
   free (e);
 }
@@ -239,9 +239,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(5988) : (a->e_magic != EDGE_MAGIC) ? FAIL(5989) : 0)
+  if ((! a) ? FAIL(6515) : (a->e_magic != EDGE_MAGIC) ? FAIL(6516) : 0)
 	 return 0;
-  if ((! b) ? FAIL(5990) : (b->e_magic != EDGE_MAGIC) ? FAIL(5991) : 0)
+  if ((! b) ? FAIL(6517) : (b->e_magic != EDGE_MAGIC) ? FAIL(6518) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -263,7 +263,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(5992) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(5993) : 0)
+  if ((! e) ? GLOBAL_FAIL(6519) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(6520) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -288,14 +288,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(5994))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(6521))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(5995) : ++vertex_count ? 0 : FAIL(5996))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6522) : ++vertex_count ? 0 : FAIL(6523))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(5997) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(6524) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -317,12 +317,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(5998) : (v->v_magic != VERTEX_MAGIC) ? FAIL(5999) : 0)
+  if ((! v) ? FAIL(6525) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6526) : 0)
 	 return;
-  v->v_magic = MUGGLE(238);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6000) : vertex_count-- ? 0 : FAIL(6001))
+  v->v_magic = MUGGLE(247);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6527) : vertex_count-- ? 0 : FAIL(6528))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(6002) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(6529) : 0)
 	 return;
   free (v);
 }
@@ -343,9 +343,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(6003) : (a->v_magic != VERTEX_MAGIC) ? FAIL(6004) : 0)
+  if ((! a) ? FAIL(6530) : (a->v_magic != VERTEX_MAGIC) ? FAIL(6531) : 0)
 	 return 0;
-  if ((! b) ? FAIL(6005) : (b->v_magic != VERTEX_MAGIC) ? FAIL(6006) : 0)
+  if ((! b) ? FAIL(6532) : (b->v_magic != VERTEX_MAGIC) ? FAIL(6533) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -369,7 +369,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(6007) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(6008) : 0)
+  if ((! v) ? GLOBAL_FAIL(6534) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(6535) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -400,7 +400,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(6009) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6010) : 0)
+  if ((! given_vertex) ? FAIL(6536) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6537) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -430,15 +430,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(6011) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(6012) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(6538) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(6539) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(6013) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6014) : 0)
+  if ((! local_vertex) ? FAIL(6540) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6541) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(6015) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6016) : 0)
+  if ((! remote_vertex) ? FAIL(6542) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6543) : 0)
 	 return NULL;
   if (! (connecting_edge->e_value))
 	 goto a;
-  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(6017) : 0)
+  if (((local_vertex->v_value ^ remote_vertex->v_value) != (1 << connecting_edge->e_value)) ? FAIL(6544) : 0)
   	 return NULL;
  a: return redex_of (1, err);
 }
@@ -460,13 +460,13 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(6018) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6019) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(6545) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6546) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(6020) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(6021) : 0)
+  if ((! edges_in) ? FAIL(6547) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(6548) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(6022) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(6023) : 0)
+  if ((! edges_out) ? FAIL(6549) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(6550) : 0)
 	 return NULL;
-  if ((edges_in->r_value != DIMENSION) ? FAIL(6024) : (edges_out->r_value != DIMENSION) ? FAIL(6025) : 0)
+  if ((edges_in->r_value != DIMENSION) ? FAIL(6551) : (edges_out->r_value != DIMENSION) ? FAIL(6552) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -491,12 +491,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(6026) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(6553) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(6027) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(6554) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(6028) : (s < (r ? r->r_value : 0)) ? FAIL(6029) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(6555) : (s < (r ? r->r_value : 0)) ? FAIL(6556) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -538,16 +538,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(6030))
+  if ((cru_vertex_count (g, LANES, err) == NUMBER_OF_VERTICES) ? 0 : FAIL(6557))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES)) ? 0 : FAIL(6031))
+  if ((cru_edge_count (g, LANES, err) == (((uintptr_t) DIMENSION) * NUMBER_OF_VERTICES)) ? 0 : FAIL(6558))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(6032))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(6559))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(6033))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(6560))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES)))
-	 FAIL(6034);
+	 FAIL(6561);
   free_redex (r, err);
   return v;
 }
@@ -589,11 +589,11 @@ iredex_map (source_vertex, edge_label, target_vertex, err)
 {
   redex r;
 
-  if ((! source_vertex) ? FAIL(6035) : (source_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6036) : 0)
+  if ((! source_vertex) ? FAIL(6562) : (source_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6563) : 0)
 	 return NULL;
-  if ((! target_vertex) ? FAIL(6037) : (target_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6038) : 0)
+  if ((! target_vertex) ? FAIL(6564) : (target_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6565) : 0)
 	 return NULL;
-  if ((! edge_label) ? FAIL(6039) : (edge_label->e_magic != EDGE_MAGIC) ? FAIL(6040) : 0)
+  if ((! edge_label) ? FAIL(6566) : (edge_label->e_magic != EDGE_MAGIC) ? FAIL(6567) : 0)
 	 return NULL;
   if ((r = redex_of (edge_label->e_value, err)))
 	 r->r_magic = IMAPEX_MAGIC;
@@ -637,11 +637,11 @@ oredex_map (source_vertex, edge_label, target_vertex, err)
 {
   redex r;
 
-  if ((! source_vertex) ? FAIL(6041) : (source_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6042) : 0)
+  if ((! source_vertex) ? FAIL(6568) : (source_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6569) : 0)
 	 return NULL;
-  if ((! target_vertex) ? FAIL(6043) : (target_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6044) : 0)
+  if ((! target_vertex) ? FAIL(6570) : (target_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6571) : 0)
 	 return NULL;
-  if ((! edge_label) ? FAIL(6045) : (edge_label->e_magic != EDGE_MAGIC) ? FAIL(6046) : 0)
+  if ((! edge_label) ? FAIL(6572) : (edge_label->e_magic != EDGE_MAGIC) ? FAIL(6573) : 0)
 	 return NULL;
   if ((r = redex_of (edge_label->e_value, err)))
 	 r->r_magic = OREDEX_MAGIC;
@@ -666,11 +666,11 @@ vredex_map (redex_in, given_vertex, redex_out, err)
 {
   redex r;
 
-  if ((! redex_in) ? FAIL(6047) : (redex_in->r_magic != IREDEX_MAGIC) ? FAIL(6048) : 0)
+  if ((! redex_in) ? FAIL(6574) : (redex_in->r_magic != IREDEX_MAGIC) ? FAIL(6575) : 0)
 	 return NULL;
-  if ((! redex_out) ? FAIL(6049) : (redex_out->r_magic != OREDEX_MAGIC) ? FAIL(6050) : 0)
+  if ((! redex_out) ? FAIL(6576) : (redex_out->r_magic != OREDEX_MAGIC) ? FAIL(6577) : 0)
 	 return NULL;
-  if ((! given_vertex) ? FAIL(6051) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6052) : 0)
+  if ((! given_vertex) ? FAIL(6578) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6579) : 0)
 	 return NULL;
   if ((r = redex_of (given_vertex->v_value, err)))
 	 r->r_magic = VREDEX_MAGIC;
@@ -693,9 +693,9 @@ either_iredex (a, b, err)
 {
   redex r;
 
-  if ((! a) ? FAIL(6053) : (a->r_magic != IMAPEX_MAGIC) ? FAIL(6054) : 0)
+  if ((! a) ? FAIL(6580) : (a->r_magic != IMAPEX_MAGIC) ? FAIL(6581) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(6055) : (b->r_magic != IREDEX_MAGIC) ? FAIL(6056) : 0)
+  if ((! b) ? FAIL(6582) : (b->r_magic != IREDEX_MAGIC) ? FAIL(6583) : 0)
 	 return NULL;
   if ((r = redex_of (a->r_value, err)))
 	 r->r_magic = IREDEX_MAGIC;
@@ -718,9 +718,9 @@ either_oredex (a, b, err)
 {
   redex r;
 
-  if ((! a) ? FAIL(6057) : (a->r_magic != OREDEX_MAGIC) ? FAIL(6058) : 0)
+  if ((! a) ? FAIL(6584) : (a->r_magic != OREDEX_MAGIC) ? FAIL(6585) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(6059) : (b->r_magic != OREDEX_MAGIC) ? FAIL(6060) : 0)
+  if ((! b) ? FAIL(6586) : (b->r_magic != OREDEX_MAGIC) ? FAIL(6587) : 0)
 	 return NULL;
   if ((r = redex_of (b->r_value, err)))
 	 r->r_magic = OREDEX_MAGIC;
@@ -741,14 +741,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(6061);
+	 FAIL(6588);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(6062);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(6063) : 0)
+	 FAIL(6589);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(6590) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(6064) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(6065) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(6066) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(6591) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(6592) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(6593) : *err);
 }
 
 
@@ -817,11 +817,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(6067) : vertex_count ? THE_FAIL(6068) : redex_count ? THE_FAIL(6069) : global_err);
+	 err = (edge_count ? THE_FAIL(6594) : vertex_count ? THE_FAIL(6595) : redex_count ? THE_FAIL(6596) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(6070);
+	 err = THE_FAIL(6597);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(6071);
+	 err = THE_FAIL(6598);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)
@@ -74,14 +74,14 @@ redex_of (n, err)
 {
   redex r;
 
-  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(6072))
+  if ((r = (redex) malloc (sizeof (*r))) ? 0 : FAIL(6599))
 	 return NULL;
   memset (r, 0, sizeof (*r));
   r->r_magic = REDEX_MAGIC;
   r->r_value = n;
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(6073) : ++redex_count ? 0 : FAIL(6074))
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(6600) : ++redex_count ? 0 : FAIL(6601))
 	 goto a;
-  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(6075) : 0))
+  if (! (pthread_mutex_unlock (&redex_lock) ? FAIL(6602) : 0))
 	 return r;
  a: free (r);
   return NULL;
@@ -98,12 +98,12 @@ free_redex (r, err)
 
 	  // Reclaim a redex.
 {
-  if ((! r) ? FAIL(6076) : (r->r_magic != REDEX_MAGIC) ? FAIL(6077) : 0)
+  if ((! r) ? FAIL(6603) : (r->r_magic != REDEX_MAGIC) ? FAIL(6604) : 0)
 	 return;
-  r->r_magic = MUGGLE(239);
-  if (pthread_mutex_lock (&redex_lock) ? FAIL(6078) : redex_count-- ? 0 : FAIL(6079))
+  r->r_magic = MUGGLE(248);
+  if (pthread_mutex_lock (&redex_lock) ? FAIL(6605) : redex_count-- ? 0 : FAIL(6606))
 	 return;
-  if (pthread_mutex_unlock (&redex_lock) ? FAIL(6080) : 0)
+  if (pthread_mutex_unlock (&redex_lock) ? FAIL(6607) : 0)
 	 return;
   free (r);
 }
@@ -118,7 +118,7 @@ free_vredex (r, err)
 
 	  // Reclaim a redex as above but expect a different magic number.
 {
-  if ((! r) ? FAIL(6081) : (r->r_magic != VREDEX_MAGIC) ? FAIL(6082) : 0)
+  if ((! r) ? FAIL(6608) : (r->r_magic != VREDEX_MAGIC) ? FAIL(6609) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -134,7 +134,7 @@ free_iredex (r, err)
 
 	  // Reclaim a redex as above but expect a different magic number.
 {
-  if ((! r) ? FAIL(6083) : (r->r_magic != IREDEX_MAGIC) ? FAIL(6084) : 0)
+  if ((! r) ? FAIL(6610) : (r->r_magic != IREDEX_MAGIC) ? FAIL(6611) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -150,7 +150,7 @@ free_imapex (r, err)
 
 	  // Reclaim a redex as above but expect a different magic number.
 {
-  if ((! r) ? FAIL(6085) : (r->r_magic != IMAPEX_MAGIC) ? FAIL(6086) : 0)
+  if ((! r) ? FAIL(6612) : (r->r_magic != IMAPEX_MAGIC) ? FAIL(6613) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -167,7 +167,7 @@ free_oredex (r, err)
 
 	  // Reclaim a redex as above but expect a different magic number.
 {
-  if ((! r) ? FAIL(6087) : (r->r_magic != OREDEX_MAGIC) ? FAIL(6088) : 0)
+  if ((! r) ? FAIL(6614) : (r->r_magic != OREDEX_MAGIC) ? FAIL(6615) : 0)
 	 return;
   r->r_magic = REDEX_MAGIC;
   free_redex (r, err);
@@ -188,14 +188,14 @@ edge_of (n, err)
 {
   edge e;
 
-  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(6089))
+  if ((e = (edge) malloc (sizeof (*e))) ? 0 : FAIL(6616))
 	 return NULL;
   memset (e, 0, sizeof (*e));
   e->e_magic = EDGE_MAGIC;
   e->e_value = n;
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(6090) : ++edge_count ? 0 : FAIL(6091))
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(6617) : ++edge_count ? 0 : FAIL(6618))
 	 goto a;
-  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(6092) : 0))
+  if (! (pthread_mutex_unlock (&edge_lock) ? FAIL(6619) : 0))
 	 return e;
  a: free (e);
   return NULL;
@@ -216,12 +216,12 @@ free_edge (e, err)
 	  // passed to the cru library as b.bu_sig.destructors.e_free in the builder
 	  // b.
 {
-  if ((! e) ? FAIL(6093) : (e->e_magic != EDGE_MAGIC) ? FAIL(6094) : 0)
+  if ((! e) ? FAIL(6620) : (e->e_magic != EDGE_MAGIC) ? FAIL(6621) : 0)
 	 return;
-  e->e_magic = MUGGLE(240);
-  if (pthread_mutex_lock (&edge_lock) ? FAIL(6095) : edge_count-- ? 0 : FAIL(6096))
+  e->e_magic = MUGGLE(249);
+  if (pthread_mutex_lock (&edge_lock) ? FAIL(6622) : edge_count-- ? 0 : FAIL(6623))
 	 return;
-  if (pthread_mutex_unlock (&edge_lock) ? FAIL(6097) : 0)
+  if (pthread_mutex_unlock (&edge_lock) ? FAIL(6624) : 0)
 	 return;
   free (e);
 }
@@ -242,9 +242,9 @@ equal_edges (a, b, err)
 	  // function cast to a cru_bpred is passed to the cru library
 	  // as b.bu_sig.orders.e_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(6098) : (a->e_magic != EDGE_MAGIC) ? FAIL(6099) : 0)
+  if ((! a) ? FAIL(6625) : (a->e_magic != EDGE_MAGIC) ? FAIL(6626) : 0)
 	 return 0;
-  if ((! b) ? FAIL(6100) : (b->e_magic != EDGE_MAGIC) ? FAIL(6101) : 0)
+  if ((! b) ? FAIL(6627) : (b->e_magic != EDGE_MAGIC) ? FAIL(6628) : 0)
 	 return 0;
   return a->e_value == b->e_value;
 }
@@ -266,7 +266,7 @@ edge_hash (e)
   size_t i;
   uintptr_t u;
 
-  if ((! e) ? GLOBAL_FAIL(6102) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(6103) : 0)
+  if ((! e) ? GLOBAL_FAIL(6629) : (e->e_magic != EDGE_MAGIC) ? GLOBAL_FAIL(6630) : 0)
 	 return 0;
   u = e->e_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -291,14 +291,14 @@ vertex_of (n, err)
 {
   vertex v;
 
-  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(6104))
+  if ((v = (vertex) malloc (sizeof (*v))) ? 0 : FAIL(6631))
 	 return NULL;
   memset (v, 0, sizeof (*v));
   v->v_magic = VERTEX_MAGIC;
   v->v_value = n;
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6105) : ++vertex_count ? 0 : FAIL(6106))
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6632) : ++vertex_count ? 0 : FAIL(6633))
 	 goto a;
-  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(6107) : 0))
+  if (! (pthread_mutex_unlock (&vertex_lock) ? FAIL(6634) : 0))
 	 return v;
  a: free (v);
   return NULL;
@@ -320,12 +320,12 @@ free_vertex (v, err)
 	  // passed to the cru library as b.bu_sig.destructors.v_free in the builder
 	  // b.
 {
-  if ((! v) ? FAIL(6108) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6109) : 0)
+  if ((! v) ? FAIL(6635) : (v->v_magic != VERTEX_MAGIC) ? FAIL(6636) : 0)
 	 return;
-  v->v_magic = MUGGLE(241);
-  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6110) : vertex_count-- ? 0 : FAIL(6111))
+  v->v_magic = MUGGLE(250);
+  if (pthread_mutex_lock (&vertex_lock) ? FAIL(6637) : vertex_count-- ? 0 : FAIL(6638))
 	 return;
-  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(6112) : 0)
+  if (pthread_mutex_unlock (&vertex_lock) ? FAIL(6639) : 0)
 	 return;
   free (v);
 }
@@ -346,9 +346,9 @@ equal_vertices (a, b, err)
 	  // equal. This function cast to a cru_bpred is passed to the
 	  // cru library as b.bu_sig.orders.v_order.equal in the builder b.
 {
-  if ((! a) ? FAIL(6113) : (a->v_magic != VERTEX_MAGIC) ? FAIL(6114) : 0)
+  if ((! a) ? FAIL(6640) : (a->v_magic != VERTEX_MAGIC) ? FAIL(6641) : 0)
 	 return 0;
-  if ((! b) ? FAIL(6115) : (b->v_magic != VERTEX_MAGIC) ? FAIL(6116) : 0)
+  if ((! b) ? FAIL(6642) : (b->v_magic != VERTEX_MAGIC) ? FAIL(6643) : 0)
 	 return 0;
   return a->v_value == b->v_value;
 }
@@ -372,7 +372,7 @@ vertex_hash (v)
   size_t i;
   uintptr_t u;
 
-  if ((! v) ? GLOBAL_FAIL(6117) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(6118) : 0)
+  if ((! v) ? GLOBAL_FAIL(6644) : (v->v_magic != VERTEX_MAGIC) ? GLOBAL_FAIL(6645) : 0)
 	 return 0;
   u = v->v_value;
   for (i = 0; i < sizeof (u); i++)  // ignore overflow
@@ -403,7 +403,7 @@ building_rule (given_vertex, err)
   uintptr_t outgoing_edge;
   vertex remote_vertex;
 
-  if ((! given_vertex) ? FAIL(6119) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6120) : 0)
+  if ((! given_vertex) ? FAIL(6646) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6647) : 0)
 	 return;
   for (outgoing_edge = 0; outgoing_edge < DIMENSION; outgoing_edge++)
 	 {
@@ -433,15 +433,15 @@ edge_checker (local_vertex, connecting_edge, remote_vertex, err)
 {
   uintptr_t e;
 
-  if (*err ? 1 : (! connecting_edge) ? FAIL(6121) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(6122) : 0)
+  if (*err ? 1 : (! connecting_edge) ? FAIL(6648) : (connecting_edge->e_magic != EDGE_MAGIC) ? FAIL(6649) : 0)
 	 return NULL;
-  if ((! local_vertex) ? FAIL(6123) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6124) : 0)
+  if ((! local_vertex) ? FAIL(6650) : (local_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6651) : 0)
 	 return NULL;
-  if ((! remote_vertex) ? FAIL(6125) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6126) : 0)
+  if ((! remote_vertex) ? FAIL(6652) : (remote_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6653) : 0)
 	 return NULL;
   if (! (connecting_edge->e_value))
 	 goto a;
-  if (connecting_edge->e_value ? FAIL(6127) : 0)
+  if (connecting_edge->e_value ? FAIL(6654) : 0)
 	 return NULL;
  a: return redex_of (1, err);
 }
@@ -463,19 +463,19 @@ vertex_checker (edges_in, given_vertex, edges_out, err)
 	  // Validate a vertex based on the incoming and outgoing
 	  // edges being valid.
 {
-  if (*err ? 1 : (! given_vertex) ? FAIL(6128) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6129) : 0)
+  if (*err ? 1 : (! given_vertex) ? FAIL(6655) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6656) : 0)
 	 return NULL;
-  if ((! edges_in) ? FAIL(6130) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(6131) : 0)
+  if ((! edges_in) ? FAIL(6657) : (edges_in->r_magic != REDEX_MAGIC) ? FAIL(6658) : 0)
 	 return NULL;
-  if ((! edges_out) ? FAIL(6132) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(6133) : 0)
+  if ((! edges_out) ? FAIL(6659) : (edges_out->r_magic != REDEX_MAGIC) ? FAIL(6660) : 0)
 	 return NULL;
-  if (given_vertex->v_value ? ((edges_in->r_value != 1) ? FAIL(6134) : 0) : 0)
+  if (given_vertex->v_value ? ((edges_in->r_value != 1) ? FAIL(6661) : 0) : 0)
 	 return NULL;
-  if (given_vertex->v_value ? ((edges_out->r_value != DIMENSION) ? FAIL(6135) : 0) : 0)
+  if (given_vertex->v_value ? ((edges_out->r_value != DIMENSION) ? FAIL(6662) : 0) : 0)
 	 return NULL;
-  if (given_vertex->v_value ? 0 : (edges_in->r_value != ((NUMBER_OF_VERTICES - 1) * ((uintptr_t) DIMENSION)) + 1) ? FAIL(6136) : 0)
+  if (given_vertex->v_value ? 0 : (edges_in->r_value != ((NUMBER_OF_VERTICES - 1) * ((uintptr_t) DIMENSION)) + 1) ? FAIL(6663) : 0)
 	 return NULL;
-  if (given_vertex->v_value ? 0 : (edges_out->r_value != NUMBER_OF_VERTICES) ? FAIL(6137) : 0)
+  if (given_vertex->v_value ? 0 : (edges_out->r_value != NUMBER_OF_VERTICES) ? FAIL(6664) : 0)
 	 return NULL;
   return redex_of (1, err);
 }
@@ -500,12 +500,12 @@ sum (l, r, err)
 
   if (*err)
 	 return NULL;
-  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(6138) : 0)
+  if ((! l) ? 0 : (l->r_magic != REDEX_MAGIC) ? FAIL(6665) : 0)
 	 return NULL;
-  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(6139) : 0)
+  if ((! r) ? 0 : (r->r_magic != REDEX_MAGIC) ? FAIL(6666) : 0)
 	 return NULL;
   s = (l ? l->r_value : 0) + (r ? r->r_value : 0);
-  if ((s < (l ? l->r_value : 0)) ? FAIL(6140) : (s < (r ? r->r_value : 0)) ? FAIL(6141) : 0)
+  if ((s < (l ? l->r_value : 0)) ? FAIL(6667) : (s < (r ? r->r_value : 0)) ? FAIL(6668) : 0)
 	 return NULL;
   return redex_of (s, err);
 }
@@ -547,16 +547,16 @@ valid (g, err)
   redex r;
   int v;
 
-  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES)) ? 0 : FAIL(6142))
+  if ((cru_vertex_count (g, LANES, err) == (NUMBER_OF_VERTICES)) ? 0 : FAIL(6669))
 	 return 0;
-  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) + 1) * NUMBER_OF_VERTICES - DIMENSION)) ? 0 : FAIL(6143))
+  if ((cru_edge_count (g, LANES, err) == ((((uintptr_t) DIMENSION) + 1) * NUMBER_OF_VERTICES - DIMENSION)) ? 0 : FAIL(6670))
 	 return 0;
-  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(6144))
+  if ((r = (redex) cru_mapreduced (g, &m, UNKILLABLE, LANES, err)) ? 0 : FAIL(6671))
 	 return 0;
-  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(6145))
+  if ((r->r_magic == REDEX_MAGIC) ? 0 : FAIL(6672))
 	 return 0;
   if (!(v = (r->r_value == NUMBER_OF_VERTICES)))
-	 FAIL(6146);
+	 FAIL(6673);
   free_redex (r, err);
   return v;
 }
@@ -578,11 +578,11 @@ cubex (source_redex, edge_label, target_redex, err)
 	  // dimension, then interpose a new vertex for each edge and
 	  // delete the edge.
 {
-  if ((! source_redex) ? FAIL(6147) : (source_redex->r_magic != VREDEX_MAGIC) ? FAIL(6148) : 0)
+  if ((! source_redex) ? FAIL(6674) : (source_redex->r_magic != VREDEX_MAGIC) ? FAIL(6675) : 0)
 	 return 0;
-  if ((! target_redex) ? FAIL(6149) : (target_redex->r_magic != VREDEX_MAGIC) ? FAIL(6150) : 0)
+  if ((! target_redex) ? FAIL(6676) : (target_redex->r_magic != VREDEX_MAGIC) ? FAIL(6677) : 0)
 	 return 0;
-  if ((! edge_label) ? FAIL(6151) : (edge_label->e_magic != EDGE_MAGIC) ? FAIL(6152) : 0)
+  if ((! edge_label) ? FAIL(6678) : (edge_label->e_magic != EDGE_MAGIC) ? FAIL(6679) : 0)
 	 return 0;
   if (((target_redex->r_value) & MASK) != DIMENSION)
 	 return 0;
@@ -609,11 +609,11 @@ iredex_map (source_vertex, edge_label, target_vertex, err)
 {
   redex r;
 
-  if ((! source_vertex) ? FAIL(6153) : (source_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6154) : 0)
+  if ((! source_vertex) ? FAIL(6680) : (source_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6681) : 0)
 	 return NULL;
-  if ((! target_vertex) ? FAIL(6155) : (target_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6156) : 0)
+  if ((! target_vertex) ? FAIL(6682) : (target_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6683) : 0)
 	 return NULL;
-  if ((! edge_label) ? FAIL(6157) : (edge_label->e_magic != EDGE_MAGIC) ? FAIL(6158) : 0)
+  if ((! edge_label) ? FAIL(6684) : (edge_label->e_magic != EDGE_MAGIC) ? FAIL(6685) : 0)
 	 return NULL;
   if ((r = redex_of (edge_label->e_value, err)))
 	 r->r_magic = IMAPEX_MAGIC;
@@ -657,11 +657,11 @@ oredex_map (source_vertex, edge_label, target_vertex, err)
 {
   redex r;
 
-  if ((! source_vertex) ? FAIL(6159) : (source_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6160) : 0)
+  if ((! source_vertex) ? FAIL(6686) : (source_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6687) : 0)
 	 return NULL;
-  if ((! target_vertex) ? FAIL(6161) : (target_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6162) : 0)
+  if ((! target_vertex) ? FAIL(6688) : (target_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6689) : 0)
 	 return NULL;
-  if ((! edge_label) ? FAIL(6163) : (edge_label->e_magic != EDGE_MAGIC) ? FAIL(6164) : 0)
+  if ((! edge_label) ? FAIL(6690) : (edge_label->e_magic != EDGE_MAGIC) ? FAIL(6691) : 0)
 	 return NULL;
   if ((r = redex_of (1, err)))
 	 r->r_magic = OREDEX_MAGIC;
@@ -687,11 +687,11 @@ vredex_map (redex_in, given_vertex, redex_out, err)
 {
   redex r;
 
-  if ((! redex_in) ? FAIL(6165) : (redex_in->r_magic != IREDEX_MAGIC) ? FAIL(6166) : 0)
+  if ((! redex_in) ? FAIL(6692) : (redex_in->r_magic != IREDEX_MAGIC) ? FAIL(6693) : 0)
 	 return NULL;
-  if ((! redex_out) ? FAIL(6167) : (redex_out->r_magic != OREDEX_MAGIC) ? FAIL(6168) : 0)
+  if ((! redex_out) ? FAIL(6694) : (redex_out->r_magic != OREDEX_MAGIC) ? FAIL(6695) : 0)
 	 return NULL;
-  if ((! given_vertex) ? FAIL(6169) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6170) : 0)
+  if ((! given_vertex) ? FAIL(6696) : (given_vertex->v_magic != VERTEX_MAGIC) ? FAIL(6697) : 0)
 	 return NULL;
   if ((r = redex_of (((given_vertex->v_value) << HALF_POINTER_WIDTH) | (redex_out->r_value), err)))
 	 r->r_magic = VREDEX_MAGIC;
@@ -714,9 +714,9 @@ either_iredex (a, b, err)
 {
   redex r;
 
-  if ((! a) ? FAIL(6171) : (a->r_magic != IMAPEX_MAGIC) ? FAIL(6172) : 0)
+  if ((! a) ? FAIL(6698) : (a->r_magic != IMAPEX_MAGIC) ? FAIL(6699) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(6173) : (b->r_magic != IREDEX_MAGIC) ? FAIL(6174) : 0)
+  if ((! b) ? FAIL(6700) : (b->r_magic != IREDEX_MAGIC) ? FAIL(6701) : 0)
 	 return NULL;
   if ((r = redex_of (a->r_value, err)))
 	 r->r_magic = IREDEX_MAGIC;
@@ -739,9 +739,9 @@ oredex_sum (a, b, err)
 {
   redex r;
 
-  if ((! a) ? FAIL(6175) : (a->r_magic != OREDEX_MAGIC) ? FAIL(6176) : 0)
+  if ((! a) ? FAIL(6702) : (a->r_magic != OREDEX_MAGIC) ? FAIL(6703) : 0)
 	 return NULL;
-  if ((! b) ? FAIL(6177) : (b->r_magic != OREDEX_MAGIC) ? FAIL(6178) : 0)
+  if ((! b) ? FAIL(6704) : (b->r_magic != OREDEX_MAGIC) ? FAIL(6705) : 0)
 	 return NULL;
   if ((r = redex_of (a->r_value + b->r_value, err)))
 	 r->r_magic = OREDEX_MAGIC;
@@ -762,14 +762,14 @@ initialized (count, lock, lock_created, err)
   pthread_mutexattr_t mutex_attribute;
 
   if (count ? (*count = 0) : 1)
-	 FAIL(6179);
+	 FAIL(6706);
   if (lock_created ? (*lock_created = 0) : 1)
-	 FAIL(6180);
-  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(6181) : 0)
+	 FAIL(6707);
+  if (*err ? 1 : pthread_mutexattr_init (&mutex_attribute) ? FAIL(6708) : 0)
 	 return 0;
-  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(6182) : 0))
-	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(6183) : 0);
-  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(6184) : *err);
+  if (!((pthread_mutexattr_settype (&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK)) ? FAIL(6709) : 0))
+	 *lock_created = ! (pthread_mutex_init (lock, &mutex_attribute) ? FAIL(6710) : 0);
+  return ! ((pthread_mutexattr_destroy (&mutex_attribute)) ? FAIL(6711) : *err);
 }
 
 
@@ -838,11 +838,11 @@ main (argc, argv)
   cru_free_now (g, LANES, &err);
   nthm_sync (&err);
   if (! err)
-	 err = (edge_count ? THE_FAIL(6185) : vertex_count ? THE_FAIL(6186) : redex_count ? THE_FAIL(6187) : global_err);
+	 err = (edge_count ? THE_FAIL(6712) : vertex_count ? THE_FAIL(6713) : redex_count ? THE_FAIL(6714) : global_err);
  a: if ((! vertex_lock_created) ? 0 : pthread_mutex_destroy (&(vertex_lock)) ? (! err) : 0)
-	 err = THE_FAIL(6188);
+	 err = THE_FAIL(6715);
   if ((! edge_lock_created) ? 0 : pthread_mutex_destroy (&(edge_lock)) ? (! err) : 0)
-	 err = THE_FAIL(6189);
+	 err = THE_FAIL(6716);
   if (err ? 1 : (! v) ? 1 : ! crudev_all_clear (&err))
 	 printf (err ? "%s failed\n%s\n" : "%s failed\n", argv[0], cru_strerror (err));
   else if ((argc > 1) ? (! limit) : 0)